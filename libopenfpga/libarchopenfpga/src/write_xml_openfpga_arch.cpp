@@ -9,6 +9,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from readarchopenfpga library */
 #include "write_xml_circuit_library.h"
@@ -29,9 +30,9 @@ void write_xml_openfpga_arch(const char* fname,
   vtr::ScopedStartFinishTimer timer("Write OpenFPGA architecture");
 
   /* Create a file handler */
-  std::fstream fp;
+  openfpga::BufferedFstream fp;
   /* Open the file stream */
-  fp.open(std::string(fname), std::fstream::out | std::fstream::trunc);
+  fp.open_file(std::string(fname), std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   openfpga::check_file_stream(fname, fp);
@@ -69,7 +70,7 @@ void write_xml_openfpga_arch(const char* fname,
   fp << "</openfpga_architecture>" << "\n";
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -80,9 +81,9 @@ void write_xml_openfpga_simulation_settings(const char* fname,
   vtr::ScopedStartFinishTimer timer("Write OpenFPGA simulation settings");
 
   /* Create a file handler */
-  std::fstream fp;
+  openfpga::BufferedFstream fp;
   /* Open the file stream */
-  fp.open(std::string(fname), std::fstream::out | std::fstream::trunc);
+  fp.open_file(std::string(fname), std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   openfpga::check_file_stream(fname, fp);
@@ -91,7 +92,7 @@ void write_xml_openfpga_simulation_settings(const char* fname,
   write_xml_simulation_setting(fp, fname, openfpga_sim_setting);
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -102,9 +103,9 @@ void write_xml_openfpga_bitstream_settings(const char* fname,
   vtr::ScopedStartFinishTimer timer("Write OpenFPGA bitstream settings");
 
   /* Create a file handler */
-  std::fstream fp;
+  openfpga::BufferedFstream fp;
   /* Open the file stream */
-  fp.open(std::string(fname), std::fstream::out | std::fstream::trunc);
+  fp.open_file(std::string(fname), std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   openfpga::check_file_stream(fname, fp);
@@ -113,5 +114,5 @@ void write_xml_openfpga_bitstream_settings(const char* fname,
   write_xml_bitstream_setting(fp, fname, openfpga_bitstream_setting);
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 }
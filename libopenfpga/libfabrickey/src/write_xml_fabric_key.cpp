@@ -12,6 +12,7 @@
 
 /* Headers from openfpga util library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from arch openfpga library */
 #include "write_xml_utils.h" 
@@ -176,9 +177,9 @@ int write_xml_fabric_key(const char* fname,
   vtr::ScopedStartFinishTimer timer("Write Fabric Key");
 
   /* Create a file handler */
-  std::fstream fp;
+  openfpga::BufferedFstream fp;
   /* Open the file stream */
-  fp.open(std::string(fname), std::fstream::out | std::fstream::trunc);
+  fp.open_file(std::string(fname), std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   openfpga::check_file_stream(fname, fp);
@@ -213,7 +214,7 @@ int write_xml_fabric_key(const char* fname,
   fp << "</fabric_key>" << "\n";
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   return err_code;
 }
@@ -234,6 +234,63 @@ void BitstreamManager::add_child_block(const ConfigBlockId& parent_block, const
   parent_block_ids_[child_block] = parent_block;
 }
 
+void BitstreamManager::add_child_blocks_from_fragment(const ConfigBlockId& parent_block,
+                                                      const BitstreamManager& fragment) {
+  /* Ensure the input ids are valid */
+  VTR_ASSERT(true == valid_block_id(parent_block));
+
+  /* The first block of the fragment stands for the parent block */
+  ConfigBlockId fragment_parent_block = ConfigBlockId(0);
+  VTR_ASSERT(true == fragment.valid_block_id(fragment_parent_block));
+  VTR_ASSERT(0 == fragment.block_bit_lengths_[fragment_parent_block]);
+
+  /* Other blocks of the fragment are shifted after the blocks of this bitstream manager */
+  size_t block_offset = num_blocks_ - 1;
+  size_t bit_offset = num_bits_;
+  auto find_block = [&](const ConfigBlockId& fragment_block) {
+    if (fragment_parent_block == fragment_block) {
+      return parent_block;
+    }
+    return ConfigBlockId(size_t(fragment_block) + block_offset);
+  };
+
+  for (size_t iblock = 1; iblock < fragment.num_blocks_; ++iblock) {
+    ConfigBlockId fragment_block = ConfigBlockId(iblock);
+    ConfigBlockId block = create_block();
+    VTR_ASSERT(find_block(fragment_block) == block);
+
+    block_names_[block] = fragment.block_names_[fragment_block];
+    /* Blocks without any bits added have no valid lsb */
+    if (size_t(-1) != fragment.block_bit_id_lsbs_[fragment_block]) {
+      block_bit_id_lsbs_[block] = fragment.block_bit_id_lsbs_[fragment_block] + bit_offset;
+    }
+    block_bit_lengths_[block] = fragment.block_bit_lengths_[fragment_block];
+    block_path_ids_[block] = fragment.block_path_ids_[fragment_block];
+    block_input_net_ids_[block] = fragment.block_input_net_ids_[fragment_block];
+    block_output_net_ids_[block] = fragment.block_output_net_ids_[fragment_block];
+
+    /* Each block of the fragment must be under its first block */
+    VTR_ASSERT(true == fragment.valid_block_id(fragment.parent_block_ids_[fragment_block]));
+    parent_block_ids_[block] = find_block(fragment.parent_block_ids_[fragment_block]);
+    child_block_ids_[block].reserve(fragment.child_block_ids_[fragment_block].size());
+    for (const ConfigBlockId& fragment_child : fragment.child_block_ids_[fragment_block]) {
+      child_block_ids_[block].push_back(find_block(fragment_child));
+    }
+  }
+
+  /* Children of the first block of the fragment are added to the parent block */
+  for (const ConfigBlockId& fragment_child : fragment.child_block_ids_[fragment_parent_block]) {
+    child_block_ids_[parent_block].push_back(find_block(fragment_child));
+  }
+
+  for (size_t ibit = 0; ibit < fragment.num_bits_; ++ibit) {
+    ConfigBitId fragment_bit = ConfigBitId(ibit);
+    bit_values_.push_back(fragment.bit_values_[fragment_bit]);
+    bit_parent_blocks_.push_back(find_block(fragment.bit_parent_blocks_[fragment_bit]));
+    num_bits_++;
+  }
+}
+
 void BitstreamManager::add_block_bits(const ConfigBlockId& block,
                                       const std::vector<bool>& block_bitstream) {
   /* Ensure the input ids are valid */
@@ -173,6 +173,16 @@ class BitstreamManager {
     /* Set a block as a child block of another */
     void add_child_block(const ConfigBlockId& parent_block, const ConfigBlockId& child_block);
 
+    /* Add all the blocks and bits of another bitstream manager, called a fragment,
+     * under a block. The first block of the fragment stands for the parent block:
+     * its child blocks become child blocks of the parent block, while itself is not added.
+     * The blocks and bits of the fragment are added in their order, so that
+     * blocks built concurrently in several fragments and then added in order
+     * get the same ids as if they were built in this bitstream manager
+     */
+    void add_child_blocks_from_fragment(const ConfigBlockId& parent_block,
+                                        const BitstreamManager& fragment);
+
     /* Add a bitstream to a block */
     void add_block_bits(const ConfigBlockId& block,
                         const std::vector<bool>& block_bitstream);
@@ -12,6 +12,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_tokenizer.h"
 #include "openfpga_version.h"
 
@@ -31,19 +32,19 @@ void report_architecture_bitstream_distribution_xml_file_head(std::fstream& fp,
                                                               const bool& include_time_stamp) {
   valid_file_stream(fp);
  
-  fp << "<!-- " << std::endl;
-  fp << "\t- Report Architecture Bitstream Distribution" << std::endl;
+  fp << "<!-- " << "\n";
+  fp << "\t- Report Architecture Bitstream Distribution" << "\n";
 
   if (include_time_stamp) {
     auto end = std::chrono::system_clock::now(); 
     std::time_t end_time = std::chrono::system_clock::to_time_t(end);
     /* Note that version is also a type of time stamp */
-    fp << "\t- Version: " << openfpga::VERSION << std::endl;
+    fp << "\t- Version: " << openfpga::VERSION << "\n";
     fp << "\t- Date: " << std::ctime(&end_time) ;
   }
 
-  fp << "--> " << std::endl;
-  fp << std::endl;
+  fp << "--> " << "\n";
+  fp << "\n";
 }
 
 /********************************************************************
@@ -71,7 +72,7 @@ void rec_report_block_bitstream_distribution_to_xml_file(std::fstream& fp,
   fp << "<block";
   fp << " name=\"" << bitstream_manager.block_name(block)<< "\"";
   fp << " number_of_bits=\"" << rec_find_bitstream_manager_block_sum_of_bits(bitstream_manager, block) << "\"";
-  fp << ">" << std::endl;
+  fp << ">" << "\n";
 
   /* Dive to child blocks if this block has any */
   for (const ConfigBlockId& child_block : bitstream_manager.block_children(block)) {
@@ -80,7 +81,7 @@ void rec_report_block_bitstream_distribution_to_xml_file(std::fstream& fp,
   }
 
   write_tab_to_file(fp, hierarchy_level);
-  fp << "</block>" <<std::endl;
+  fp << "</block>" << "\n";
 }
 
 /********************************************************************
@@ -105,8 +106,8 @@ int report_architecture_bitstream_distribution(const BitstreamManager& bitstream
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(fname.c_str(), fp);
 
@@ -122,7 +123,7 @@ int report_architecture_bitstream_distribution(const BitstreamManager& bitstream
   rec_report_block_bitstream_distribution_to_xml_file(fp, bitstream_manager, top_block[0], max_hierarchy_level, 0);
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   return 0;
 }
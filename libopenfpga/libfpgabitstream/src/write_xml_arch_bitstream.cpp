@@ -13,6 +13,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_tokenizer.h"
 
 #include "openfpga_reserved_words.h"
@@ -31,10 +32,10 @@ void write_bitstream_xml_file_head(std::fstream& fp,
                                    const bool& include_time_stamp) {
   valid_file_stream(fp);
  
-  fp << "<!--" << std::endl;
-  fp << "\t- Architecture independent bitstream" << std::endl;
-  fp << "\t- Author: Xifan TANG" << std::endl;
-  fp << "\t- Organization: University of Utah" << std::endl;
+  fp << "<!--" << "\n";
+  fp << "\t- Architecture independent bitstream" << "\n";
+  fp << "\t- Author: Xifan TANG" << "\n";
+  fp << "\t- Organization: University of Utah" << "\n";
 
   if (include_time_stamp) {
     auto end = std::chrono::system_clock::now(); 
@@ -42,8 +43,8 @@ void write_bitstream_xml_file_head(std::fstream& fp,
     fp << "\t- Date: " << std::ctime(&end_time) ;
   }
 
-  fp << "-->" << std::endl;
-  fp << std::endl;
+  fp << "-->" << "\n";
+  fp << "\n";
 }
 
 /********************************************************************
@@ -66,7 +67,7 @@ void rec_write_block_bitstream_to_xml_file(std::fstream& fp,
   fp << "<bitstream_block";
   fp << " name=\"" << bitstream_manager.block_name(block)<< "\"";
   fp << " hierarchy_level=\"" << hierarchy_level << "\"";
-  fp << ">" << std::endl;
+  fp << ">" << "\n";
 
   /* Dive to child blocks if this block has any */
   for (const ConfigBlockId& child_block : bitstream_manager.block_children(block)) {
@@ -75,7 +76,7 @@ void rec_write_block_bitstream_to_xml_file(std::fstream& fp,
   
   if (0 == bitstream_manager.block_bits(block).size()) {
     write_tab_to_file(fp, hierarchy_level);
-    fp << "</bitstream_block>" <<std::endl;
+    fp << "</bitstream_block>" << "\n";
     return;
   }
 
@@ -83,17 +84,17 @@ void rec_write_block_bitstream_to_xml_file(std::fstream& fp,
   
   /* Output hierarchy of this parent*/
   write_tab_to_file(fp, hierarchy_level + 1);
-  fp << "<hierarchy>" << std::endl;
+  fp << "<hierarchy>" << "\n";
   size_t hierarchy_counter = 0;
   for (const ConfigBlockId& temp_block : block_hierarchy) {
     write_tab_to_file(fp, hierarchy_level + 2);
     fp << "<instance level=\"" << hierarchy_counter << "\"";
     fp << " name=\"" << bitstream_manager.block_name(temp_block) << "\"";
-    fp << "/>" << std::endl;
+    fp << "/>" << "\n";
     hierarchy_counter++;
   }
   write_tab_to_file(fp, hierarchy_level + 1);
-  fp << "</hierarchy>" << std::endl;
+  fp << "</hierarchy>" << "\n";
 
   /* Output input/output nets if there are any */
   if (false == bitstream_manager.block_input_net_ids(block).empty()) {
@@ -144,21 +145,23 @@ void rec_write_block_bitstream_to_xml_file(std::fstream& fp,
   if (true == bitstream_manager.valid_block_path_id(block)) {
     fp << " path_id=\"" << bitstream_manager.block_path_id(block) << "\"";
   }
-  fp << ">" << std::endl;
+  fp << ">" << "\n";
 
   for (const ConfigBitId& child_bit : bitstream_manager.block_bits(block)) {
     write_tab_to_file(fp, hierarchy_level + 2);
     fp << "<bit";
-    fp << " memory_port=\"" << CONFIGURABLE_MEMORY_DATA_OUT_NAME << "[" << bit_counter << "]" << "\"";
+    fp << " memory_port=\"" << CONFIGURABLE_MEMORY_DATA_OUT_NAME << "[";
+    write_uint_to_file(fp, bit_counter);
+    fp << "]" << "\"";
     fp << " value=\"" << bitstream_manager.bit_value(child_bit) << "\"";
-    fp << "/>" << std::endl;
+    fp << "/>" << "\n";
     bit_counter++;
   }
   write_tab_to_file(fp, hierarchy_level + 1);
-  fp << "</bitstream>" << std::endl;
+  fp << "</bitstream>" << "\n";
 
   write_tab_to_file(fp, hierarchy_level);
-  fp << "</bitstream_block>" <<std::endl;
+  fp << "</bitstream_block>" << "\n";
 }
 
 /********************************************************************
@@ -187,8 +190,8 @@ void write_xml_architecture_bitstream(const BitstreamManager& bitstream_manager,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(fname.c_str(), fp);
 
@@ -204,7 +207,7 @@ void write_xml_architecture_bitstream(const BitstreamManager& bitstream_manager,
   rec_write_block_bitstream_to_xml_file(fp, bitstream_manager, top_block[0], 0);
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 } /* end namespace openfpga */
@@ -5,6 +5,7 @@
 #include <map>
 #include <vector>
 #include <functional>
+#include <istream>
 #include <ctime>
 
 #include "vtr_vector.h"
@@ -146,19 +147,40 @@ class Shell {
     void run_script_mode(const char* script_file_name,
                          T& context,
                          const bool& batch_mode = false);
+    /* Start the server mode, where clients send scripts through a UNIX socket.
+     * The context is kept between the sessions, except the data which is 
+     * cleared by the reset function at the beginning of each session.
+     * The status of the commands executed before the server mode is also kept,
+     * so that sessions can depend on them.
+     * An exit command only ends its session, while the server keeps
+     * serving until a session requests to stop it.
+     * A command throwing an exception aborts its session only, but a command
+     * calling exit() (as most of the OpenFPGA libraries do on fatal errors)
+     * still terminates the server.
+     * Return false if the socket can not be used
+     */
+    bool run_server_mode(const char* socket_path,
+                         T& context,
+                         std::function<void(T&)> reset_session);
     /* Print all the commands by their classes. This is actually the help desk */
     void print_commands() const;
     /* Find the exit code (assume quit shell now) */
     int exit_code() const;
     /* Show statistics of errors during command execution */
     int execution_errors() const;
-    /* Quit the shell */
-    void exit(const int& init_err = 0) const;
+    /* Quit the shell, or end the current session in server mode */
+    void exit(const int& init_err = 0);
+    /* Stop the server mode once the current session ends */
+    void stop_server();
   private: /* Private executors */
     /* Execute a command, the command line is the user's input to launch a command
      * The common_context is the data structure to exchange data between commands
      */
     int execute_command(const char* cmd_line, T& common_context);
+    /* Execute the commands of a script, and stop at the first fatal error
+     * Return the status of the last executed command
+     */
+    int execute_script(std::istream& fp, T& common_context);
   private: /* Internal data */ 
     /* Name of the shell, this will appear in the interactive mode */
     std::string name_;
@@ -221,6 +243,15 @@ class Shell {
 
     /* Timer */
     std::clock_t time_start_;
+
+    /* Status of the server mode:
+     * - if a session is being executed
+     * - if the current session is ended by an exit command
+     * - if the server should stop once the current session ends
+     */
+    bool server_session_running_;
+    bool server_session_exited_;
+    bool server_stop_requested_;
 };
 
 } /* End namespace openfpga */
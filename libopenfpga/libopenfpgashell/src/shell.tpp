@@ -2,7 +2,10 @@
  * Member functions for class Shell
  ********************************************************************/
 #include <fstream>
+#include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <exception>
 
 /* Headers from vtrutil library */
 #include "vtr_log.h"
@@ -10,6 +13,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_tokenizer.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from readline library */
 #include <readline/readline.h>
@@ -18,6 +22,7 @@
 /* Headers from openfpgashell library */
 #include "command_parser.h"
 #include "command_echo.h"
+#include "shell_server.h"
 
 /* Begin namespace openfpga */
 namespace openfpga {
@@ -29,6 +34,9 @@ template<class T>
 Shell<T>::Shell(const char* name) {
   name_ = std::string(name);
   time_start_ = 0;
+  server_session_running_ = false;
+  server_session_exited_ = false;
+  server_stop_requested_ = false;
 }
 
 /************************************************************************
@@ -285,8 +293,6 @@ void Shell<T>::run_script_mode(const char* script_file_name,
     VTR_LOG("%s\n", title().c_str());
   } 
 
-  std::string line;
-
   /* Create an input file stream */
   std::ifstream fp(script_file_name);
 
@@ -297,89 +303,102 @@ void Shell<T>::run_script_mode(const char* script_file_name,
     return; 
   }
 
-  /* Consider that each line may not end due to the continued line charactor 
-   * Use cmd_line to conjunct multiple lines 
-   */
-  std::string cmd_line;
+  int status = execute_script(fp, context);
 
-  /* Read line by line */
-  while (getline(fp, line)) {
-    /* Skip empty line */
-    if (true == line.empty()) {
-      continue;
+  /* Check the execution status of the command, 
+   * if fatal error happened, we should abort immediately 
+   */
+  if (CMD_EXEC_FATAL_ERROR == status) {
+    VTR_LOG("Fatal error occurred!\n");
+    /* If in the batch mode, we will exit with errors */ 
+    VTR_LOGV(batch_mode, "OpenFPGA Abort\n");
+    if (batch_mode) {
+      exit(CMD_EXEC_FATAL_ERROR);
     }
+    /* If not in the batch mode, we will got to interactive mode */ 
+    VTR_LOGV(!batch_mode, "Enter interactive mode\n");
+  }
+  fp.close();
 
-    /* If the line that starts with '#', it is commented, we can skip */ 
-    if ('#' == line.front()) {
-      continue;
-    }
-    /* Try to split the line with '#', the string before '#' is the read command we want */
-    std::string cmd_part = line;
-    std::size_t cmd_end_pos = line.find_first_of('#');
-    /* If the full line has '#', we need the part before it */
-    if (cmd_end_pos != std::string::npos) {
-      cmd_part = line.substr(0, cmd_end_pos);
-    }
+  /* If not in batch mode, switch to interactive mode, stay tuned */
+  if (!batch_mode) {
+    run_interactive_mode(context, true); 
+  }
+}
 
-    /* Remove the space at the end of the line
-     * So that we can check easily if there is a continued line in the end  
-     */
-    StringToken cmd_part_tokenizer(cmd_part);
-    cmd_part_tokenizer.rtrim(std::string(" "));
-    cmd_part = cmd_part_tokenizer.data();
+template <class T>
+bool Shell<T>::run_server_mode(const char* socket_path,
+                               T& context,
+                               std::function<void(T&)> reset_session) {
+  int server_socket = open_shell_server_socket(std::string(socket_path));
+  if (INVALID_SHELL_SOCKET == server_socket) {
+    return false;
+  }
 
-    /* If the line ends with '\', this is a continued line, parse the next until it ends */
-    if ('\\' == cmd_part.back()) {
-      /* Pop up the last charactor and conjunct to cmd_line */
-      cmd_part.pop_back();
- 
-      if (!cmd_part.empty()) {
-        cmd_line += cmd_part; 
-      }
-      /* Not finished yet. Parse the next line */
+  VTR_LOG("Start server mode of %s on socket %s...\n",
+          name().c_str(), socket_path);
+
+  /* Each session starts from the status of the commands executed so far */
+  vtr::vector<ShellCommandId, int> server_command_status = command_status_;
+
+  size_t num_sessions = 0;
+  server_stop_requested_ = false;
+  while (false == server_stop_requested_) {
+    int session_socket = accept_shell_session(server_socket);
+    if (INVALID_SHELL_SOCKET == session_socket) {
+      break;
+    }
+
+    std::string script;
+    if (false == read_shell_session_script(session_socket, script)) {
+      close_shell_session(session_socket, CMD_EXEC_FATAL_ERROR);
       continue;
-    } else {
-      /* End of this line, if cmd_line is empty, 
-       * there is no previous lines, cache the part we have
-       * and then execute the command 
-       */
-      cmd_line += cmd_part;
     }
 
-    /* Remove the space at the beginning of the line */
-    StringToken cmd_line_tokenizer(cmd_line);
-    cmd_line_tokenizer.ltrim(std::string(" "));
-    cmd_line = cmd_line_tokenizer.data();
+    num_sessions++;
+    VTR_LOG("\nStart session #%lu of server mode\n", num_sessions);
+    /* Sessions are measured in wall time: the CPU time of the process
+     * is counted for all the threads and over-estimates parallel commands
+     */
+    std::chrono::steady_clock::time_point session_start = std::chrono::steady_clock::now();
 
-    /* Process the command only when the full command line in ended */
-    if (!cmd_line.empty()) {
-      VTR_LOG("\nCommand line to execute: %s\n", cmd_line.c_str());
-      int status = execute_command(cmd_line.c_str(), context);
-      /* Empty the line ready to start a new line */
-      cmd_line.clear();
+    command_status_ = server_command_status;
+    reset_session(context);
 
-      /* Check the execution status of the command, 
-       * if fatal error happened, we should abort immediately 
-       */
-      if (CMD_EXEC_FATAL_ERROR == status) {
-        VTR_LOG("Fatal error occurred!\n");
-        /* If in the batch mode, we will exit with errors */ 
-        VTR_LOGV(batch_mode, "OpenFPGA Abort\n");
-        if (batch_mode) {
-          exit(CMD_EXEC_FATAL_ERROR);
-        }
-        /* If not in the batch mode, we will got to interactive mode */ 
-        VTR_LOGV(!batch_mode, "Enter interactive mode\n");
-        break;
-      }
+    server_session_running_ = true;
+    server_session_exited_ = false;
+    std::istringstream fp(script);
+    int status = CMD_EXEC_SUCCESS;
+    /* An exception thrown by a command (e.g., a VPR error) only aborts the session,
+     * the server keeps serving the following sessions
+     */
+    try {
+      status = execute_script(fp, context);
+    } catch (const std::exception& e) {
+      VTR_LOG_ERROR("%s\n", e.what());
+      status = CMD_EXEC_FATAL_ERROR;
+    } catch (...) {
+      VTR_LOG_ERROR("Unknown exception\n");
+      status = CMD_EXEC_FATAL_ERROR;
+    }
+    server_session_running_ = false;
+    int session_exit_code = exit_code();
+    if (CMD_EXEC_FATAL_ERROR == status) {
+      VTR_LOG("Fatal error occurred! Abort session #%lu\n", num_sessions);
+      session_exit_code = 1;
     }
-  }
-  fp.close();
 
-  /* If not in batch mode, switch to interactive mode, stay tuned */
-  if (!batch_mode) {
-    run_interactive_mode(context, true); 
+    VTR_LOG("Finish session #%lu with exit code %d in %g seconds\n",
+            num_sessions, session_exit_code,
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - session_start).count());
+    close_shell_session(session_socket, session_exit_code);
   }
+
+  VTR_LOG("Stop server mode of %s after %lu sessions\n",
+          name().c_str(), num_sessions);
+  close_shell_server_socket(server_socket, std::string(socket_path));
+
+  return true;
 }
 
 template <class T>
@@ -442,7 +461,14 @@ int Shell<T>::execution_errors() const {
 }
 
 template <class T>
-void Shell<T>::exit(const int& init_err) const {
+void Shell<T>::exit(const int& init_err) {
+  /* In server mode, only the current session ends and the server keeps serving */
+  if (true == server_session_running_) {
+    VTR_LOG("Exit the current session\n");
+    server_session_exited_ = true;
+    return;
+  }
+
   /* Check all the command status, if we see fatal errors or minor errors, we drop an error code */
   int shell_exit_code = exit_code() | init_err;
 
@@ -465,6 +491,18 @@ void Shell<T>::exit(const int& init_err) const {
   std::exit(shell_exit_code);
 }
 
+template <class T>
+void Shell<T>::stop_server() {
+  if (false == server_session_running_) {
+    VTR_LOG_WARN("Server mode is not running. Nothing to stop\n");
+    return;
+  }
+
+  VTR_LOG("Stop the server after the current session\n");
+  server_session_exited_ = true;
+  server_stop_requested_ = true;
+}
+
 /************************************************************************
  * Private executors
  ***********************************************************************/
@@ -533,6 +571,9 @@ int Shell<T>::execute_command(const char* cmd_line,
   /* Parse succeed. Let user to confirm selected options */ 
   print_command_context(commands_[cmd_id], command_contexts_[cmd_id]);
 
+  /* Snapshot the output file counters, to report the I/O of this command */
+  OutputFileStats io_stats_before = output_file_stats();
+
   /* Execute the command depending on the type of function ! */ 
   switch (command_execute_function_types_[cmd_id]) {
   case CONST_STANDARD:
@@ -561,6 +602,16 @@ int Shell<T>::execute_command(const char* cmd_line,
     return CMD_EXEC_FATAL_ERROR;
   }
 
+  /* Report the files written by the command, if any */
+  OutputFileStats io_stats_after = output_file_stats();
+  if (io_stats_after.num_files > io_stats_before.num_files) {
+    VTR_LOG("Command '%s' wrote %lu file(s), %lu bytes in %g seconds\n",
+            commands_[cmd_id].name().c_str(),
+            io_stats_after.num_files - io_stats_before.num_files,
+            io_stats_after.num_bytes - io_stats_before.num_bytes,
+            io_stats_after.seconds - io_stats_before.seconds);
+  }
+
   /* Forbid users to return the status CMD_EXEC_NONE */
   if (CMD_EXEC_NONE == command_status_[cmd_id]) {
     VTR_LOG_ERROR("It is illegal to return never-executed status for an executed command!\n");
@@ -570,6 +621,89 @@ int Shell<T>::execute_command(const char* cmd_line,
   return command_status_[cmd_id];
 }
 
+template <class T>
+int Shell<T>::execute_script(std::istream& fp,
+                             T& common_context) {
+  std::string line;
+  int status = CMD_EXEC_SUCCESS;
+
+  /* Consider that each line may not end due to the continued line charactor 
+   * Use cmd_line to conjunct multiple lines 
+   */
+  std::string cmd_line;
+
+  /* Read line by line */
+  while (getline(fp, line)) {
+    /* Skip empty line */
+    if (true == line.empty()) {
+      continue;
+    }
+
+    /* If the line that starts with '#', it is commented, we can skip */ 
+    if ('#' == line.front()) {
+      continue;
+    }
+    /* Try to split the line with '#', the string before '#' is the read command we want */
+    std::string cmd_part = line;
+    std::size_t cmd_end_pos = line.find_first_of('#');
+    /* If the full line has '#', we need the part before it */
+    if (cmd_end_pos != std::string::npos) {
+      cmd_part = line.substr(0, cmd_end_pos);
+    }
+
+    /* Remove the space at the end of the line
+     * So that we can check easily if there is a continued line in the end  
+     */
+    StringToken cmd_part_tokenizer(cmd_part);
+    cmd_part_tokenizer.rtrim(std::string(" "));
+    cmd_part = cmd_part_tokenizer.data();
+
+    /* If the line ends with '\', this is a continued line, parse the next until it ends */
+    if ('\\' == cmd_part.back()) {
+      /* Pop up the last charactor and conjunct to cmd_line */
+      cmd_part.pop_back();
+ 
+      if (!cmd_part.empty()) {
+        cmd_line += cmd_part; 
+      }
+      /* Not finished yet. Parse the next line */
+      continue;
+    } else {
+      /* End of this line, if cmd_line is empty, 
+       * there is no previous lines, cache the part we have
+       * and then execute the command 
+       */
+      cmd_line += cmd_part;
+    }
+
+    /* Remove the space at the beginning of the line */
+    StringToken cmd_line_tokenizer(cmd_line);
+    cmd_line_tokenizer.ltrim(std::string(" "));
+    cmd_line = cmd_line_tokenizer.data();
+
+    /* Process the command only when the full command line in ended */
+    if (!cmd_line.empty()) {
+      VTR_LOG("\nCommand line to execute: %s\n", cmd_line.c_str());
+      status = execute_command(cmd_line.c_str(), common_context);
+      /* Empty the line ready to start a new line */
+      cmd_line.clear();
+
+      /* If fatal error happened, we should abort immediately */
+      if (CMD_EXEC_FATAL_ERROR == status) {
+        break;
+      }
+
+      /* The session of server mode is ended by the command */
+      if (true == server_session_exited_) {
+        break;
+      }
+    }
+  }
+
+  return status;
+}
+
+
 /************************************************************************
  * Public invalidators/validators 
  ***********************************************************************/
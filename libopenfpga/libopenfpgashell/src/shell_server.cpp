@@ -0,0 +1,142 @@
+/*********************************************************************
+ * This file includes functions to exchange scripts with the clients
+ * of a shell in server mode, through a local UNIX socket
+ *
+ * A session is a connection from a client, which
+ * - sends the commands to execute, as in a script file
+ * - shuts down its writing side of the connection
+ * - receives the exit code of the session, ended by a new line
+ ********************************************************************/
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "vtr_log.h"
+#include "shell_server.h"
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/* Number of clients which can wait for a session */
+constexpr int SHELL_SERVER_BACKLOG = 16;
+
+/*********************************************************************
+ * Create a UNIX socket at a given path and listen to it
+ * The socket is only accessible to its owner (permission 0600)
+ * Any file left at the path, e.g., by a previous server, is removed
+ * Return INVALID_SHELL_SOCKET if the socket can not be created
+ ********************************************************************/
+int open_shell_server_socket(const std::string& socket_path) {
+  struct sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (socket_path.empty() || socket_path.size() >= sizeof(addr.sun_path)) {
+    VTR_LOG_ERROR("Invalid socket path '%s' for server mode!\n",
+                  socket_path.c_str());
+    return INVALID_SHELL_SOCKET;
+  }
+  std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+  int server_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (0 > server_socket) {
+    VTR_LOG_ERROR("Fail to create a socket for server mode: %s\n",
+                  std::strerror(errno));
+    return INVALID_SHELL_SOCKET;
+  }
+
+  /* Only the owner of the server can connect to the socket,
+   * as the sessions execute any command with the rights of the server
+   */
+  unlink(socket_path.c_str());
+  mode_t default_mask = umask(S_IRWXG | S_IRWXO);
+  int bind_status = bind(server_socket, (struct sockaddr*)&addr, sizeof(addr));
+  umask(default_mask);
+  if ( (0 > bind_status)
+    || (0 > chmod(socket_path.c_str(), S_IRUSR | S_IWUSR))
+    || (0 > listen(server_socket, SHELL_SERVER_BACKLOG)) ) {
+    VTR_LOG_ERROR("Fail to listen to socket '%s': %s\n",
+                  socket_path.c_str(), std::strerror(errno));
+    close(server_socket);
+    return INVALID_SHELL_SOCKET;
+  }
+
+  return server_socket;
+}
+
+void close_shell_server_socket(const int& server_socket,
+                               const std::string& socket_path) {
+  close(server_socket);
+  unlink(socket_path.c_str());
+}
+
+/*********************************************************************
+ * Wait for the next client
+ * Return INVALID_SHELL_SOCKET if the server socket is no longer usable
+ ********************************************************************/
+int accept_shell_session(const int& server_socket) {
+  while (true) {
+    int session_socket = accept(server_socket, nullptr, nullptr);
+    if (0 <= session_socket) {
+      return session_socket;
+    }
+    /* Retry when interrupted or when the client has already left */
+    if ( (EINTR == errno) || (ECONNABORTED == errno) ) {
+      continue;
+    }
+    VTR_LOG_ERROR("Fail to accept a session: %s\n", std::strerror(errno));
+    return INVALID_SHELL_SOCKET;
+  }
+}
+
+/*********************************************************************
+ * Read all the commands sent by a client, until it ends its writing
+ ********************************************************************/
+bool read_shell_session_script(const int& session_socket,
+                               std::string& script) {
+  script.clear();
+  char buffer[4096];
+  while (true) {
+    ssize_t num_bytes = read(session_socket, buffer, sizeof(buffer));
+    if (0 < num_bytes) {
+      script.append(buffer, num_bytes);
+      continue;
+    }
+    if (0 == num_bytes) {
+      return true;
+    }
+    if (EINTR == errno) {
+      continue;
+    }
+    VTR_LOG_ERROR("Fail to read the script of a session: %s\n", std::strerror(errno));
+    return false;
+  }
+}
+
+/*********************************************************************
+ * Send the exit code to the client and end the session
+ * The client may have left, so a failure is not an error of the server
+ ********************************************************************/
+void close_shell_session(const int& session_socket,
+                         const int& exit_code) {
+  std::string reply = std::to_string(exit_code) + std::string("\n");
+  size_t num_sent = 0;
+  while (num_sent < reply.size()) {
+    ssize_t num_bytes = send(session_socket, reply.c_str() + num_sent, reply.size() - num_sent, MSG_NOSIGNAL);
+    if (0 < num_bytes) {
+      num_sent += num_bytes;
+      continue;
+    }
+    if ( (0 > num_bytes) && (EINTR == errno) ) {
+      continue;
+    }
+    break;
+  }
+  close(session_socket);
+}
+
+} /* End namespace openfpga */
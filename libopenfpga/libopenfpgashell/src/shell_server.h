@@ -0,0 +1,34 @@
+#ifndef SHELL_SERVER_H
+#define SHELL_SERVER_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <string>
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/* Socket descriptor which is returned when a socket can not be opened */
+constexpr int INVALID_SHELL_SOCKET = -1;
+
+int open_shell_server_socket(const std::string& socket_path);
+
+void close_shell_server_socket(const int& server_socket,
+                               const std::string& socket_path);
+
+int accept_shell_session(const int& server_socket);
+
+bool read_shell_session_script(const int& session_socket,
+                               std::string& script);
+
+void close_shell_session(const int& session_socket,
+                         const int& exit_code);
+
+} /* End namespace openfpga */
+
+#endif
@@ -2,6 +2,15 @@
  * Test the shell interface by pre-defining simple commands
  * like exit() and help()
  *******************************************************************/
+#include <cstring>
+#include <string>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include "vtr_log.h"
 #include "command_parser.h"
 #include "command_echo.h"
@@ -42,6 +51,122 @@ int shell_execute_print_macro(int argc, char** argv) {
   return CMD_EXEC_SUCCESS; 
 }
 
+/********************************************************************
+ * Run a session as a client of the shell in server mode
+ * Return the reply of the server, i.e., the exit code of the session
+ *******************************************************************/
+static
+std::string run_client_session(const std::string& socket_path,
+                               const std::string& script) {
+  struct sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+  int client_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+  /* The server may not listen yet, retry for a while */
+  int num_tries = 0;
+  while (0 > connect(client_socket, (struct sockaddr*)&addr, sizeof(addr))) {
+    if (100 < ++num_tries) {
+      close(client_socket);
+      return std::string();
+    }
+    usleep(100000);
+  }
+
+  if (script.size() != size_t(write(client_socket, script.c_str(), script.size()))) {
+    close(client_socket);
+    return std::string();
+  }
+  shutdown(client_socket, SHUT_WR);
+
+  std::string reply;
+  char buffer[64];
+  ssize_t num_bytes;
+  while (0 < (num_bytes = read(client_socket, buffer, sizeof(buffer)))) {
+    reply.append(buffer, num_bytes);
+  }
+  close(client_socket);
+
+  return reply;
+}
+
+static
+bool check_client_session(const std::string& socket_path,
+                          const std::string& script,
+                          const std::string& expected_reply) {
+  std::string reply = run_client_session(socket_path, script);
+  if (expected_reply != reply) {
+    VTR_LOG_ERROR("Session replied '%s' while '%s' is expected\n",
+                  reply.c_str(), expected_reply.c_str());
+    return false;
+  }
+  return true;
+}
+
+/********************************************************************
+ * Test the server mode of a shell with several sessions over a socket
+ * - a session ended by 'exit' does not stop the server
+ * - the status of commands is not kept between sessions
+ * - a session can stop the server by 'stop_server'
+ *******************************************************************/
+static
+int test_server_mode(Shell<ShellContext>& shell,
+                     ShellContext& shell_context,
+                     const std::string& socket_path) {
+  pid_t server_pid = fork();
+  if (0 > server_pid) {
+    VTR_LOG_ERROR("Fail to start the server\n");
+    return 1;
+  }
+
+  if (0 == server_pid) {
+    bool status = shell.run_server_mode(socket_path.c_str(), shell_context,
+                                        [](ShellContext& context) { context.a = 0; });
+    fflush(stdout);
+    _exit(status ? 0 : 1);
+  }
+
+  int num_err = 0;
+  /* Commands after 'exit' are not executed */
+  if (false == check_client_session(socket_path, "set --value 3\nprint\nexit\nprint_macro after_exit\n", "0\n")) {
+    num_err++;
+  }
+
+  /* Only the owner can access the socket */
+  struct stat socket_stat;
+  if ( (0 != stat(socket_path.c_str(), &socket_stat))
+    || ((S_IRUSR | S_IWUSR) != (socket_stat.st_mode & (S_IRWXU | S_IRWXG | S_IRWXO))) ) {
+    VTR_LOG_ERROR("Socket '%s' is not restricted to its owner\n", socket_path.c_str());
+    num_err++;
+  }
+
+  /* 'set' executed in the previous session is not considered in this session */
+  if (false == check_client_session(socket_path, "print\n", "1\n")) {
+    num_err++;
+  }
+
+  if (false == check_client_session(socket_path, "set --value 4\nprint\nstop_server\n", "0\n")) {
+    num_err++;
+  }
+
+  int server_status = 1;
+  waitpid(server_pid, &server_status, 0);
+  if ( (false == WIFEXITED(server_status)) || (0 != WEXITSTATUS(server_status)) ) {
+    VTR_LOG_ERROR("Server did not stop properly\n");
+    num_err++;
+  }
+
+  if (0 == access(socket_path.c_str(), F_OK)) {
+    VTR_LOG_ERROR("Socket '%s' is not removed after the server stops\n", socket_path.c_str());
+    num_err++;
+  }
+
+  VTR_LOG("Server mode test finished with %d errors\n", num_err);
+
+  return num_err;
+}
+
 int main(int argc, char** argv) {
   /* Create the command to launch shell in different modes */
   Command start_cmd("test_shell");
@@ -56,6 +181,9 @@ int main(int argc, char** argv) {
   start_cmd.set_option_require_value(opt_script_mode, OPT_STRING);
   start_cmd.set_option_short_name(opt_script_mode, "f");
 
+  CommandOptionId opt_test_server = start_cmd.add_option("test_server", false, "Test the server mode with several sessions over a socket");
+  start_cmd.set_option_require_value(opt_test_server, OPT_STRING);
+
   CommandOptionId opt_help = start_cmd.add_option("help", false, "Help desk"); 
   start_cmd.set_option_short_name(opt_help, "h");
 
@@ -128,7 +256,12 @@ int main(int argc, char** argv) {
   Command shell_cmd_exit("exit");
   ShellCommandId shell_cmd_exit_id = shell.add_command(shell_cmd_exit, "Exit the shell");
   shell.set_command_class(shell_cmd_exit_id, basic_cmd_class);
-  shell.set_command_execute_function(shell_cmd_exit_id, [shell](){shell.exit();});
+  shell.set_command_execute_function(shell_cmd_exit_id, [&shell](){shell.exit();});
+
+  Command shell_cmd_stop_server("stop_server");
+  ShellCommandId shell_cmd_stop_server_id = shell.add_command(shell_cmd_stop_server, "Stop the server mode");
+  shell.set_command_class(shell_cmd_stop_server_id, basic_cmd_class);
+  shell.set_command_execute_function(shell_cmd_stop_server_id, [&shell](){shell.stop_server();});
 
   /* Note: help must be the last to add because the linking to execute function will do a snapshot on the shell */
   Command shell_cmd_help("help");
@@ -162,6 +295,11 @@ int main(int argc, char** argv) {
                             shell_context);
       return 0;
     }
+
+    if (true == start_cmd_context.option_enable(start_cmd, opt_test_server)) {
+      return test_server_mode(shell, shell_context,
+                              start_cmd_context.option_value(start_cmd, opt_test_server));
+    }
     /* Reach here there is something wrong, show the help desk */
     print_command_options(start_cmd);
   }
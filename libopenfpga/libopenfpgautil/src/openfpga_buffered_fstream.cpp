@@ -0,0 +1,386 @@
+/********************************************************************
+ * Member functions for class BufferedFstream
+ *******************************************************************/
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <streambuf>
+
+#ifdef OPENFPGA_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef OPENFPGA_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+/* Headers from vtrutil library */
+#include "vtr_log.h"
+
+#include "openfpga_buffered_fstream.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+constexpr size_t BufferedFstream::DEFAULT_BUFFER_SIZE;
+
+/* Counters shared by all the streams, which may be closed by different threads */
+static std::mutex output_file_stats_mutex;
+static OutputFileStats output_file_stats_total;
+
+/********************************************************************
+ * Internal utilities for compression
+ *******************************************************************/
+static 
+bool output_compression_supported(const e_output_compression& compression) {
+  switch (compression) {
+  case OUTPUT_COMPRESSION_NONE:
+    return true;
+  case OUTPUT_COMPRESSION_GZIP:
+#ifdef OPENFPGA_WITH_ZLIB
+    return true;
+#else
+    return false;
+#endif
+  case OUTPUT_COMPRESSION_ZSTD:
+#ifdef OPENFPGA_WITH_ZSTD
+    return true;
+#else
+    return false;
+#endif
+  default:
+    return false;
+  }
+}
+
+/********************************************************************
+ * A stream buffer which compresses the data written by a BufferedFstream
+ * and writes the compressed data to the file buffer of the stream
+ *
+ * The data is compressed each time the buffer is full, so that
+ * the plain text never reaches the disk
+ *******************************************************************/
+class OutputCompressor : public std::streambuf {
+  public: /* Constructors */
+    OutputCompressor(std::streambuf* file_buffer,
+                     const std::string& fname,
+                     const size_t& buffer_size)
+      : file_buffer_(file_buffer),
+        fname_(fname),
+        buffer_(std::max(buffer_size, BufferedFstream::DEFAULT_BUFFER_SIZE)) {
+      setp(buffer_.data(), buffer_.data() + buffer_.size());
+    }
+    virtual ~OutputCompressor() = default;
+
+  public: /* Accessors */
+    /* Number of bytes written before compression */
+    size_t num_bytes() const { return num_bytes_; }
+
+  public: /* Mutators */
+    /* Compress the data left in the buffer and end the compressed stream */
+    bool finish() {
+      return compress_buffer(true);
+    }
+
+  protected: /* Functions of std::streambuf */
+    int_type overflow(int_type ch) override {
+      if (false == compress_buffer(false)) {
+        return traits_type::eof();
+      }
+      if (false == traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+      }
+      return traits_type::not_eof(ch);
+    }
+
+    /* The data is handed to the compressor, which decides when to output it */
+    int sync() override {
+      return compress_buffer(false) ? 0 : -1;
+    }
+
+  protected: /* Internal functions */
+    /* Compress the data, and end the compressed stream when it is the last data */
+    virtual bool compress(const char* data, const size_t& size, const bool& last) = 0;
+
+    bool write_to_file(const char* data, const size_t& size) {
+      return std::streamsize(size) == file_buffer_->sputn(data, std::streamsize(size));
+    }
+
+    void report_error(const char* reason) const {
+      VTR_LOG_ERROR("Unable to write compressed file '%s': %s!\n",
+                    fname_.c_str(), reason);
+    }
+
+  private: /* Internal functions */
+    /* Once an error is reported, the data is dropped until the file is closed */
+    bool compress_buffer(const bool& last) {
+      size_t size = size_t(pptr() - pbase());
+      if (false == failed_) {
+        failed_ = !compress(pbase(), size, last);
+      }
+      num_bytes_ += size;
+      setp(buffer_.data(), buffer_.data() + buffer_.size());
+      return !failed_;
+    }
+
+  private: /* Internal data */
+    std::streambuf* file_buffer_;
+    std::string fname_;
+    std::vector<char> buffer_;
+    size_t num_bytes_ = 0;
+    bool failed_ = false;
+};
+
+#ifdef OPENFPGA_WITH_ZLIB
+/********************************************************************
+ * Compression in gzip format with zlib
+ *******************************************************************/
+class GzipCompressor : public OutputCompressor {
+  public: /* Constructors */
+    GzipCompressor(std::streambuf* file_buffer,
+                   const std::string& fname,
+                   const size_t& buffer_size)
+      : OutputCompressor(file_buffer, fname, buffer_size),
+        out_chunk_(BufferedFstream::DEFAULT_BUFFER_SIZE) {
+      /* A window of 15 bits, plus 16 to write a gzip header and trailer */
+      if (Z_OK != deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                               15 + 16, 8, Z_DEFAULT_STRATEGY)) {
+        report_error("cannot initialize zlib");
+        exit(1);
+      }
+    }
+    ~GzipCompressor() {
+      if (false == ended_) {
+        deflateEnd(&stream_);
+      }
+    }
+
+  protected: /* Internal functions */
+    bool compress(const char* data, const size_t& size, const bool& last) override {
+      stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+      stream_.avail_in = uInt(size);
+      int flush = last ? Z_FINISH : Z_NO_FLUSH;
+      int status = Z_OK;
+      do {
+        stream_.next_out = reinterpret_cast<Bytef*>(out_chunk_.data());
+        stream_.avail_out = uInt(out_chunk_.size());
+        status = deflate(&stream_, flush);
+        if ( (Z_STREAM_ERROR == status)
+          || ((Z_BUF_ERROR == status) && (0 < stream_.avail_in)) ) {
+          report_error(nullptr == stream_.msg ? "zlib error" : stream_.msg);
+          return false;
+        }
+        if (false == write_to_file(out_chunk_.data(), out_chunk_.size() - stream_.avail_out)) {
+          report_error("cannot write file");
+          return false;
+        }
+      } while ( (0 == stream_.avail_out)
+             || (last && (Z_STREAM_END != status)) );
+
+      if (true == last) {
+        ended_ = true;
+        if (Z_OK != deflateEnd(&stream_)) {
+          report_error("cannot end zlib stream");
+          return false;
+        }
+      }
+      return true;
+    }
+
+  private: /* Internal data */
+    z_stream stream_ = z_stream();
+    bool ended_ = false;
+    std::vector<char> out_chunk_;
+};
+#endif
+
+#ifdef OPENFPGA_WITH_ZSTD
+/********************************************************************
+ * Compression in zstd format with libzstd
+ *******************************************************************/
+class ZstdCompressor : public OutputCompressor {
+  public: /* Constructors */
+    ZstdCompressor(std::streambuf* file_buffer,
+                   const std::string& fname,
+                   const size_t& buffer_size)
+      : OutputCompressor(file_buffer, fname, buffer_size),
+        cctx_(ZSTD_createCCtx()),
+        out_chunk_(ZSTD_CStreamOutSize()) {
+      if (nullptr == cctx_) {
+        report_error("cannot create a zstd context");
+        exit(1);
+      }
+    }
+    ~ZstdCompressor() {
+      ZSTD_freeCCtx(cctx_);
+    }
+
+  protected: /* Internal functions */
+    bool compress(const char* data, const size_t& size, const bool& last) override {
+      ZSTD_EndDirective directive = last ? ZSTD_e_end : ZSTD_e_continue;
+      ZSTD_inBuffer input = { data, size, 0 };
+      bool done = false;
+      while (false == done) {
+        ZSTD_outBuffer output = { out_chunk_.data(), out_chunk_.size(), 0 };
+        size_t remaining = ZSTD_compressStream2(cctx_, &output, &input, directive);
+        if (ZSTD_isError(remaining)) {
+          report_error(ZSTD_getErrorName(remaining));
+          return false;
+        }
+        if (false == write_to_file(out_chunk_.data(), output.pos)) {
+          report_error("cannot write file");
+          return false;
+        }
+        done = last ? (0 == remaining) : (input.pos == input.size);
+      }
+      return true;
+    }
+
+  private: /* Internal data */
+    ZSTD_CCtx* cctx_;
+    std::vector<char> out_chunk_;
+};
+#endif
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+BufferedFstream::BufferedFstream(const size_t& buffer_size)
+  : buffer_(buffer_size) {
+  if (0 < buffer_size) {
+    stream_.rdbuf()->pubsetbuf(buffer_.data(), buffer_.size());
+  }
+}
+
+BufferedFstream::~BufferedFstream() {
+  if (is_open()) {
+    close_file();
+  }
+}
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+bool BufferedFstream::is_open() const {
+  return stream_.is_open();
+}
+
+/**************************************************
+ * Public Mutators
+ *************************************************/
+void BufferedFstream::open_file(const std::string& fname, std::ios_base::openmode mode) {
+  fname_ = fname;
+  output_ = (0 != (mode & std::ios_base::out));
+  e_output_compression compression = OUTPUT_COMPRESSION_NONE;
+  if (true == output_) {
+    compression = find_output_compression(fname);
+  }
+
+  if (false == output_compression_supported(compression)) {
+    VTR_LOG_ERROR("OpenFPGA is built without support of the compression required by file '%s'!\n",
+                  fname.c_str());
+    exit(1);
+  }
+
+  open_time_ = std::chrono::steady_clock::now();
+  if (OUTPUT_COMPRESSION_NONE == compression) {
+    stream_.open(fname, mode);
+    return;
+  }
+
+  /* Compressed files are written by the compressor, in place of the file buffer */
+  stream_.open(fname, mode | std::ios_base::binary);
+  if (false == is_open()) {
+    return;
+  }
+  switch (compression) {
+#ifdef OPENFPGA_WITH_ZLIB
+  case OUTPUT_COMPRESSION_GZIP:
+    compressor_.reset(new GzipCompressor(stream_.rdbuf(), fname, buffer_.size()));
+    break;
+#endif
+#ifdef OPENFPGA_WITH_ZSTD
+  case OUTPUT_COMPRESSION_ZSTD:
+    compressor_.reset(new ZstdCompressor(stream_.rdbuf(), fname, buffer_.size()));
+    break;
+#endif
+  default:
+    /* Unsupported compressions are rejected above */
+    VTR_LOG_ERROR("Invalid compression for file '%s'!\n",
+                  fname.c_str());
+    exit(1);
+  }
+  stream_.std::ios::rdbuf(compressor_.get());
+}
+
+void BufferedFstream::open_file(const char* fname, std::ios_base::openmode mode) {
+  open_file(std::string(fname), mode);
+}
+
+void BufferedFstream::close_file() {
+  if (false == is_open()) {
+    stream_.close();
+    return;
+  }
+
+  size_t num_bytes = 0;
+  if (nullptr != compressor_) {
+    bool status = compressor_->finish();
+    num_bytes = compressor_->num_bytes();
+    /* Give the file buffer back to the stream */
+    stream_.std::ios::rdbuf(stream_.rdbuf());
+    compressor_.reset();
+    if (false == status) {
+      exit(1);
+    }
+  } else if (true == output_) {
+    std::streampos end_pos = stream_.tellp();
+    if (std::streampos(-1) != end_pos) {
+      num_bytes = size_t(end_pos);
+    }
+  }
+
+  stream_.close();
+  if ( (true == output_) && (true == stream_.fail()) ) {
+    VTR_LOG_ERROR("Unable to write file '%s'!\n",
+                  fname_.c_str());
+    exit(1);
+  }
+
+  if (true == output_) {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - open_time_;
+    std::lock_guard<std::mutex> lock(output_file_stats_mutex);
+    output_file_stats_total.num_files++;
+    output_file_stats_total.num_bytes += num_bytes;
+    output_file_stats_total.seconds += elapsed.count();
+  }
+}
+
+/********************************************************************
+ * Find the compression of an output file from its name
+ *******************************************************************/
+e_output_compression find_output_compression(const std::string& fname) {
+  auto ends_with = [&](const std::string& suffix) {
+    return (fname.size() > suffix.size())
+        && (0 == fname.compare(fname.size() - suffix.size(), suffix.size(), suffix));
+  };
+
+  if (ends_with(".gz")) {
+    return OUTPUT_COMPRESSION_GZIP;
+  }
+  if (ends_with(".zst")) {
+    return OUTPUT_COMPRESSION_ZSTD;
+  }
+  return OUTPUT_COMPRESSION_NONE;
+}
+
+/********************************************************************
+ * Counters of all the files written through BufferedFstream so far
+ *******************************************************************/
+OutputFileStats output_file_stats() {
+  std::lock_guard<std::mutex> lock(output_file_stats_mutex);
+  return output_file_stats_total;
+}
+
+} /* namespace openfpga ends */
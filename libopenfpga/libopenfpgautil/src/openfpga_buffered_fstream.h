@@ -0,0 +1,118 @@
+#ifndef OPENFPGA_BUFFERED_FSTREAM_H
+#define OPENFPGA_BUFFERED_FSTREAM_H
+
+/********************************************************************
+ * Include header files required by the data structure definition
+ *******************************************************************/
+#include <stddef.h>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * Compression applied to an output file, selected by its file name:
+ * - '.gz' files are compressed with gzip (requires zlib)
+ * - '.zst' files are compressed with zstd (requires libzstd)
+ *******************************************************************/
+enum e_output_compression {
+  OUTPUT_COMPRESSION_NONE,
+  OUTPUT_COMPRESSION_GZIP,
+  OUTPUT_COMPRESSION_ZSTD,
+  NUM_OUTPUT_COMPRESSIONS
+};
+
+/********************************************************************
+ * Counters of all the files written through BufferedFstream
+ * - num_bytes is the size of the files before compression
+ * - seconds is the time the files were open, i.e., spent in writers
+ *******************************************************************/
+struct OutputFileStats {
+  size_t num_files = 0;
+  size_t num_bytes = 0;
+  double seconds = 0.;
+};
+
+/********************************************************************
+ * A file stream with a large write buffer, for netlist writers
+ *
+ * The default buffer of std::fstream is only a few kB, and writers
+ * which end each line with std::endl flush it on every line.
+ * Writers should end lines with '\n' instead, so that the buffer is only
+ * written to the file when it is full, when flush() is called
+ * explicitly or when the file is closed.
+ *
+ * When a file name ends with '.gz' or '.zst', the buffer is compressed
+ * into the file each time it is full. Writers do not need to know about it.
+ *
+ * Every file written is accounted in the counters of output_file_stats()
+ *
+ * The file stream is owned by the BufferedFstream rather than inherited,
+ * as the open() and close() of std::fstream are not virtual and
+ * would skip the compression and the counters.
+ * Files are opened and closed with open_file() and close_file() only.
+ * The stream converts to a std::fstream&, so that it can be passed to all
+ * the writer functions accepting a std::fstream, which must not open or
+ * close the file themselves.
+ *
+ * Example:
+ *   BufferedFstream fp;
+ *   fp.open_file(fname, std::fstream::out | std::fstream::trunc);
+ *   check_file_stream(fname.c_str(), fp);
+ *   fp << ".subckt ..." << "\n";
+ *   fp.close_file();
+ *******************************************************************/
+class OutputCompressor;
+
+class BufferedFstream {
+  public: /* Constructors */
+    /* The buffer must be set before opening any file */
+    explicit BufferedFstream(const size_t& buffer_size = DEFAULT_BUFFER_SIZE);
+    /* Flush and close the file before the buffer is released */
+    ~BufferedFstream();
+    /* The buffer is shared with the file stream, so a stream can not be copied */
+    BufferedFstream(const BufferedFstream&) = delete;
+    BufferedFstream& operator=(const BufferedFstream&) = delete;
+
+  public: /* Accessors */
+    bool is_open() const;
+
+  public: /* Mutators */
+    void open_file(const std::string& fname, std::ios_base::openmode mode = std::ios_base::in | std::ios_base::out);
+    void open_file(const char* fname, std::ios_base::openmode mode = std::ios_base::in | std::ios_base::out);
+    /* Flush and close the file, end its compression if any, and update the counters */
+    void close_file();
+
+    /* The file stream for the writer functions */
+    operator std::fstream&() { return stream_; }
+
+    template<class T>
+    std::ostream& operator<<(const T& value) { return stream_ << value; }
+    std::ostream& operator<<(std::ostream& (*manipulator)(std::ostream&)) { return stream_ << manipulator; }
+
+  public: /* Constants */
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+  private: /* Internal data */
+    std::vector<char> buffer_;
+    std::fstream stream_;
+    std::string fname_;
+    /* Stream buffer compressing the data into the file, for compressed files only */
+    std::unique_ptr<OutputCompressor> compressor_;
+    bool output_ = false;
+    std::chrono::steady_clock::time_point open_time_;
+};
+
+/* Find the compression of an output file from its name */
+e_output_compression find_output_compression(const std::string& fname);
+
+/* Counters of all the files written through BufferedFstream so far */
+OutputFileStats output_file_stats();
+
+} /* namespace openfpga ends */
+
+#endif
@@ -272,4 +272,47 @@ bool write_tab_to_file(std::fstream& fp,
   return true;
 }
 
+/******************************************************************** 
+ * Write a list of bits to a file as a string of '0' and '1',
+ * with a single write instead of one per bit
+ ********************************************************************/
+bool write_bits_to_file(std::fstream& fp,
+                        const std::vector<bool>& bits) {
+  if (false == valid_file_stream(fp)) {
+    return false;
+  }
+
+  std::string bit_str(bits.size(), '0');
+  for (size_t ibit = 0; ibit < bits.size(); ++ibit) {
+    if (true == bits[ibit]) {
+      bit_str[ibit] = '1';
+    }
+  }
+  fp.write(bit_str.data(), bit_str.size());
+
+  return true;
+}
+
+/******************************************************************** 
+ * Write an unsigned integer to a file in decimal,
+ * without the locale and formatting flags of operator<<
+ ********************************************************************/
+bool write_uint_to_file(std::fstream& fp,
+                        const size_t& value) {
+  if (false == valid_file_stream(fp)) {
+    return false;
+  }
+
+  char digits[20];
+  size_t first_digit = sizeof(digits);
+  size_t remainder = value;
+  do {
+    digits[--first_digit] = char('0' + remainder % 10);
+    remainder /= 10;
+  } while (0 != remainder);
+  fp.write(digits + first_digit, sizeof(digits) - first_digit);
+
+  return true;
+}
+
 } /* namespace openfpga ends */
@@ -5,6 +5,8 @@
  * Include header files that are required by function declaration
  *******************************************************************/
 #include <fstream>
+#include <string>
+#include <vector>
 
 /********************************************************************
  * Function declaration
@@ -31,6 +33,12 @@ bool write_space_to_file(std::fstream& fp,
 bool write_tab_to_file(std::fstream& fp,
                        const size_t& num_tab);
 
+bool write_bits_to_file(std::fstream& fp,
+                        const std::vector<bool>& bits);
+
+bool write_uint_to_file(std::fstream& fp,
+                        const size_t& value);
+
 } /* namespace openfpga ends */
 
 #endif
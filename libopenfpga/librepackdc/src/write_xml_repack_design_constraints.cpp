@@ -12,6 +12,7 @@
 
 /* Headers from openfpga util library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from arch openfpga library */
 #include "write_xml_utils.h" 
@@ -64,9 +65,9 @@ int write_xml_repack_design_constraints(const char* fname,
   vtr::ScopedStartFinishTimer timer("Write Repack Design Constraints");
 
   /* Create a file handler */
-  std::fstream fp;
+  openfpga::BufferedFstream fp;
   /* Open the file stream */
-  fp.open(std::string(fname), std::fstream::out | std::fstream::trunc);
+  fp.open_file(std::string(fname), std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   openfpga::check_file_stream(fname, fp);
@@ -91,7 +92,7 @@ int write_xml_repack_design_constraints(const char* fname,
   fp << "</repack_design_constraints>" << "\n";
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   return err_code;
 }
@@ -0,0 +1,207 @@
+#ifndef VTR_PARALLEL_H
+#define VTR_PARALLEL_H
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vtr {
+
+//Returns the number of worker threads to use for a requested job count.
+//A request of 0 means 'use all the hardware threads available'.
+inline size_t resolve_num_jobs(size_t num_jobs) {
+    if (0 == num_jobs) {
+        num_jobs = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    return num_jobs;
+}
+
+//Returns the number of chunks parallel_for_chunks() will split num_items into
+inline size_t num_parallel_chunks(size_t num_items, size_t num_jobs) {
+    return std::max<size_t>(1, std::min(num_items, resolve_num_jobs(num_jobs)));
+}
+
+//Splits the index range [0, num_items) into contiguous chunks and calls
+//
+//    func(ichunk, begin, end)
+//
+//for each chunk, with one thread per chunk (chunk 0 runs on the calling thread).
+//
+//Chunks are deterministic: they only depend on num_items and num_jobs,
+//and chunk i always covers lower indices than chunk i+1. Callers can therefore
+//accumulate per-chunk results and merge them in chunk order to get the same
+//output as a serial walk.
+//
+//If any chunk throws, all the other chunks are still joined and the exception
+//from the lowest-numbered failing chunk is re-thrown on the calling thread.
+//
+//When num_jobs is 1 (or there is at most one item) no thread is spawned.
+template<typename F>
+void parallel_for_chunks(size_t num_items, size_t num_jobs, F&& func) {
+    size_t num_chunks = num_parallel_chunks(num_items, num_jobs);
+
+    if (1 == num_chunks) {
+        func(0, 0, num_items);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(num_chunks, nullptr);
+
+    auto run_chunk = [&](size_t ichunk) {
+        size_t begin = ichunk * num_items / num_chunks;
+        size_t end = (ichunk + 1) * num_items / num_chunks;
+        try {
+            func(ichunk, begin, end);
+        } catch (...) {
+            errors[ichunk] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_chunks - 1);
+    for (size_t ichunk = 1; ichunk < num_chunks; ++ichunk) {
+        workers.emplace_back(run_chunk, ichunk);
+    }
+    run_chunk(0);
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+//A fixed set of worker threads running parallel_for_chunks()-style loops.
+//
+//parallel_for_chunks() starts new threads on every call, which is fine for
+//a few large loops but far too slow for many small ones (e.g. one per batch
+//of placement moves). ParallelWorkers starts its threads once, and keeps
+//them waiting for work between calls to for_chunks().
+//
+//for_chunks() has the same semantics as parallel_for_chunks(): the chunks are
+//deterministic, chunk 0 runs on the calling thread, and the exception of the
+//lowest failing chunk is re-thrown. It must not be called concurrently
+//from several threads.
+class ParallelWorkers {
+  public:
+    explicit ParallelWorkers(size_t num_jobs)
+        : num_jobs_(resolve_num_jobs(num_jobs)) {
+        threads_.reserve(num_jobs_ - 1);
+        for (size_t iworker = 1; iworker < num_jobs_; ++iworker) {
+            threads_.emplace_back(&ParallelWorkers::worker_loop, this, iworker);
+        }
+    }
+
+    ~ParallelWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_cv_.notify_all();
+        for (std::thread& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    ParallelWorkers(const ParallelWorkers&) = delete;
+    ParallelWorkers& operator=(const ParallelWorkers&) = delete;
+
+    //Number of threads (including the calling one) used by for_chunks()
+    size_t num_jobs() const { return num_jobs_; }
+
+    template<typename F>
+    void for_chunks(size_t num_items, F&& func) {
+        size_t num_chunks = num_parallel_chunks(num_items, num_jobs_);
+
+        if (1 == num_chunks) {
+            func(0, 0, num_items);
+            return;
+        }
+
+        errors_.assign(num_chunks, nullptr);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = [&](size_t ichunk) {
+                func(ichunk, ichunk * num_items / num_chunks, (ichunk + 1) * num_items / num_chunks);
+            };
+            num_chunks_ = num_chunks;
+            num_pending_ = num_chunks - 1;
+            ++generation_;
+        }
+        start_cv_.notify_all();
+
+        run_chunk(0);
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_cv_.wait(lock, [&] { return num_pending_ == 0; });
+            task_ = nullptr;
+        }
+
+        for (const std::exception_ptr& error : errors_) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+  private:
+    void run_chunk(size_t ichunk) {
+        try {
+            task_(ichunk);
+        } catch (...) {
+            errors_[ichunk] = std::current_exception();
+        }
+    }
+
+    void worker_loop(size_t iworker) {
+        size_t seen_generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_cv_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+                if (stop_) {
+                    return;
+                }
+                seen_generation = generation_;
+                if (iworker >= num_chunks_) {
+                    continue; //Nothing to do for this worker this time
+                }
+            }
+
+            run_chunk(iworker);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --num_pending_;
+            }
+            done_cv_.notify_one();
+        }
+    }
+
+    size_t num_jobs_;
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    bool stop_ = false;
+    size_t generation_ = 0;
+    size_t num_chunks_ = 0;
+    size_t num_pending_ = 0;
+    std::function<void(size_t)> task_;
+    std::vector<std::exception_ptr> errors_;
+};
+
+} // namespace vtr
+
+#endif
@@ -96,6 +96,7 @@ class vector_map {
     void clear() { vec_.clear(); }
 
     size_t capacity() const { return vec_.capacity(); }
+    void reserve(size_t n) { vec_.reserve(n); }
     void shrink_to_fit() { vec_.shrink_to_fit(); }
 
     //Iterators
@@ -0,0 +1,91 @@
+#include "catch.hpp"
+
+#include "vtr_parallel.h"
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Parallel Chunks", "[vtr_parallel]") {
+    for (size_t num_jobs : {1, 2, 3, 8}) {
+        for (size_t num_items : {0, 1, 5, 100}) {
+            std::vector<int> visited(num_items, 0);
+            size_t num_chunks = vtr::num_parallel_chunks(num_items, num_jobs);
+            std::vector<size_t> chunk_begins(num_chunks, 0);
+            std::vector<size_t> chunk_ends(num_chunks, 0);
+
+            vtr::parallel_for_chunks(num_items, num_jobs, [&](size_t ichunk, size_t begin, size_t end) {
+                chunk_begins[ichunk] = begin;
+                chunk_ends[ichunk] = end;
+                for (size_t i = begin; i < end; ++i) {
+                    visited[i]++;
+                }
+            });
+
+            //Every item visited exactly once
+            REQUIRE(std::accumulate(visited.begin(), visited.end(), 0) == int(num_items));
+            for (int count : visited) {
+                REQUIRE(count == 1);
+            }
+
+            //Chunks are contiguous and ordered
+            REQUIRE(chunk_begins.front() == 0);
+            REQUIRE(chunk_ends.back() == num_items);
+            for (size_t ichunk = 1; ichunk < num_chunks; ++ichunk) {
+                REQUIRE(chunk_begins[ichunk] == chunk_ends[ichunk - 1]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Parallel Chunks Exceptions", "[vtr_parallel]") {
+    //The exception of the lowest failing chunk is reported
+    try {
+        vtr::parallel_for_chunks(4, 4, [&](size_t ichunk, size_t /*begin*/, size_t /*end*/) {
+            if (ichunk >= 1) {
+                throw std::runtime_error(std::to_string(ichunk));
+            }
+        });
+        FAIL("Expected an exception");
+    } catch (const std::runtime_error& err) {
+        REQUIRE(std::string(err.what()) == "1");
+    }
+}
+
+TEST_CASE("Parallel Workers", "[vtr_parallel]") {
+    for (size_t num_jobs : {1, 2, 4}) {
+        vtr::ParallelWorkers workers(num_jobs);
+        REQUIRE(workers.num_jobs() == num_jobs);
+
+        //Workers are re-used across many calls of varying sizes
+        for (size_t iter = 0; iter < 200; ++iter) {
+            size_t num_items = iter % 7;
+            std::vector<int> visited(num_items, 0);
+
+            workers.for_chunks(num_items, [&](size_t /*ichunk*/, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    visited[i]++;
+                }
+            });
+
+            for (int count : visited) {
+                REQUIRE(count == 1);
+            }
+        }
+
+        //Exceptions are reported, and the workers remain usable
+        try {
+            workers.for_chunks(num_jobs, [&](size_t ichunk, size_t /*begin*/, size_t /*end*/) {
+                throw std::runtime_error(std::to_string(ichunk));
+            });
+            FAIL("Expected an exception");
+        } catch (const std::runtime_error& err) {
+            REQUIRE(std::string(err.what()) == "0");
+        }
+
+        size_t num_visited = 0;
+        workers.for_chunks(1, [&](size_t /*ichunk*/, size_t begin, size_t end) {
+            num_visited += end - begin;
+        });
+        REQUIRE(num_visited == 1);
+    }
+}
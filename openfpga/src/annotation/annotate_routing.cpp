@@ -34,16 +34,14 @@ void annotate_rr_node_nets(const DeviceContext& device_ctx,
     if (false == clustering_ctx.clb_nlist.net_sinks(net_id).size()) {
       continue;
     }
-    t_trace* tptr = routing_ctx.trace[net_id].head;
-    while (tptr != nullptr) {
-      RRNodeId rr_node = tptr->index;
+    for (const t_trace& trace : routing_ctx.trace[net_id]) {
+      RRNodeId rr_node = trace.index;
       /* Ignore source and sink nodes, they are the common node multiple starting and ending points */
       if ( (SOURCE != device_ctx.rr_graph.node_type(rr_node)) 
         && (SINK != device_ctx.rr_graph.node_type(rr_node)) ) {
         vpr_routing_annotation.set_rr_node_net(rr_node, net_id);
         counter++;
       }
-      tptr = tptr->next;
     }
   }
 
@@ -61,7 +59,7 @@ void annotate_rr_node_nets(const DeviceContext& device_ctx,
  *******************************************************************/
 static 
 RRNodeId find_previous_node_from_routing_traces(const RRGraph& rr_graph,
-                                                t_trace* routing_trace_head,
+                                                const t_traceback& routing_traces,
                                                 const RRNodeId& prev_node_candidate,
                                                 const RRNodeId& cur_rr_node) {
   RRNodeId prev_node = prev_node_candidate;
@@ -99,9 +97,8 @@ RRNodeId find_previous_node_from_routing_traces(const RRGraph& rr_graph,
      * which should be considered in routing optimization
      */
     if (false == valid_prev_node) {
-      t_trace* tptr = routing_trace_head;
-      while (tptr != nullptr) {
-        RRNodeId cand_prev_node = tptr->index;
+      for (const t_trace& trace : routing_traces) {
+        RRNodeId cand_prev_node = trace.index;
         bool is_good_cand = false;
         for (const RREdgeId& in_edge : rr_graph.node_in_edges(cur_rr_node)) {
           if (cand_prev_node == rr_graph.edge_src_node(in_edge)) {
@@ -115,9 +112,6 @@ RRNodeId find_previous_node_from_routing_traces(const RRGraph& rr_graph,
           prev_node = cand_prev_node;
           break;
         }
-
-        /* Move on to the next */
-        tptr = tptr->next;
       }
     } 
   }
@@ -152,13 +146,14 @@ void annotate_rr_node_previous_nodes(const DeviceContext& device_ctx,
     /* Cache Previous nodes */
     RRNodeId prev_node = RRNodeId::INVALID();
 
-    t_trace* tptr = routing_ctx.trace[net_id].head;
-    while (tptr != nullptr) {
-      RRNodeId rr_node = tptr->index;
+    const t_traceback& routing_traces = routing_ctx.trace[net_id];
+
+    for (const t_trace& trace : routing_traces) {
+      RRNodeId rr_node = trace.index;
 
       /* Find the right previous node */
       prev_node = find_previous_node_from_routing_traces(device_ctx.rr_graph,
-                                                         routing_ctx.trace[net_id].head,
+                                                         routing_traces,
                                                          prev_node,
                                                          rr_node);
 
@@ -170,9 +165,6 @@ void annotate_rr_node_previous_nodes(const DeviceContext& device_ctx,
 
       /* Update prev_node */
       prev_node = rr_node;
-
-      /* Move on to the next */
-      tptr = tptr->next;
     }
   }
 
@@ -6,6 +6,7 @@
 #include "vtr_time.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_hash.h"
 
 /* Headers from openfpgautil library */
 #include "openfpga_side_manager.h"
@@ -669,4 +670,49 @@ void annotate_rr_graph_circuit_models(const DeviceContext& vpr_device_ctx,
   annotate_direct_circuit_models(vpr_device_ctx, openfpga_arch, vpr_device_annotation, verbose_output);
 }
 
+/********************************************************************
+ * Build the fingerprint of the routing resource graph of a device,
+ * which tells if the GSBs and the multiplexer library built from
+ * a routing resource graph can be applied to another one.
+ * The fingerprint covers
+ * - the number of nodes and edges
+ * - the channel width
+ * - the type, coordinates and ptc of each node
+ * - the terminals and switch of each edge
+ *******************************************************************/
+RRGraphFingerprint build_rr_graph_fingerprint(const DeviceContext& vpr_device_ctx) {
+  const RRGraph& rr_graph = vpr_device_ctx.rr_graph;
+
+  RRGraphFingerprint fingerprint;
+  fingerprint.num_nodes = rr_graph.nodes().size();
+  fingerprint.num_edges = rr_graph.edges().size();
+  fingerprint.chan_width = vpr_device_ctx.chan_width.max;
+
+  vtr::hash_combine(fingerprint.hash, vpr_device_ctx.chan_width.x_max);
+  vtr::hash_combine(fingerprint.hash, vpr_device_ctx.chan_width.y_max);
+  for (const int& width : vpr_device_ctx.chan_width.x_list) {
+    vtr::hash_combine(fingerprint.hash, width);
+  }
+  for (const int& width : vpr_device_ctx.chan_width.y_list) {
+    vtr::hash_combine(fingerprint.hash, width);
+  }
+
+  for (const RRNodeId& node : rr_graph.nodes()) {
+    vtr::hash_combine(fingerprint.hash, size_t(rr_graph.node_type(node)));
+    vtr::hash_combine(fingerprint.hash, rr_graph.node_xlow(node));
+    vtr::hash_combine(fingerprint.hash, rr_graph.node_ylow(node));
+    vtr::hash_combine(fingerprint.hash, rr_graph.node_xhigh(node));
+    vtr::hash_combine(fingerprint.hash, rr_graph.node_yhigh(node));
+    vtr::hash_combine(fingerprint.hash, rr_graph.node_ptc_num(node));
+  }
+
+  for (const RREdgeId& edge : rr_graph.edges()) {
+    vtr::hash_combine(fingerprint.hash, size_t(rr_graph.edge_src_node(edge)));
+    vtr::hash_combine(fingerprint.hash, size_t(rr_graph.edge_sink_node(edge)));
+    vtr::hash_combine(fingerprint.hash, size_t(rr_graph.edge_switch(edge)));
+  }
+
+  return fingerprint;
+}
+
 } /* end namespace openfpga */
@@ -28,6 +28,8 @@ void annotate_rr_graph_circuit_models(const DeviceContext& vpr_device_ctx,
                                       VprDeviceAnnotation& vpr_device_annotation,
                                       const bool& verbose_output);
 
+RRGraphFingerprint build_rr_graph_fingerprint(const DeviceContext& vpr_device_ctx);
+
 } /* end namespace openfpga */
 
 #endif
@@ -19,6 +19,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "check_netlist_naming_conflict.h"
 
@@ -165,9 +166,9 @@ void print_netlist_naming_fix_report(const std::string& fname,
                                      const AtomNetlist& atom_netlist,
                                      const VprNetlistAnnotation& vpr_netlist_annotation) {
   /* Create a file handler */
-  std::fstream fp;
+  BufferedFstream fp;
   /* Open the file stream */
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   openfpga::check_file_stream(fname.c_str(), fp);
@@ -208,7 +209,7 @@ void print_netlist_naming_fix_report(const std::string& fname,
   fp << "</netlist>" << "\n";
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
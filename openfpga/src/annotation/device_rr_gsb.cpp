@@ -1,8 +1,14 @@
 /************************************************************************
  * Member functions for class DeviceRRGSB
  ***********************************************************************/
+#include <map>
+
 #include "vtr_log.h"
 #include "vtr_assert.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_side_manager.h"
+
 #include "device_rr_gsb.h"
 
 /* namespace openfpga begins */
@@ -143,6 +149,16 @@ const RRGSB& DeviceRRGSB::get_sb_unique_module(const vtr::Point<size_t>& coordin
   return get_sb_unique_module(sb_unique_module_id);
 } 
 
+/* Give a coordinate of a rr switch block and one of its sides, 
+ * and return the side of its unique mirror which should be wired to it.
+ * This is the same side, unless the unique mirror is a rotation or a reflection
+ */ 
+e_side DeviceRRGSB::get_sb_unique_module_side(const vtr::Point<size_t>& coordinate, const e_side& side) const {
+  VTR_ASSERT(validate_coordinate(coordinate));
+  VTR_ASSERT(NUM_SIDES != side);
+  return sb_unique_module_side_map_[coordinate.x()][coordinate.y()][size_t(side)];
+} 
+
 /************************************************************************
  * Public mutators
  ***********************************************************************/
@@ -154,6 +170,7 @@ void DeviceRRGSB::reserve(const vtr::Point<size_t>& coordinate) {
   gsb_unique_module_id_.resize(coordinate.x());
 
   sb_unique_module_id_.resize(coordinate.x());
+  sb_unique_module_side_map_.resize(coordinate.x());
 
   cbx_unique_module_id_.resize(coordinate.x());
   cby_unique_module_id_.resize(coordinate.x());
@@ -164,6 +181,7 @@ void DeviceRRGSB::reserve(const vtr::Point<size_t>& coordinate) {
     gsb_unique_module_id_[x].resize(coordinate.y()); 
 
     sb_unique_module_id_[x].resize(coordinate.y()); 
+    sb_unique_module_side_map_[x].resize(coordinate.y()); 
 
     cbx_unique_module_id_[x].resize(coordinate.y());
     cby_unique_module_id_[x].resize(coordinate.y()); 
@@ -176,6 +194,7 @@ void DeviceRRGSB::resize_upon_need(const vtr::Point<size_t>& coordinate) {
     rr_gsb_.resize(coordinate.x() + 1);
 
     sb_unique_module_id_.resize(coordinate.x() + 1);
+    sb_unique_module_side_map_.resize(coordinate.x() + 1);
 
     cbx_unique_module_id_.resize(coordinate.x() + 1);
     cby_unique_module_id_.resize(coordinate.x() + 1);
@@ -184,6 +203,7 @@ void DeviceRRGSB::resize_upon_need(const vtr::Point<size_t>& coordinate) {
   if (coordinate.y() + 1 > rr_gsb_[coordinate.x()].size()) {
     rr_gsb_[coordinate.x()].resize(coordinate.y() + 1);
     sb_unique_module_id_[coordinate.x()].resize(coordinate.y() + 1);
+    sb_unique_module_side_map_[coordinate.x()].resize(coordinate.y() + 1);
 
     cbx_unique_module_id_[coordinate.x()].resize(coordinate.y() + 1);
     cby_unique_module_id_[coordinate.x()].resize(coordinate.y() + 1);
@@ -212,14 +232,17 @@ RRGSB& DeviceRRGSB::get_mutable_gsb(const size_t& x, const size_t& y) {
   return get_mutable_gsb(coordinate);
 }
 
-/* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors */
+/* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors 
+ * The fingerprint of each CB is computed once, and a CB is a mirror of the unique module with the same fingerprint
+ */
 void DeviceRRGSB::build_cb_unique_module(const RRGraph& rr_graph, const t_rr_type& cb_type) {
   /* Make sure a clean start */
   clear_cb_unique_module(cb_type);
 
+  std::map<std::vector<uint64_t>, size_t> unique_module_ids;
+
   for (size_t ix = 0; ix < rr_gsb_.size(); ++ix) {
     for (size_t iy = 0; iy < rr_gsb_[ix].size(); ++iy) {
-      bool is_unique_module = true;
       vtr::Point<size_t> gsb_coordinate(ix, iy);
 
       /* Bypass non-exist CB */
@@ -227,32 +250,53 @@ void DeviceRRGSB::build_cb_unique_module(const RRGraph& rr_graph, const t_rr_typ
         continue;
       }
 
-      /* Traverse the unique_mirror list and check it is an mirror of another */
-      for (size_t id = 0; id < get_num_cb_unique_module(cb_type); ++id) {
-        const RRGSB& unique_module = get_cb_unique_module(cb_type, id);
-        if (true == rr_gsb_[ix][iy].is_cb_mirror(rr_graph, unique_module, cb_type)) {
-          /* This is a mirror, raise the flag and we finish */
-          is_unique_module = false;
-          /* Record the id of unique mirror */
-          set_cb_unique_module_id(cb_type, gsb_coordinate, id); 
-          break;
-        }
-      }
+      /* Find if the CB is an mirror of a unique module */
+      auto result = unique_module_ids.emplace(rr_gsb_[ix][iy].get_cb_fingerprint(rr_graph, cb_type),
+                                              get_num_cb_unique_module(cb_type));
       /* Add to list if this is a unique mirror*/
-      if (true == is_unique_module) {
+      if (true == result.second) {
         add_cb_unique_module(cb_type, gsb_coordinate);
-        /* Record the id of unique mirror */
-        set_cb_unique_module_id(cb_type, gsb_coordinate, get_num_cb_unique_module(cb_type) - 1); 
       }
+      /* Record the id of unique mirror */
+      set_cb_unique_module_id(cb_type, gsb_coordinate, result.first->second); 
     }
   } 
 }
 
-/* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors */
-void DeviceRRGSB::build_sb_unique_module(const RRGraph& rr_graph) {
+/************************************************************************
+ * Get all the rotations and reflections of a switch block, the identity first
+ * Sides are numbered clockwise, so that a rotation adds to the side index 
+ * while a reflection negates it.
+ * Each of them maps the opposite sides to opposite sides,
+ * which keeps the passing wires of a switch block 
+ ***********************************************************************/
+static 
+std::vector<t_rr_gsb_side_map> get_rr_gsb_side_symmetries() {
+  std::vector<t_rr_gsb_side_map> side_maps;
+  for (size_t reflect = 0; reflect < 2; ++reflect) {
+    for (size_t rotate = 0; rotate < NUM_SIDES; ++rotate) {
+      t_rr_gsb_side_map side_map;
+      for (size_t side = 0; side < NUM_SIDES; ++side) {
+        size_t reflected_side = (0 == reflect) ? side : (NUM_SIDES - side) % NUM_SIDES;
+        side_map[side] = SideManager((reflected_side + rotate) % NUM_SIDES).get_side();
+      }
+      side_maps.push_back(side_map);
+    }
+  }
+  return side_maps;
+}
+
+/* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors 
+ * When rotatable_sb is enabled, a switch block which is not a mirror of any unique module
+ * is also compared to the rotations and reflections of the unique modules
+ */
+void DeviceRRGSB::build_sb_unique_module(const RRGraph& rr_graph, const bool& rotatable_sb) {
   /* Make sure a clean start */
   clear_sb_unique_module();
 
+  std::vector<t_rr_gsb_side_map> side_symmetries = get_rr_gsb_side_symmetries();
+  const t_rr_gsb_side_map& identity_side_map = side_symmetries[0];
+
   /* Build the unique module */
   for (size_t ix = 0; ix < rr_gsb_.size(); ++ix) {
     for (size_t iy = 0; iy < rr_gsb_[ix].size(); ++iy) {
@@ -271,15 +315,30 @@ void DeviceRRGSB::build_sb_unique_module(const RRGraph& rr_graph) {
           is_unique_module = false;
           /* Record the id of unique mirror */
           sb_unique_module_id_[ix][iy] = id; 
+          sb_unique_module_side_map_[ix][iy] = identity_side_map;
           break;
         }
       }
 
+      /* Try the rotations and reflections of the unique modules, skipping the identity */
+      for (size_t id = 0; (true == rotatable_sb) && (true == is_unique_module) && (id < get_num_sb_unique_module()); ++id) {
+        const RRGSB& unique_module = get_sb_unique_module(id);
+        for (size_t isym = 1; isym < side_symmetries.size(); ++isym) {
+          if (true == rr_gsb_[ix][iy].is_sb_mirror(rr_graph, unique_module, side_symmetries[isym])) {
+            is_unique_module = false;
+            sb_unique_module_id_[ix][iy] = id; 
+            sb_unique_module_side_map_[ix][iy] = side_symmetries[isym];
+            break;
+          }
+        }
+      }
+
       /* Add to list if this is a unique mirror*/
       if (true == is_unique_module) {
         sb_unique_module_.push_back(sb_coordinate);
         /* Record the id of unique mirror */
         sb_unique_module_id_[ix][iy] = sb_unique_module_.size() - 1; 
+        sb_unique_module_side_map_[ix][iy] = identity_side_map;
       }
     }
   } 
@@ -304,6 +363,7 @@ void DeviceRRGSB::build_gsb_unique_module() {
          */
         const vtr::Point<size_t>& gsb_unique_module_coordinate = gsb_unique_module_[id];
         if ((sb_unique_module_id_[ix][iy] == sb_unique_module_id_[gsb_unique_module_coordinate.x()][gsb_unique_module_coordinate.y()])
+         && (sb_unique_module_side_map_[ix][iy] == sb_unique_module_side_map_[gsb_unique_module_coordinate.x()][gsb_unique_module_coordinate.y()])
          && (cbx_unique_module_id_[ix][iy] == cbx_unique_module_id_[gsb_unique_module_coordinate.x()][gsb_unique_module_coordinate.y()])
          && (cby_unique_module_id_[ix][iy] == cby_unique_module_id_[gsb_unique_module_coordinate.x()][gsb_unique_module_coordinate.y()])) {
           /* This is a mirror, raise the flag and we finish */
@@ -323,8 +383,8 @@ void DeviceRRGSB::build_gsb_unique_module() {
   } 
 }
 
-void DeviceRRGSB::build_unique_module(const RRGraph& rr_graph) {
-  build_sb_unique_module(rr_graph);
+void DeviceRRGSB::build_unique_module(const RRGraph& rr_graph, const bool& rotatable_sb) {
+  build_sb_unique_module(rr_graph, rotatable_sb);
 
   build_cb_unique_module(rr_graph, CHANX);
   build_cb_unique_module(rr_graph, CHANY);
@@ -408,6 +468,7 @@ void DeviceRRGSB::clear_sb_unique_module_id() {
   /* clean rr_switch_block array */
   for (size_t x = 0; x < rr_gsb_.size(); ++x) {
     sb_unique_module_id_[x].clear(); 
+    sb_unique_module_side_map_[x].clear(); 
   }
 }
 
@@ -35,6 +35,7 @@ class DeviceRRGSB {
     const RRGSB& get_gsb_unique_module(const size_t& index) const; /* Get a rr-gsb which is a unique mirror */ 
     const RRGSB& get_sb_unique_module(const size_t& index) const; /* Get a rr switch block which a unique mirror */ 
     const RRGSB& get_sb_unique_module(const vtr::Point<size_t>& coordinate) const; /* Get a rr switch block which a unique mirror */ 
+    e_side get_sb_unique_module_side(const vtr::Point<size_t>& coordinate, const e_side& side) const; /* Get the side of the unique mirror which is wired to a side of a switch block */
     const RRGSB& get_cb_unique_module(const t_rr_type& cb_type, const size_t& index) const; /* Get a rr switch block which a unique mirror */ 
     const RRGSB& get_cb_unique_module(const t_rr_type& cb_type, const vtr::Point<size_t>& coordinate) const;
     size_t get_num_cb_unique_module(const t_rr_type& cb_type) const; /* get the number of unique mirrors of CBs */
@@ -46,7 +47,7 @@ class DeviceRRGSB {
     void add_rr_gsb(const vtr::Point<size_t>& coordinate, const RRGSB& rr_gsb); /* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors */
     RRGSB& get_mutable_gsb(const vtr::Point<size_t>& coordinate); /* Get a rr switch block in the array with a coordinate */
     RRGSB& get_mutable_gsb(const size_t& x, const size_t& y); /* Get a rr switch block in the array with a coordinate */
-    void build_unique_module(const RRGraph& rr_graph); /* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors */
+    void build_unique_module(const RRGraph& rr_graph, const bool& rotatable_sb); /* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors */
     void clear(); /* clean the content */
   private: /* Internal cleaners */
     void clear_gsb(); /* clean the content */
@@ -67,7 +68,7 @@ class DeviceRRGSB {
     void add_gsb_unique_module(const vtr::Point<size_t>& coordinate);
     void add_cb_unique_module(const t_rr_type& cb_type, const vtr::Point<size_t>& coordinate);
     void set_cb_unique_module_id(const t_rr_type& cb_type, const vtr::Point<size_t>& coordinate, size_t id);
-    void build_sb_unique_module(const RRGraph& rr_graph); /* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors */
+    void build_sb_unique_module(const RRGraph& rr_graph, const bool& rotatable_sb); /* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors */
     void build_cb_unique_module(const RRGraph& rr_graph, const t_rr_type& cb_type); /* Add a switch block to the array, which will automatically identify and update the lists of unique side module */
     void build_gsb_unique_module(); /* Add a switch block to the array, which will automatically identify and update the lists of unique mirrors and rotatable mirrors */
   private: /* Internal Data */
@@ -77,6 +78,7 @@ class DeviceRRGSB {
     std::vector<vtr::Point<size_t>> gsb_unique_module_; 
 
     std::vector<std::vector<size_t>> sb_unique_module_id_; /* A map from rr_gsb to its unique mirror */
+    std::vector<std::vector<t_rr_gsb_side_map>> sb_unique_module_side_map_; /* A map from the sides of rr_gsb to the sides of its unique mirror, which may be rotated or reflected */
     std::vector<vtr::Point<size_t>> sb_unique_module_; 
 
     std::vector<std::vector<size_t>> cbx_unique_module_id_; /* A map from rr_gsb to its unique mirror */
@@ -41,9 +41,10 @@ AtomNetlist::TruthTable VprClusteringAnnotation::truth_table(t_pb* pb) const {
   return block_truth_tables_.at(pb);
 }
 
-PhysicalPb VprClusteringAnnotation::physical_pb(const ClusterBlockId& block_id) const {
+const PhysicalPb& VprClusteringAnnotation::physical_pb(const ClusterBlockId& block_id) const {
+  static const PhysicalPb empty_physical_pb;
   if (physical_pbs_.end() == physical_pbs_.find(block_id)) {
-    return PhysicalPb();
+    return empty_physical_pb;
   }
 
   return physical_pbs_.at(block_id);
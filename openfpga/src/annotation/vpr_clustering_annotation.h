@@ -35,7 +35,7 @@ class VprClusteringAnnotation {
     ClusterNetId net(const ClusterBlockId& block_id, const int& pin_index) const;
     bool is_truth_table_adapted(t_pb* pb) const;
     AtomNetlist::TruthTable truth_table(t_pb* pb) const;
-    PhysicalPb physical_pb(const ClusterBlockId& block_id) const;
+    const PhysicalPb& physical_pb(const ClusterBlockId& block_id) const;
   public:  /* Public mutators */
     void rename_net(const ClusterBlockId& block_id, const int& pin_index,
                     const ClusterNetId& net_id);
@@ -9,6 +9,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_side_manager.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_naming.h"
 #include "openfpga_rr_graph_utils.h"
@@ -37,16 +38,16 @@ void write_rr_switch_block_to_xml(const std::string fname_prefix,
            fname.c_str());
 
   /* Create a file handler*/
-  std::fstream fp;
+  BufferedFstream fp;
   /* Open a file */
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(fname.c_str(), fp);
 
   /* Output location of the Switch Block */
   fp << "<rr_gsb x=\"" << rr_gsb.get_x() << "\" y=\"" << rr_gsb.get_y() << "\""
-     << " num_sides=\"" << rr_gsb.get_num_sides() << "\">" << std::endl;
+     << " num_sides=\"" << rr_gsb.get_num_sides() << "\">" << "\n";
 
   /* Output each side */ 
   for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
@@ -63,7 +64,7 @@ void write_rr_switch_block_to_xml(const std::string fname_prefix,
          << "\" node_id=\"" << size_t(cur_rr_node)
          << "\" mux_size=\"" << get_rr_graph_configurable_driver_nodes(rr_graph, cur_rr_node).size()
          << "\">" 
-         << std::endl; 
+         << "\n"; 
       /* General information of each driving nodes */
       for (const RRNodeId& driver_node : get_rr_graph_configurable_driver_nodes(rr_graph, cur_rr_node)) {
         /* Skip OPINs: they should be in direct connections */
@@ -90,11 +91,11 @@ void write_rr_switch_block_to_xml(const std::string fname_prefix,
            << "\" index=\"" << driver_node_index 
            << "\" segment_id=\"" << size_t(des_segment_id)
            << "\"/>" 
-           << std::endl; 
+           << "\n"; 
       }
       fp << "\t</" << rr_node_typename[rr_graph.node_type(cur_rr_node)] 
          << ">" 
-         << std::endl; 
+         << "\n"; 
     }
 
     /* Output chan nodes */
@@ -122,7 +123,7 @@ void write_rr_switch_block_to_xml(const std::string fname_prefix,
          << "\" segment_id=\"" << size_t(src_segment_id)
          << "\" mux_size=\"" << driver_rr_edges.size()
          << "\">" 
-         << std::endl; 
+         << "\n"; 
 
       /* Direct connection: output the node on the opposite side */
       if (0 == driver_rr_edges.size()) {
@@ -133,7 +134,7 @@ void write_rr_switch_block_to_xml(const std::string fname_prefix,
            << "\" node_id=\"" << size_t(cur_rr_node)
            << "\" segment_id=\"" << size_t(src_segment_id)
            << "\"/>" 
-           << std::endl; 
+           << "\n"; 
       } else {
         for (const RREdgeId& driver_rr_edge : driver_rr_edges) {
           const RRNodeId& driver_rr_node = rr_graph.edge_src_node(driver_rr_edge);
@@ -151,7 +152,7 @@ void write_rr_switch_block_to_xml(const std::string fname_prefix,
                << "\" node_id=\"" << size_t(driver_rr_node)
                << "\" grid_side=\"" <<  grid_side.to_string() 
                <<"\"/>" 
-               << std::endl; 
+               << "\n"; 
           } else {
             const RRSegmentId& des_segment_id = rr_gsb.get_chan_node_segment(driver_node_side, driver_node_index);
             fp << "\t\t<driver_node type=\"" << rr_node_typename[rr_graph.node_type(driver_rr_node)]
@@ -160,21 +161,21 @@ void write_rr_switch_block_to_xml(const std::string fname_prefix,
                << "\" node_id=\"" << size_t(driver_rr_node)
                << "\" segment_id=\"" << size_t(des_segment_id)
                << "\"/>" 
-               << std::endl; 
+               << "\n"; 
           }
         }  
       }
       fp << "\t</" << rr_node_typename[rr_graph.node_type(cur_rr_node)]
          << ">" 
-         << std::endl; 
+         << "\n"; 
     }
   }
 
   fp << "</rr_gsb>" 
-     << std::endl;
+     << "\n";
 
   /* close a file */
-  fp.close();
+  fp.close_file();
 }
 
 /***************************************************************************************
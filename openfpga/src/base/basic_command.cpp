@@ -1,6 +1,7 @@
 /********************************************************************
  * Add basic commands to the OpenFPGA shell interface, including:
  * - exit
+ * - stop_server
  * - version
  * - help
  *******************************************************************/
@@ -17,7 +18,13 @@ void add_basic_commands(openfpga::Shell<OpenfpgaContext>& shell) {
   Command shell_cmd_exit("exit");
   ShellCommandId shell_cmd_exit_id = shell.add_command(shell_cmd_exit, "Exit the shell");
   shell.set_command_class(shell_cmd_exit_id, basic_cmd_class);
-  shell.set_command_execute_function(shell_cmd_exit_id, [shell](){shell.exit();});
+  shell.set_command_execute_function(shell_cmd_exit_id, [&shell](){shell.exit();});
+
+  /* Stop the server mode */
+  Command shell_cmd_stop_server("stop_server");
+  ShellCommandId shell_cmd_stop_server_id = shell.add_command(shell_cmd_stop_server, "Stop the server mode after the current session");
+  shell.set_command_class(shell_cmd_stop_server_id, basic_cmd_class);
+  shell.set_command_execute_function(shell_cmd_stop_server_id, [&shell](){shell.stop_server();});
 
   /* Version */
   Command shell_cmd_version("version");
@@ -1,6 +1,8 @@
 /******************************************************************************
  * Memember functions for data structure IoLocationMap
  ******************************************************************************/
+#include <algorithm>
+
 #include "vtr_assert.h"
 
 #include "io_location_map.h"
@@ -9,30 +11,89 @@
 namespace openfpga {
 
 /**************************************************
- * Public Accessors 
+ * Public Accessors
  *************************************************/
 size_t IoLocationMap::io_index(const size_t& x,
                                const size_t& y,
                                const size_t& z,
                                const std::string& io_port_name) const {
-  if (x >= io_indices_.size()) {
+  return io_index(x, y, z, io_port_id(io_port_name));
+}
+
+size_t IoLocationMap::io_port_id(const std::string& io_port_name) const {
+  auto result = io_port_ids_.find(io_port_name);
+  if (result == io_port_ids_.end()) {
     return size_t(-1);
   }
+  return result->second;
+}
 
-  if (y >= io_indices_[x].size()) {
+size_t IoLocationMap::num_io_ports() const {
+  return io_port_names_.size();
+}
+
+std::string IoLocationMap::io_port_name(const size_t& io_port_id) const {
+  VTR_ASSERT(io_port_id < io_port_names_.size());
+  return io_port_names_[io_port_id];
+}
+
+size_t IoLocationMap::io_index(const size_t& x,
+                               const size_t& y,
+                               const size_t& z,
+                               const size_t& io_port_id) const {
+  if ( (x >= width_)
+    || (y >= height_)
+    || (z >= capacity_)
+    || (io_port_id >= num_ports_) ) {
     return size_t(-1);
   }
 
-  if (z >= io_indices_[x][y].size()) {
-    return size_t(-1);
+  return io_indices_[location_offset(x, y, z) + io_port_id];
+}
+
+size_t IoLocationMap::num_io_indices(const size_t& io_port_id) const {
+  VTR_ASSERT(io_port_id < io_locations_.size());
+  return io_locations_[io_port_id].size();
+}
+
+bool IoLocationMap::io_location(const size_t& io_port_id,
+                                const size_t& io_index,
+                                size_t& x,
+                                size_t& y,
+                                size_t& z) const {
+  if ( (io_port_id >= io_locations_.size())
+    || (io_index >= io_locations_[io_port_id].size()) ) {
+    return false;
   }
 
-  auto result = io_indices_[x][y][z].find(io_port_name);
-  if (result == io_indices_[x][y][z].end()) {
-    return size_t(-1);
+  const t_io_location& location = io_locations_[io_port_id][io_index];
+  if (size_t(-1) == location.x) {
+    return false;
   }
 
-  return result->second;
+  x = location.x;
+  y = location.y;
+  z = location.z;
+  return true;
+}
+
+/**************************************************
+ * Public Mutators
+ *************************************************/
+void IoLocationMap::reserve(const size_t& width,
+                            const size_t& height,
+                            const size_t& capacity,
+                            const std::vector<BasicPort>& io_ports) {
+  /* Intern the ports first, so that the look-up is sized for all of them */
+  for (const BasicPort& io_port : io_ports) {
+    size_t port_id = intern_io_port(io_port.get_name());
+    io_locations_[port_id].reserve(io_port.get_width());
+  }
+
+  if ( (0 == width) || (0 == height) || (0 == capacity) ) {
+    return;
+  }
+  expand_io_indices(width - 1, height - 1, capacity - 1, io_port_names_.size());
 }
 
 void IoLocationMap::set_io_index(const size_t& x,
@@ -40,19 +101,79 @@ void IoLocationMap::set_io_index(const size_t& x,
                                  const size_t& z,
                                  const std::string& io_port_name,
                                  const size_t& io_index) {
-  if (x >= io_indices_.size()) {
-    io_indices_.resize(x + 1);
+  size_t port_id = intern_io_port(io_port_name);
+
+  expand_io_indices(x, y, z, io_port_names_.size());
+
+  io_indices_[location_offset(x, y, z) + port_id] = io_index;
+
+  /* Update the reverse look-up */
+  std::vector<t_io_location>& port_locations = io_locations_[port_id];
+  if (io_index >= port_locations.size()) {
+    port_locations.resize(io_index + 1, {size_t(-1), size_t(-1), size_t(-1)});
+  }
+  port_locations[io_index] = {x, y, z};
+}
+
+/**************************************************
+ * Internal utilities
+ *************************************************/
+size_t IoLocationMap::intern_io_port(const std::string& io_port_name) {
+  auto result = io_port_ids_.find(io_port_name);
+  if (result != io_port_ids_.end()) {
+    return result->second;
   }
 
-  if (y >= io_indices_[x].size()) {
-    io_indices_[x].resize(y + 1);
+  size_t port_id = io_port_names_.size();
+  io_port_names_.push_back(io_port_name);
+  io_port_ids_[io_port_name] = port_id;
+  io_locations_.emplace_back();
+  return port_id;
+}
+
+void IoLocationMap::expand_io_indices(const size_t& x,
+                                      const size_t& y,
+                                      const size_t& z,
+                                      const size_t& num_ports) {
+  if ( (x < width_)
+    && (y < height_)
+    && (z < capacity_)
+    && (num_ports <= num_ports_) ) {
+    return;
   }
 
-  if (z >= io_indices_[x][y].size()) {
-    io_indices_[x][y].resize(z + 1);
+  /* Grow geometrically, as the look-up is usually built location by location */
+  size_t new_width = (x < width_) ? width_ : std::max(x + 1, 2 * width_);
+  size_t new_height = (y < height_) ? height_ : std::max(y + 1, 2 * height_);
+  size_t new_capacity = (z < capacity_) ? capacity_ : std::max(z + 1, 2 * capacity_);
+  size_t new_num_ports = (num_ports <= num_ports_) ? num_ports_ : std::max(num_ports, 2 * num_ports_);
+
+  std::vector<size_t> new_io_indices(new_width * new_height * new_capacity * new_num_ports, size_t(-1));
+
+  /* Copy the existing indices to their new place */
+  for (size_t ix = 0; ix < width_; ++ix) {
+    for (size_t iy = 0; iy < height_; ++iy) {
+      for (size_t iz = 0; iz < capacity_; ++iz) {
+        size_t old_offset = location_offset(ix, iy, iz);
+        size_t new_offset = ((ix * new_height + iy) * new_capacity + iz) * new_num_ports;
+        std::copy(io_indices_.begin() + old_offset,
+                  io_indices_.begin() + old_offset + num_ports_,
+                  new_io_indices.begin() + new_offset);
+      }
+    }
   }
 
-  io_indices_[x][y][z][io_port_name] = io_index;
+  io_indices_.swap(new_io_indices);
+  width_ = new_width;
+  height_ = new_height;
+  capacity_ = new_capacity;
+  num_ports_ = new_num_ports;
+}
+
+size_t IoLocationMap::location_offset(const size_t& x,
+                                      const size_t& y,
+                                      const size_t& z) const {
+  return ((x * height_ + y) * capacity_ + z) * num_ports_;
 }
 
 } /* end namespace openfpga */
@@ -9,6 +9,8 @@
 #include <string>
 #include <map>
 
+#include "openfpga_port.h"
+
 /* Begin namespace openfpga */
 namespace openfpga {
 
@@ -17,7 +19,7 @@ namespace openfpga {
  * in the FPGA fabric, i.e., the module graph, and logical location
  * of the I/O in VPR coordinate system
  *
- * For example: 
+ * For example:
  *
  *      ioA[0]   ioA[1]      ioB[0]    ioB[1]     ioA[2]
  *   +-----------------+   +--------+--------+  +--------+
@@ -27,6 +29,14 @@ namespace openfpga {
  *   |  [0]   |  [1]   |   |  [0]   |  [1]   |  |  [0]   |
  *   +-----------------+   +--------+--------+  +--------+
  *
+ * The I/O port names are interned to small integer ids, so that
+ * the indices can be stored in a single flat array addressed by
+ * [x][y][z][port_id]. Callers which look up many I/Os of the same port
+ * should resolve the port id once with io_port_id() and use the
+ * id-based accessors.
+ *
+ * A reverse look-up, from the index of an I/O in the fabric
+ * to its location, is also maintained.
  *******************************************************************/
 class IoLocationMap {
   public: /* Public aggregators */
@@ -34,15 +44,85 @@ class IoLocationMap {
                     const size_t& y,
                     const size_t& z,
                     const std::string& io_port_name) const;
+
+    /* Find the id of an I/O port, return size_t(-1) if the port is not in the map */
+    size_t io_port_id(const std::string& io_port_name) const;
+
+    /* Number of I/O ports in the map; valid port ids are [0, num_io_ports()) */
+    size_t num_io_ports() const;
+
+    /* Name of an I/O port */
+    std::string io_port_name(const size_t& io_port_id) const;
+
+    /* Same as io_index() by port name, but without any string look-up */
+    size_t io_index(const size_t& x,
+                    const size_t& y,
+                    const size_t& z,
+                    const size_t& io_port_id) const;
+
+    /* Number of I/O indices registered for a port */
+    size_t num_io_indices(const size_t& io_port_id) const;
+
+    /* Reverse look-up: the location [x][y][z] of an I/O of a port in the fabric
+     * Return false if no location is registered for the I/O
+     */
+    bool io_location(const size_t& io_port_id,
+                     const size_t& io_index,
+                     size_t& x,
+                     size_t& y,
+                     size_t& z) const;
   public: /* Public mutators */
+    /* Pre-allocate the look-up for a fabric of a given size and its I/O ports,
+     * whose widths are the number of I/O indices of each port.
+     * This is optional, but avoids growing the look-up while it is built
+     */
+    void reserve(const size_t& width,
+                 const size_t& height,
+                 const size_t& capacity,
+                 const std::vector<BasicPort>& io_ports);
+
     void set_io_index(const size_t& x,
                       const size_t& y,
                       const size_t& z,
                       const std::string& io_port_name,
                       const size_t& io_index);
+  private: /* Internal utilities */
+    /* Find or create the id of an I/O port */
+    size_t intern_io_port(const std::string& io_port_name);
+
+    /* Grow the flat look-up so that it covers [x][y][z] for all the ports */
+    void expand_io_indices(const size_t& x,
+                           const size_t& y,
+                           const size_t& z,
+                           const size_t& num_ports);
+
+    /* Offset of the first port of location [x][y][z] in io_indices_ */
+    size_t location_offset(const size_t& x,
+                           const size_t& y,
+                           const size_t& z) const;
   private: /* Internal Data */
-    /* I/O index fast lookup by [x][y][z] location */
-    std::vector<std::vector<std::vector<std::map<std::string, size_t>>>> io_indices_;
+    /* Interned I/O port names */
+    std::vector<std::string> io_port_names_;
+    std::map<std::string, size_t> io_port_ids_;
+
+    /* Dimensions of the flat look-up */
+    size_t width_ = 0;
+    size_t height_ = 0;
+    size_t capacity_ = 0;
+    size_t num_ports_ = 0;
+
+    /* I/O index fast lookup by [x][y][z][port_id] location,
+     * size_t(-1) for locations without the I/O port
+     */
+    std::vector<size_t> io_indices_;
+
+    /* Location [x][y][z] of each I/O index, organized by [port_id][io_index] */
+    struct t_io_location {
+      size_t x;
+      size_t y;
+      size_t z;
+    };
+    std::vector<std::vector<t_io_location>> io_locations_;
 };
 
 } /* End namespace openfpga*/
@@ -25,6 +25,7 @@
 #include "build_fabric_bitstream.h"
 #include "build_io_mapping_info.h"
 #include "write_xml_io_mapping.h"
+#include "command_option_utils.h"
 #include "openfpga_bitstream.h"
 
 /* Include global variables of VPR */
@@ -44,11 +45,17 @@ int fpga_bitstream(OpenfpgaContext& openfpga_ctx,
   CommandOptionId opt_write_file = cmd.option("write_file");
   CommandOptionId opt_read_file = cmd.option("read_file");
 
+  size_t num_jobs = 1;
+  if (CMD_EXEC_SUCCESS != read_num_jobs_option(cmd, cmd_context, num_jobs)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   if (true == cmd_context.option_enable(cmd, opt_read_file)) {
     openfpga_ctx.mutable_bitstream_manager() = read_xml_architecture_bitstream(cmd_context.option_value(cmd, opt_read_file).c_str());
   } else {
     openfpga_ctx.mutable_bitstream_manager() = build_device_bitstream(g_vpr_ctx,
                                                                       openfpga_ctx,
+                                                                      num_jobs,
                                                                       cmd_context.option_enable(cmd, opt_verbose));
   }
 
@@ -75,11 +82,17 @@ int build_fabric_bitstream(OpenfpgaContext& openfpga_ctx,
 
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  size_t num_jobs = 1;
+  if (CMD_EXEC_SUCCESS != read_num_jobs_option(cmd, cmd_context, num_jobs)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   /* Build fabric bitstream here */
   openfpga_ctx.mutable_fabric_bitstream() = build_fabric_dependent_bitstream(openfpga_ctx.bitstream_manager(),
                                                                              openfpga_ctx.module_graph(),
                                                                              openfpga_ctx.arch().circuit_lib,
                                                                              openfpga_ctx.arch().config_protocol,
+                                                                             num_jobs,
                                                                              cmd_context.option_enable(cmd, opt_verbose));
 
   /* TODO: should identify the error code from internal function execution */
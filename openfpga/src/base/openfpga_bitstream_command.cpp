@@ -60,6 +60,10 @@ ShellCommandId add_openfpga_build_arch_bitstream_command(openfpga::Shell<Openfpg
   /* Add an option '--no_time_stamp' */
   shell_cmd.add_option("no_time_stamp", false, "Do not print time stamp in output files");
 
+  /* Add an option '--jobs' */
+  CommandOptionId opt_jobs = shell_cmd.add_option("jobs", false, "Number of threads used to build the bitstream of grids and routing blocks (0: all the cores). By default, 1");
+  shell_cmd.set_option_require_value(opt_jobs, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
   
@@ -122,6 +126,10 @@ ShellCommandId add_openfpga_build_fabric_bitstream_command(openfpga::Shell<Openf
                                                            const std::vector<ShellCommandId>& dependent_cmds) {
   Command shell_cmd("build_fabric_bitstream");
 
+  /* Add an option '--jobs' */
+  CommandOptionId opt_jobs = shell_cmd.add_option("jobs", false, "Number of threads used to build the configuration regions (0: all the cores). By default, 1");
+  shell_cmd.set_option_require_value(opt_jobs, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
 
@@ -13,6 +13,7 @@
 
 #include "device_rr_gsb.h"
 #include "device_rr_gsb_utils.h"
+#include "command_option_utils.h"
 #include "build_device_module.h"
 #include "fabric_hierarchy_writer.h"
 #include "fabric_key_writer.h"
@@ -32,11 +33,12 @@ namespace openfpga {
  *******************************************************************/
 static 
 void compress_routing_hierarchy(OpenfpgaContext& openfpga_ctx,
+                                const bool& rotatable_sb,
                                 const bool& verbose_output) {
   vtr::ScopedStartFinishTimer timer("Identify unique General Switch Blocks (GSBs)");
 
   /* Build unique module lists */
-  openfpga_ctx.mutable_device_rr_gsb().build_unique_module(g_vpr_ctx.device().rr_graph);
+  openfpga_ctx.mutable_device_rr_gsb().build_unique_module(g_vpr_ctx.device().rr_graph, rotatable_sb);
 
   /* Report the stats */
   VTR_LOGV(verbose_output, 
@@ -71,14 +73,28 @@ int build_fabric(OpenfpgaContext& openfpga_ctx,
 
   CommandOptionId opt_frame_view = cmd.option("frame_view");
   CommandOptionId opt_compress_routing = cmd.option("compress_routing");
+  CommandOptionId opt_rotatable_sb = cmd.option("rotatable_sb");
   CommandOptionId opt_duplicate_grid_pin = cmd.option("duplicate_grid_pin");
   CommandOptionId opt_gen_random_fabric_key = cmd.option("generate_random_fabric_key");
   CommandOptionId opt_write_fabric_key = cmd.option("write_fabric_key");
   CommandOptionId opt_load_fabric_key = cmd.option("load_fabric_key");
   CommandOptionId opt_verbose = cmd.option("verbose");
   
+  if ( (true == cmd_context.option_enable(cmd, opt_rotatable_sb))
+    && (false == cmd_context.option_enable(cmd, opt_compress_routing)) ) {
+    VTR_LOG_ERROR("Option '--rotatable_sb' requires option '--compress_routing' to be enabled!\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  size_t num_jobs = 1;
+  if (CMD_EXEC_SUCCESS != read_num_jobs_option(cmd, cmd_context, num_jobs)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   if (true == cmd_context.option_enable(cmd, opt_compress_routing)) {
-    compress_routing_hierarchy(openfpga_ctx, cmd_context.option_enable(cmd, opt_verbose));
+    compress_routing_hierarchy(openfpga_ctx,
+                               cmd_context.option_enable(cmd, opt_rotatable_sb),
+                               cmd_context.option_enable(cmd, opt_verbose));
     /* Update flow manager to enable compress routing */
     openfpga_ctx.mutable_flow_manager().set_compress_routing(true);
   }
@@ -99,7 +115,6 @@ int build_fabric(OpenfpgaContext& openfpga_ctx,
     predefined_fabric_key = read_xml_fabric_key(fkey_fname.c_str());
   }
 
-  VTR_LOG("\n");
 
   curr_status = build_device_module_graph(openfpga_ctx.mutable_module_graph(),
                                           openfpga_ctx.mutable_decoder_lib(),
@@ -111,6 +126,7 @@ int build_fabric(OpenfpgaContext& openfpga_ctx,
                                           cmd_context.option_enable(cmd, opt_duplicate_grid_pin),
                                           predefined_fabric_key,
                                           cmd_context.option_enable(cmd, opt_gen_random_fabric_key),
+                                          num_jobs,
                                           cmd_context.option_enable(cmd, opt_verbose));
 
   /* If there is any error, final status cannot be overwritten by a success flag */
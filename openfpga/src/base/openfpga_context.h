@@ -99,6 +99,20 @@ class OpenfpgaContext : public Context  {
     openfpga::FabricGlobalPortInfo& mutable_fabric_global_port_info() { return fabric_global_port_info_; }
     openfpga::NetlistManager& mutable_verilog_netlists() { return verilog_netlists_; }
     openfpga::NetlistManager& mutable_spice_netlists() { return spice_netlists_; }
+  public:  /* Public mutators for the server mode */
+    /* Clear the data which depends on the user design, i.e., the mapping results
+     * and the bitstreams, and keep the architecture and the fabric
+     * so that a new design can be implemented on the same fabric
+     */
+    void reset_design_data() {
+      vpr_netlist_annotation_ = openfpga::VprNetlistAnnotation();
+      vpr_clustering_annotation_ = openfpga::VprClusteringAnnotation();
+      vpr_placement_annotation_ = openfpga::VprPlacementAnnotation();
+      vpr_routing_annotation_ = openfpga::VprRoutingAnnotation();
+      bitstream_manager_ = openfpga::BitstreamManager();
+      fabric_bitstream_ = openfpga::FabricBitstream();
+      flow_manager_.set_resident_fabric(true);
+    }
   private: /* Internal data */
     /* Data structure to store information from read_openfpga_arch library */
     openfpga::Arch arch_;
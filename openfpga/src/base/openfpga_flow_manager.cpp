@@ -14,6 +14,7 @@ namespace openfpga {
 FlowManager::FlowManager() {
   /* Turn off compress_routing as default */
   compress_routing_ = false;
+  resident_fabric_ = false;
 }
 
 /**************************************************
@@ -23,6 +24,14 @@ bool FlowManager::compress_routing() const {
   return compress_routing_;
 }
 
+bool FlowManager::resident_fabric() const {
+  return resident_fabric_;
+}
+
+const RRGraphFingerprint& FlowManager::fabric_rr_graph_fingerprint() const {
+  return fabric_rr_graph_fingerprint_;
+}
+
 /******************************************************************************
  * Private Mutators
  ******************************************************************************/
@@ -30,5 +39,13 @@ void FlowManager::set_compress_routing(const bool& enabled) {
   compress_routing_ = enabled;
 }
 
+void FlowManager::set_resident_fabric(const bool& enabled) {
+  resident_fabric_ = enabled;
+}
+
+void FlowManager::set_fabric_rr_graph_fingerprint(const RRGraphFingerprint& fingerprint) {
+  fabric_rr_graph_fingerprint_ = fingerprint;
+}
+
 
 } /* end namespace openfpga */
@@ -4,9 +4,35 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
+#include <cstddef>
+
 /* Begin namespace openfpga */
 namespace openfpga {
 
+/********************************************************************
+ * Fingerprint of the routing resource graph that the GSBs and
+ * the multiplexer library of a fabric are built from.
+ * A resident fabric of the server mode can only be reused when
+ * the routing resource graph of a new session has exactly the same fingerprint
+ *******************************************************************/
+struct RRGraphFingerprint {
+  size_t num_nodes = 0;
+  size_t num_edges = 0;
+  int chan_width = 0;
+  /* Hash of node types, coordinates and ptc as well as edge switches */
+  size_t hash = 0;
+
+  bool operator==(const RRGraphFingerprint& other) const {
+    return (num_nodes == other.num_nodes)
+        && (num_edges == other.num_edges)
+        && (chan_width == other.chan_width)
+        && (hash == other.hash);
+  }
+  bool operator!=(const RRGraphFingerprint& other) const {
+    return !(*this == other);
+  }
+};
+
 /********************************************************************
  * FlowManager aims to resolve the dependency between OpenFPGA functional
  * code blocks
@@ -19,10 +45,18 @@ class FlowManager {
     FlowManager();
   public: /* Public accessors */
     bool compress_routing() const;
+    /* Check if the fabric is kept from a previous session of the server mode */
+    bool resident_fabric() const;
+    /* Fingerprint of the routing resource graph that the fabric is built from */
+    const RRGraphFingerprint& fabric_rr_graph_fingerprint() const;
   public: /* Public mutators */
     void set_compress_routing(const bool& enabled);
+    void set_resident_fabric(const bool& enabled);
+    void set_fabric_rr_graph_fingerprint(const RRGraphFingerprint& fingerprint);
   private: /* Internal Data */
     bool compress_routing_;
+    bool resident_fabric_;
+    RRGraphFingerprint fabric_rr_graph_fingerprint_;
 };
 
 } /* End namespace openfpga*/
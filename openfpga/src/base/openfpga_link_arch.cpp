@@ -124,19 +124,39 @@ int link_arch(OpenfpgaContext& openfpga_ctx,
     return CMD_EXEC_FATAL_ERROR;
   }
 
-  annotate_device_rr_gsb(g_vpr_ctx.device(),
-                         openfpga_ctx.mutable_device_rr_gsb(),
-                         cmd_context.option_enable(cmd, opt_verbose));
-
-  if (true == cmd_context.option_enable(cmd, opt_sort_edge)) {
-    sort_device_rr_gsb_chan_node_in_edges(g_vpr_ctx.device().rr_graph,
-                                          openfpga_ctx.mutable_device_rr_gsb(),
-                                          cmd_context.option_enable(cmd, opt_verbose));
-  } 
-
-  /* Build multiplexer library */
-  openfpga_ctx.mutable_mux_lib() = build_device_mux_library(g_vpr_ctx.device(),
-                                                            const_cast<const OpenfpgaContext&>(openfpga_ctx)); 
+  /* In server mode, the GSBs and the multiplexer library of the fabric are kept
+   * between the sessions. They are only valid when the routing resource graph
+   * rebuilt by VPR is exactly the one they are built from
+   */
+  RRGraphFingerprint rr_graph_fingerprint = build_rr_graph_fingerprint(g_vpr_ctx.device());
+  if (true == openfpga_ctx.flow_manager().resident_fabric()) {
+    if (rr_graph_fingerprint != openfpga_ctx.flow_manager().fabric_rr_graph_fingerprint()) {
+      const RRGraphFingerprint& fabric_fingerprint = openfpga_ctx.flow_manager().fabric_rr_graph_fingerprint();
+      VTR_LOG_ERROR("The routing resource graph (%lu nodes, %lu edges, channel width %d) differs from the one of the resident fabric (%lu nodes, %lu edges, channel width %d)!\n",
+                    rr_graph_fingerprint.num_nodes, rr_graph_fingerprint.num_edges, rr_graph_fingerprint.chan_width,
+                    fabric_fingerprint.num_nodes, fabric_fingerprint.num_edges, fabric_fingerprint.chan_width);
+      VTR_LOG_ERROR("The resident fabric can not be used for this session. Please restart the server with the new architecture\n");
+      openfpga_ctx.mutable_flow_manager().set_resident_fabric(false);
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    VTR_LOG("Keep the General Switch Blocks (GSBs) and multiplexer library of the resident fabric\n");
+  } else {
+    annotate_device_rr_gsb(g_vpr_ctx.device(),
+                           openfpga_ctx.mutable_device_rr_gsb(),
+                           cmd_context.option_enable(cmd, opt_verbose));
+
+    if (true == cmd_context.option_enable(cmd, opt_sort_edge)) {
+      sort_device_rr_gsb_chan_node_in_edges(g_vpr_ctx.device().rr_graph,
+                                            openfpga_ctx.mutable_device_rr_gsb(),
+                                            cmd_context.option_enable(cmd, opt_verbose));
+    } 
+
+    /* Build multiplexer library */
+    openfpga_ctx.mutable_mux_lib() = build_device_mux_library(g_vpr_ctx.device(),
+                                                              const_cast<const OpenfpgaContext&>(openfpga_ctx)); 
+
+    openfpga_ctx.mutable_flow_manager().set_fabric_rr_graph_fingerprint(rr_graph_fingerprint);
+  }
 
   /* Build tile direct annotation */
   openfpga_ctx.mutable_tile_direct() = build_device_tile_direct(g_vpr_ctx.device(),
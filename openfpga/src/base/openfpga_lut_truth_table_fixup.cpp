@@ -6,6 +6,8 @@
 #include "vtr_time.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
+#include "vtr_parallel.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -15,6 +17,7 @@
 
 #include "pb_type_utils.h"
 #include "lut_utils.h"
+#include "command_option_utils.h"
 #include "openfpga_lut_truth_table_fixup.h"
 
 /* Include global variables of VPR */
@@ -23,6 +26,17 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/********************************************************************
+ * The fix-ups found for a chunk of clustered blocks:
+ * the truth table to be adapted for each LUT pb,
+ * and the verbose outputs, both in the order of the blocks
+ *******************************************************************/
+struct LutTruthTableFixupBatch {
+  std::vector<t_pb*> pbs;
+  std::vector<AtomNetlist::TruthTable> truth_tables;
+  std::string verbose_log;
+};
+
 /********************************************************************
  * Apply the fix-up to truth table of LUT according to its pin
  * rotation status by packer
@@ -34,7 +48,7 @@ static
 void fix_up_lut_atom_block_truth_table(const AtomContext& atom_ctx,
                                        t_pb* pb,
                                        const t_pb_routes& pb_route,
-                                       VprClusteringAnnotation& vpr_clustering_annotation,
+                                       LutTruthTableFixupBatch& fixup_batch,
                                        const bool& verbose) {
   t_pb_graph_node* pb_graph_node = pb->pb_graph_node;
   t_pb_type* pb_type = pb->pb_graph_node->pb_type;
@@ -89,39 +103,44 @@ void fix_up_lut_atom_block_truth_table(const AtomContext& atom_ctx,
      */
     const AtomNetlist::TruthTable& orig_tt = atom_ctx.nlist.block_truth_table(atom_blk);
     const AtomNetlist::TruthTable& adapt_tt = lut_truth_table_adaption(orig_tt, rotated_pin_map); 
-    vpr_clustering_annotation.adapt_truth_table(pb, adapt_tt);
+    fixup_batch.pbs.push_back(pb);
+    fixup_batch.truth_tables.push_back(adapt_tt);
 
     /* Print info is in the verbose mode */
-    VTR_LOGV(verbose, "Original truth table\n");
-    VTR_LOGV(verbose, "Index: ");
+    if (false == verbose) {
+      continue;
+    }
+    std::string& log = fixup_batch.verbose_log;
+    log += "Original truth table\n";
+    log += "Index: ";
     for (size_t i = 0; i < rotated_pin_map.size(); ++i) {
       if (0 < i) {
-        VTR_LOGV(verbose, ",");
+        log += ",";
       }
-      VTR_LOGV(verbose, "%lu", i);
+      log += std::to_string(i);
     }
-    VTR_LOGV(verbose, "\n");
+    log += "\n";
     for (const std::string& tt_line : truth_table_to_string(orig_tt)) {
-      VTR_LOGV(verbose, "\t%s\n", tt_line.c_str());
+      log += "\t" + tt_line + "\n";
     }
-    VTR_LOGV(verbose, "\n");
-    VTR_LOGV(verbose, "Pin rotation map: ");
+    log += "\n";
+    log += "Pin rotation map: ";
     for (size_t i = 0; i < rotated_pin_map.size(); ++i) {
       if (0 < i) {
-        VTR_LOGV(verbose, ",");
+        log += ",";
       }
       if (-1 == rotated_pin_map[i]) {
-        VTR_LOGV(verbose, "open");
+        log += "open";
       } else {
-        VTR_LOGV(verbose, "%lu", rotated_pin_map[i]);
+        log += std::to_string(rotated_pin_map[i]);
       }
     }
-    VTR_LOGV(verbose, "\n");
-    VTR_LOGV(verbose, "Adapt truth table\n");
+    log += "\n";
+    log += "Adapt truth table\n";
     for (const std::string& tt_line : truth_table_to_string(adapt_tt)) {
-      VTR_LOGV(verbose, "\t%s\n", tt_line.c_str());
+      log += "\t" + tt_line + "\n";
     }
-    VTR_LOGV(verbose, "\n");
+    log += "\n";
   }
 }
 
@@ -135,7 +154,7 @@ static
 void rec_adapt_lut_pb_tt(const AtomContext& atom_ctx,
                          t_pb* pb,
                          const t_pb_routes& pb_route,
-                         VprClusteringAnnotation& vpr_clustering_annotation,
+                         LutTruthTableFixupBatch& fixup_batch,
                          const bool& verbose) {
   t_pb_graph_node* pb_graph_node = pb->pb_graph_node; 
 
@@ -149,7 +168,7 @@ void rec_adapt_lut_pb_tt(const AtomContext& atom_ctx,
        * mode 1 is the regular mode
        */
       if (1 == pb->mode) {
-        fix_up_lut_atom_block_truth_table(atom_ctx, pb->child_pbs[0], pb_route, vpr_clustering_annotation, verbose);
+        fix_up_lut_atom_block_truth_table(atom_ctx, pb->child_pbs[0], pb_route, fixup_batch, verbose);
       }
     }
     return;
@@ -162,7 +181,7 @@ void rec_adapt_lut_pb_tt(const AtomContext& atom_ctx,
     for (int jpb = 0; jpb < mapped_mode->pb_type_children[ipb].num_pb; ++jpb) {
       /* See if we still have any pb children to walk through */
       if ((pb->child_pbs[ipb] != nullptr) && (pb->child_pbs[ipb][jpb].name != nullptr)) {
-        rec_adapt_lut_pb_tt(atom_ctx, &(pb->child_pbs[ipb][jpb]), pb_route, vpr_clustering_annotation, verbose);
+        rec_adapt_lut_pb_tt(atom_ctx, &(pb->child_pbs[ipb][jpb]), pb_route, fixup_batch, verbose);
       }
     }
   }
@@ -171,17 +190,38 @@ void rec_adapt_lut_pb_tt(const AtomContext& atom_ctx,
 /********************************************************************
  * Main function to fix up truth table for each LUT used in FPGA
  * This function will walk through each clustered block
+ * The clustered blocks are fixed up by chunks in parallel,
+ * and the adapted truth tables are then applied to the clustering annotation
+ * in the order of the blocks, so that the results and the verbose outputs
+ * are the same whatever the number of threads
  *******************************************************************/
 static 
 void update_lut_tt_with_post_packing_results(const AtomContext& atom_ctx,
                                              const ClusteringContext& clustering_ctx,
                                              VprClusteringAnnotation& vpr_clustering_annotation,
+                                             const size_t& num_jobs,
                                              const bool& verbose) {
-  for (auto blk_id : clustering_ctx.clb_nlist.blocks()) {
-    rec_adapt_lut_pb_tt(atom_ctx,
-                        clustering_ctx.clb_nlist.block_pb(blk_id),
-                        clustering_ctx.clb_nlist.block_pb(blk_id)->pb_route,
-                        vpr_clustering_annotation, verbose);
+  std::vector<ClusterBlockId> blocks(clustering_ctx.clb_nlist.blocks().begin(),
+                                     clustering_ctx.clb_nlist.blocks().end());
+
+  std::vector<LutTruthTableFixupBatch> fixup_batches(vtr::num_parallel_chunks(blocks.size(), num_jobs));
+
+  vtr::parallel_for_chunks(blocks.size(), num_jobs, [&](size_t ichunk, size_t begin, size_t end) {
+    for (size_t iblk = begin; iblk < end; ++iblk) {
+      rec_adapt_lut_pb_tt(atom_ctx,
+                          clustering_ctx.clb_nlist.block_pb(blocks[iblk]),
+                          clustering_ctx.clb_nlist.block_pb(blocks[iblk])->pb_route,
+                          fixup_batches[ichunk], verbose);
+    }
+  });
+
+  /* Apply the fix-ups in the order of the blocks */
+  for (const LutTruthTableFixupBatch& fixup_batch : fixup_batches) {
+    VTR_LOGV(verbose, "%s", fixup_batch.verbose_log.c_str());
+    for (size_t ifixup = 0; ifixup < fixup_batch.pbs.size(); ++ifixup) {
+      vpr_clustering_annotation.adapt_truth_table(fixup_batch.pbs[ifixup],
+                                                  fixup_batch.truth_tables[ifixup]);
+    }
   }
 }
 
@@ -203,10 +243,16 @@ int lut_truth_table_fixup(OpenfpgaContext& openfpga_context,
 
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  size_t num_jobs = 1;
+  if (CMD_EXEC_SUCCESS != read_num_jobs_option(cmd, cmd_context, num_jobs)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   /* Apply fix-up to each packed block */
   update_lut_tt_with_post_packing_results(g_vpr_ctx.atom(), 
                                           g_vpr_ctx.clustering(),
                                           openfpga_context.mutable_vpr_clustering_annotation(),
+                                          num_jobs,
                                           cmd_context.option_enable(cmd, opt_verbose));
 
   /* TODO: should identify the error code from internal function execution */
@@ -5,6 +5,9 @@
  * IMPORTANT: keep all the naming functions in this file to be 
  * generic for both Verilog and SPICE generators 
  ********************************************************************/
+#include <array>
+#include <limits>
+
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
@@ -17,6 +20,51 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/************************************************
+ * Append the decimal representation of an index to a name,
+ * without the temporary string created by std::to_string()
+ * Names are built in a single string this way, 
+ * as the generators below are called many times when building 
+ * and writing the fabric
+ ***********************************************/
+static 
+void append_name_index(std::string& name, const size_t& index) {
+  char digits[std::numeric_limits<size_t>::digits10 + 1];
+  char* digit_end = digits + sizeof(digits);
+  char* digit_begin = digit_end;
+  size_t value = index;
+  do {
+    --digit_begin;
+    *digit_begin = char('0' + value % 10);
+    value /= 10;
+  } while (0 != value);
+  name.append(digit_begin, digit_end);
+}
+
+static 
+void append_name_index(std::string& name, const int& index) {
+  if (0 > index) {
+    name += '-';
+    append_name_index(name, size_t(-static_cast<long long>(index)));
+    return;
+  }
+  append_name_index(name, size_t(index));
+}
+
+/************************************************
+ * Get the prefix of the names related to a routing channel 
+ ***********************************************/
+static 
+const char* get_chan_name_prefix(const t_rr_type& chan_type) {
+  /* Channel must be either CHANX or CHANY */
+  VTR_ASSERT( (CHANX == chan_type) || (CHANY == chan_type) );
+
+  if (CHANX == chan_type) {
+    return "chanx";
+  }
+  return "chany";
+}
+
 /************************************************
  * A generic function to generate the instance name
  * in the following format:
@@ -27,7 +75,13 @@ namespace openfpga {
  ***********************************************/
 std::string generate_instance_name(const std::string& instance_name,
                                    const size_t& instance_id) {
-  return instance_name + std::string("_") + std::to_string(instance_id) + std::string("_");
+  std::string name;
+  name.reserve(instance_name.size() + std::numeric_limits<size_t>::digits10 + 3);
+  name += instance_name;
+  name += '_';
+  append_name_index(name, instance_id);
+  name += '_';
+  return name;
 }
 
 /************************************************
@@ -54,7 +108,9 @@ std::string generate_instance_wildcard_name(const std::string& instance_name,
 std::string generate_mux_node_name(const size_t& node_level, 
                                    const bool& add_buffer_postfix) {
   /* Generate the basic node_name */
-  std::string node_name = "mux_l" + std::to_string(node_level) + "_in";
+  std::string node_name("mux_l");
+  append_name_index(node_name, node_level);
+  node_name += "_in";
 
   /* Add a postfix upon requests */
   if (true == add_buffer_postfix)  {
@@ -75,7 +131,11 @@ std::string generate_mux_node_name(const size_t& node_level,
 std::string generate_mux_branch_instance_name(const size_t& node_level, 
                                               const size_t& node_index_at_level,
                                               const bool& add_buffer_postfix) {
-  return std::string(generate_mux_node_name(node_level, add_buffer_postfix) + "_" + std::to_string(node_index_at_level) + "_");
+  std::string instance_name = generate_mux_node_name(node_level, add_buffer_postfix);
+  instance_name += '_';
+  append_name_index(instance_name, node_index_at_level);
+  instance_name += '_';
+  return instance_name;
 }
 
 /************************************************
@@ -252,7 +312,13 @@ std::string generate_routing_block_netlist_name(const std::string& prefix,
 std::string generate_routing_block_netlist_name(const std::string& prefix, 
                                                 const vtr::Point<size_t>& coordinate,
                                                 const std::string& postfix) {
-  return std::string( prefix + std::to_string(coordinate.x()) + std::string("__") + std::to_string(coordinate.y()) + std::string("_") + postfix );
+  std::string netlist_name(prefix);
+  append_name_index(netlist_name, coordinate.x());
+  netlist_name += "__";
+  append_name_index(netlist_name, coordinate.y());
+  netlist_name += '_';
+  netlist_name += postfix;
+  return netlist_name;
 }
 
 /*********************************************************************
@@ -282,16 +348,11 @@ std::string generate_connection_block_netlist_name(const t_rr_type& cb_type,
  *********************************************************************/
 std::string generate_routing_channel_module_name(const t_rr_type& chan_type, 
                                                  const size_t& block_id) {
-  /* Channel must be either CHANX or CHANY */
-  VTR_ASSERT( (CHANX == chan_type) || (CHANY == chan_type) );
-
-  /* Create a map between chan_type and module_prefix */
-  std::map<t_rr_type, std::string> module_prefix_map;
-  /* TODO: use a constexpr string to replace the fixed name? */
-  module_prefix_map[CHANX] = std::string("chanx");
-  module_prefix_map[CHANY] = std::string("chany");
-
-  return std::string( module_prefix_map[chan_type] + std::string("_") + std::to_string(block_id) + std::string("_") );
+  std::string module_name(get_chan_name_prefix(chan_type));
+  module_name += '_';
+  append_name_index(module_name, block_id);
+  module_name += '_';
+  return module_name;
 }
 
 /*********************************************************************
@@ -299,16 +360,12 @@ std::string generate_routing_channel_module_name(const t_rr_type& chan_type,
  *********************************************************************/
 std::string generate_routing_channel_module_name(const t_rr_type& chan_type, 
                                                  const vtr::Point<size_t>& coordinate) {
-  /* Channel must be either CHANX or CHANY */
-  VTR_ASSERT( (CHANX == chan_type) || (CHANY == chan_type) );
-
-  /* Create a map between chan_type and module_prefix */
-  std::map<t_rr_type, std::string> module_prefix_map;
-  /* TODO: use a constexpr string to replace the fixed name? */
-  module_prefix_map[CHANX] = std::string("chanx");
-  module_prefix_map[CHANY] = std::string("chany");
-
-  return std::string( module_prefix_map[chan_type] + std::to_string(coordinate.x()) + std::string("_") + std::to_string(coordinate.y()) + std::string("_") );
+  std::string module_name(get_chan_name_prefix(chan_type));
+  append_name_index(module_name, coordinate.x());
+  module_name += '_';
+  append_name_index(module_name, coordinate.y());
+  module_name += '_';
+  return module_name;
 }
 
 /*********************************************************************
@@ -321,24 +378,19 @@ std::string generate_routing_track_port_name(const t_rr_type& chan_type,
                                              const vtr::Point<size_t>& coordinate,
                                              const size_t& track_id,
                                              const PORTS& port_direction) {
-  /* Channel must be either CHANX or CHANY */
-  VTR_ASSERT( (CHANX == chan_type) || (CHANY == chan_type) );
-
-  /* Create a map between chan_type and module_prefix */
-  std::map<t_rr_type, std::string> module_prefix_map;
-  /* TODO: use a constexpr string to replace the fixed name? */
-  module_prefix_map[CHANX] = std::string("chanx");
-  module_prefix_map[CHANY] = std::string("chany");
-
-  std::string port_name = module_prefix_map[chan_type]; 
-  port_name += std::string("_" + std::to_string(coordinate.x()) + std::string("__") + std::to_string(coordinate.y()) + std::string("__"));
+  std::string port_name(get_chan_name_prefix(chan_type)); 
+  port_name += '_';
+  append_name_index(port_name, coordinate.x());
+  port_name += "__";
+  append_name_index(port_name, coordinate.y());
+  port_name += "__";
 
   switch (port_direction) {
   case OUT_PORT:
-    port_name += std::string("out_"); 
+    port_name += "out_"; 
     break;
   case IN_PORT:
-    port_name += std::string("in_"); 
+    port_name += "in_"; 
     break;
   default:
     VTR_LOG_ERROR("Invalid direction of chan_rr_node!\n");
@@ -346,7 +398,8 @@ std::string generate_routing_track_port_name(const t_rr_type& chan_type,
   }
 
   /* Add the track id to the port name */
-  port_name += std::to_string(track_id) + std::string("_");
+  append_name_index(port_name, track_id);
+  port_name += '_';
 
   return port_name;
 }
@@ -366,32 +419,43 @@ std::string generate_sb_module_track_port_name(const t_rr_type& chan_type,
   /* Channel must be either CHANX or CHANY */
   VTR_ASSERT( (CHANX == chan_type) || (CHANY == chan_type) );
 
-  /* Create a map between chan_type and module_prefix */
-  std::map<t_rr_type, std::string> module_prefix_map;
-  /* TODO: use a constexpr string to replace the fixed name? */
-  module_prefix_map[CHANX] = std::string("chanx");
-  module_prefix_map[CHANY] = std::string("chany");
-
-  std::string port_name = module_prefix_map[chan_type]; 
-  port_name += std::string("_");
-
-  SideManager side_manager(module_side);
-  port_name += std::string(side_manager.to_string());
-  port_name += std::string("_");
-
-  switch (port_direction) {
-  case OUT_PORT:
-    port_name += std::string("out"); 
-    break;
-  case IN_PORT:
-    port_name += std::string("in"); 
-    break;
-  default:
+  if ( (OUT_PORT != port_direction) && (IN_PORT != port_direction) ) {
     VTR_LOG_ERROR("Invalid direction of chan_rr_node!\n");
     exit(1);
   }
 
-  return port_name;
+  /* There are only a few port names, which are generated once
+   * and shared by all the switch blocks 
+   * Note that the static initialization is thread-safe
+   */
+  typedef std::array<std::array<std::array<std::string, 2>, NUM_SIDES>, 2> t_sb_track_port_names;
+  static const t_sb_track_port_names port_names = []() {
+    t_sb_track_port_names names;
+    for (const t_rr_type& name_chan_type : {CHANX, CHANY}) {
+      for (size_t side = 0; side < NUM_SIDES; ++side) {
+        for (const PORTS& name_direction : {IN_PORT, OUT_PORT}) {
+          std::string& port_name = names[CHANY == name_chan_type][side][OUT_PORT == name_direction];
+          port_name = get_chan_name_prefix(name_chan_type);
+          port_name += '_';
+          port_name += SideManager(side).to_string();
+          port_name += '_';
+          port_name += (OUT_PORT == name_direction) ? "out" : "in";
+        }
+      }
+    }
+    return names;
+  }();
+
+  if (NUM_SIDES <= size_t(module_side)) {
+    std::string port_name(get_chan_name_prefix(chan_type)); 
+    port_name += '_';
+    port_name += SideManager(module_side).to_string();
+    port_name += '_';
+    port_name += (OUT_PORT == port_direction) ? "out" : "in";
+    return port_name;
+  }
+
+  return port_names[CHANY == chan_type][size_t(module_side)][OUT_PORT == port_direction];
 }
 
 /*********************************************************************
@@ -419,30 +483,30 @@ std::string generate_cb_module_track_port_name(const t_rr_type& chan_type,
   /* Channel must be either CHANX or CHANY */
   VTR_ASSERT( (CHANX == chan_type) || (CHANY == chan_type) );
 
-  /* Create a map between chan_type and module_prefix */
-  std::map<t_rr_type, std::map<bool, std::string>> module_prefix_map;
-  /* TODO: use a constexpr string to replace the fixed name? */
-  module_prefix_map[CHANX][true] = std::string("chanx_left");
-  module_prefix_map[CHANX][false] = std::string("chanx_right");
-  module_prefix_map[CHANY][true] = std::string("chany_bottom");
-  module_prefix_map[CHANY][false] = std::string("chany_top");
-
-  std::string port_name = module_prefix_map[chan_type][upper_location];
-  port_name += std::string("_");
-
-  switch (port_direction) {
-  case OUT_PORT:
-    port_name += std::string("out"); 
-    break;
-  case IN_PORT:
-    port_name += std::string("in"); 
-    break;
-  default:
+  if ( (OUT_PORT != port_direction) && (IN_PORT != port_direction) ) {
     VTR_LOG_ERROR("Invalid direction of chan_rr_node!\n");
     exit(1);
   }
 
-  return port_name;
+  /* There are only a few port names, which are generated once
+   * and shared by all the connection blocks 
+   * Note that the static initialization is thread-safe
+   */
+  typedef std::array<std::array<std::array<std::string, 2>, 2>, 2> t_cb_track_port_names;
+  static const t_cb_track_port_names port_names = []() {
+    t_cb_track_port_names names;
+    const std::array<std::array<const char*, 2>, 2> module_prefixes = {{ {{"chanx_right", "chanx_left"}}, 
+                                                                         {{"chany_top", "chany_bottom"}} }};
+    for (size_t ichan = 0; ichan < 2; ++ichan) {
+      for (size_t iupper = 0; iupper < 2; ++iupper) {
+        names[ichan][iupper][0] = std::string(module_prefixes[ichan][iupper]) + "_in";
+        names[ichan][iupper][1] = std::string(module_prefixes[ichan][iupper]) + "_out";
+      }
+    }
+    return names;
+  }();
+
+  return port_names[CHANY == chan_type][true == upper_location][OUT_PORT == port_direction];
 }
 
 /*********************************************************************
@@ -452,22 +516,18 @@ std::string generate_cb_module_track_port_name(const t_rr_type& chan_type,
 std::string generate_routing_track_middle_output_port_name(const t_rr_type& chan_type, 
                                                            const vtr::Point<size_t>& coordinate,
                                                            const size_t& track_id) {
-  /* Channel must be either CHANX or CHANY */
-  VTR_ASSERT( (CHANX == chan_type) || (CHANY == chan_type) );
-
-  /* Create a map between chan_type and module_prefix */
-  std::map<t_rr_type, std::string> module_prefix_map;
-  /* TODO: use a constexpr string to replace the fixed name? */
-  module_prefix_map[CHANX] = std::string("chanx");
-  module_prefix_map[CHANY] = std::string("chany");
-
-  std::string port_name = module_prefix_map[chan_type]; 
-  port_name += std::string("_" + std::to_string(coordinate.x()) + std::string("__") + std::to_string(coordinate.y()) + std::string("__"));
+  std::string port_name(get_chan_name_prefix(chan_type)); 
+  port_name += '_';
+  append_name_index(port_name, coordinate.x());
+  port_name += "__";
+  append_name_index(port_name, coordinate.y());
+  port_name += "__";
 
-  port_name += std::string("midout_"); 
+  port_name += "midout_"; 
 
   /* Add the track id to the port name */
-  port_name += std::to_string(track_id) + std::string("_");
+  append_name_index(port_name, track_id);
+  port_name += '_';
 
   return port_name;
 }
@@ -476,7 +536,12 @@ std::string generate_routing_track_middle_output_port_name(const t_rr_type& chan
  * Generate the module name for a switch block with a given coordinate
  *********************************************************************/
 std::string generate_switch_block_module_name(const vtr::Point<size_t>& coordinate) {
-  return std::string( "sb_" + std::to_string(coordinate.x()) + std::string("__") + std::to_string(coordinate.y()) + std::string("_") );
+  std::string module_name("sb_");
+  append_name_index(module_name, coordinate.x());
+  module_name += "__";
+  append_name_index(module_name, coordinate.y());
+  module_name += '_';
+  return module_name;
 }
 
 /*********************************************************************
@@ -497,7 +562,12 @@ std::string generate_connection_block_module_name(const t_rr_type& cb_type,
     exit(1);
   }
 
-  return std::string( prefix + std::to_string(coordinate.x()) + std::string("__") + std::to_string(coordinate.y()) + std::string("_") );
+  append_name_index(prefix, coordinate.x());
+  prefix += "__";
+  append_name_index(prefix, coordinate.y());
+  prefix += '_';
+
+  return prefix;
 }
 
 /*********************************************************************
@@ -514,18 +584,18 @@ std::string generate_grid_port_name(const size_t& width,
   VTR_ASSERT(1 == pin_info.get_width());
 
   SideManager side_manager(side);
-  std::string port_name = std::string(side_manager.to_string());
-  port_name += std::string("_width_");
-  port_name += std::to_string(width);
-  port_name += std::string("_height_");
-  port_name += std::to_string(height);
-  port_name += std::string("_subtile_");
-  port_name += std::to_string(subtile_index);
-  port_name += std::string("__pin_");
+  std::string port_name = side_manager.to_string();
+  port_name += "_width_";
+  append_name_index(port_name, width);
+  port_name += "_height_";
+  append_name_index(port_name, height);
+  port_name += "_subtile_";
+  append_name_index(port_name, subtile_index);
+  port_name += "__pin_";
   port_name += pin_info.get_name();
-  port_name += std::string("_");
-  port_name += std::to_string(pin_info.get_lsb());
-  port_name += std::string("_");
+  port_name += '_';
+  append_name_index(port_name, pin_info.get_lsb());
+  port_name += '_';
   return port_name;
 }
 
@@ -545,18 +615,18 @@ std::string generate_grid_duplicated_port_name(const size_t& width,
   VTR_ASSERT(1 == pin_info.get_width());
 
   SideManager side_manager(side);
-  std::string port_name = std::string(side_manager.to_string());
-  port_name += std::string("_width_");
-  port_name += std::to_string(width);
-  port_name += std::string("_height_");
-  port_name += std::to_string(height);
-  port_name += std::string("_subtile_");
-  port_name += std::to_string(subtile_index);
-  port_name += std::string("__pin_");
+  std::string port_name = side_manager.to_string();
+  port_name += "_width_";
+  append_name_index(port_name, width);
+  port_name += "_height_";
+  append_name_index(port_name, height);
+  port_name += "_subtile_";
+  append_name_index(port_name, subtile_index);
+  port_name += "__pin_";
   port_name += pin_info.get_name();
-  port_name += std::string("_");
-  port_name += std::to_string(pin_info.get_lsb());
-  port_name += std::string("_");
+  port_name += '_';
+  append_name_index(port_name, pin_info.get_lsb());
+  port_name += '_';
 
   if (true == upper_port) {
     port_name += std::string("upper");
@@ -579,8 +649,9 @@ std::string generate_routing_module_grid_port_name(const size_t& width,
                                                    const e_side& side, 
                                                    const BasicPort& pin_info) {
   /* For non-top netlist */
-  std::string port_name = std::string("grid_");
-  return port_name + generate_grid_port_name(width, height, subtile_index, side, pin_info);
+  std::string port_name("grid_");
+  port_name += generate_grid_port_name(width, height, subtile_index, side, pin_info);
+  return port_name;
 }
 
 /*********************************************************************
@@ -994,7 +1065,8 @@ std::string generate_sb_mux_instance_name(const std::string& prefix,
                                           const std::string& postfix) {
   std::string instance_name(prefix);
   instance_name += SideManager(sb_side).to_string();
-  instance_name += std::string("_track_") + std::to_string(track_id);
+  instance_name += "_track_";
+  append_name_index(instance_name, track_id);
   instance_name += postfix;
 
   return instance_name;
@@ -1012,7 +1084,8 @@ std::string generate_sb_memory_instance_name(const std::string& prefix,
                                              const std::string& postfix) {
   std::string instance_name(prefix);
   instance_name += SideManager(sb_side).to_string();
-  instance_name += std::string("_track_") + std::to_string(track_id);
+  instance_name += "_track_";
+  append_name_index(instance_name, track_id);
   instance_name += postfix;
 
   return instance_name;
@@ -1032,7 +1105,8 @@ std::string generate_cb_mux_instance_name(const std::string& prefix,
   std::string instance_name(prefix);
 
   instance_name += SideManager(cb_side).to_string();
-  instance_name += std::string("_ipin_") + std::to_string(pin_id);
+  instance_name += "_ipin_";
+  append_name_index(instance_name, pin_id);
   instance_name += postfix;
 
   return instance_name;
@@ -1051,7 +1125,8 @@ std::string generate_cb_memory_instance_name(const std::string& prefix,
   std::string instance_name(prefix);
 
   instance_name += SideManager(cb_side).to_string();
-  instance_name += std::string("_ipin_") + std::to_string(pin_id);
+  instance_name += "_ipin_";
+  append_name_index(instance_name, pin_id);
   instance_name += postfix;
 
   return instance_name;
@@ -1076,14 +1151,14 @@ std::string generate_pb_mux_instance_name(const std::string& prefix,
   instance_name += std::string(pb_graph_pin->parent_node->pb_type->name);
 
   if (IN_PORT == pb_graph_pin->port->type) {
-    instance_name += std::string("_");
-    instance_name += std::to_string(pb_graph_pin->parent_node->placement_index);
+    instance_name += '_';
+    append_name_index(instance_name, pb_graph_pin->parent_node->placement_index);
   }
 
-  instance_name += std::string("_");
-  instance_name += std::string(pb_graph_pin->port->name);
-  instance_name += std::string("_");
-  instance_name += std::to_string(pb_graph_pin->pin_number);
+  instance_name += '_';
+  instance_name += pb_graph_pin->port->name;
+  instance_name += '_';
+  append_name_index(instance_name, pb_graph_pin->pin_number);
   instance_name += postfix;
 
   return instance_name;
@@ -1108,14 +1183,14 @@ std::string generate_pb_memory_instance_name(const std::string& prefix,
   instance_name += std::string(pb_graph_pin->parent_node->pb_type->name);
 
   if (IN_PORT == pb_graph_pin->port->type) {
-    instance_name += std::string("_");
-    instance_name += std::to_string(pb_graph_pin->parent_node->placement_index);
+    instance_name += '_';
+    append_name_index(instance_name, pb_graph_pin->parent_node->placement_index);
   }
 
-  instance_name += std::string("_");
-  instance_name += std::string(pb_graph_pin->port->name);
-  instance_name += std::string("_");
-  instance_name += std::to_string(pb_graph_pin->pin_number);
+  instance_name += '_';
+  instance_name += pb_graph_pin->port->name;
+  instance_name += '_';
+  append_name_index(instance_name, pb_graph_pin->pin_number);
   instance_name += postfix;
 
   return instance_name;
@@ -1132,11 +1207,11 @@ std::string generate_grid_block_instance_name(const std::string& prefix,
   std::string module_name(prefix);
 
   module_name += generate_grid_block_netlist_name(block_name, is_block_io, io_side, std::string());
-  module_name += std::string("_");
-  module_name += std::to_string(grid_coord.x());
-  module_name += std::string("__");
-  module_name += std::to_string(grid_coord.y());
-  module_name += std::string("_");
+  module_name += '_';
+  append_name_index(module_name, grid_coord.x());
+  module_name += "__";
+  append_name_index(module_name, grid_coord.y());
+  module_name += '_';
 
   return module_name;
 }
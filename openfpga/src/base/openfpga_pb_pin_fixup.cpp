@@ -6,6 +6,8 @@
 #include "vtr_time.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
+#include "vtr_parallel.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -18,6 +20,7 @@
 
 #include "pb_type_utils.h"
 #include "openfpga_physical_tile_utils.h"
+#include "command_option_utils.h"
 #include "openfpga_pb_pin_fixup.h"
 
 /* Include global variables of VPR */
@@ -26,19 +29,40 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/********************************************************************
+ * A clustered block to fix up, and the grid where it is placed
+ *******************************************************************/
+struct PbPinFixupLocation {
+  vtr::Point<size_t> grid_coord;
+  ClusterBlockId blk_id;
+  e_side border_side;
+};
+
+/********************************************************************
+ * The fix-ups found for a chunk of clustered blocks:
+ * the net to be mapped to each pin which should be updated,
+ * and the verbose outputs, both in the order of the blocks
+ *******************************************************************/
+struct PbPinFixupBatch {
+  std::vector<ClusterBlockId> blocks;
+  std::vector<int> pins;
+  std::vector<ClusterNetId> nets;
+  std::string verbose_log;
+};
+
 /********************************************************************
  * Fix up the pb pin mapping results for a given clustered block
  * 1. For each input/output pin of a clustered pb, 
  *    - find a corresponding node in RRGraph object
  *    - find the net id for the node in routing context
  *    - find the net id for the node in clustering context
- *    - if the net id does not match, we update the clustering context
+ *    - if the net id does not match, we record an update of the clustering context
  *******************************************************************/
 static 
 void update_cluster_pin_with_post_routing_results(const DeviceContext& device_ctx,
                                                   const ClusteringContext& clustering_ctx,
                                                   const VprRoutingAnnotation& vpr_routing_annotation,
-                                                  VprClusteringAnnotation& vpr_clustering_annotation,
+                                                  PbPinFixupBatch& fixup_batch,
                                                   const vtr::Point<size_t>& grid_coord,
                                                   const ClusterBlockId& blk_id,
                                                   const e_side& border_side,
@@ -104,47 +128,49 @@ void update_cluster_pin_with_post_routing_results(const DeviceContext& device_ct
     if ( (ClusterNetId::INVALID() != cluster_net_id)
       && (ClusterNetId::INVALID() == routing_net_id)
       && (true == clustering_ctx.clb_nlist.net_is_ignored(cluster_net_id))) {
-      VTR_LOGV(verbose,
-               "Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s.%s[%d]' as it is not routed\n",
-               clustering_ctx.clb_nlist.block_pb(blk_id)->name,
-               grid_coord.x(), grid_coord.y(),
-               clustering_ctx.clb_nlist.block_pb(blk_id)->pb_graph_node->pb_type->name,
-               get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->port->name,
-               get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->pin_number
-               );
+      if (true == verbose) {
+        fixup_batch.verbose_log += vtr::string_fmt("Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s.%s[%d]' as it is not routed\n",
+                                                   clustering_ctx.clb_nlist.block_pb(blk_id)->name,
+                                                   grid_coord.x(), grid_coord.y(),
+                                                   clustering_ctx.clb_nlist.block_pb(blk_id)->pb_graph_node->pb_type->name,
+                                                   get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->port->name,
+                                                   get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->pin_number);
+      }
       continue;
     }
 
     /* Ignore used in local cluster only, reserved one CLB pin */
     if ( (ClusterNetId::INVALID() != cluster_net_id)
       && (0 == clustering_ctx.clb_nlist.net_sinks(cluster_net_id).size())) {
-      VTR_LOGV(verbose,
-               "Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s.%s[%d]' as it is a local net inside the cluster\n",
-               clustering_ctx.clb_nlist.block_pb(blk_id)->name,
-               grid_coord.x(), grid_coord.y(),
-               clustering_ctx.clb_nlist.block_pb(blk_id)->pb_graph_node->pb_type->name,
-               get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->port->name,
-               get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->pin_number
-               );
+      if (true == verbose) {
+        fixup_batch.verbose_log += vtr::string_fmt("Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s.%s[%d]' as it is a local net inside the cluster\n",
+                                                   clustering_ctx.clb_nlist.block_pb(blk_id)->name,
+                                                   grid_coord.x(), grid_coord.y(),
+                                                   clustering_ctx.clb_nlist.block_pb(blk_id)->pb_graph_node->pb_type->name,
+                                                   get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->port->name,
+                                                   get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->pin_number);
+      }
       continue;
     }
 
     /* If matched, we finish here */
     if (routing_net_id == cluster_net_id) {
-     VTR_LOGV(verbose,
-               "Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s.%s[%d]' as it matches cluster routing\n",
-               clustering_ctx.clb_nlist.block_pb(blk_id)->name,
-               grid_coord.x(), grid_coord.y(),
-               clustering_ctx.clb_nlist.block_pb(blk_id)->pb_graph_node->pb_type->name,
-               get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->port->name,
-               get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->pin_number
-               );
+      if (true == verbose) {
+        fixup_batch.verbose_log += vtr::string_fmt("Bypass net at clustered block '%s' pin 'grid[%ld][%ld].%s.%s[%d]' as it matches cluster routing\n",
+                                                   clustering_ctx.clb_nlist.block_pb(blk_id)->name,
+                                                   grid_coord.x(), grid_coord.y(),
+                                                   clustering_ctx.clb_nlist.block_pb(blk_id)->pb_graph_node->pb_type->name,
+                                                   get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->port->name,
+                                                   get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->pin_number);
+      }
       continue;
     }
 
     /* Add to net modification */
-    vpr_clustering_annotation.rename_net(blk_id, j, routing_net_id);
- 
+    fixup_batch.blocks.push_back(blk_id);
+    fixup_batch.pins.push_back(j);
+    fixup_batch.nets.push_back(routing_net_id);
+
     std::string routing_net_name("unmapped");
     if (ClusterNetId::INVALID() != routing_net_id) {
       routing_net_name = clustering_ctx.clb_nlist.net_name(routing_net_id);
@@ -155,22 +181,27 @@ void update_cluster_pin_with_post_routing_results(const DeviceContext& device_ct
       cluster_net_name = clustering_ctx.clb_nlist.net_name(cluster_net_id);
     }
 
-    VTR_LOGV(verbose,
-             "Fixed up net '%s' mapping mismatch at clustered block '%s' pin 'grid[%ld][%ld].%s.%s[%d]' (was net '%s')\n",
-             routing_net_name.c_str(),
-             clustering_ctx.clb_nlist.block_pb(blk_id)->name,
-             grid_coord.x(), grid_coord.y(),
-             clustering_ctx.clb_nlist.block_pb(blk_id)->pb_graph_node->pb_type->name,
-             get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->port->name,
-             get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->pin_number,
-             cluster_net_name.c_str()
-             );
+    if (true == verbose) {
+      fixup_batch.verbose_log += vtr::string_fmt("Fixed up net '%s' mapping mismatch at clustered block '%s' pin 'grid[%ld][%ld].%s.%s[%d]' (was net '%s')\n",
+                                                 routing_net_name.c_str(),
+                                                 clustering_ctx.clb_nlist.block_pb(blk_id)->name,
+                                                 grid_coord.x(), grid_coord.y(),
+                                                 clustering_ctx.clb_nlist.block_pb(blk_id)->pb_graph_node->pb_type->name,
+                                                 get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->port->name,
+                                                 get_pb_graph_node_pin_from_block_pin(blk_id, physical_pin)->pin_number,
+                                                 cluster_net_name.c_str());
+    }
   }
 }
 
 /********************************************************************
  * Main function to fix up the pb pin mapping results 
  * This function will walk through each grid
+ * The clustered blocks are fixed up by chunks in parallel,
+ * as each of them only requires read-only accesses to the contexts.
+ * The fix-ups are then applied to the clustering annotation
+ * in the order of the blocks, so that the results and the verbose outputs
+ * are the same whatever the number of threads
  *******************************************************************/
 static 
 void update_pb_pin_with_post_routing_results(const DeviceContext& device_ctx,
@@ -178,7 +209,10 @@ void update_pb_pin_with_post_routing_results(const DeviceContext& device_ctx,
                                              const PlacementContext& placement_ctx,
                                              const VprRoutingAnnotation& vpr_routing_annotation,
                                              VprClusteringAnnotation& vpr_clustering_annotation,
+                                             const size_t& num_jobs,
                                              const bool& verbose) {
+  std::vector<PbPinFixupLocation> fixup_locations;
+
   /* Update the core logic (center blocks of the FPGA) */
   for (size_t x = 1; x < device_ctx.grid.width() - 1; ++x) {
     for (size_t y = 1; y < device_ctx.grid.height() - 1; ++y) {
@@ -193,13 +227,7 @@ void update_pb_pin_with_post_routing_results(const DeviceContext& device_ctx,
           continue;
         }
         /* We know the entrance to grid info and mapping results, do the fix-up for this block */
-        vtr::Point<size_t> grid_coord(x, y);
-        update_cluster_pin_with_post_routing_results(device_ctx, clustering_ctx, 
-                                                     vpr_routing_annotation,
-                                                     vpr_clustering_annotation,
-                                                     grid_coord, cluster_blk_id, NUM_SIDES,
-                                                     placement_ctx.block_locs[cluster_blk_id].loc.z,
-                                                     verbose);
+        fixup_locations.push_back({vtr::Point<size_t>(x, y), cluster_blk_id, NUM_SIDES});
       } 
     }
   }
@@ -242,15 +270,39 @@ void update_pb_pin_with_post_routing_results(const DeviceContext& device_ctx,
           continue;
         }
         /* Update on I/O grid */
-        update_cluster_pin_with_post_routing_results(device_ctx, clustering_ctx, 
-                                                     vpr_routing_annotation,
-                                                     vpr_clustering_annotation,
-                                                     io_coord, cluster_blk_id, io_side,
-                                                     placement_ctx.block_locs[cluster_blk_id].loc.z,
-                                                     verbose);
+        fixup_locations.push_back({io_coord, cluster_blk_id, io_side});
       }
     }
   }
+
+  /* The fast look-up of the routing resource graph must be built before the parallel region */
+  device_ctx.rr_graph.initialize_fast_node_lookup();
+
+  std::vector<PbPinFixupBatch> fixup_batches(vtr::num_parallel_chunks(fixup_locations.size(), num_jobs));
+
+  vtr::parallel_for_chunks(fixup_locations.size(), num_jobs, [&](size_t ichunk, size_t begin, size_t end) {
+    for (size_t iloc = begin; iloc < end; ++iloc) {
+      const PbPinFixupLocation& fixup_location = fixup_locations[iloc];
+      update_cluster_pin_with_post_routing_results(device_ctx, clustering_ctx, 
+                                                   vpr_routing_annotation,
+                                                   fixup_batches[ichunk],
+                                                   fixup_location.grid_coord,
+                                                   fixup_location.blk_id,
+                                                   fixup_location.border_side,
+                                                   placement_ctx.block_locs[fixup_location.blk_id].loc.z,
+                                                   verbose);
+    }
+  });
+
+  /* Apply the fix-ups in the order of the blocks */
+  for (const PbPinFixupBatch& fixup_batch : fixup_batches) {
+    VTR_LOGV(verbose, "%s", fixup_batch.verbose_log.c_str());
+    for (size_t ifixup = 0; ifixup < fixup_batch.blocks.size(); ++ifixup) {
+      vpr_clustering_annotation.rename_net(fixup_batch.blocks[ifixup],
+                                           fixup_batch.pins[ifixup],
+                                           fixup_batch.nets[ifixup]);
+    }
+  }
 }
 
 /********************************************************************
@@ -271,12 +323,18 @@ int pb_pin_fixup(OpenfpgaContext& openfpga_context,
 
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  size_t num_jobs = 1;
+  if (CMD_EXEC_SUCCESS != read_num_jobs_option(cmd, cmd_context, num_jobs)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   /* Apply fix-up to each grid */
   update_pb_pin_with_post_routing_results(g_vpr_ctx.device(),
                                           g_vpr_ctx.clustering(),
                                           g_vpr_ctx.placement(), 
                                           openfpga_context.vpr_routing_annotation(),
                                           openfpga_context.mutable_vpr_clustering_annotation(),
+                                          num_jobs,
                                           cmd_context.option_enable(cmd, opt_verbose));
 
   /* TODO: should identify the error code from internal function execution */
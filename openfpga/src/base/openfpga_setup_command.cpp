@@ -268,6 +268,10 @@ ShellCommandId add_openfpga_pb_pin_fixup_command(openfpga::Shell<OpenfpgaContext
 
   Command shell_cmd("pb_pin_fixup");
 
+  /* Add an option '--jobs' */
+  CommandOptionId opt_jobs = shell_cmd.add_option("jobs", false, "Number of threads used to fix up the clustered blocks (0: all the cores). By default, 1");
+  shell_cmd.set_option_require_value(opt_jobs, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -293,6 +297,11 @@ ShellCommandId add_openfpga_lut_truth_table_fixup_command(openfpga::Shell<Openfp
                                                           const std::vector<ShellCommandId>& dependent_cmds) {
 
   Command shell_cmd("lut_truth_table_fixup");
+
+  /* Add an option '--jobs' */
+  CommandOptionId opt_jobs = shell_cmd.add_option("jobs", false, "Number of threads used to fix up the clustered blocks (0: all the cores). By default, 1");
+  shell_cmd.set_option_require_value(opt_jobs, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -325,6 +334,9 @@ ShellCommandId add_openfpga_build_fabric_command(openfpga::Shell<OpenfpgaContext
   /* Add an option '--compress_routing' */
   shell_cmd.add_option("compress_routing", false, "Compress the number of unique routing modules by identifying the unique GSBs");
 
+  /* Add an option '--rotatable_sb' */
+  shell_cmd.add_option("rotatable_sb", false, "Further compress the unique switch blocks by identifying the ones which are rotations or reflections of each other, e.g., from 9 to 6 on a 4x4 fabric with the subset pattern and none with the wilton pattern. Require '--compress_routing'");
+
   /* Add an option '--duplicate_grid_pin' */
   shell_cmd.add_option("duplicate_grid_pin", false, "Duplicate the pins on the same side of a grid");
 
@@ -339,6 +351,10 @@ ShellCommandId add_openfpga_build_fabric_command(openfpga::Shell<OpenfpgaContext
   /* Add an option '--generate_random_fabric_key' */
   shell_cmd.add_option("generate_random_fabric_key", false, "Create a random fabric key which will shuffle the memory address for encryption purpose");
 
+  /* Add an option '--jobs' */
+  CommandOptionId opt_jobs = shell_cmd.add_option("jobs", false, "Number of threads used to build the routing modules (0: all the cores). By default, 1");
+  shell_cmd.set_option_require_value(opt_jobs, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
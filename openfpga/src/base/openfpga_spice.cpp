@@ -9,6 +9,7 @@
 #include "command_exit_codes.h"
 
 #include "spice_api.h"
+#include "command_option_utils.h"
 #include "openfpga_spice.h"
 
 /* Include global variables of VPR */
@@ -35,6 +36,11 @@ int write_fabric_spice(OpenfpgaContext& openfpga_ctx,
   options.set_explicit_port_mapping(cmd_context.option_enable(cmd, opt_explicit_port_mapping));
   options.set_verbose_output(cmd_context.option_enable(cmd, opt_verbose));
   options.set_compress_routing(openfpga_ctx.flow_manager().compress_routing());
+  size_t num_jobs = 1;
+  if (CMD_EXEC_SUCCESS != read_num_jobs_option(cmd, cmd_context, num_jobs)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  options.set_num_jobs(num_jobs);
   
   int status = CMD_EXEC_SUCCESS;
   status = fpga_fabric_spice(openfpga_ctx.module_graph(),
@@ -38,6 +38,10 @@ ShellCommandId add_openfpga_write_fabric_spice_command(openfpga::Shell<OpenfpgaC
   /* Add an option '--explicit_port_mapping' */
   shell_cmd.add_option("explicit_port_mapping", false, "Use explicit port mapping in Verilog netlists");
 
+  /* Add an option '--jobs' */
+  CommandOptionId opt_jobs = shell_cmd.add_option("jobs", false, "Number of threads used to write the routing and grid netlists (0: all the cores). By default, 1");
+  shell_cmd.set_option_require_value(opt_jobs, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
   
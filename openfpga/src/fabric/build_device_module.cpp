@@ -39,6 +39,7 @@ int build_device_module_graph(ModuleManager& module_manager,
                               const bool& duplicate_grid_pin,
                               const FabricKey& fabric_key,
                               const bool& generate_random_fabric_key,
+                              const size_t& num_jobs,
                               const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build fabric module graph");
 
@@ -97,7 +98,7 @@ int build_device_module_graph(ModuleManager& module_manager,
                                  openfpga_ctx.device_rr_gsb(),
                                  openfpga_ctx.arch().circuit_lib,
                                  openfpga_ctx.arch().config_protocol.type(),
-                                 sram_model, verbose);
+                                 sram_model, num_jobs, verbose);
   } else {
     VTR_ASSERT_SAFE(false == compress_routing);
     build_flatten_routing_modules(module_manager,
@@ -107,7 +108,7 @@ int build_device_module_graph(ModuleManager& module_manager,
                                   openfpga_ctx.device_rr_gsb(),
                                   openfpga_ctx.arch().circuit_lib,
                                   openfpga_ctx.arch().config_protocol.type(),
-                                  sram_model, verbose);
+                                  sram_model, num_jobs, verbose);
   }
 
   /* Build FPGA fabric top-level module */
@@ -125,7 +126,8 @@ int build_device_module_graph(ModuleManager& module_manager,
                             openfpga_ctx.arch().config_protocol,
                             sram_model,
                             frame_view, compress_routing, duplicate_grid_pin,
-                            fabric_key, generate_random_fabric_key);
+                            fabric_key, generate_random_fabric_key,
+                            num_jobs);
 
   if (CMD_EXEC_FATAL_ERROR == status) {
     return status;
@@ -140,6 +142,11 @@ int build_device_module_graph(ModuleManager& module_manager,
    */
   rename_primitive_module_port_names(module_manager, openfpga_ctx.arch().circuit_lib);
 
+  /* All the nets are built: store them compactly */
+  for (const ModuleId& module : module_manager.modules()) {
+    module_manager.compact_module_nets(module);
+  }
+
   return status;
 }
 
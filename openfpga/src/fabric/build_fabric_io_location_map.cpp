@@ -35,6 +35,27 @@ IoLocationMap build_fabric_io_location_map(const ModuleManager& module_manager,
 
   IoLocationMap io_location_map;
 
+  std::string top_module_name = generate_fpga_top_module_name();
+  ModuleId top_module = module_manager.find_module(top_module_name);
+  VTR_ASSERT(true == module_manager.valid_module_id(top_module));
+
+  /* Size the look-up for the whole fabric and all the GPIO ports upfront */
+  int max_capacity = 0;
+  for (size_t ix = 0; ix < grids.width(); ++ix) {
+    for (size_t iy = 0; iy < grids.height(); ++iy) {
+      max_capacity = std::max(max_capacity, grids[ix][iy].type->capacity);
+    }
+  }
+  std::vector<BasicPort> top_io_ports;
+  for (const ModuleManager::e_module_port_type& module_io_port_type : MODULE_IO_PORT_TYPES) {
+    for (const ModulePortId& gpio_port_id : module_manager.module_port_ids_by_type(top_module, module_io_port_type)) {
+      if (true == module_manager.port_is_mappable_io(top_module, gpio_port_id)) {
+        top_io_ports.push_back(module_manager.module_port(top_module, gpio_port_id));
+      }
+    }
+  }
+  io_location_map.reserve(grids.width(), grids.height(), max_capacity, top_io_ports);
+
   std::map<std::string, size_t> io_counter;
 
   /* Create the coordinate range for each side of FPGA fabric */
@@ -159,10 +180,6 @@ IoLocationMap build_fabric_io_location_map(const ModuleManager& module_manager,
   }
 
   /* Check all the GPIO ports in the top-level module has been mapped */
-  std::string top_module_name = generate_fpga_top_module_name();
-  ModuleId top_module = module_manager.find_module(top_module_name);
-  VTR_ASSERT(true == module_manager.valid_module_id(top_module));
-
   for (const ModuleManager::e_module_port_type& module_io_port_type : MODULE_IO_PORT_TYPES) {
     for (const ModulePortId& gpio_port_id : module_manager.module_port_ids_by_type(top_module, module_io_port_type)) {
       /* Only care mappable I/O */
@@ -172,6 +189,15 @@ IoLocationMap build_fabric_io_location_map(const ModuleManager& module_manager,
       
       const BasicPort& gpio_port = module_manager.module_port(top_module, gpio_port_id);
       VTR_ASSERT(io_counter[gpio_port.get_name()] == gpio_port.get_width());
+
+      /* Each GPIO pin should be reachable from its location, and vice versa */
+      size_t io_port_id = io_location_map.io_port_id(gpio_port.get_name());
+      VTR_ASSERT(io_location_map.num_io_indices(io_port_id) == gpio_port.get_width());
+      for (size_t io_index = 0; io_index < gpio_port.get_width(); ++io_index) {
+        size_t io_x, io_y, io_z;
+        VTR_ASSERT(true == io_location_map.io_location(io_port_id, io_index, io_x, io_y, io_z));
+        VTR_ASSERT(io_index == io_location_map.io_index(io_x, io_y, io_z, io_port_id));
+      }
     }
   }
 
@@ -6,12 +6,14 @@
  * 2. Switch blocks
  *******************************************************************/
 #include <vector>
+#include <functional>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_geometry.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
+#include "vtr_parallel.h"
 
 /* Headers from openfpgautil library */
 #include "openfpga_side_manager.h"
@@ -20,6 +22,7 @@
 #include "openfpga_naming.h"
 
 #include "rr_gsb_utils.h"
+#include "device_rr_gsb_utils.h"
 #include "openfpga_rr_graph_utils.h"
 #include "module_manager_utils.h"
 #include "build_module_graph_utils.h"
@@ -333,16 +336,16 @@ void build_switch_block_interc_modules(ModuleManager& module_manager,
  *
  ********************************************************************/
 static 
-void build_switch_block_module(ModuleManager& module_manager, 
-                               DecoderLibrary& decoder_lib,
-                               const VprDeviceAnnotation& device_annotation,
-                               const DeviceGrid& grids,
-                               const RRGraph& rr_graph,
-                               const CircuitLibrary& circuit_lib,
-                               const e_config_protocol_type& sram_orgz_type,
-                               const CircuitModelId& sram_model,
-                               const RRGSB& rr_gsb,
-                               const bool& verbose) {
+ModuleId build_switch_block_module(ModuleManager& module_manager, 
+                                   DecoderLibrary& decoder_lib,
+                                   const VprDeviceAnnotation& device_annotation,
+                                   const DeviceGrid& grids,
+                                   const RRGraph& rr_graph,
+                                   const CircuitLibrary& circuit_lib,
+                                   const e_config_protocol_type& sram_orgz_type,
+                                   const CircuitModelId& sram_model,
+                                   const RRGSB& rr_gsb,
+                                   const bool& verbose) {
   /* Create a Module of Switch Block and add to module manager */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
   ModuleId sb_module = module_manager.add_module(generate_switch_block_module_name(gsb_coordinate)); 
@@ -475,6 +478,8 @@ void build_switch_block_module(ModuleManager& module_manager,
   }
 
   VTR_LOGV(verbose, "Done\n");
+
+  return sb_module;
 }
 
 /*********************************************************************
@@ -741,17 +746,17 @@ void build_connection_block_interc_modules(ModuleManager& module_manager,
  *              
  ********************************************************************/
 static 
-void build_connection_block_module(ModuleManager& module_manager, 
-                                   DecoderLibrary& decoder_lib,
-                                   const VprDeviceAnnotation& device_annotation,
-                                   const DeviceGrid& grids,
-                                   const RRGraph& rr_graph,
-                                   const CircuitLibrary& circuit_lib, 
-                                   const e_config_protocol_type& sram_orgz_type, 
-                                   const CircuitModelId& sram_model, 
-                                   const RRGSB& rr_gsb,
-                                   const t_rr_type& cb_type,
-                                   const bool& verbose) {
+ModuleId build_connection_block_module(ModuleManager& module_manager, 
+                                       DecoderLibrary& decoder_lib,
+                                       const VprDeviceAnnotation& device_annotation,
+                                       const DeviceGrid& grids,
+                                       const RRGraph& rr_graph,
+                                       const CircuitLibrary& circuit_lib, 
+                                       const e_config_protocol_type& sram_orgz_type, 
+                                       const CircuitModelId& sram_model, 
+                                       const RRGSB& rr_gsb,
+                                       const t_rr_type& cb_type,
+                                       const bool& verbose) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_cb_x(cb_type), rr_gsb.get_cb_y(cb_type));
 
@@ -903,9 +908,80 @@ void build_connection_block_module(ModuleManager& module_manager,
   }
 
   VTR_LOGV(verbose, "Done\n");
+
+  return cb_module;
 }
 
 
+/********************************************************************
+ * Build a list of routing modules with a given number of threads.
+ * build_module(module_manager, decoder_lib, imodule, verbose) should
+ * build the imodule-th routing module and return its id.
+ *
+ * The list is split into contiguous chunks, one per thread.
+ * The first chunk is built in the module manager itself, while the
+ * other chunks are built in fragments, which only include the names
+ * and ports of the existing modules and are created before any thread starts.
+ * The modules of the fragments are then merged into the module manager
+ * in the order of the list, so that the module ids are the same as in a serial build.
+ *
+ * Frame-based memories create decoder modules when building the routing
+ * modules, which cannot be merged from fragments. In this case, or when
+ * there is a single thread, the modules are built one by one.
+ *******************************************************************/
+static 
+void build_routing_module_list(ModuleManager& module_manager,
+                               DecoderLibrary& decoder_lib,
+                               const e_config_protocol_type& sram_orgz_type,
+                               const size_t& num_modules,
+                               const size_t& num_jobs,
+                               const bool& verbose,
+                               const std::function<ModuleId(ModuleManager&, DecoderLibrary&, const size_t&, const bool&)>& build_module) {
+  size_t num_chunks = vtr::num_parallel_chunks(num_modules, num_jobs);
+
+  if ( (CONFIG_MEM_FRAME_BASED == sram_orgz_type)
+    || (1 == num_chunks) ) {
+    for (size_t imodule = 0; imodule < num_modules; ++imodule) {
+      build_module(module_manager, decoder_lib, imodule, verbose);
+    }
+    return;
+  }
+
+  std::vector<ModuleManager> fragments;
+  fragments.reserve(num_chunks - 1);
+  for (size_t ichunk = 1; ichunk < num_chunks; ++ichunk) {
+    fragments.push_back(module_manager.create_fragment());
+  }
+  /* Other protocols than frame-based memories never add decoders here */
+  std::vector<DecoderLibrary> fragment_decoder_libs(num_chunks - 1);
+  std::vector<std::vector<ModuleId>> chunk_modules(num_chunks);
+
+  /* Verbose outputs of the threads would interleave: they are printed after merging */
+  vtr::parallel_for_chunks(num_modules, num_chunks, [&](size_t ichunk, size_t begin, size_t end) {
+    ModuleManager& chunk_module_manager = (0 == ichunk) ? module_manager : fragments[ichunk - 1];
+    DecoderLibrary& chunk_decoder_lib = (0 == ichunk) ? decoder_lib : fragment_decoder_libs[ichunk - 1];
+    for (size_t imodule = begin; imodule < end; ++imodule) {
+      chunk_modules[ichunk].push_back(build_module(chunk_module_manager, chunk_decoder_lib, imodule, false));
+    }
+  });
+
+  for (size_t ichunk = 1; ichunk < num_chunks; ++ichunk) {
+    VTR_ASSERT(0 == fragment_decoder_libs[ichunk - 1].decoders().size());
+    for (ModuleId& module : chunk_modules[ichunk]) {
+      module = module_manager.add_module_from_fragment(fragments[ichunk - 1], module);
+      VTR_ASSERT(true == module_manager.valid_module_id(module));
+    }
+  }
+
+  for (const std::vector<ModuleId>& modules : chunk_modules) {
+    for (const ModuleId& module : modules) {
+      VTR_LOGV(verbose,
+               "Building module '%s'...Done\n",
+               module_manager.module_name(module).c_str());
+    }
+  }
+}
+
 /********************************************************************
  * Iterate over all the connection blocks in a device
  * and build a module for each of them 
@@ -920,31 +996,24 @@ void build_flatten_connection_block_modules(ModuleManager& module_manager,
                                             const e_config_protocol_type& sram_orgz_type,
                                             const CircuitModelId& sram_model,
                                             const t_rr_type& cb_type,
+                                            const size_t& num_jobs,
                                             const bool& verbose) {
-  /* Build unique X-direction connection block modules */
-  vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
-
-  for (size_t ix = 0; ix < cb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < cb_range.y(); ++iy) {
-      /* Check if the connection block exists in the device!
-       * Some of them do NOT exist due to heterogeneous blocks (height > 1) 
-       * We will skip those modules
-       */
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
-      if (false == rr_gsb.is_cb_exist(cb_type)) {
-        continue;
-      }
-      build_connection_block_module(module_manager, 
-                                    decoder_lib,
-                                    device_annotation,
-                                    device_ctx.grid,
-                                    device_ctx.rr_graph,
-                                    circuit_lib, 
-                                    sram_orgz_type, sram_model, 
-                                    rr_gsb, cb_type,
-                                    verbose);
-    }
-  }
+  std::vector<const RRGSB*> rr_gsbs = find_device_rr_gsbs_with_module(device_rr_gsb, false, cb_type);
+
+  build_routing_module_list(module_manager, decoder_lib, sram_orgz_type,
+                            rr_gsbs.size(), num_jobs, verbose,
+                            [&](ModuleManager& curr_module_manager, DecoderLibrary& curr_decoder_lib,
+                                const size_t& imodule, const bool& curr_verbose) {
+    return build_connection_block_module(curr_module_manager, 
+                                         curr_decoder_lib,
+                                         device_annotation,
+                                         device_ctx.grid,
+                                         device_ctx.rr_graph,
+                                         circuit_lib, 
+                                         sram_orgz_type, sram_model, 
+                                         *rr_gsbs[imodule], cb_type,
+                                         curr_verbose);
+  });
 }
 
 /********************************************************************
@@ -964,30 +1033,28 @@ void build_flatten_routing_modules(ModuleManager& module_manager,
                                    const CircuitLibrary& circuit_lib,
                                    const e_config_protocol_type& sram_orgz_type,
                                    const CircuitModelId& sram_model,
+                                   const size_t& num_jobs,
                                    const bool& verbose) {
 
   vtr::ScopedStartFinishTimer timer("Build routing modules...");
 
-  vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
-
   /* Build unique switch block modules */
-  for (size_t ix = 0; ix < sb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < sb_range.y(); ++iy) {
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
-      if (false == rr_gsb.is_sb_exist()) {
-        continue;
-      }
-      build_switch_block_module(module_manager,
-                                decoder_lib,
-                                device_annotation,
-                                device_ctx.grid,
-                                device_ctx.rr_graph,
-                                circuit_lib, 
-                                sram_orgz_type, sram_model, 
-                                rr_gsb,
-                                verbose);
-    }
-  }
+  std::vector<const RRGSB*> sb_rr_gsbs = find_device_rr_gsbs_with_module(device_rr_gsb, true, NUM_RR_TYPES);
+
+  build_routing_module_list(module_manager, decoder_lib, sram_orgz_type,
+                            sb_rr_gsbs.size(), num_jobs, verbose,
+                            [&](ModuleManager& curr_module_manager, DecoderLibrary& curr_decoder_lib,
+                                const size_t& imodule, const bool& curr_verbose) {
+    return build_switch_block_module(curr_module_manager,
+                                     curr_decoder_lib,
+                                     device_annotation,
+                                     device_ctx.grid,
+                                     device_ctx.rr_graph,
+                                     circuit_lib, 
+                                     sram_orgz_type, sram_model, 
+                                     *sb_rr_gsbs[imodule],
+                                     curr_verbose);
+  });
 
   build_flatten_connection_block_modules(module_manager,
                                          decoder_lib,
@@ -997,6 +1064,7 @@ void build_flatten_routing_modules(ModuleManager& module_manager,
                                          circuit_lib, 
                                          sram_orgz_type, sram_model, 
                                          CHANX,
+                                         num_jobs,
                                          verbose);
 
   build_flatten_connection_block_modules(module_manager,
@@ -1007,6 +1075,7 @@ void build_flatten_routing_modules(ModuleManager& module_manager,
                                          circuit_lib,
                                          sram_orgz_type, sram_model, 
                                          CHANY,
+                                         num_jobs,
                                          verbose);
 }
 
@@ -1029,52 +1098,43 @@ void build_unique_routing_modules(ModuleManager& module_manager,
                                   const CircuitLibrary& circuit_lib,
                                   const e_config_protocol_type& sram_orgz_type,
                                   const CircuitModelId& sram_model,
+                                  const size_t& num_jobs,
                                   const bool& verbose) {
 
   vtr::ScopedStartFinishTimer timer("Build unique routing modules...");
 
   /* Build unique switch block modules */
-  for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(isb);
-    build_switch_block_module(module_manager,
-                              decoder_lib,
-                              device_annotation,
-                              device_ctx.grid,
-                              device_ctx.rr_graph,
-                              circuit_lib, 
-                              sram_orgz_type, sram_model, 
-                              unique_mirror,
-                              verbose);
-  }
-
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANX); ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANX, icb);
-
-    build_connection_block_module(module_manager, 
-                                  decoder_lib,
-                                  device_annotation,
-                                  device_ctx.grid,
-                                  device_ctx.rr_graph,
-                                  circuit_lib,  
-                                  sram_orgz_type, sram_model, 
-                                  unique_mirror, CHANX,
-                                  verbose);
-  }
-
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANY); ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANY, icb);
-
-    build_connection_block_module(module_manager, 
-                                  decoder_lib,
-                                  device_annotation,
-                                  device_ctx.grid,
-                                  device_ctx.rr_graph,
-                                  circuit_lib, 
-                                  sram_orgz_type, sram_model, 
-                                  unique_mirror, CHANY,
-                                  verbose);
+  build_routing_module_list(module_manager, decoder_lib, sram_orgz_type,
+                            device_rr_gsb.get_num_sb_unique_module(), num_jobs, verbose,
+                            [&](ModuleManager& curr_module_manager, DecoderLibrary& curr_decoder_lib,
+                                const size_t& isb, const bool& curr_verbose) {
+    return build_switch_block_module(curr_module_manager,
+                                     curr_decoder_lib,
+                                     device_annotation,
+                                     device_ctx.grid,
+                                     device_ctx.rr_graph,
+                                     circuit_lib, 
+                                     sram_orgz_type, sram_model, 
+                                     device_rr_gsb.get_sb_unique_module(isb),
+                                     curr_verbose);
+  });
+
+  /* Build unique X-direction and Y-direction connection block modules */
+  for (const t_rr_type& cb_type : {CHANX, CHANY}) {
+    build_routing_module_list(module_manager, decoder_lib, sram_orgz_type,
+                              device_rr_gsb.get_num_cb_unique_module(cb_type), num_jobs, verbose,
+                              [&](ModuleManager& curr_module_manager, DecoderLibrary& curr_decoder_lib,
+                                  const size_t& icb, const bool& curr_verbose) {
+      return build_connection_block_module(curr_module_manager, 
+                                           curr_decoder_lib,
+                                           device_annotation,
+                                           device_ctx.grid,
+                                           device_ctx.rr_graph,
+                                           circuit_lib,  
+                                           sram_orgz_type, sram_model, 
+                                           device_rr_gsb.get_cb_unique_module(cb_type, icb), cb_type,
+                                           curr_verbose);
+    });
   }
 }
 
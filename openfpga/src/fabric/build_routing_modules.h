@@ -27,6 +27,7 @@ void build_flatten_routing_modules(ModuleManager& module_manager,
                                    const CircuitLibrary& circuit_lib,
                                    const e_config_protocol_type& sram_orgz_type,
                                    const CircuitModelId& sram_model,
+                                   const size_t& num_jobs,
                                    const bool& verbose);
 
 void build_unique_routing_modules(ModuleManager& module_manager,
@@ -37,6 +38,7 @@ void build_unique_routing_modules(ModuleManager& module_manager,
                                   const CircuitLibrary& circuit_lib,
                                   const e_config_protocol_type& sram_orgz_type,
                                   const CircuitModelId& sram_model,
+                                  const size_t& num_jobs,
                                   const bool& verbose); 
 
 } /* end namespace openfpga */
@@ -299,7 +299,8 @@ int build_top_module(ModuleManager& module_manager,
                      const bool& compact_routing_hierarchy,
                      const bool& duplicate_grid_pin,
                      const FabricKey& fabric_key,
-                     const bool& generate_random_fabric_key) {
+                     const bool& generate_random_fabric_key,
+                     const size_t& num_jobs) {
 
   vtr::ScopedStartFinishTimer timer("Build FPGA fabric module");
 
@@ -335,7 +336,8 @@ int build_top_module(ModuleManager& module_manager,
                                                vpr_device_annotation, 
                                                grids, grid_instance_ids, 
                                                rr_graph, device_rr_gsb, sb_instance_ids, cb_instance_ids,
-                                               compact_routing_hierarchy, duplicate_grid_pin);
+                                               compact_routing_hierarchy, duplicate_grid_pin,
+                                               num_jobs);
     /* Add inter-CLB direct connections */
     add_top_module_nets_tile_direct_connections(module_manager, top_module, circuit_lib, 
                                                 vpr_device_annotation,
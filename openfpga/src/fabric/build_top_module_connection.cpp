@@ -5,6 +5,7 @@
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_time.h"
+#include "vtr_parallel.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -63,8 +64,8 @@ namespace openfpga {
  *
  *******************************************************************/
 static 
-void add_top_module_nets_connect_grids_and_sb(ModuleManager& module_manager, 
-                                              const ModuleId& top_module, 
+void add_top_module_nets_connect_grids_and_sb(const ModuleManager& module_manager, 
+                                              ModuleNetBatch& net_batch, 
                                               const VprDeviceAnnotation& vpr_device_annotation,
                                               const DeviceGrid& grids,
                                               const vtr::Matrix<size_t>& grid_instance_ids,
@@ -102,9 +103,14 @@ void add_top_module_nets_connect_grids_and_sb(ModuleManager& module_manager,
   size_t sink_sb_instance = sb_instance_ids[instance_sb_coordinate.x()][instance_sb_coordinate.y()];
 
   /* Connect grid output pins (OPIN) to switch block grid pins */
-  for (size_t side = 0; side < module_sb.get_num_sides(); ++side) {
+  for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
     SideManager side_manager(side);
-    for (size_t inode = 0; inode < module_sb.get_num_opin_nodes(side_manager.get_side()); ++inode) {
+    /* The side of the module which is wired to this side of the instance */
+    e_side module_side = side_manager.get_side();
+    if (true == compact_routing_hierarchy) {
+      module_side = device_rr_gsb.get_sb_unique_module_side(vtr::Point<size_t>(rr_gsb.get_x(), rr_gsb.get_y()), side_manager.get_side());
+    }
+    for (size_t inode = 0; inode < module_sb.get_num_opin_nodes(module_side); ++inode) {
       /* Collect source-related information */
       /* Generate the grid module name by considering if it locates on the border */
       vtr::Point<size_t> grid_coordinate(rr_graph.node_xlow(rr_gsb.get_opin_node(side_manager.get_side(), inode)), 
@@ -130,14 +136,14 @@ void add_top_module_nets_connect_grids_and_sb(ModuleManager& module_manager,
       BasicPort src_grid_port = module_manager.module_port(src_grid_module, src_grid_port_id); 
 
       /* Collect sink-related information */
-      vtr::Point<size_t> sink_sb_port_coord(rr_graph.node_xlow(module_sb.get_opin_node(side_manager.get_side(), inode)),
-                                            rr_graph.node_ylow(module_sb.get_opin_node(side_manager.get_side(), inode)));
-      std::string sink_sb_port_name = generate_sb_module_grid_port_name(side_manager.get_side(),
-                                                                        rr_graph.node_side(module_sb.get_opin_node(side_manager.get_side(), inode)),
+      vtr::Point<size_t> sink_sb_port_coord(rr_graph.node_xlow(module_sb.get_opin_node(module_side, inode)),
+                                            rr_graph.node_ylow(module_sb.get_opin_node(module_side, inode)));
+      std::string sink_sb_port_name = generate_sb_module_grid_port_name(module_side,
+                                                                        rr_graph.node_side(module_sb.get_opin_node(module_side, inode)),
                                                                         grids,
                                                                         vpr_device_annotation,
                                                                         rr_graph,
-                                                                        module_sb.get_opin_node(side_manager.get_side(), inode)); 
+                                                                        module_sb.get_opin_node(module_side, inode)); 
       ModulePortId sink_sb_port_id = module_manager.find_module_port(sink_sb_module, sink_sb_port_name);
       VTR_ASSERT(true == module_manager.valid_module_port_id(sink_sb_module, sink_sb_port_id));
       BasicPort sink_sb_port =  module_manager.module_port(sink_sb_module, sink_sb_port_id); 
@@ -147,9 +153,9 @@ void add_top_module_nets_connect_grids_and_sb(ModuleManager& module_manager,
       
       /* Create a net for each pin */
       for (size_t pin_id = 0; pin_id < src_grid_port.pins().size(); ++pin_id) {
-        ModuleNetId net = create_module_source_pin_net(module_manager, top_module, src_grid_module, src_grid_instance, src_grid_port_id, src_grid_port.pins()[pin_id]);
+        net_batch.add_net(src_grid_module, src_grid_instance, src_grid_port_id, src_grid_port.pins()[pin_id]);
         /* Configure the net sink */
-        module_manager.add_module_net_sink(top_module, net, sink_sb_module, sink_sb_instance, sink_sb_port_id, sink_sb_port.pins()[pin_id]);
+        net_batch.add_net_sink(sink_sb_module, sink_sb_instance, sink_sb_port_id, sink_sb_port.pins()[pin_id]);
       }
     } 
   }
@@ -192,8 +198,8 @@ void add_top_module_nets_connect_grids_and_sb(ModuleManager& module_manager,
  *
  *******************************************************************/
 static 
-void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(ModuleManager& module_manager, 
-                                                                   const ModuleId& top_module, 
+void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(const ModuleManager& module_manager, 
+                                                                   ModuleNetBatch& net_batch, 
                                                                    const VprDeviceAnnotation& vpr_device_annotation,
                                                                    const DeviceGrid& grids,
                                                                    const vtr::Matrix<size_t>& grid_instance_ids,
@@ -241,9 +247,14 @@ void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(ModuleManager
   sb_side2postfix_map[LEFT] = false;
 
   /* Connect grid output pins (OPIN) to switch block grid pins */
-  for (size_t side = 0; side < module_sb.get_num_sides(); ++side) {
+  for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
     SideManager side_manager(side);
-    for (size_t inode = 0; inode < module_sb.get_num_opin_nodes(side_manager.get_side()); ++inode) {
+    /* The side of the module which is wired to this side of the instance */
+    e_side module_side = side_manager.get_side();
+    if (true == compact_routing_hierarchy) {
+      module_side = device_rr_gsb.get_sb_unique_module_side(vtr::Point<size_t>(rr_gsb.get_x(), rr_gsb.get_y()), side_manager.get_side());
+    }
+    for (size_t inode = 0; inode < module_sb.get_num_opin_nodes(module_side); ++inode) {
       /* Collect source-related information */
       /* Generate the grid module name by considering if it locates on the border */
       vtr::Point<size_t> grid_coordinate(rr_graph.node_xlow(rr_gsb.get_opin_node(side_manager.get_side(), inode)),
@@ -283,14 +294,14 @@ void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(ModuleManager
       BasicPort src_grid_port = module_manager.module_port(src_grid_module, src_grid_port_id); 
 
       /* Collect sink-related information */
-      vtr::Point<size_t> sink_sb_port_coord(rr_graph.node_xlow(module_sb.get_opin_node(side_manager.get_side(), inode)),
-                                            rr_graph.node_ylow(module_sb.get_opin_node(side_manager.get_side(), inode)));
-      std::string sink_sb_port_name = generate_sb_module_grid_port_name(side_manager.get_side(),
-                                                                        rr_graph.node_side(module_sb.get_opin_node(side_manager.get_side(), inode)),
+      vtr::Point<size_t> sink_sb_port_coord(rr_graph.node_xlow(module_sb.get_opin_node(module_side, inode)),
+                                            rr_graph.node_ylow(module_sb.get_opin_node(module_side, inode)));
+      std::string sink_sb_port_name = generate_sb_module_grid_port_name(module_side,
+                                                                        rr_graph.node_side(module_sb.get_opin_node(module_side, inode)),
                                                                         grids,
                                                                         vpr_device_annotation,
                                                                         rr_graph,
-                                                                        module_sb.get_opin_node(side_manager.get_side(), inode)); 
+                                                                        module_sb.get_opin_node(module_side, inode)); 
       ModulePortId sink_sb_port_id = module_manager.find_module_port(sink_sb_module, sink_sb_port_name);
       VTR_ASSERT(true == module_manager.valid_module_port_id(sink_sb_module, sink_sb_port_id));
       BasicPort sink_sb_port =  module_manager.module_port(sink_sb_module, sink_sb_port_id); 
@@ -300,9 +311,9 @@ void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(ModuleManager
       
       /* Create a net for each pin */
       for (size_t pin_id = 0; pin_id < src_grid_port.pins().size(); ++pin_id) {
-        ModuleNetId net = create_module_source_pin_net(module_manager, top_module, src_grid_module, src_grid_instance, src_grid_port_id, src_grid_port.pins()[pin_id]);
+        net_batch.add_net(src_grid_module, src_grid_instance, src_grid_port_id, src_grid_port.pins()[pin_id]);
         /* Configure the net sink */
-        module_manager.add_module_net_sink(top_module, net, sink_sb_module, sink_sb_instance, sink_sb_port_id, sink_sb_port.pins()[pin_id]);
+        net_batch.add_net_sink(sink_sb_module, sink_sb_instance, sink_sb_port_id, sink_sb_port.pins()[pin_id]);
       }
     } 
   }
@@ -364,8 +375,8 @@ void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(ModuleManager
  *
  *******************************************************************/
 static 
-void add_top_module_nets_connect_grids_and_cb(ModuleManager& module_manager, 
-                                              const ModuleId& top_module, 
+void add_top_module_nets_connect_grids_and_cb(const ModuleManager& module_manager, 
+                                              ModuleNetBatch& net_batch, 
                                               const VprDeviceAnnotation& vpr_device_annotation,
                                               const DeviceGrid& grids,
                                               const vtr::Matrix<size_t>& grid_instance_ids,
@@ -458,9 +469,9 @@ void add_top_module_nets_connect_grids_and_cb(ModuleManager& module_manager,
       
       /* Create a net for each pin */
       for (size_t pin_id = 0; pin_id < src_cb_port.pins().size(); ++pin_id) {
-        ModuleNetId net = create_module_source_pin_net(module_manager, top_module, src_cb_module, src_cb_instance, src_cb_port_id, src_cb_port.pins()[pin_id]);
+        net_batch.add_net(src_cb_module, src_cb_instance, src_cb_port_id, src_cb_port.pins()[pin_id]);
         /* Configure the net sink */
-        module_manager.add_module_net_sink(top_module, net, sink_grid_module, sink_grid_instance, sink_grid_port_id, sink_grid_port.pins()[pin_id]);
+        net_batch.add_net_sink(sink_grid_module, sink_grid_instance, sink_grid_port_id, sink_grid_port.pins()[pin_id]);
       }
     }
   }
@@ -506,8 +517,8 @@ void add_top_module_nets_connect_grids_and_cb(ModuleManager& module_manager,
  *
  *******************************************************************/
 static 
-void add_top_module_nets_connect_sb_and_cb(ModuleManager& module_manager, 
-                                           const ModuleId& top_module, 
+void add_top_module_nets_connect_sb_and_cb(const ModuleManager& module_manager, 
+                                           ModuleNetBatch& net_batch, 
                                            const RRGraph& rr_graph,
                                            const DeviceRRGSB& device_rr_gsb,
                                            const RRGSB& rr_gsb, 
@@ -540,11 +551,16 @@ void add_top_module_nets_connect_sb_and_cb(ModuleManager& module_manager,
   size_t sb_instance = sb_instance_ids[instance_sb_coordinate.x()][instance_sb_coordinate.y()];
 
   /* Connect grid output pins (OPIN) to switch block grid pins */
-  for (size_t side = 0; side < module_sb.get_num_sides(); ++side) {
+  for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
     SideManager side_manager(side);
+    /* The side of the module which is wired to this side of the instance */
+    e_side module_side = side_manager.get_side();
+    if (true == compact_routing_hierarchy) {
+      module_side = device_rr_gsb.get_sb_unique_module_side(vtr::Point<size_t>(rr_gsb.get_x(), rr_gsb.get_y()), side_manager.get_side());
+    }
     /* Iterate over the routing tracks on this side */
     /* Early skip: if there is no routing tracks at this side */
-    if (0 == module_sb.get_chan_width(side_manager.get_side())) {
+    if (0 == module_sb.get_chan_width(module_side)) {
       continue;
     }
     /* Find the Connection Block module */
@@ -590,10 +606,10 @@ void add_top_module_nets_connect_sb_and_cb(ModuleManager& module_manager,
     vtr::Point<size_t> instance_cb_coordinate(instance_cb.get_cb_x(cb_type), instance_cb.get_cb_y(cb_type));
     size_t cb_instance = cb_instance_ids.at(cb_type)[instance_cb_coordinate.x()][instance_cb_coordinate.y()];
  
-    for (size_t itrack = 0; itrack < module_sb.get_chan_width(side_manager.get_side()); ++itrack) {
-      std::string sb_port_name = generate_sb_module_track_port_name(rr_graph.node_type(module_sb.get_chan_node(side_manager.get_side(), itrack)),
-                                                                    side_manager.get_side(), 
-                                                                    module_sb.get_chan_node_direction(side_manager.get_side(), itrack));
+    for (size_t itrack = 0; itrack < module_sb.get_chan_width(module_side); ++itrack) {
+      std::string sb_port_name = generate_sb_module_track_port_name(rr_graph.node_type(module_sb.get_chan_node(module_side, itrack)),
+                                                                    module_side, 
+                                                                    module_sb.get_chan_node_direction(module_side, itrack));
       /* Prepare SB-related port information */
       ModulePortId sb_port_id = module_manager.find_module_port(sb_module_id, sb_port_name); 
       VTR_ASSERT(true == module_manager.valid_module_port_id(sb_module_id, sb_port_id));
@@ -602,10 +618,10 @@ void add_top_module_nets_connect_sb_and_cb(ModuleManager& module_manager,
       /* Prepare CB-related port information */ 
       PORTS cb_port_direction = OUT_PORT;
       /* The cb port direction should be opposite to the sb port !!! */
-      if (OUT_PORT == module_sb.get_chan_node_direction(side_manager.get_side(), itrack)) {
+      if (OUT_PORT == module_sb.get_chan_node_direction(module_side, itrack)) {
         cb_port_direction = IN_PORT;
       } else {
-        VTR_ASSERT(IN_PORT == module_sb.get_chan_node_direction(side_manager.get_side(), itrack));
+        VTR_ASSERT(IN_PORT == module_sb.get_chan_node_direction(module_side, itrack));
       }  
      
       /* Upper CB port is required if the routing tracks are on the top or right sides of 
@@ -623,18 +639,47 @@ void add_top_module_nets_connect_sb_and_cb(ModuleManager& module_manager,
        * If sb port is an output (source), cb port is an input (sink) 
        * If sb port is an input (sink), cb port is an output (source) 
        */
-      if (OUT_PORT == module_sb.get_chan_node_direction(side_manager.get_side(), itrack)) {
-        ModuleNetId net = create_module_source_pin_net(module_manager, top_module, sb_module_id, sb_instance, sb_port_id, itrack / 2);
-        module_manager.add_module_net_sink(top_module, net, cb_module_id, cb_instance, cb_port_id, itrack / 2);
+      if (OUT_PORT == module_sb.get_chan_node_direction(module_side, itrack)) {
+        net_batch.add_net(sb_module_id, sb_instance, sb_port_id, itrack / 2);
+        net_batch.add_net_sink(cb_module_id, cb_instance, cb_port_id, itrack / 2);
       } else {
-        VTR_ASSERT(IN_PORT == module_sb.get_chan_node_direction(side_manager.get_side(), itrack));
-        ModuleNetId net = create_module_source_pin_net(module_manager, top_module, cb_module_id, cb_instance, cb_port_id, itrack / 2);
-        module_manager.add_module_net_sink(top_module, net, sb_module_id, sb_instance, sb_port_id, itrack / 2);
+        VTR_ASSERT(IN_PORT == module_sb.get_chan_node_direction(module_side, itrack));
+        net_batch.add_net(cb_module_id, cb_instance, cb_port_id, itrack / 2);
+        net_batch.add_net_sink(sb_module_id, sb_instance, sb_port_id, itrack / 2);
       }
     }
   }
 }
 
+/********************************************************************
+ * Count the pins of a GSB which are connected by
+ * add_top_module_nets_connect_grids_and_gsbs(), i.e.,
+ * the grid output pins and the routing tracks of the switch block
+ * as well as the grid input pins of the connection blocks.
+ * Each of them drives at most one net with a single sink
+ *******************************************************************/
+static 
+size_t count_top_module_gsb_net_pins(const RRGSB& rr_gsb) {
+  size_t num_pins = 0;
+
+  for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
+    SideManager side_manager(side);
+    num_pins += rr_gsb.get_num_opin_nodes(side_manager.get_side());
+    num_pins += rr_gsb.get_chan_width(side_manager.get_side());
+  }
+
+  for (const t_rr_type& cb_type : {CHANX, CHANY}) {
+    if (false == rr_gsb.is_cb_exist(cb_type)) {
+      continue;
+    }
+    for (const e_side& cb_ipin_side : rr_gsb.get_cb_ipin_sides(cb_type)) {
+      num_pins += rr_gsb.get_num_ipin_nodes(cb_ipin_side);
+    }
+  }
+
+  return num_pins;
+}
+
 /********************************************************************
  * Add module nets to connect the grid ports/pins to Connection Blocks
  * and Switch Blocks
@@ -678,50 +723,74 @@ void add_top_module_nets_connect_grids_and_gsbs(ModuleManager& module_manager,
                                                 const vtr::Matrix<size_t>& sb_instance_ids,
                                                 const std::map<t_rr_type, vtr::Matrix<size_t>>& cb_instance_ids,
                                                 const bool& compact_routing_hierarchy,
-                                                const bool& duplicate_grid_pin) {
+                                                const bool& duplicate_grid_pin,
+                                                const size_t& num_jobs) {
 
   vtr::ScopedStartFinishTimer timer("Add module nets between grids and GSBs");
 
   vtr::Point<size_t> gsb_range = device_rr_gsb.get_gsb_range();
 
-  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
-      vtr::Point<size_t> gsb_coordinate(ix, iy);
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
+  /* The nets of each chunk of GSB columns are collected in a separated batch,
+   * which only requires read-only accesses to the module manager.
+   * The batches are then added to the top module in the order of the GSBs,
+   * so that the nets are the same as when they are created one by one
+   */
+  std::vector<ModuleNetBatch> net_batches(vtr::num_parallel_chunks(gsb_range.x(), num_jobs));
+
+  vtr::parallel_for_chunks(gsb_range.x(), num_jobs, [&](size_t ichunk, size_t ix_begin, size_t ix_end) {
+    const ModuleManager& const_module_manager = module_manager;
+    ModuleNetBatch& net_batch = net_batches[ichunk];
+
+    /* Pre-size the batch from the pin counts of its GSBs */
+    size_t num_pins = 0;
+    for (size_t ix = ix_begin; ix < ix_end; ++ix) {
+      for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
+        num_pins += count_top_module_gsb_net_pins(device_rr_gsb.get_gsb(ix, iy));
+      }
+    }
+    net_batch.reserve(num_pins, num_pins);
+
+    for (size_t ix = ix_begin; ix < ix_end; ++ix) {
+      for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
+        const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
+
+        /* Connect the grid pins of the GSB to adjacent grids */
+        if (false == duplicate_grid_pin) {
+          add_top_module_nets_connect_grids_and_sb(const_module_manager, net_batch, 
+                                                   vpr_device_annotation,
+                                                   grids, grid_instance_ids,
+                                                   rr_graph, device_rr_gsb, rr_gsb, sb_instance_ids, 
+                                                   compact_routing_hierarchy);
+        } else {
+          VTR_ASSERT_SAFE(true == duplicate_grid_pin);
+          add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(const_module_manager, net_batch, 
+                                                                        vpr_device_annotation,
+                                                                        grids, grid_instance_ids,
+                                                                        rr_graph, device_rr_gsb, rr_gsb, sb_instance_ids, 
+                                                                        compact_routing_hierarchy);
+        }
 
-      /* Connect the grid pins of the GSB to adjacent grids */
-      if (false == duplicate_grid_pin) {
-        add_top_module_nets_connect_grids_and_sb(module_manager, top_module, 
+        add_top_module_nets_connect_grids_and_cb(const_module_manager, net_batch, 
                                                  vpr_device_annotation,
                                                  grids, grid_instance_ids,
-                                                 rr_graph, device_rr_gsb, rr_gsb, sb_instance_ids, 
+                                                 rr_graph, device_rr_gsb, rr_gsb, CHANX, cb_instance_ids.at(CHANX),
                                                  compact_routing_hierarchy);
-      } else {
-        VTR_ASSERT_SAFE(true == duplicate_grid_pin);
-        add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(module_manager, top_module, 
-                                                                      vpr_device_annotation,
-                                                                      grids, grid_instance_ids,
-                                                                      rr_graph, device_rr_gsb, rr_gsb, sb_instance_ids, 
-                                                                      compact_routing_hierarchy);
-      }
-
-      add_top_module_nets_connect_grids_and_cb(module_manager, top_module, 
-                                               vpr_device_annotation,
-                                               grids, grid_instance_ids,
-                                               rr_graph, device_rr_gsb, rr_gsb, CHANX, cb_instance_ids.at(CHANX),
-                                               compact_routing_hierarchy);
 
-      add_top_module_nets_connect_grids_and_cb(module_manager, top_module, 
-                                               vpr_device_annotation,
-                                               grids, grid_instance_ids,
-                                               rr_graph, device_rr_gsb, rr_gsb, CHANY, cb_instance_ids.at(CHANY),
-                                               compact_routing_hierarchy);
-
-      add_top_module_nets_connect_sb_and_cb(module_manager, top_module, 
-                                            rr_graph, device_rr_gsb, rr_gsb, sb_instance_ids, cb_instance_ids,
-                                            compact_routing_hierarchy);
+        add_top_module_nets_connect_grids_and_cb(const_module_manager, net_batch, 
+                                                 vpr_device_annotation,
+                                                 grids, grid_instance_ids,
+                                                 rr_graph, device_rr_gsb, rr_gsb, CHANY, cb_instance_ids.at(CHANY),
+                                                 compact_routing_hierarchy);
 
+        add_top_module_nets_connect_sb_and_cb(const_module_manager, net_batch, 
+                                              rr_graph, device_rr_gsb, rr_gsb, sb_instance_ids, cb_instance_ids,
+                                              compact_routing_hierarchy);
+      }
     }
+  });
+
+  for (const ModuleNetBatch& net_batch : net_batches) {
+    module_manager.add_module_net_batch(top_module, net_batch);
   }
 }
 
@@ -31,7 +31,8 @@ void add_top_module_nets_connect_grids_and_gsbs(ModuleManager& module_manager,
                                                 const vtr::Matrix<size_t>& sb_instance_ids,
                                                 const std::map<t_rr_type, vtr::Matrix<size_t>>& cb_instance_ids,
                                                 const bool& compact_routing_hierarchy,
-                                                const bool& duplicate_grid_pin);
+                                                const bool& duplicate_grid_pin,
+                                                const size_t& num_jobs);
 
 int add_top_module_global_ports_from_grid_modules(ModuleManager& module_manager,
                                                   const ModuleId& top_module,
@@ -8,6 +8,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_naming.h"
 
@@ -108,9 +109,9 @@ int write_fabric_hierarchy_to_text_file(const ModuleManager& module_manager,
   VTR_ASSERT(true != fname.empty());
 
   /* Create a file handler*/
-  std::fstream fp;
+  BufferedFstream fp;
   /* Open a file */
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(fname.c_str(), fp);
@@ -143,7 +144,7 @@ int write_fabric_hierarchy_to_text_file(const ModuleManager& module_manager,
                                                           verbose);
 
   /* close a file */
-  fp.close();
+  fp.close_file();
 
   return err_code;
 }
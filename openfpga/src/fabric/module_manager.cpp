@@ -16,6 +16,51 @@ namespace openfpga {
 /******************************************************************************
  * Public Constructors
  ******************************************************************************/
+ModuleManager ModuleManager::create_fragment() const {
+  ModuleManager fragment;
+
+  fragment.ids_ = ids_;
+  fragment.names_ = names_;
+  fragment.usages_ = usages_;
+  fragment.name_id_map_ = name_id_map_;
+
+  /* Children and nets are left empty: they are not visible from the new modules */
+  fragment.parents_.resize(ids_.size());
+  fragment.children_.resize(ids_.size());
+  fragment.num_child_instances_.resize(ids_.size());
+  fragment.child_instance_names_.resize(ids_.size());
+  fragment.configurable_children_.resize(ids_.size());
+  fragment.configurable_child_instances_.resize(ids_.size());
+  fragment.configurable_child_regions_.resize(ids_.size());
+  fragment.configurable_child_coordinates_.resize(ids_.size());
+
+  fragment.config_region_ids_.resize(ids_.size());
+  fragment.config_region_children_.resize(ids_.size());
+
+  fragment.port_ids_ = port_ids_;
+  fragment.ports_ = ports_;
+  fragment.port_types_ = port_types_;
+  fragment.port_is_mappable_io_ = port_is_mappable_io_;
+  fragment.port_is_wire_ = port_is_wire_;
+  fragment.port_is_register_ = port_is_register_;
+  fragment.port_preproc_flags_ = port_preproc_flags_;
+  fragment.port_lookup_ = port_lookup_;
+
+  fragment.num_nets_.resize(ids_.size(), 0);
+  fragment.invalid_net_ids_.resize(ids_.size());
+  fragment.net_names_.resize(ids_.size());
+  fragment.net_terminals_.resize(ids_.size());
+  fragment.net_src_spans_.resize(ids_.size());
+  fragment.net_sink_spans_.resize(ids_.size());
+
+  /* Reserve the instance 0 of each module for itself, as add_module() does */
+  fragment.net_lookup_.resize(ids_.size());
+  for (const ModuleId& module : ids_) {
+    fragment.net_lookup_[module][module].emplace_back();
+  }
+
+  return fragment;
+}
 
 /**************************************************
  * Public Accessors : Aggregates
@@ -95,14 +140,18 @@ std::vector<vtr::Point<int>> ModuleManager::configurable_child_coordinates(const
 ModuleManager::module_net_src_range ModuleManager::module_net_sources(const ModuleId& module, const ModuleNetId& net) const {
   /* Validate the module_id */
   VTR_ASSERT(valid_module_net_id(module, net));
-  return vtr::make_range(net_src_ids_[module][net].begin(), net_src_ids_[module][net].end());
+  /* Ids of sources are the same for all the nets: 0, 1, ..., size - 1 */
+  return vtr::make_range(module_net_src_iterator(ModuleNetSrcId(0)),
+                         module_net_src_iterator(ModuleNetSrcId(net_src_spans_[module][net].size)));
 }
 
 /* Find the sink ids of modules */
 ModuleManager::module_net_sink_range ModuleManager::module_net_sinks(const ModuleId& module, const ModuleNetId& net) const {
   /* Validate the module_id */
   VTR_ASSERT(valid_module_net_id(module, net));
-  return vtr::make_range(net_sink_ids_[module][net].begin(), net_sink_ids_[module][net].end());
+  /* Ids of sinks are the same for all the nets: 0, 1, ..., size - 1 */
+  return vtr::make_range(module_net_sink_iterator(ModuleNetSinkId(0)),
+                         module_net_sink_iterator(ModuleNetSinkId(net_sink_spans_[module][net].size)));
 }
 
 ModuleManager::region_range ModuleManager::regions(const ModuleId& module) const {
@@ -383,10 +432,11 @@ vtr::vector<ModuleNetSrcId, ModuleId> ModuleManager::net_source_modules(const Mo
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
+  const NetTerminalSpan& span = net_src_spans_[module][net];
   vtr::vector<ModuleNetSrcId, ModuleId> src_modules;
-  src_modules.reserve(net_src_terminal_ids_[module][net].size());
-  for (const size_t& id : net_src_terminal_ids_[module][net]) {
-    src_modules.push_back(net_terminal_storage_[id].first);
+  src_modules.reserve(span.size);
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    src_modules.push_back(net_terminals_[module][iterm].module);
   }
 
   return src_modules;
@@ -397,7 +447,14 @@ vtr::vector<ModuleNetSrcId, size_t> ModuleManager::net_source_instances(const Mo
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_src_instance_ids_[module][net];
+  const NetTerminalSpan& span = net_src_spans_[module][net];
+  vtr::vector<ModuleNetSrcId, size_t> src_instances;
+  src_instances.reserve(span.size);
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    src_instances.push_back(net_terminals_[module][iterm].instance);
+  }
+
+  return src_instances;
 }
 
 /* Find the source ports of a net */
@@ -405,10 +462,11 @@ vtr::vector<ModuleNetSrcId, ModulePortId> ModuleManager::net_source_ports(const
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
+  const NetTerminalSpan& span = net_src_spans_[module][net];
   vtr::vector<ModuleNetSrcId, ModulePortId> src_ports;
-  src_ports.reserve(net_src_terminal_ids_[module][net].size());
-  for (const size_t& id : net_src_terminal_ids_[module][net]) {
-    src_ports.push_back(net_terminal_storage_[id].second);
+  src_ports.reserve(span.size);
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    src_ports.push_back(net_terminals_[module][iterm].port);
   }
 
   return src_ports;
@@ -419,7 +477,14 @@ vtr::vector<ModuleNetSrcId, size_t> ModuleManager::net_source_pins(const ModuleI
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_src_pin_ids_[module][net];
+  const NetTerminalSpan& span = net_src_spans_[module][net];
+  vtr::vector<ModuleNetSrcId, size_t> src_pins;
+  src_pins.reserve(span.size);
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    src_pins.push_back(net_terminals_[module][iterm].pin);
+  }
+
+  return src_pins;
 }
 
 /* Identify if a pin of a port in a module already exists in the net source list*/
@@ -433,11 +498,13 @@ bool ModuleManager::net_source_exist(const ModuleId& module, const ModuleNetId&
    * If a net source has the same src_module, instance_id, src_port and src_pin,
    * we can say that the source has already been added to this net!
    */
-  for (const ModuleNetSrcId& net_src : module_net_sources(module, net)) {
-    if ( (src_module == net_terminal_storage_[net_src_terminal_ids_[module][net][net_src]].first) 
-      && (instance_id == net_source_instances(module, net)[net_src])   
-      && (src_port == net_terminal_storage_[net_src_terminal_ids_[module][net][net_src]].second) 
-      && (src_pin == net_source_pins(module, net)[net_src]) ) {
+  const NetTerminalSpan& span = net_src_spans_[module][net];
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    const NetTerminal& terminal = net_terminals_[module][iterm];
+    if ( (src_module == terminal.module) 
+      && (instance_id == terminal.instance)   
+      && (src_port == terminal.port) 
+      && (src_pin == terminal.pin) ) {
       return true;
     }
   }
@@ -451,10 +518,11 @@ vtr::vector<ModuleNetSinkId, ModuleId> ModuleManager::net_sink_modules(const Mod
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
+  const NetTerminalSpan& span = net_sink_spans_[module][net];
   vtr::vector<ModuleNetSinkId, ModuleId> sink_modules;
-  sink_modules.reserve(net_sink_terminal_ids_[module][net].size());
-  for (const size_t& id : net_sink_terminal_ids_[module][net]) {
-    sink_modules.push_back(net_terminal_storage_[id].first);
+  sink_modules.reserve(span.size);
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    sink_modules.push_back(net_terminals_[module][iterm].module);
   }
 
   return sink_modules;
@@ -465,7 +533,14 @@ vtr::vector<ModuleNetSinkId, size_t> ModuleManager::net_sink_instances(const Mod
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_sink_instance_ids_[module][net];
+  const NetTerminalSpan& span = net_sink_spans_[module][net];
+  vtr::vector<ModuleNetSinkId, size_t> sink_instances;
+  sink_instances.reserve(span.size);
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    sink_instances.push_back(net_terminals_[module][iterm].instance);
+  }
+
+  return sink_instances;
 }
 
 /* Find the sink ports of a net */
@@ -473,10 +548,11 @@ vtr::vector<ModuleNetSinkId, ModulePortId> ModuleManager::net_sink_ports(const M
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
+  const NetTerminalSpan& span = net_sink_spans_[module][net];
   vtr::vector<ModuleNetSinkId, ModulePortId> sink_ports;
-  sink_ports.reserve(net_sink_terminal_ids_[module][net].size());
-  for (const size_t& id : net_sink_terminal_ids_[module][net]) {
-    sink_ports.push_back(net_terminal_storage_[id].second);
+  sink_ports.reserve(span.size);
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    sink_ports.push_back(net_terminals_[module][iterm].port);
   }
 
   return sink_ports;
@@ -487,7 +563,14 @@ vtr::vector<ModuleNetSinkId, size_t> ModuleManager::net_sink_pins(const ModuleId
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_sink_pin_ids_[module][net];
+  const NetTerminalSpan& span = net_sink_spans_[module][net];
+  vtr::vector<ModuleNetSinkId, size_t> sink_pins;
+  sink_pins.reserve(span.size);
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    sink_pins.push_back(net_terminals_[module][iterm].pin);
+  }
+
+  return sink_pins;
 }
 
 /* Identify if a pin of a port in a module already exists in the net sink list*/
@@ -501,11 +584,13 @@ bool ModuleManager::net_sink_exist(const ModuleId& module, const ModuleNetId& ne
    * If a net sink has the same sink_module, instance_id, sink_port and sink_pin,
    * we can say that the sink has already been added to this net!
    */
-  for (const ModuleNetSinkId& net_sink : module_net_sinks(module, net)) {
-    if ( (sink_module == net_terminal_storage_[net_sink_terminal_ids_[module][net][net_sink]].first) 
-      && (instance_id == net_sink_instances(module, net)[net_sink])   
-      && (sink_port == net_terminal_storage_[net_sink_terminal_ids_[module][net][net_sink]].second) 
-      && (sink_pin == net_sink_pins(module, net)[net_sink]) ) {
+  const NetTerminalSpan& span = net_sink_spans_[module][net];
+  for (size_t iterm = span.begin; iterm < span.begin + span.size; ++iterm) {
+    const NetTerminal& terminal = net_terminals_[module][iterm];
+    if ( (sink_module == terminal.module) 
+      && (instance_id == terminal.instance)   
+      && (sink_port == terminal.port) 
+      && (sink_pin == terminal.pin) ) {
       return true;
     }
   }
@@ -532,6 +617,44 @@ size_t ModuleManager::find_child_module_index_in_parent_module(const ModuleId& p
   return size_t(-1);
 }
 
+/******************************************************************************
+ * Private Mutators
+ ******************************************************************************/
+void ModuleManager::reserve_net_terminal_span(const ModuleId& module, NetTerminalSpan& span,
+                                              const size_t& num_terminals) {
+  if (num_terminals <= span.capacity) {
+    return;
+  }
+
+  std::vector<NetTerminal>& terminals = net_terminals_[module];
+
+  /* The span is at the end of the terminal array: simply grow the array */
+  if (span.begin + span.capacity == terminals.size()) {
+    terminals.resize(span.begin + num_terminals);
+    span.capacity = num_terminals;
+    return;
+  }
+
+  /* Otherwise, move the span to the end of the terminal array.
+   * The room it used is given back by compact_module_nets()
+   */
+  size_t new_begin = terminals.size();
+  terminals.resize(new_begin + num_terminals);
+  std::copy(terminals.begin() + span.begin, terminals.begin() + span.begin + span.size,
+            terminals.begin() + new_begin);
+  span.begin = new_begin;
+  span.capacity = num_terminals;
+}
+
+void ModuleManager::add_net_terminal(const ModuleId& module, NetTerminalSpan& span,
+                                     const NetTerminal& terminal) {
+  if (span.size == span.capacity) {
+    reserve_net_terminal_span(module, span, std::max<size_t>(1, 2 * span.capacity));
+  }
+  net_terminals_[module][span.begin + span.size] = terminal;
+  span.size++;
+}
+
 /******************************************************************************
  * Public Mutators
  ******************************************************************************/
@@ -573,15 +696,9 @@ ModuleId ModuleManager::add_module(const std::string& name) {
   num_nets_.emplace_back(0);
   invalid_net_ids_.emplace_back();
   net_names_.emplace_back();
-  net_src_ids_.emplace_back();
-  net_src_terminal_ids_.emplace_back();
-  net_src_instance_ids_.emplace_back();
-  net_src_pin_ids_.emplace_back();
-
-  net_sink_ids_.emplace_back();
-  net_sink_terminal_ids_.emplace_back();
-  net_sink_instance_ids_.emplace_back();
-  net_sink_pin_ids_.emplace_back();
+  net_terminals_.emplace_back();
+  net_src_spans_.emplace_back();
+  net_sink_spans_.emplace_back();
 
   /* Register in the name-to-id map */
   name_id_map_[name] = module;
@@ -599,6 +716,74 @@ ModuleId ModuleManager::add_module(const std::string& name) {
   return module;
 }
 
+/* Add a copy of a module built in a fragment of this module manager */
+ModuleId ModuleManager::add_module_from_fragment(const ModuleManager& fragment, const ModuleId& fragment_module) {
+  VTR_ASSERT(fragment.valid_module_id(fragment_module));
+
+  ModuleId module = add_module(fragment.module_name(fragment_module));
+  if (false == valid_module_id(module)) {
+    return ModuleId::INVALID();
+  }
+
+  usages_[module] = fragment.usages_[fragment_module];
+
+  /* Child modules must exist in both module managers with the same ids */
+  for (const ModuleId& child : fragment.children_[fragment_module]) {
+    VTR_ASSERT(valid_module_id(child));
+    VTR_ASSERT(names_[child] == fragment.names_[child]);
+    std::vector<ModuleId>::iterator parent_it = std::find(parents_[child].begin(), parents_[child].end(), module);
+    if (parent_it == parents_[child].end()) {
+      parents_[child].push_back(module);
+    }
+  }
+  children_[module] = fragment.children_[fragment_module];
+  num_child_instances_[module] = fragment.num_child_instances_[fragment_module];
+  child_instance_names_[module] = fragment.child_instance_names_[fragment_module];
+
+  configurable_children_[module] = fragment.configurable_children_[fragment_module];
+  configurable_child_instances_[module] = fragment.configurable_child_instances_[fragment_module];
+  configurable_child_regions_[module] = fragment.configurable_child_regions_[fragment_module];
+  configurable_child_coordinates_[module] = fragment.configurable_child_coordinates_[fragment_module];
+
+  config_region_ids_[module] = fragment.config_region_ids_[fragment_module];
+  config_region_children_[module] = fragment.config_region_children_[fragment_module];
+
+  port_ids_[module] = fragment.port_ids_[fragment_module];
+  ports_[module] = fragment.ports_[fragment_module];
+  port_types_[module] = fragment.port_types_[fragment_module];
+  port_is_wire_[module] = fragment.port_is_wire_[fragment_module];
+  port_is_mappable_io_[module] = fragment.port_is_mappable_io_[fragment_module];
+  port_is_register_[module] = fragment.port_is_register_[fragment_module];
+  port_preproc_flags_[module] = fragment.port_preproc_flags_[fragment_module];
+  port_lookup_[module] = fragment.port_lookup_[fragment_module];
+
+  num_nets_[module] = fragment.num_nets_[fragment_module];
+  invalid_net_ids_[module] = fragment.invalid_net_ids_[fragment_module];
+  net_names_[module] = fragment.net_names_[fragment_module];
+  net_src_spans_[module] = fragment.net_src_spans_[fragment_module];
+  net_sink_spans_[module] = fragment.net_sink_spans_[fragment_module];
+
+  /* The module itself has a new id in the net terminals */
+  net_terminals_[module] = fragment.net_terminals_[fragment_module];
+  for (NetTerminal& terminal : net_terminals_[module]) {
+    if (terminal.module == fragment_module) {
+      terminal.module = module;
+    }
+  }
+
+  /* The net look-up of the module includes itself as a terminal module */
+  net_lookup_[module].clear();
+  for (const auto& terminal_module_lookup : fragment.net_lookup_[fragment_module]) {
+    if (terminal_module_lookup.first == fragment_module) {
+      net_lookup_[module][module] = terminal_module_lookup.second;
+    } else {
+      net_lookup_[module][terminal_module_lookup.first] = terminal_module_lookup.second;
+    }
+  }
+
+  return module;
+}
+
 /* Add a port to a module */
 ModulePortId ModuleManager::add_port(const ModuleId& module, 
                                      const BasicPort& port_info, const enum e_module_port_type& port_type) {
@@ -821,15 +1006,10 @@ void ModuleManager::reserve_module_nets(const ModuleId& module,
   VTR_ASSERT ( valid_module_id(module) );
 
   net_names_[module].reserve(num_nets);
-  net_src_ids_[module].reserve(num_nets);
-  net_src_terminal_ids_[module].reserve(num_nets);
-  net_src_instance_ids_[module].reserve(num_nets);
-  net_src_pin_ids_[module].reserve(num_nets);
-
-  net_sink_ids_[module].reserve(num_nets);
-  net_sink_terminal_ids_[module].reserve(num_nets);
-  net_sink_instance_ids_[module].reserve(num_nets);
-  net_sink_pin_ids_[module].reserve(num_nets);
+  net_src_spans_[module].reserve(num_nets);
+  net_sink_spans_[module].reserve(num_nets);
+  /* Most nets have one source and one sink */
+  net_terminals_[module].reserve(2 * num_nets);
 }
 
 /* Add a net to the connection graph of the module */ 
@@ -843,20 +1023,13 @@ ModuleNetId ModuleManager::create_module_net(const ModuleId& module) {
   
   /* Allocate net-related data structures */
   net_names_[module].emplace_back();
-  net_src_ids_[module].emplace_back();
-  net_src_terminal_ids_[module].emplace_back();
-  net_src_instance_ids_[module].emplace_back();
-  net_src_pin_ids_[module].emplace_back();
+  net_src_spans_[module].emplace_back();
+  net_sink_spans_[module].emplace_back();
 
   /* Reserve a source */
   reserve_module_net_sources(module, net, 1);
 
-  net_sink_ids_[module].emplace_back();
-  net_sink_terminal_ids_[module].emplace_back();
-  net_sink_instance_ids_[module].emplace_back();
-  net_sink_pin_ids_[module].emplace_back();
-
-  /* Reserve a source */
+  /* Reserve a sink */
   reserve_module_net_sinks(module, net, 1);
 
   return net;
@@ -876,10 +1049,7 @@ void ModuleManager::reserve_module_net_sources(const ModuleId& module, const Mod
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  net_src_ids_[module][net].reserve(num_sources);
-  net_src_terminal_ids_[module][net].reserve(num_sources);
-  net_src_instance_ids_[module][net].reserve(num_sources);
-  net_src_pin_ids_[module][net].reserve(num_sources);
+  reserve_net_terminal_span(module, net_src_spans_[module][net], num_sources);
 }
 
 /* Add a source to a net in the connection graph */
@@ -889,46 +1059,28 @@ ModuleNetSrcId ModuleManager::add_module_net_source(const ModuleId& module, cons
   /* Validate the module and net id */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  /* Create a new id for src node */
-  ModuleNetSrcId net_src = ModuleNetSrcId(net_src_ids_[module][net].size());
-  net_src_ids_[module][net].push_back(net_src);
-
   /* Validate the source module */
   VTR_ASSERT(valid_module_id(src_module));
 
   /* Validate the port exists in the src module */
   VTR_ASSERT(valid_module_port_id(src_module, src_port));
 
-  /* Create pair of module and port
-   * Search in the storage. If found, use the existing pair
-   * Otherwise, add the pair
-   */
-  std::pair<ModuleId, ModulePortId> terminal(src_module, src_port);
-  std::vector<std::pair<ModuleId, ModulePortId>>::iterator it = std::find(net_terminal_storage_.begin(),
-                                                                          net_terminal_storage_.end(),
-                                                                          terminal);
-  if (it == net_terminal_storage_.end()) {
-    net_src_terminal_ids_[module][net].push_back(net_terminal_storage_.size());
-    net_terminal_storage_.push_back(terminal);
-  } else {
-   VTR_ASSERT_SAFE(it != net_terminal_storage_.end());
-   net_src_terminal_ids_[module][net].push_back(std::distance(net_terminal_storage_.begin(), it));
-  }
-
   /* if it has the same id as module, our instance id will be by default 0 */
   size_t src_instance_id = instance_id;
   if (src_module == module) {
     src_instance_id = 0;
-    net_src_instance_ids_[module][net].push_back(src_instance_id);
   } else {
     /* Check the instance id of the src module */
     VTR_ASSERT (src_instance_id < num_instance(module, src_module));
-    net_src_instance_ids_[module][net].push_back(src_instance_id);
   } 
 
   /* Validate the pin id is in the range of the port width */
-  VTR_ASSERT(src_pin < module_port(src_module, src_port).get_width());
-  net_src_pin_ids_[module][net].push_back(src_pin);
+  VTR_ASSERT(src_pin < ports_[src_module][src_port].get_width());
+
+  /* Create a new id for src node */
+  NetTerminalSpan& span = net_src_spans_[module][net];
+  ModuleNetSrcId net_src = ModuleNetSrcId(span.size);
+  add_net_terminal(module, span, {src_module, src_port, src_instance_id, src_pin});
 
   /* Update fast look-up for nets */
   net_lookup_[module][src_module][src_instance_id][src_port][src_pin] = net;
@@ -941,10 +1093,7 @@ void ModuleManager::reserve_module_net_sinks(const ModuleId& module, const Modul
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  net_sink_ids_[module][net].reserve(num_sinks);
-  net_sink_terminal_ids_[module][net].reserve(num_sinks);
-  net_sink_instance_ids_[module][net].reserve(num_sinks);
-  net_sink_pin_ids_[module][net].reserve(num_sinks);
+  reserve_net_terminal_span(module, net_sink_spans_[module][net], num_sinks);
 }
 
 /* Add a sink to a net in the connection graph */
@@ -954,46 +1103,28 @@ ModuleNetSinkId ModuleManager::add_module_net_sink(const ModuleId& module, const
   /* Validate the module and net id */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  /* Create a new id for sink node */
-  ModuleNetSinkId net_sink = ModuleNetSinkId(net_sink_ids_[module][net].size());
-  net_sink_ids_[module][net].push_back(net_sink);
-
   /* Validate the source module */
   VTR_ASSERT(valid_module_id(sink_module));
 
   /* Validate the port exists in the sink module */
   VTR_ASSERT(valid_module_port_id(sink_module, sink_port));
 
-  /* Create pair of module and port
-   * Search in the storage. If found, use the existing pair
-   * Otherwise, add the pair
-   */
-  std::pair<ModuleId, ModulePortId> terminal(sink_module, sink_port);
-  std::vector<std::pair<ModuleId, ModulePortId>>::iterator it = std::find(net_terminal_storage_.begin(),
-                                                                          net_terminal_storage_.end(),
-                                                                          terminal);
-  if (it == net_terminal_storage_.end()) {
-    net_sink_terminal_ids_[module][net].push_back(net_terminal_storage_.size());
-    net_terminal_storage_.push_back(terminal);
-  } else {
-   VTR_ASSERT_SAFE(it != net_terminal_storage_.end());
-   net_sink_terminal_ids_[module][net].push_back(std::distance(net_terminal_storage_.begin(), it));
-  }
-
   /* if it has the same id as module, our instance id will be by default 0 */
   size_t sink_instance_id = instance_id;
   if (sink_module == module) {
     sink_instance_id = 0;
-    net_sink_instance_ids_[module][net].push_back(sink_instance_id);
   } else {
     /* Check the instance id of the src module */
     VTR_ASSERT (sink_instance_id < num_instance(module, sink_module));
-    net_sink_instance_ids_[module][net].push_back(sink_instance_id);
   } 
 
   /* Validate the pin id is in the range of the port width */
-  VTR_ASSERT(sink_pin < module_port(sink_module, sink_port).get_width());
-  net_sink_pin_ids_[module][net].push_back(sink_pin);
+  VTR_ASSERT(sink_pin < ports_[sink_module][sink_port].get_width());
+
+  /* Create a new id for sink node */
+  NetTerminalSpan& span = net_sink_spans_[module][net];
+  ModuleNetSinkId net_sink = ModuleNetSinkId(span.size);
+  add_net_terminal(module, span, {sink_module, sink_port, sink_instance_id, sink_pin});
 
   /* Update fast look-up for nets */
   net_lookup_[module][sink_module][sink_instance_id][sink_port][sink_pin] = net;
@@ -1001,6 +1132,117 @@ ModuleNetSinkId ModuleManager::add_module_net_sink(const ModuleId& module, const
   return net_sink;
 }
 
+void ModuleManager::add_module_net_batch(const ModuleId& module, const ModuleNetBatch& net_batch) {
+  /* Validate the module id */
+  VTR_ASSERT(valid_module_id(module));
+
+  /* Reserve for the worst case, where each net of the batch is a new net */
+  size_t max_num_nets = num_nets_[module] + net_batch.num_nets();
+  net_names_[module].reserve(max_num_nets);
+  net_src_spans_[module].reserve(max_num_nets);
+  net_sink_spans_[module].reserve(max_num_nets);
+  net_terminals_[module].reserve(net_terminals_[module].size() + net_batch.num_nets() + net_batch.num_sinks());
+
+  /* Look-up of the nets driving or driven by the pins of a port of a terminal.
+   * Consecutive terminals of a batch are usually pins of the same port
+   * (e.g., the inputs of a multiplexer), so the look-up and the validation
+   * of a (module, instance, port) are done once and reused for its pins
+   */
+  struct TerminalPortLookup {
+    ModuleId module = ModuleId::INVALID();
+    size_t instance = size_t(-1);
+    ModulePortId port = ModulePortId::INVALID();
+    /* Instance id of the terminal. If the terminal is the module itself, the instance id is by default 0 */
+    size_t instance_id = 0;
+    std::vector<ModuleNetId>* pin_nets = nullptr;
+  };
+  auto update_terminal_port_lookup = [&](const ModuleNetTerminal& terminal, TerminalPortLookup& lookup) {
+    if ( (terminal.module == lookup.module)
+      && (terminal.instance == lookup.instance)
+      && (terminal.port == lookup.port) ) {
+      return;
+    }
+    /* Validate the terminal as add_module_net_source/sink() do */
+    VTR_ASSERT(valid_module_port_id(terminal.module, terminal.port));
+    lookup.module = terminal.module;
+    lookup.instance = terminal.instance;
+    lookup.port = terminal.port;
+    lookup.instance_id = 0;
+    if (terminal.module != module) {
+      VTR_ASSERT_SAFE(terminal.instance < num_instance(module, terminal.module));
+      lookup.instance_id = terminal.instance;
+    }
+    lookup.pin_nets = &net_lookup_[module][terminal.module][lookup.instance_id][terminal.port];
+  };
+
+  TerminalPortLookup src_lookup;
+  TerminalPortLookup sink_lookup;
+  for (size_t inet = 0; inet < net_batch.num_nets(); ++inet) {
+    const ModuleNetTerminal& src = net_batch.net_source(inet);
+    update_terminal_port_lookup(src, src_lookup);
+    VTR_ASSERT(src.pin < src_lookup.pin_nets->size());
+
+    /* Reuse the net driven by the source pin if there is any */
+    ModuleNetId net = (*src_lookup.pin_nets)[src.pin];
+    if (ModuleNetId::INVALID() == net) {
+      net = ModuleNetId(num_nets_[module]);
+      num_nets_[module]++;
+
+      net_names_[module].emplace_back();
+      net_src_spans_[module].emplace_back();
+      net_sink_spans_[module].emplace_back();
+
+      add_net_terminal(module, net_src_spans_[module][net], {src.module, src.port, src_lookup.instance_id, src.pin});
+
+      (*src_lookup.pin_nets)[src.pin] = net;
+    }
+
+    NetTerminalSpan& sink_span = net_sink_spans_[module][net];
+    reserve_net_terminal_span(module, sink_span,
+                              sink_span.size + net_batch.net_sink_end(inet) - net_batch.net_sink_begin(inet));
+
+    for (size_t isink = net_batch.net_sink_begin(inet); isink < net_batch.net_sink_end(inet); ++isink) {
+      const ModuleNetTerminal& sink = net_batch.sink(isink);
+      update_terminal_port_lookup(sink, sink_lookup);
+      VTR_ASSERT(sink.pin < sink_lookup.pin_nets->size());
+
+      add_net_terminal(module, sink_span, {sink.module, sink.port, sink_lookup.instance_id, sink.pin});
+
+      (*sink_lookup.pin_nets)[sink.pin] = net;
+    }
+  }
+}
+
+void ModuleManager::compact_module_nets(const ModuleId& module) {
+  /* Validate the module id */
+  VTR_ASSERT(valid_module_id(module));
+
+  size_t num_terminals = 0;
+  for (size_t inet = 0; inet < num_nets_[module]; ++inet) {
+    num_terminals += net_src_spans_[module][ModuleNetId(inet)].size + net_sink_spans_[module][ModuleNetId(inet)].size;
+  }
+
+  /* Store the sources and then the sinks of each net, in the order of the nets, with no spare room */
+  std::vector<NetTerminal> compact_terminals;
+  compact_terminals.reserve(num_terminals);
+  for (size_t inet = 0; inet < num_nets_[module]; ++inet) {
+    ModuleNetId net = ModuleNetId(inet);
+    for (NetTerminalSpan* span : {&net_src_spans_[module][net], &net_sink_spans_[module][net]}) {
+      size_t new_begin = compact_terminals.size();
+      compact_terminals.insert(compact_terminals.end(),
+                               net_terminals_[module].begin() + span->begin,
+                               net_terminals_[module].begin() + span->begin + span->size);
+      span->begin = new_begin;
+      span->capacity = span->size;
+    }
+  }
+  net_terminals_[module].swap(compact_terminals);
+
+  net_names_[module].shrink_to_fit();
+  net_src_spans_[module].shrink_to_fit();
+  net_sink_spans_[module].shrink_to_fit();
+}
+
 /******************************************************************************
  * Public Deconstructor
  ******************************************************************************/
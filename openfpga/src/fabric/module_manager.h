@@ -10,6 +10,7 @@
 #include "vtr_vector.h"
 #include "vtr_geometry.h"
 #include "module_manager_fwd.h"
+#include "module_net_batch.h"
 #include "openfpga_port.h"
 
 /* begin namespace openfpga */
@@ -67,6 +68,14 @@ class ModuleManager {
     };
 
   public: /* Public Constructors */
+    /* Create a fragment of this module manager, which includes
+     * all the modules with the same ids, names, usages and ports,
+     * but none of their children, configurable children and nets.
+     * This is all that is required to instanciate the modules
+     * when building new modules in the fragment,
+     * which are then added back by add_module_from_fragment()
+     */
+    ModuleManager create_fragment() const;
 
   public: /* Type implementations */
     /*
@@ -115,16 +124,55 @@ class ModuleManager {
         const std::unordered_set<ID>& invalid_ids_;
     };
 
+    /*
+     * This class (forward delcared above) is a template used to represent the ids
+     * of the sources (sinks) of a net, which are 0, 1, ..., size - 1 for all the nets.
+     * The ids are calculated from the iterator value, so that a range of ids
+     * stays valid when nets or terminals are added to the module manager.
+     */
+    template<class ID>
+    class terminal_id_iterator : public std::iterator<std::bidirectional_iterator_tag, ID> {
+      public:
+        typedef typename std::iterator<std::bidirectional_iterator_tag, ID>::value_type value_type;
+        typedef typename std::iterator<std::bidirectional_iterator_tag, ID>::iterator iterator;
+
+        explicit terminal_id_iterator(value_type init)
+            : value_(init) {}
+
+        //Advance to the next ID value
+        iterator operator++() {
+            value_ = ID(size_t(value_) + 1);
+            return *this;
+        }
+
+        //Advance to the previous ID value
+        iterator operator--() {
+            value_ = ID(size_t(value_) - 1);
+            return *this;
+        }
+
+        //Dereference the iterator
+        value_type operator*() const { return value_; }
+
+        friend bool operator==(const terminal_id_iterator<ID> lhs, const terminal_id_iterator<ID> rhs) { return lhs.value_ == rhs.value_; }
+        friend bool operator!=(const terminal_id_iterator<ID> lhs, const terminal_id_iterator<ID> rhs) { return !(lhs == rhs); }
+
+      private:
+        value_type value_;
+    };
+
   public: /* Types and ranges */
     //Lazy iterator utility forward declaration
     template<class ID>
     class lazy_id_iterator;
+    template<class ID>
+    class terminal_id_iterator;
 
     typedef vtr::vector<ModuleId, ModuleId>::const_iterator module_iterator;
     typedef vtr::vector<ModulePortId, ModulePortId>::const_iterator module_port_iterator;
     typedef lazy_id_iterator<ModuleNetId> module_net_iterator;
-    typedef vtr::vector<ModuleNetSrcId, ModuleNetSrcId>::const_iterator module_net_src_iterator;
-    typedef vtr::vector<ModuleNetSinkId, ModuleNetSinkId>::const_iterator module_net_sink_iterator;
+    typedef terminal_id_iterator<ModuleNetSrcId> module_net_src_iterator;
+    typedef terminal_id_iterator<ModuleNetSinkId> module_net_sink_iterator;
     typedef vtr::vector<ConfigRegionId, ConfigRegionId>::const_iterator region_iterator;
 
     typedef vtr::Range<module_iterator> module_range;
@@ -233,11 +281,40 @@ class ModuleManager {
                         const ModuleId& sink_module, const size_t& instance_id,
                         const ModulePortId& sink_port, const size_t& sink_pin);
 
+  private: /* Private data structures */
+    /* A source or a sink of a net: a pin of the module or of an instance of a child module */
+    struct NetTerminal {
+      ModuleId module;
+      ModulePortId port;
+      size_t instance;
+      size_t pin;
+    };
+
+    /* Location of the sources (or the sinks) of a net in the terminal array of its module */
+    struct NetTerminalSpan {
+      size_t begin = 0;
+      size_t size = 0;
+      size_t capacity = 0;
+    };
+
   private: /* Private accessors */
     size_t find_child_module_index_in_parent_module(const ModuleId& parent_module, const ModuleId& child_module) const;
+  private: /* Private mutators */
+    /* Make sure that a span of net terminals has room for a number of terminals */
+    void reserve_net_terminal_span(const ModuleId& module, NetTerminalSpan& span, const size_t& num_terminals);
+    /* Add a terminal at the end of a span of net terminals */
+    void add_net_terminal(const ModuleId& module, NetTerminalSpan& span, const NetTerminal& terminal);
   public: /* Public mutators */
     /* Add a module */
     ModuleId add_module(const std::string& name);
+    /* Add a copy of a module built in another module manager, called a fragment.
+     * The fragment must be created by create_fragment() before the module is built,
+     * so that the child modules of the module have the same ids in both module managers.
+     * This allows modules to be built concurrently in separated fragments,
+     * and then merged in a fixed order.
+     * Return an invalid id if the module name is already used
+     */
+    ModuleId add_module_from_fragment(const ModuleManager& fragment, const ModuleId& fragment_module);
     /* Add a port to a module */
     ModulePortId add_port(const ModuleId& module, 
                           const BasicPort& port_info, const enum e_module_port_type& port_type);
@@ -316,6 +393,18 @@ class ModuleManager {
     ModuleNetSinkId add_module_net_sink(const ModuleId& module, const ModuleNetId& net,
                                         const ModuleId& sink_module, const size_t& instance_id,
                                         const ModulePortId& sink_port, const size_t& sink_pin);
+
+    /* Add all the nets of a batch to the connection graph of the module, in order.
+     * As create_module_source_pin_net() does, a net is only created when its source pin
+     * does not drive any net of the module yet. Otherwise, the sinks are added to the existing net.
+     * Memory is reserved for all the nets of the batch at once
+     */
+    void add_module_net_batch(const ModuleId& module, const ModuleNetBatch& net_batch);
+
+    /* Store the sources and sinks of the nets of a module contiguously, in the order of the nets,
+     * and release the spare memory. Call it once the nets of a module are built
+     */
+    void compact_module_nets(const ModuleId& module);
   public: /* Public deconstructors */
     /* This is a strong function which will remove all the configurable children 
      * under a given parent module
@@ -389,16 +478,15 @@ class ModuleManager {
     vtr::vector<ModuleId, std::unordered_set<ModuleNetId>> invalid_net_ids_;   /* Invalid net ids */
     vtr::vector<ModuleId, vtr::vector<ModuleNetId, std::string>> net_names_;    /* Name of net */ 
 
-    vtr::vector<ModuleId, vtr::vector<ModuleNetId, vtr::vector<ModuleNetSrcId, ModuleNetSrcId>>> net_src_ids_;  /* Unique id of the source that drive the net */ 
-    vtr::vector<ModuleId, vtr::vector<ModuleNetId, vtr::vector<ModuleNetSrcId, size_t>>> net_src_terminal_ids_;  /* Pin ids that drive the net */ 
-    vtr::vector<ModuleId, vtr::vector<ModuleNetId, vtr::vector<ModuleNetSrcId, size_t>>> net_src_instance_ids_;  /* Pin ids that drive the net */ 
-    vtr::vector<ModuleId, vtr::vector<ModuleNetId, vtr::vector<ModuleNetSrcId, size_t>>> net_src_pin_ids_;  /* Pin ids that drive the net */ 
-
-
-    vtr::vector<ModuleId, vtr::vector<ModuleNetId, vtr::vector<ModuleNetSinkId, ModuleNetSinkId>>> net_sink_ids_;  /* Unique ids of the sink that the net drives */ 
-    vtr::vector<ModuleId, vtr::vector<ModuleNetId, vtr::vector<ModuleNetSinkId, size_t>>> net_sink_terminal_ids_;  /* Pin ids that the net drives */ 
-    vtr::vector<ModuleId, vtr::vector<ModuleNetId, vtr::vector<ModuleNetSinkId, size_t>>> net_sink_instance_ids_;  /* Pin ids that drive the net */ 
-    vtr::vector<ModuleId, vtr::vector<ModuleNetId, vtr::vector<ModuleNetSinkId, size_t>>> net_sink_pin_ids_;  /* Pin ids that drive the net */ 
+    /* Sources and sinks of the nets of each module.
+     * All the terminals of the nets of a module are stored in a single array,
+     * where each net owns a span for its sources and a span for its sinks.
+     * When a span is full, it is moved to the end of the array, leaving a hole,
+     * which is removed by compact_module_nets()
+     */
+    vtr::vector<ModuleId, std::vector<NetTerminal>> net_terminals_;
+    vtr::vector<ModuleId, vtr::vector<ModuleNetId, NetTerminalSpan>> net_src_spans_;
+    vtr::vector<ModuleId, vtr::vector<ModuleNetId, NetTerminalSpan>> net_sink_spans_;
 
     /* fast look-up for module */
     std::map<std::string, ModuleId> name_id_map_;
@@ -409,11 +497,6 @@ class ModuleManager {
     /* fast look-up for nets */
     typedef vtr::vector<ModuleId, std::map<ModuleId, std::vector<std::map<ModulePortId, std::vector<ModuleNetId>>>>> NetLookup;
     mutable NetLookup net_lookup_; /* [module_ids][module_ids][instance_ids][port_ids][pin_ids] */ 
-
-    /* Store pairs of a module and a port, which are frequently used in net terminals
-     * (either source or sink)
-     */
-    std::vector<std::pair<ModuleId, ModulePortId>> net_terminal_storage_;
 };
 
 } /* end namespace openfpga */
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Memember functions for data structure ModuleNetBatch
+ ******************************************************************************/
+#include "vtr_assert.h"
+
+#include "module_net_batch.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+size_t ModuleNetBatch::num_nets() const {
+  return net_sources_.size();
+}
+
+size_t ModuleNetBatch::num_sinks() const {
+  return sinks_.size();
+}
+
+const ModuleNetTerminal& ModuleNetBatch::net_source(const size_t& inet) const {
+  VTR_ASSERT_SAFE(inet < net_sources_.size());
+  return net_sources_[inet];
+}
+
+size_t ModuleNetBatch::net_sink_begin(const size_t& inet) const {
+  VTR_ASSERT_SAFE(inet < net_sources_.size());
+  return net_sink_offsets_[inet];
+}
+
+size_t ModuleNetBatch::net_sink_end(const size_t& inet) const {
+  VTR_ASSERT_SAFE(inet < net_sources_.size());
+  if (inet == net_sources_.size() - 1) {
+    return sinks_.size();
+  }
+  return net_sink_offsets_[inet + 1];
+}
+
+const ModuleNetTerminal& ModuleNetBatch::sink(const size_t& isink) const {
+  VTR_ASSERT_SAFE(isink < sinks_.size());
+  return sinks_[isink];
+}
+
+/**************************************************
+ * Public Mutators
+ *************************************************/
+void ModuleNetBatch::reserve(const size_t& num_nets, const size_t& num_sinks) {
+  net_sources_.reserve(num_nets);
+  net_sink_offsets_.reserve(num_nets);
+  sinks_.reserve(num_sinks);
+}
+
+size_t ModuleNetBatch::add_net(const ModuleId& src_module, const size_t& src_instance,
+                               const ModulePortId& src_port, const size_t& src_pin) {
+  net_sources_.push_back({src_module, src_instance, src_port, src_pin});
+  net_sink_offsets_.push_back(sinks_.size());
+  return net_sources_.size() - 1;
+}
+
+void ModuleNetBatch::add_net_sink(const ModuleId& sink_module, const size_t& sink_instance,
+                                  const ModulePortId& sink_port, const size_t& sink_pin) {
+  /* A sink must follow the net it belongs to */
+  VTR_ASSERT(!net_sources_.empty());
+  sinks_.push_back({sink_module, sink_instance, sink_port, sink_pin});
+}
+
+} /* end namespace openfpga */
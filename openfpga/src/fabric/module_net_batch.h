@@ -0,0 +1,64 @@
+#ifndef MODULE_NET_BATCH_H
+#define MODULE_NET_BATCH_H
+
+#include <vector>
+#include "module_manager_fwd.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/******************************************************************************
+ * A pin of a module, or of an instance of a child module,
+ * which is a source or a sink of a module net
+ ******************************************************************************/
+struct ModuleNetTerminal {
+  ModuleId module;
+  size_t instance;
+  ModulePortId port;
+  size_t pin;
+};
+
+/******************************************************************************
+ * This files includes a data structure to collect the nets of a module
+ * before adding them to the module manager, in bulk.
+ *
+ * Each net of the batch has one source pin and a list of sink pins.
+ * All the terminals are stored in flat arrays, so that a batch can be filled
+ * without any allocation per net, once reserved.
+ *
+ * A batch does not depend on the module manager, so that several batches
+ * can be filled in parallel (e.g., one per row of GSBs) and then added
+ * in order by ModuleManager::add_module_net_batch()
+ ******************************************************************************/
+class ModuleNetBatch {
+  public: /* Accessors */
+    size_t num_nets() const;
+    size_t num_sinks() const;
+
+    const ModuleNetTerminal& net_source(const size_t& inet) const;
+    /* Sinks of a net are stored in [net_sink_begin(), net_sink_end()) of the sinks */
+    size_t net_sink_begin(const size_t& inet) const;
+    size_t net_sink_end(const size_t& inet) const;
+    const ModuleNetTerminal& sink(const size_t& isink) const;
+
+  public: /* Mutators */
+    void reserve(const size_t& num_nets, const size_t& num_sinks);
+
+    /* Add a net driven by a pin, and return its index in the batch */
+    size_t add_net(const ModuleId& src_module, const size_t& src_instance,
+                   const ModulePortId& src_port, const size_t& src_pin);
+
+    /* Add a sink to the last net of the batch */
+    void add_net_sink(const ModuleId& sink_module, const size_t& sink_instance,
+                      const ModulePortId& sink_port, const size_t& sink_pin);
+
+  private: /* Internal data */
+    std::vector<ModuleNetTerminal> net_sources_;
+    /* Offsets of the first sink of each net in the sink list */
+    std::vector<size_t> net_sink_offsets_;
+    std::vector<ModuleNetTerminal> sinks_;
+};
+
+} /* end namespace openfpga */
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef BUILD_BITSTREAM_FRAGMENTS_H
+#define BUILD_BITSTREAM_FRAGMENTS_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <vector>
+#include "vtr_parallel.h"
+#include "bitstream_manager.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * Build the blocks of a list of items (e.g., grids or routing blocks)
+ * under a parent block, with num_jobs threads.
+ *
+ * The items are split into contiguous chunks. The first chunk is built
+ * in the bitstream manager directly, while the other chunks are built
+ * in fragments, i.e., separated bitstream managers whose first block
+ * stands for the parent block. The fragments are then added in order,
+ * so that the bitstream manager is the same as the one built with 1 thread.
+ *
+ * The function build_item(bitstream_manager, parent_block, item) must
+ * only add blocks under the parent block, and must only read shared data
+ *******************************************************************/
+template<class F>
+void build_bitstream_blocks_in_fragments(BitstreamManager& bitstream_manager,
+                                         const ConfigBlockId& parent_block,
+                                         const size_t& num_items,
+                                         const size_t& num_jobs,
+                                         F&& build_item) {
+  size_t num_chunks = vtr::num_parallel_chunks(num_items, num_jobs);
+
+  std::vector<BitstreamManager> fragments(num_chunks > 1 ? num_chunks - 1 : 0);
+  for (BitstreamManager& fragment : fragments) {
+    fragment.add_block(bitstream_manager.block_name(parent_block));
+  }
+
+  vtr::parallel_for_chunks(num_items, num_jobs, [&](size_t ichunk, size_t begin, size_t end) {
+    BitstreamManager& chunk_bitstream_manager = (0 == ichunk) ? bitstream_manager : fragments[ichunk - 1];
+    ConfigBlockId chunk_parent_block = (0 == ichunk) ? parent_block : ConfigBlockId(0);
+    for (size_t item = begin; item < end; ++item) {
+      build_item(chunk_bitstream_manager, chunk_parent_block, item);
+    }
+  });
+
+  for (const BitstreamManager& fragment : fragments) {
+    bitstream_manager.add_child_blocks_from_fragment(parent_block, fragment);
+  }
+}
+
+} /* end namespace openfpga */
+
+#endif
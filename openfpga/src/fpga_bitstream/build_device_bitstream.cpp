@@ -128,9 +128,13 @@ size_t rec_estimate_device_bitstream_num_bits(const ModuleManager& module_manage
  * Note: this function create a bitstream which is binding to the module graphs
  * of the FPGA fabric that FPGA-X2P generates!
  * But it can be used to output a generic bitstream for VPR mapping FPGA
+ *
+ * Grids and routing blocks are built with num_jobs threads.
+ * The blocks and bits get the same ids whatever the number of threads
  *******************************************************************/
 BitstreamManager build_device_bitstream(const VprContext& vpr_ctx,
                                         const OpenfpgaContext& openfpga_ctx,
+                                        const size_t& num_jobs,
                                         const bool& verbose) {
 
   std::string timer_message = std::string("\nBuild fabric-independent bitstream for implementation '") + vpr_ctx.atom().nlist.netlist_name() + std::string("'\n");
@@ -177,6 +181,7 @@ BitstreamManager build_device_bitstream(const VprContext& vpr_ctx,
                        openfpga_ctx.vpr_clustering_annotation(),
                        openfpga_ctx.vpr_placement_annotation(),
                        openfpga_ctx.vpr_bitstream_annotation(),
+                       num_jobs,
                        verbose);
   VTR_LOGV(verbose, "Done\n");
 
@@ -191,7 +196,8 @@ BitstreamManager build_device_bitstream(const VprContext& vpr_ctx,
                           openfpga_ctx.vpr_routing_annotation(),
                           vpr_ctx.device().rr_graph,
                           openfpga_ctx.device_rr_gsb(),
-                          openfpga_ctx.flow_manager().compress_routing());
+                          openfpga_ctx.flow_manager().compress_routing(),
+                          num_jobs);
   VTR_LOGV(verbose, "Done\n");
 
   VTR_LOGV(verbose,
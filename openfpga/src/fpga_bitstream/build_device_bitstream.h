@@ -17,6 +17,7 @@ namespace openfpga {
 
 BitstreamManager build_device_bitstream(const VprContext& vpr_ctx,
                                         const OpenfpgaContext& openfpga_ctx,
+                                        const size_t& num_jobs,
                                         const bool& verbose);
 
 } /* end namespace openfpga */
@@ -9,6 +9,7 @@
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
+#include "vtr_parallel.h"
 
 /* Headers from openfpgautil library */
 #include "openfpga_decode.h"
@@ -17,6 +18,7 @@
 #include "openfpga_naming.h"
 
 #include "decoder_library_utils.h"
+#include "memory_utils.h"
 #include "bitstream_manager_utils.h"
 #include "build_fabric_bitstream.h"
 #include "build_fabric_bitstream_memory_bank.h"
@@ -42,6 +44,7 @@ void rec_build_module_fabric_dependent_chain_bitstream(const BitstreamManager& b
                                                        const ModuleId& top_module,
                                                        const ModuleId& parent_module,
                                                        const ConfigRegionId& config_region,
+                                                       FabricBitId& cur_fabric_bit,
                                                        FabricBitstream& fabric_bitstream,
                                                        const FabricBitRegionId& fabric_bitstream_region) {
 
@@ -66,6 +69,7 @@ void rec_build_module_fabric_dependent_chain_bitstream(const BitstreamManager& b
                                                           module_manager, top_module,
                                                           child_module,
                                                           config_region,
+                                                          cur_fabric_bit,
                                                           fabric_bitstream,
                                                           fabric_bitstream_region);
       }
@@ -86,6 +90,7 @@ void rec_build_module_fabric_dependent_chain_bitstream(const BitstreamManager& b
                                                           module_manager, top_module,
                                                           child_module,
                                                           config_region,
+                                                          cur_fabric_bit,
                                                           fabric_bitstream,
                                                           fabric_bitstream_region);
       }
@@ -99,7 +104,9 @@ void rec_build_module_fabric_dependent_chain_bitstream(const BitstreamManager& b
    * And then, we can return
    */
   for (const ConfigBitId& config_bit : bitstream_manager.block_bits(parent_block)) {
-    FabricBitId fabric_bit = fabric_bitstream.add_bit(config_bit);
+    FabricBitId fabric_bit = cur_fabric_bit;
+    cur_fabric_bit = FabricBitId(size_t(cur_fabric_bit) + 1);
+    fabric_bitstream.set_bit_config_bit(fabric_bit, config_bit);
     fabric_bitstream.add_bit_to_region(fabric_bitstream_region, fabric_bit);
   }
 }
@@ -131,6 +138,7 @@ void rec_build_module_fabric_dependent_memory_bank_bitstream(const BitstreamMana
                                                              const size_t& num_bls,
                                                              const size_t& num_wls, 
                                                              size_t& cur_mem_index,
+                                                             FabricBitId& cur_fabric_bit,
                                                              FabricBitstream& fabric_bitstream,
                                                              const FabricBitRegionId& fabric_bitstream_region) {
 
@@ -174,6 +182,7 @@ void rec_build_module_fabric_dependent_memory_bank_bitstream(const BitstreamMana
                                                                 bl_addr_size, wl_addr_size,
                                                                 num_bls, num_wls,
                                                                 cur_mem_index,
+                                                                cur_fabric_bit,
                                                                 fabric_bitstream,
                                                                 fabric_bitstream_region);
       }
@@ -213,6 +222,7 @@ void rec_build_module_fabric_dependent_memory_bank_bitstream(const BitstreamMana
                                                                 bl_addr_size, wl_addr_size,
                                                                 num_bls, num_wls,
                                                                 cur_mem_index,
+                                                                cur_fabric_bit,
                                                                 fabric_bitstream,
                                                                 fabric_bitstream_region);
       }
@@ -228,7 +238,9 @@ void rec_build_module_fabric_dependent_memory_bank_bitstream(const BitstreamMana
    * And then, we can return
    */
   for (const ConfigBitId& config_bit : bitstream_manager.block_bits(parent_block)) {
-    FabricBitId fabric_bit = fabric_bitstream.add_bit(config_bit);
+    FabricBitId fabric_bit = cur_fabric_bit;
+    cur_fabric_bit = FabricBitId(size_t(cur_fabric_bit) + 1);
+    fabric_bitstream.set_bit_config_bit(fabric_bit, config_bit);
   
     /* Find BL address */
     size_t cur_bl_index = std::floor(cur_mem_index / num_bls);
@@ -287,6 +299,7 @@ void rec_build_module_fabric_dependent_frame_bitstream(const BitstreamManager& b
                                                        const std::vector<ModuleId>& parent_modules,
                                                        const std::vector<char>& addr_code,
                                                        const char& bitstream_dont_care_char,
+                                                       FabricBitId& cur_fabric_bit,
                                                        FabricBitstream& fabric_bitstream,
                                                        FabricBitRegionId& fabric_bitstream_region) {
 
@@ -434,6 +447,7 @@ void rec_build_module_fabric_dependent_frame_bitstream(const BitstreamManager& b
                                                         child_modules,
                                                         child_addr_code,
                                                         bitstream_dont_care_char,
+                                                        cur_fabric_bit,
                                                         fabric_bitstream,
                                                         fabric_bitstream_region);
     }
@@ -471,7 +485,9 @@ void rec_build_module_fabric_dependent_frame_bitstream(const BitstreamManager& b
 
     child_addr_code.insert(child_addr_code.begin(), addr_bits_vec.begin(), addr_bits_vec.end());
 
-    const FabricBitId& fabric_bit = fabric_bitstream.add_bit(config_bit);
+    FabricBitId fabric_bit = cur_fabric_bit;
+    cur_fabric_bit = FabricBitId(size_t(cur_fabric_bit) + 1);
+    fabric_bitstream.set_bit_config_bit(fabric_bit, config_bit);
 
     /* Set address */
     fabric_bitstream.set_bit_address(fabric_bit, child_addr_code);
@@ -484,6 +500,110 @@ void rec_build_module_fabric_dependent_frame_bitstream(const BitstreamManager& b
   }
 }
 
+/********************************************************************
+ * The bits of a configuration region in the fabric bitstream.
+ * They are a contiguous slice [first_bit, first_bit + num_bits)
+ * of the fabric bitstream, so that regions can be built independently
+ *******************************************************************/
+struct FabricBitstreamRegionSlice {
+  ConfigRegionId config_region;
+  FabricBitRegionId fabric_bitstream_region;
+  FabricBitId first_bit;
+  size_t num_bits;
+};
+
+/********************************************************************
+ * Count the number of configuration bits in a configuration region,
+ * which are all the bits under the blocks of its configurable children
+ * Decoders at the top-level module are bypassed, as they have no bits 
+ *******************************************************************/
+static 
+size_t find_fabric_dependent_region_num_bits(const ConfigProtocol& config_protocol,
+                                             const BitstreamManager& bitstream_manager,
+                                             const ConfigBlockId& top_block,
+                                             const ModuleManager& module_manager,
+                                             const ModuleId& top_module,
+                                             const ConfigRegionId& config_region) {
+  std::vector<ModuleId> configurable_children = module_manager.region_configurable_children(top_module, config_region);
+  std::vector<size_t> configurable_child_instances = module_manager.region_configurable_child_instances(top_module, config_region);
+
+  size_t num_configurable_children = configurable_children.size();
+  num_configurable_children -= estimate_num_configurable_children_to_skip_by_config_protocol(config_protocol, num_configurable_children);
+
+  size_t num_bits = 0;
+  for (size_t child_id = 0; child_id < num_configurable_children; ++child_id) {
+    std::string instance_name = module_manager.instance_name(top_module, configurable_children[child_id], configurable_child_instances[child_id]);
+    ConfigBlockId child_block = bitstream_manager.find_child_block(top_block, instance_name); 
+    /* Bypass the children without any bits */
+    if (false == bitstream_manager.valid_block_id(child_block)) {
+      continue;
+    }
+    num_bits += rec_find_bitstream_manager_block_sum_of_bits(bitstream_manager, child_block);
+  }
+
+  return num_bits;
+}
+
+/********************************************************************
+ * Allocate all the bits of the fabric bitstream, and a slice of bits
+ * for each of the given configuration regions.
+ * The slices follow the order of the regions, so that the fabric bitstream
+ * is the same as the one built by adding the bits region by region
+ *******************************************************************/
+static 
+std::vector<FabricBitstreamRegionSlice> allocate_fabric_dependent_bitstream_regions(const ConfigProtocol& config_protocol,
+                                                                                    const BitstreamManager& bitstream_manager,
+                                                                                    const ConfigBlockId& top_block,
+                                                                                    const ModuleManager& module_manager,
+                                                                                    const ModuleId& top_module,
+                                                                                    const std::vector<ConfigRegionId>& config_regions,
+                                                                                    FabricBitstream& fabric_bitstream) {
+  std::vector<FabricBitstreamRegionSlice> region_slices;
+  region_slices.reserve(config_regions.size());
+  fabric_bitstream.reserve_regions(config_regions.size());
+
+  size_t num_bits = 0;
+  for (const ConfigRegionId& config_region : config_regions) {
+    FabricBitstreamRegionSlice region_slice;
+    region_slice.config_region = config_region;
+    region_slice.fabric_bitstream_region = fabric_bitstream.add_region();
+    region_slice.first_bit = FabricBitId(num_bits);
+    region_slice.num_bits = find_fabric_dependent_region_num_bits(config_protocol,
+                                                                  bitstream_manager, top_block,
+                                                                  module_manager, top_module,
+                                                                  config_region);
+    fabric_bitstream.reserve_region_bits(region_slice.fabric_bitstream_region, region_slice.num_bits);
+    num_bits += region_slice.num_bits;
+    region_slices.push_back(region_slice);
+  }
+
+  fabric_bitstream.allocate_bits(num_bits);
+
+  return region_slices;
+}
+
+/********************************************************************
+ * Build the bitstream of each configuration region in its own slice.
+ * Regions are independent, so they are built in parallel with num_jobs threads
+ * The build_region function should fill the slice of a region,
+ * starting from the bit given as a cursor, and advance the cursor.
+ *******************************************************************/
+template<class F>
+static 
+void build_fabric_dependent_bitstream_regions(const std::vector<FabricBitstreamRegionSlice>& region_slices,
+                                              const size_t& num_jobs,
+                                              F&& build_region) {
+  vtr::parallel_for_chunks(region_slices.size(), num_jobs, [&](size_t /*ichunk*/, size_t begin, size_t end) {
+    for (size_t islice = begin; islice < end; ++islice) {
+      const FabricBitstreamRegionSlice& region_slice = region_slices[islice];
+      FabricBitId cur_fabric_bit = region_slice.first_bit;
+      build_region(region_slice, cur_fabric_bit);
+      /* Each region must fill its slice exactly */
+      VTR_ASSERT(size_t(cur_fabric_bit) == size_t(region_slice.first_bit) + region_slice.num_bits);
+    }
+  });
+}
+
 /********************************************************************
  * Main function to build a fabric-dependent bitstream
  * by considering the configuration protocol types 
@@ -495,39 +615,37 @@ void build_module_fabric_dependent_bitstream(const ConfigProtocol& config_protoc
                                              const ConfigBlockId& top_block,
                                              const ModuleManager& module_manager,
                                              const ModuleId& top_module,
+                                             const size_t& num_jobs,
                                              FabricBitstream& fabric_bitstream) {
 
-  switch (config_protocol.type()) {
-  case CONFIG_MEM_STANDALONE: {
-    /* Reserve bits before build-up */
-    fabric_bitstream.reserve_bits(bitstream_manager.num_bits());
-
-    for (const ConfigRegionId& config_region : module_manager.regions(top_module)) {
-      FabricBitRegionId fabric_bitstream_region = fabric_bitstream.add_region();
-      rec_build_module_fabric_dependent_chain_bitstream(bitstream_manager, top_block,
-                                                        module_manager, top_module, 
-                                                        top_module,
-                                                        config_region,
-                                                        fabric_bitstream,
-                                                        fabric_bitstream_region);
-    }
-
-    break;
+  std::vector<ConfigRegionId> config_regions;
+  for (const ConfigRegionId& config_region : module_manager.regions(top_module)) {
+    config_regions.push_back(config_region);
   }
-  case CONFIG_MEM_SCAN_CHAIN: { 
-    /* Reserve bits before build-up */
-    fabric_bitstream.reserve_bits(bitstream_manager.num_bits());
 
-    for (const ConfigRegionId& config_region : module_manager.regions(top_module)) {
-      FabricBitRegionId fabric_bitstream_region = fabric_bitstream.add_region();
+  switch (config_protocol.type()) {
+  case CONFIG_MEM_STANDALONE: 
+  case CONFIG_MEM_SCAN_CHAIN: { 
+    /* Allocate bits before build-up */
+    std::vector<FabricBitstreamRegionSlice> region_slices = allocate_fabric_dependent_bitstream_regions(config_protocol,
+                                                                                                       bitstream_manager, top_block,
+                                                                                                       module_manager, top_module,
+                                                                                                       config_regions,
+                                                                                                       fabric_bitstream);
+
+    build_fabric_dependent_bitstream_regions(region_slices, num_jobs, [&](const FabricBitstreamRegionSlice& region_slice, FabricBitId& cur_fabric_bit) {
       rec_build_module_fabric_dependent_chain_bitstream(bitstream_manager, top_block,
                                                         module_manager, top_module, 
                                                         top_module,
-                                                        config_region,
+                                                        region_slice.config_region,
+                                                        cur_fabric_bit,
                                                         fabric_bitstream,
-                                                        fabric_bitstream_region);
-      fabric_bitstream.reverse_region_bits(fabric_bitstream_region);
-    }
+                                                        region_slice.fabric_bitstream_region);
+      /* Configuration chains are loaded from the tail */
+      if (CONFIG_MEM_SCAN_CHAIN == config_protocol.type()) {
+        fabric_bitstream.reverse_region_bits(region_slice.fabric_bitstream_region);
+      }
+    });
     break;
   }
   case CONFIG_MEM_MEMORY_BANK: { 
@@ -539,19 +657,23 @@ void build_module_fabric_dependent_bitstream(const ConfigProtocol& config_protoc
     ModulePortId wl_addr_port = module_manager.find_module_port(top_module, std::string(DECODER_WL_ADDRESS_PORT_NAME));
     BasicPort wl_addr_port_info = module_manager.module_port(top_module, wl_addr_port);
 
-    /* Reserve bits before build-up */
+    /* Allocate bits before build-up */
     fabric_bitstream.set_use_address(true);
     fabric_bitstream.set_use_wl_address(true);
     fabric_bitstream.set_bl_address_length(bl_addr_port_info.get_width());
     fabric_bitstream.set_wl_address_length(wl_addr_port_info.get_width());
-    fabric_bitstream.reserve_bits(bitstream_manager.num_bits());
+    std::vector<FabricBitstreamRegionSlice> region_slices = allocate_fabric_dependent_bitstream_regions(config_protocol,
+                                                                                                       bitstream_manager, top_block,
+                                                                                                       module_manager, top_module,
+                                                                                                       config_regions,
+                                                                                                       fabric_bitstream);
 
     /* Build bitstreams by region */
-    for (const ConfigRegionId& config_region : module_manager.regions(top_module)) {
+    build_fabric_dependent_bitstream_regions(region_slices, num_jobs, [&](const FabricBitstreamRegionSlice& region_slice, FabricBitId& cur_fabric_bit) {
       size_t cur_mem_index = 0;
 
       /* Find port information for local BL and WL decoder in this region */
-      std::vector<ModuleId> configurable_children = module_manager.region_configurable_children(top_module, config_region);
+      std::vector<ModuleId> configurable_children = module_manager.region_configurable_children(top_module, region_slice.config_region);
       VTR_ASSERT(2 <= configurable_children.size()); 
       ModuleId bl_decoder_module = configurable_children[configurable_children.size() - 2];
       ModuleId wl_decoder_module = configurable_children[configurable_children.size() - 1];
@@ -563,18 +685,18 @@ void build_module_fabric_dependent_bitstream(const ConfigProtocol& config_protoc
       BasicPort wl_port_info = module_manager.module_port(wl_decoder_module, wl_port);
 
       /* Build the bitstream for all the blocks in this region */
-      FabricBitRegionId fabric_bitstream_region = fabric_bitstream.add_region();
       rec_build_module_fabric_dependent_memory_bank_bitstream(bitstream_manager, top_block,
                                                               module_manager, top_module, top_module, 
-                                                              config_region,
+                                                              region_slice.config_region,
                                                               bl_addr_port_info.get_width(),
                                                               wl_addr_port_info.get_width(),
                                                               bl_port_info.get_width(),
                                                               wl_port_info.get_width(),
                                                               cur_mem_index,
+                                                              cur_fabric_bit,
                                                               fabric_bitstream,
-                                                              fabric_bitstream_region);
-    }
+                                                              region_slice.fabric_bitstream_region);
+    });
     break;
   }
   case CONFIG_MEM_QL_MEMORY_BANK: { 
@@ -590,11 +712,6 @@ void build_module_fabric_dependent_bitstream(const ConfigProtocol& config_protoc
     ModulePortId addr_port = module_manager.find_module_port(top_module, std::string(DECODER_ADDRESS_PORT_NAME));
     BasicPort addr_port_info = module_manager.module_port(top_module, addr_port);
 
-    /* Reserve bits before build-up */
-    fabric_bitstream.set_use_address(true);
-    fabric_bitstream.reserve_bits(bitstream_manager.num_bits());
-    fabric_bitstream.set_address_length(addr_port_info.get_width());
-
     /* Avoid use don't care if there is only a region */
     char bitstream_dont_care_char = DONT_CARE_CHAR;
     if (1 == module_manager.regions(top_module).size()) {
@@ -616,13 +733,25 @@ void build_module_fabric_dependent_bitstream(const ConfigProtocol& config_protoc
       max_decoder_addr_size = std::max(max_decoder_addr_size, decoder_addr_port.get_width()); 
     }
 
-    for (const ConfigRegionId& config_region : module_manager.regions(top_module)) {
-      std::vector<ModuleId> configurable_children = module_manager.region_configurable_children(top_module, config_region);
-
-      /* Bypass non-configurable regions */
-      if (0 == configurable_children.size()) {
-        continue;
+    /* Bypass non-configurable regions */
+    std::vector<ConfigRegionId> configurable_regions;
+    for (const ConfigRegionId& config_region : config_regions) {
+      if (0 < module_manager.region_configurable_children(top_module, config_region).size()) {
+        configurable_regions.push_back(config_region);
       }
+    }
+
+    /* Allocate bits before build-up */
+    fabric_bitstream.set_use_address(true);
+    fabric_bitstream.set_address_length(addr_port_info.get_width());
+    std::vector<FabricBitstreamRegionSlice> region_slices = allocate_fabric_dependent_bitstream_regions(config_protocol,
+                                                                                                       bitstream_manager, top_block,
+                                                                                                       module_manager, top_module,
+                                                                                                       configurable_regions,
+                                                                                                       fabric_bitstream);
+
+    build_fabric_dependent_bitstream_regions(region_slices, num_jobs, [&](const FabricBitstreamRegionSlice& region_slice, FabricBitId& cur_fabric_bit) {
+      std::vector<ModuleId> configurable_children = module_manager.region_configurable_children(top_module, region_slice.config_region);
 
       /* Find the idle address bit which should be added to the head of the address bit
        * This depends on the number of address bits required by this region
@@ -644,18 +773,19 @@ void build_module_fabric_dependent_bitstream(const ConfigProtocol& config_protoc
       VTR_ASSERT(max_decoder_addr_size >= decoder_addr_port.get_width());
       std::vector<char> idle_addr_bits(max_decoder_addr_size - decoder_addr_port.get_width(), bitstream_dont_care_char);
      
-      FabricBitRegionId fabric_bitstream_region = fabric_bitstream.add_region();
+      FabricBitRegionId fabric_bitstream_region = region_slice.fabric_bitstream_region;
       rec_build_module_fabric_dependent_frame_bitstream(bitstream_manager,
                                                         std::vector<ConfigBlockId>(1, top_block),
                                                         module_manager,
                                                         top_module,
-                                                        config_region,
+                                                        region_slice.config_region,
                                                         std::vector<ModuleId>(1, top_module),
-	  												    idle_addr_bits,
+                                                        idle_addr_bits,
                                                         bitstream_dont_care_char,
+                                                        cur_fabric_bit,
                                                         fabric_bitstream,
                                                         fabric_bitstream_region);
-    }
+    });
     break;
   }
   default:
@@ -705,6 +835,7 @@ FabricBitstream build_fabric_dependent_bitstream(const BitstreamManager& bitstre
                                                  const ModuleManager& module_manager,
                                                  const CircuitLibrary& circuit_lib,
                                                  const ConfigProtocol& config_protocol,
+                                                 const size_t& num_jobs,
                                                  const bool& verbose) {
   FabricBitstream fabric_bitstream; 
 
@@ -725,6 +856,7 @@ FabricBitstream build_fabric_dependent_bitstream(const BitstreamManager& bitstre
   build_module_fabric_dependent_bitstream(config_protocol, circuit_lib,
                                           bitstream_manager, top_block[0],
                                           module_manager, top_module, 
+                                          num_jobs,
                                           fabric_bitstream);
 
   VTR_LOGV(verbose,
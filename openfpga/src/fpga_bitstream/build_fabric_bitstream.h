@@ -22,6 +22,7 @@ FabricBitstream build_fabric_dependent_bitstream(const BitstreamManager& bitstre
                                                  const ModuleManager& module_manager,
                                                  const CircuitLibrary& circuit_lib,
                                                  const ConfigProtocol& config_protocol,
+                                                 const size_t& num_jobs,
                                                  const bool& verbose);
 
 } /* end namespace openfpga */
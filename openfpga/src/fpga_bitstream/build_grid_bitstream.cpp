@@ -29,6 +29,7 @@
 #include "build_mux_bitstream.h"
 #include "openfpga_device_grid_utils.h"
 
+#include "build_bitstream_fragments.h"
 #include "build_grid_bitstream.h"
 
 /* begin namespace openfpga */
@@ -750,6 +751,9 @@ void build_physical_block_bitstream(BitstreamManager& bitstream_manager,
  * Generate bitstreams for all the grids, including 
  * 1. core grids that sit in the center of the fabric
  * 2. side grids (I/O grids) that sit in the borders for the fabric
+ *
+ * Grids are independent from each other, so their bitstreams are built
+ * with num_jobs threads, in the same order as with 1 thread
  *******************************************************************/
 void build_grid_bitstream(BitstreamManager& bitstream_manager,
                           const ConfigBlockId& top_block,
@@ -762,9 +766,11 @@ void build_grid_bitstream(BitstreamManager& bitstream_manager,
                           const VprClusteringAnnotation& cluster_annotation,
                           const VprPlacementAnnotation& place_annotation,
                           const VprBitstreamAnnotation& bitstream_annotation,
+                          const size_t& num_jobs,
                           const bool& verbose) {
 
-  VTR_LOGV(verbose, "Generating bitstream for core grids...");
+  /* Collect the grids to build, as (coordinate, border side) pairs */
+  std::vector<std::pair<vtr::Point<size_t>, e_side>> grids_to_build;
 
   /* Generate bitstream for the core logic block one by one */
   for (size_t ix = 1; ix < grids.width() - 1; ++ix) {
@@ -780,17 +786,10 @@ void build_grid_bitstream(BitstreamManager& bitstream_manager,
       }
       /* Add a grid module to top_module*/
       vtr::Point<size_t> grid_coord(ix, iy);
-      build_physical_block_bitstream(bitstream_manager, top_block, module_manager,
-                                     circuit_lib, mux_lib,
-                                     atom_ctx,
-                                     device_annotation, cluster_annotation,
-                                     place_annotation, bitstream_annotation,
-                                     grids, grid_coord, NUM_SIDES);
+      grids_to_build.push_back(std::make_pair(grid_coord, NUM_SIDES));
     }
   }
-  VTR_LOGV(verbose, "Done\n");
-
-  VTR_LOGV(verbose, "Generating bitstream for I/O grids...");
+  size_t num_core_grids = grids_to_build.size();
 
   /* Create the coordinate range for each side of FPGA fabric */
   std::map<e_side, std::vector<vtr::Point<size_t>>> io_coordinates = generate_perimeter_grid_coordinates( grids);
@@ -807,14 +806,22 @@ void build_grid_bitstream(BitstreamManager& bitstream_manager,
         || (0 < grids[io_coordinate.x()][io_coordinate.y()].height_offset) ) {
         continue;
       }
-      build_physical_block_bitstream(bitstream_manager, top_block, module_manager,
-                                     circuit_lib, mux_lib,
-                                     atom_ctx,
-                                     device_annotation, cluster_annotation, 
-                                     place_annotation, bitstream_annotation,
-                                     grids, io_coordinate, io_side);
+      grids_to_build.push_back(std::make_pair(io_coordinate, io_side));
     }
   }
+
+  VTR_LOGV(verbose, "Generating bitstream for %lu core grids and %lu I/O grids...",
+           num_core_grids, grids_to_build.size() - num_core_grids);
+
+  build_bitstream_blocks_in_fragments(bitstream_manager, top_block, grids_to_build.size(), num_jobs,
+                                      [&](BitstreamManager& chunk_bitstream_manager, const ConfigBlockId& chunk_top_block, const size_t& igrid) {
+    build_physical_block_bitstream(chunk_bitstream_manager, chunk_top_block, module_manager,
+                                   circuit_lib, mux_lib,
+                                   atom_ctx,
+                                   device_annotation, cluster_annotation,
+                                   place_annotation, bitstream_annotation,
+                                   grids, grids_to_build[igrid].first, grids_to_build[igrid].second);
+  });
   VTR_LOGV(verbose, "Done\n");
 }
 
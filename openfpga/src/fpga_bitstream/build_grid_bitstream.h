@@ -34,6 +34,7 @@ void build_grid_bitstream(BitstreamManager& bitstream_manager,
                           const VprClusteringAnnotation& cluster_annotation,
                           const VprPlacementAnnotation& place_annotation,
                           const VprBitstreamAnnotation& bitstream_annotation,
+                          const size_t& num_jobs,
                           const bool& verbose);
 
 } /* end namespace openfpga */
@@ -53,6 +53,13 @@ IoMap build_fpga_io_mapping_info(const ModuleManager& module_manager,
     }
   }
 
+  /* Resolve the I/O ports in the location map once, rather than for each I/O block */
+  std::vector<size_t> module_io_port_location_ids;
+  for (const ModulePortId& module_io_port_id : module_io_ports) {
+    const BasicPort& module_io_port = module_manager.module_port(top_module, module_io_port_id);
+    module_io_port_location_ids.push_back(io_location_map.io_port_id(module_io_port.get_name()));
+  }
+
   /* Type mapping between VPR block and Module port */
   std::map<AtomBlockType, ModuleManager::e_module_port_type> atom_block_type_to_module_port_type;
   atom_block_type_to_module_port_type[AtomBlockType::INPAD] = ModuleManager::MODULE_GPIN_PORT;
@@ -75,14 +82,15 @@ IoMap build_fpga_io_mapping_info(const ModuleManager& module_manager,
      *         or should find a GPOUT for OUTPAD
      */ 
     std::pair<ModulePortId, size_t> mapped_module_io_info = std::make_pair(ModulePortId::INVALID(), -1);
-    for (const ModulePortId& module_io_port_id : module_io_ports) {
-      const BasicPort& module_io_port = module_manager.module_port(top_module, module_io_port_id);
+    const t_pl_loc& atom_blk_loc = place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc;
+    for (size_t iport = 0; iport < module_io_ports.size(); ++iport) {
+      const ModulePortId& module_io_port_id = module_io_ports[iport];
 
       /* Find the index of the mapped GPIO in top-level FPGA fabric */
-      size_t temp_io_index = io_location_map.io_index(place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.x,
-                                                      place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.y,
-                                                      place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.z,
-                                                      module_io_port.get_name());
+      size_t temp_io_index = io_location_map.io_index(atom_blk_loc.x,
+                                                      atom_blk_loc.y,
+                                                      atom_blk_loc.z,
+                                                      module_io_port_location_ids[iport]);
 
       /* Bypass invalid index (not mapped to this GPIO port) */
       if (size_t(-1) == temp_io_index) {
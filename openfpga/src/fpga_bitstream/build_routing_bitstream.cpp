@@ -22,6 +22,7 @@
 
 #include "mux_bitstream_constants.h"
 #include "build_mux_bitstream.h"
+#include "build_bitstream_fragments.h"
 #include "build_routing_bitstream.h"
 
 /* begin namespace openfpga */
@@ -150,6 +151,8 @@ void build_switch_block_interc_bitstream(BitstreamManager& bitstream_manager,
                                          const VprDeviceAnnotation& device_annotation,
                                          const VprRoutingAnnotation& routing_annotation,
                                          const RRGSB& rr_gsb,
+                                         const RRGSB& module_sb,
+                                         const t_rr_gsb_side_map& module_side_map,
                                          const e_side& chan_side,
                                          const size_t& chan_node_id) {
 
@@ -160,7 +163,12 @@ void build_switch_block_interc_bitstream(BitstreamManager& bitstream_manager,
 
   /* Determine if the interc lies inside a channel wire, that is interc between segments */
   if (false == rr_gsb.is_sb_node_passing_wire(rr_graph, chan_side, chan_node_id)) {
-    driver_rr_nodes = get_rr_gsb_chan_node_configurable_driver_nodes(rr_graph, rr_gsb, chan_side, chan_node_id);
+    if (true == is_rr_gsb_side_map_identity(module_side_map)) {
+      driver_rr_nodes = get_rr_gsb_chan_node_configurable_driver_nodes(rr_graph, rr_gsb, chan_side, chan_node_id);
+    } else {
+      /* The module is rotated or reflected: follow the order of the multiplexer inputs in the module */
+      driver_rr_nodes = get_rr_gsb_chan_node_configurable_driver_nodes_in_module(rr_graph, rr_gsb, module_sb, module_side_map, chan_side, chan_node_id);
+    }
     /* Special: if there are zero-driver nodes. We skip here */
     if (0 == driver_rr_nodes.size()) {
       return; 
@@ -172,8 +180,10 @@ void build_switch_block_interc_bitstream(BitstreamManager& bitstream_manager,
     /* No bitstream generation required by a special direct connection*/
     return;
   } else if (1 < driver_rr_nodes.size()) {
-    /* Create the block denoting the memory instances that drives this node in Switch Block */
-    std::string mem_block_name = generate_sb_memory_instance_name(SWITCH_BLOCK_MEM_INSTANCE_PREFIX, chan_side, chan_node_id, std::string(""));
+    /* Create the block denoting the memory instances that drives this node in Switch Block 
+     * The memory instance is named after the side of the module
+     */
+    std::string mem_block_name = generate_sb_memory_instance_name(SWITCH_BLOCK_MEM_INSTANCE_PREFIX, module_side_map[size_t(chan_side)], chan_node_id, std::string(""));
     ConfigBlockId mux_mem_block = bitstream_manager.add_block(mem_block_name);
     bitstream_manager.add_child_block(sb_configurable_block, mux_mem_block);
     /* This is a routing multiplexer! Generate bitstream */
@@ -194,6 +204,9 @@ void build_switch_block_interc_bitstream(BitstreamManager& bitstream_manager,
  *
  * Note that the output nodes typically spread over all the sides of a Switch Block
  * So, we will iterate over that.
+ *
+ * The module of the Switch Block may be a rotation or a reflection of it,
+ * whose sides are given by module_side_map
  *******************************************************************/
 static 
 void build_switch_block_bitstream(BitstreamManager& bitstream_manager,
@@ -205,7 +218,9 @@ void build_switch_block_bitstream(BitstreamManager& bitstream_manager,
                                   const VprDeviceAnnotation& device_annotation,
                                   const VprRoutingAnnotation& routing_annotation,
                                   const RRGraph& rr_graph,
-                                  const RRGSB& rr_gsb) {
+                                  const RRGSB& rr_gsb,
+                                  const RRGSB& module_sb,
+                                  const t_rr_gsb_side_map& module_side_map) {
 
   /* Iterate over all the multiplexers */
   for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
@@ -221,7 +236,8 @@ void build_switch_block_bitstream(BitstreamManager& bitstream_manager,
                                           module_manager, 
                                           circuit_lib, mux_lib, rr_graph,
                                           atom_ctx, device_annotation, routing_annotation,
-                                          rr_gsb, side_manager.get_side(), itrack);
+                                          rr_gsb, module_sb, module_side_map,
+                                          side_manager.get_side(), itrack);
     }
   }
 }
@@ -417,6 +433,7 @@ void build_connection_block_bitstream(BitstreamManager& bitstream_manager,
 
 /********************************************************************
  * Create bitstream for a X-direction or Y-direction Connection Blocks
+ * Columns of connection blocks are built with num_jobs threads
  *******************************************************************/
 static 
 void build_connection_block_bitstreams(BitstreamManager& bitstream_manager,
@@ -430,11 +447,13 @@ void build_connection_block_bitstreams(BitstreamManager& bitstream_manager,
                                        const RRGraph& rr_graph,
                                        const DeviceRRGSB& device_rr_gsb,
                                        const bool& compact_routing_hierarchy,
-                                       const t_rr_type& cb_type) {
+                                       const t_rr_type& cb_type,
+                                       const size_t& num_jobs) {
 
   vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
 
-  for (size_t ix = 0; ix < cb_range.x(); ++ix) {
+  build_bitstream_blocks_in_fragments(bitstream_manager, top_configurable_block, cb_range.x(), num_jobs,
+                                      [&](BitstreamManager& column_bitstream_manager, const ConfigBlockId& column_top_block, const size_t& ix) {
     for (size_t iy = 0; iy < cb_range.y(); ++iy) {
       const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
       /* Check if the connection block exists in the device!
@@ -469,21 +488,21 @@ void build_connection_block_bitstreams(BitstreamManager& bitstream_manager,
       } 
 
       /* Create a block for the bitstream which corresponds to the Switch block */
-      ConfigBlockId cb_configurable_block = bitstream_manager.add_block(generate_connection_block_module_name(cb_type, cb_coord));
+      ConfigBlockId cb_configurable_block = column_bitstream_manager.add_block(generate_connection_block_module_name(cb_type, cb_coord));
       /* Set switch block as a child of top block */
-      bitstream_manager.add_child_block(top_configurable_block, cb_configurable_block);
+      column_bitstream_manager.add_child_block(column_top_block, cb_configurable_block);
 
       /* Reserve child blocks for new created block */
-      bitstream_manager.reserve_child_blocks(cb_configurable_block,
-                                             count_module_manager_module_configurable_children(module_manager, cb_module)); 
+      column_bitstream_manager.reserve_child_blocks(cb_configurable_block,
+                                                    count_module_manager_module_configurable_children(module_manager, cb_module)); 
   
-      build_connection_block_bitstream(bitstream_manager, cb_configurable_block, module_manager,  
+      build_connection_block_bitstream(column_bitstream_manager, cb_configurable_block, module_manager,  
                                        circuit_lib, mux_lib,
                                        atom_ctx, device_annotation, routing_annotation,
                                        rr_graph,
                                        rr_gsb, cb_type);
     }
-  }
+  });
 }
 
 /********************************************************************
@@ -491,6 +510,8 @@ void build_connection_block_bitstreams(BitstreamManager& bitstream_manager,
  * Two major tasks: 
  * 1. Generate bitstreams for Switch Blocks
  * 2. Generate bitstreams for both X-direction and Y-direction Connection Blocks
+ * Routing blocks are independent from each other, so each column of them
+ * is built by one of num_jobs threads, in the same order as with 1 thread
  *******************************************************************/
 void build_routing_bitstream(BitstreamManager& bitstream_manager,
                              const ConfigBlockId& top_configurable_block,
@@ -502,7 +523,8 @@ void build_routing_bitstream(BitstreamManager& bitstream_manager,
                              const VprRoutingAnnotation& routing_annotation,
                              const RRGraph& rr_graph,
                              const DeviceRRGSB& device_rr_gsb,
-                             const bool& compact_routing_hierarchy) {
+                             const bool& compact_routing_hierarchy,
+                             const size_t& num_jobs) {
 
   /* Generate bitstream for each switch blocks
    * To organize the bitstream in blocks, we create a block for each switch block 
@@ -510,7 +532,8 @@ void build_routing_bitstream(BitstreamManager& bitstream_manager,
    */
   VTR_LOG("Generating bitstream for Switch blocks...");
   vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
-  for (size_t ix = 0; ix < sb_range.x(); ++ix) {
+  build_bitstream_blocks_in_fragments(bitstream_manager, top_configurable_block, sb_range.x(), num_jobs,
+                                      [&](BitstreamManager& column_bitstream_manager, const ConfigBlockId& column_top_block, const size_t& ix) {
     for (size_t iy = 0; iy < sb_range.y(); ++iy) {
       const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
       /* Check if the switch block exists in the device!
@@ -525,12 +548,22 @@ void build_routing_bitstream(BitstreamManager& bitstream_manager,
 
       /* Find the sb module so that we can precisely reserve child blocks */
       std::string sb_module_name = generate_switch_block_module_name(sb_coord);
+      /* The module may be a rotation or a reflection of the switch block */
+      const RRGSB* module_sb = &rr_gsb;
+      t_rr_gsb_side_map module_side_map;
+      for (size_t side = 0; side < NUM_SIDES; ++side) {
+        module_side_map[side] = SideManager(side).get_side();
+      }
       if (true == compact_routing_hierarchy) {
         vtr::Point<size_t> unique_sb_coord(ix, iy);
         const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(sb_coord);
         unique_sb_coord.set_x(unique_mirror.get_sb_x()); 
         unique_sb_coord.set_y(unique_mirror.get_sb_y()); 
         sb_module_name = generate_switch_block_module_name(unique_sb_coord);
+        module_sb = &unique_mirror;
+        for (size_t side = 0; side < NUM_SIDES; ++side) {
+          module_side_map[side] = device_rr_gsb.get_sb_unique_module_side(sb_coord, SideManager(side).get_side());
+        }
       } 
       ModuleId sb_module = module_manager.find_module(sb_module_name);
       VTR_ASSERT(true == module_manager.valid_module_id(sb_module));
@@ -541,21 +574,21 @@ void build_routing_bitstream(BitstreamManager& bitstream_manager,
       } 
 
       /* Create a block for the bitstream which corresponds to the Switch block */
-      ConfigBlockId sb_configurable_block = bitstream_manager.add_block(generate_switch_block_module_name(sb_coord));
+      ConfigBlockId sb_configurable_block = column_bitstream_manager.add_block(generate_switch_block_module_name(sb_coord));
       /* Set switch block as a child of top block */
-      bitstream_manager.add_child_block(top_configurable_block, sb_configurable_block);
+      column_bitstream_manager.add_child_block(column_top_block, sb_configurable_block);
 
       /* Reserve child blocks for new created block */
-      bitstream_manager.reserve_child_blocks(sb_configurable_block,
-                                             count_module_manager_module_configurable_children(module_manager, sb_module)); 
+      column_bitstream_manager.reserve_child_blocks(sb_configurable_block,
+                                                    count_module_manager_module_configurable_children(module_manager, sb_module)); 
 
-      build_switch_block_bitstream(bitstream_manager, sb_configurable_block, module_manager,  
+      build_switch_block_bitstream(column_bitstream_manager, sb_configurable_block, module_manager,  
                                    circuit_lib, mux_lib,
                                    atom_ctx, device_annotation, routing_annotation,
                                    rr_graph,
-                                   rr_gsb);
+                                   rr_gsb, *module_sb, module_side_map);
     }
-  }
+  });
   VTR_LOG("Done\n");
 
   /* Generate bitstream for each connection blocks
@@ -570,7 +603,8 @@ void build_routing_bitstream(BitstreamManager& bitstream_manager,
                                     rr_graph,
                                     device_rr_gsb,
                                     compact_routing_hierarchy,
-                                    CHANX);
+                                    CHANX,
+                                    num_jobs);
   VTR_LOG("Done\n");
 
   VTR_LOG("Generating bitstream for Y-direction Connection blocks ...");
@@ -581,7 +615,8 @@ void build_routing_bitstream(BitstreamManager& bitstream_manager,
                                     rr_graph,
                                     device_rr_gsb,
                                     compact_routing_hierarchy,
-                                    CHANY);
+                                    CHANY,
+                                    num_jobs);
   VTR_LOG("Done\n");
 
 }
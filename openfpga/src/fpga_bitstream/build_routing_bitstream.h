@@ -34,7 +34,8 @@ void build_routing_bitstream(BitstreamManager& bitstream_manager,
                              const VprRoutingAnnotation& routing_annotation,
                              const RRGraph& rr_graph,
                              const DeviceRRGSB& device_rr_gsb,
-                             const bool& compact_routing_hierarchy);
+                             const bool& compact_routing_hierarchy,
+                             const size_t& num_jobs);
 
 } /* end namespace openfpga */
 
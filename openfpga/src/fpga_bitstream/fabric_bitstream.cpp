@@ -138,6 +138,28 @@ FabricBitId FabricBitstream::add_bit(const ConfigBitId& config_bit_id) {
   return bit; 
 }
 
+void FabricBitstream::allocate_bits(const size_t& num_bits) {
+  VTR_ASSERT(0 == num_bits_);
+
+  num_bits_ = num_bits;
+  config_bit_ids_.resize(num_bits, ConfigBitId::INVALID());
+
+  if (true == use_address_) {
+    bit_addresses_.resize(num_bits);
+    bit_dins_.resize(num_bits);
+ 
+    if (true == use_wl_address_) {
+      bit_wl_addresses_.resize(num_bits);
+    }
+  }
+}
+
+void FabricBitstream::set_bit_config_bit(const FabricBitId& bit_id,
+                                         const ConfigBitId& config_bit_id) {
+  VTR_ASSERT(true == valid_bit_id(bit_id));
+  config_bit_ids_[bit_id] = config_bit_id;
+}
+
 void FabricBitstream::set_bit_address(const FabricBitId& bit_id,
                                       const std::vector<char>& address,
                                       const bool& tolerant_short_address) {
@@ -221,6 +243,13 @@ FabricBitRegionId FabricBitstream::add_region() {
   return region; 
 }
 
+void FabricBitstream::reserve_region_bits(const FabricBitRegionId& region_id,
+                                          const size_t& num_bits) {
+  VTR_ASSERT(true == valid_region_id(region_id));
+ 
+  region_bit_ids_[region_id].reserve(num_bits); 
+}
+
 void FabricBitstream::add_bit_to_region(const FabricBitRegionId& region_id,
                                         const FabricBitId& bit_id) {
   VTR_ASSERT(true == valid_region_id(region_id));
@@ -134,6 +134,16 @@ class FabricBitstream {
     /* Add a new configuration bit to the bitstream manager */
     FabricBitId add_bit(const ConfigBitId& config_bit_id);
 
+    /* Allocate a given number of bits at once, whose configuration bits
+     * are then set by set_bit_config_bit().
+     * Unlike add_bit(), the data of different bits can be set in parallel.
+     * This function is only applicable before any bits are added
+     */
+    void allocate_bits(const size_t& num_bits);
+
+    void set_bit_config_bit(const FabricBitId& bit_id,
+                            const ConfigBitId& config_bit_id);
+
     void set_bit_address(const FabricBitId& bit_id,
                          const std::vector<char>& address,
                          const bool& tolerant_short_address = false);
@@ -155,6 +165,10 @@ class FabricBitstream {
     /* Add a new configuration region */
     FabricBitRegionId add_region();
 
+    /* Reserve the bits of a region */
+    void reserve_region_bits(const FabricBitRegionId& region_id,
+                             const size_t& num_bits);
+
     void add_bit_to_region(const FabricBitRegionId& region_id,
                            const FabricBitId& bit_id);
 
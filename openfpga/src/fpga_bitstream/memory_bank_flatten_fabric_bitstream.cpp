@@ -29,20 +29,21 @@ size_t MemoryBankFlattenFabricBitstream::wl_vector_size() const {
   return wl_vec_size;
 }
 
-std::vector<std::string> MemoryBankFlattenFabricBitstream::bl_vector(const std::vector<std::string>& wl_vec) const {
+const std::vector<PackedBitAddress>& MemoryBankFlattenFabricBitstream::bl_vector(const std::vector<PackedBitAddress>& wl_vec) const {
   return bitstream_.at(wl_vec);
 }
 
-std::vector<std::vector<std::string>> MemoryBankFlattenFabricBitstream::wl_vectors() const {
-  std::vector<std::vector<std::string>> wl_vecs;
+std::vector<std::vector<PackedBitAddress>> MemoryBankFlattenFabricBitstream::wl_vectors() const {
+  std::vector<std::vector<PackedBitAddress>> wl_vecs;
+  wl_vecs.reserve(bitstream_.size());
   for (const auto& pair : bitstream_) {
     wl_vecs.push_back(pair.first);
   }
   return wl_vecs;
 }
 
-void MemoryBankFlattenFabricBitstream::add_blwl_vectors(const std::vector<std::string>& bl_vec,
-                                                        const std::vector<std::string>& wl_vec) {
+void MemoryBankFlattenFabricBitstream::add_blwl_vectors(const std::vector<PackedBitAddress>& bl_vec,
+                                                        const std::vector<PackedBitAddress>& wl_vec) {
   /* TODO: Add sanity check. Give a warning if the wl vector is already there */
   bitstream_[wl_vec] = bl_vec;
 }
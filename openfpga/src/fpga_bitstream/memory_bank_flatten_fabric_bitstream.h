@@ -5,6 +5,7 @@
 #include <map>
 #include <vector>
 #include "vtr_vector.h"
+#include "packed_bit_address.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
@@ -13,6 +14,8 @@ namespace openfpga {
  * This files includes data structures that stores a downloadable format of fabric bitstream
  * which is compatible with memory bank configuration protocol using flatten BL/WL buses
  * @note This data structure is mainly used to output bitstream file for compatible protocols
+ * @note BL/WL vectors are stored as packed bit addresses; use PackedBitAddress::to_string()
+ *       to format them when writing the bitstream
  ******************************************************************************/
 class MemoryBankFlattenFabricBitstream {
   public: /* Accessors */
@@ -26,22 +29,22 @@ class MemoryBankFlattenFabricBitstream {
     size_t wl_vector_size() const;
 
     /* @brief Return the BL vectors with a given WL key */
-    std::vector<std::string> bl_vector(const std::vector<std::string>& wl_vec) const;
+    const std::vector<PackedBitAddress>& bl_vector(const std::vector<PackedBitAddress>& wl_vec) const;
 
     /* @brief Return all the WL vectors in a downloaded sequence */
-    std::vector<std::vector<std::string>> wl_vectors() const;
+    std::vector<std::vector<PackedBitAddress>> wl_vectors() const;
 
   public: /* Mutators */
     /* @brief add a pair of BL/WL vectors to the bitstream database */
-    void add_blwl_vectors(const std::vector<std::string>& bl_vec,
-                          const std::vector<std::string>& wl_vec);
+    void add_blwl_vectors(const std::vector<PackedBitAddress>& bl_vec,
+                          const std::vector<PackedBitAddress>& wl_vec);
   public:  /* Validators */
   private: /* Internal data */
     /* [(wl_bank0, wl_bank1, ...)] = [(bl_bank0, bl_bank1, ...)]
      * Must use (WL, BL) as pairs in the map!!!
      * This is because BL data may not be unique while WL must be unique
      */
-    std::map<std::vector<std::string>, std::vector<std::string>> bitstream_; 
+    std::map<std::vector<PackedBitAddress>, std::vector<PackedBitAddress>> bitstream_; 
 };
 
 } /* end namespace openfpga */
@@ -0,0 +1,200 @@
+/******************************************************************************
+ * Memember functions for data structure PackedBitAddress
+ ******************************************************************************/
+#include <algorithm>
+
+#include "vtr_assert.h"
+
+#include "openfpga_decode.h"
+
+#include "packed_bit_address.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+constexpr size_t NUM_BITS_PER_WORD = 64;
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+PackedBitAddress::PackedBitAddress(const size_t& num_bits, const char& fill_bit)
+  : num_bits_(num_bits),
+    values_(num_words(num_bits), 0),
+    cares_(num_words(num_bits), 0) {
+  if (DONT_CARE_CHAR == fill_bit) {
+    return;
+  }
+
+  VTR_ASSERT('0' == fill_bit || '1' == fill_bit);
+  /* Only set the bits in range, so that the unused bits of the last word are always 0 */
+  for (size_t ibit = 0; ibit < num_bits_; ++ibit) {
+    set_bit(ibit, fill_bit);
+  }
+}
+
+PackedBitAddress::PackedBitAddress(const std::vector<char>& bits)
+  : num_bits_(bits.size()),
+    values_(num_words(bits.size()), 0),
+    cares_(num_words(bits.size()), 0) {
+  for (size_t ibit = 0; ibit < num_bits_; ++ibit) {
+    set_bit(ibit, bits[ibit]);
+  }
+}
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+size_t PackedBitAddress::size() const {
+  return num_bits_;
+}
+
+char PackedBitAddress::bit(const size_t& ibit) const {
+  VTR_ASSERT_SAFE(ibit < num_bits_);
+  uint64_t mask = uint64_t(1) << (ibit % NUM_BITS_PER_WORD);
+  size_t iword = ibit / NUM_BITS_PER_WORD;
+  if (0 == (cares_[iword] & mask)) {
+    return DONT_CARE_CHAR;
+  }
+  return (0 == (values_[iword] & mask)) ? '0' : '1';
+}
+
+bool PackedBitAddress::has_dont_care() const {
+  for (size_t iword = 0; iword < cares_.size(); ++iword) {
+    uint64_t word_mask = ~uint64_t(0);
+    /* The unused bits of the last word are not don't cares */
+    if ( (iword == cares_.size() - 1)
+      && (0 != num_bits_ % NUM_BITS_PER_WORD) ) {
+      word_mask = (uint64_t(1) << (num_bits_ % NUM_BITS_PER_WORD)) - 1;
+    }
+    if (word_mask != (cares_[iword] & word_mask)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<PackedBitAddress> PackedBitAddress::expand_dont_care_bits() const {
+  std::vector<size_t> dont_care_bits;
+  for (size_t ibit = 0; ibit < num_bits_; ++ibit) {
+    if (DONT_CARE_CHAR == bit(ibit)) {
+      dont_care_bits.push_back(ibit);
+    }
+  }
+
+  /* Each combination of the don't care bits is an expanded address.
+   * The first don't care bit is the most significant one, as in expand_dont_care_bin_str()
+   */
+  VTR_ASSERT(dont_care_bits.size() < NUM_BITS_PER_WORD);
+  size_t num_combinations = size_t(1) << dont_care_bits.size();
+
+  std::vector<PackedBitAddress> expanded_addresses;
+  expanded_addresses.reserve(num_combinations);
+  for (size_t icomb = 0; icomb < num_combinations; ++icomb) {
+    PackedBitAddress expanded_address = *this;
+    for (size_t idc = 0; idc < dont_care_bits.size(); ++idc) {
+      bool bit_value = 1 == ((icomb >> (dont_care_bits.size() - 1 - idc)) & 1);
+      expanded_address.set_bit(dont_care_bits[idc], bit_value ? '1' : '0');
+    }
+    expanded_addresses.push_back(expanded_address);
+  }
+
+  return expanded_addresses;
+}
+
+size_t PackedBitAddress::hash() const {
+  /* FNV-1a style mixing of the words */
+  uint64_t result = 14695981039346656037ULL ^ num_bits_;
+  for (size_t iword = 0; iword < values_.size(); ++iword) {
+    result = (result ^ values_[iword]) * 1099511628211ULL;
+    result = (result ^ cares_[iword]) * 1099511628211ULL;
+  }
+  return size_t(result ^ (result >> 32));
+}
+
+std::string PackedBitAddress::to_string() const {
+  std::string bit_str(num_bits_, DONT_CARE_CHAR);
+  for (size_t ibit = 0; ibit < num_bits_; ++ibit) {
+    bit_str[ibit] = bit(ibit);
+  }
+  return bit_str;
+}
+
+bool PackedBitAddress::operator==(const PackedBitAddress& other) const {
+  return (num_bits_ == other.num_bits_)
+      && (values_ == other.values_)
+      && (cares_ == other.cares_);
+}
+
+bool PackedBitAddress::operator!=(const PackedBitAddress& other) const {
+  return !(*this == other);
+}
+
+bool PackedBitAddress::operator<(const PackedBitAddress& other) const {
+  /* Find the first bit which differs, and compare it as a character,
+   * i.e., '0' < '1' < 'x'
+   */
+  size_t num_common_words = std::min(values_.size(), other.values_.size());
+  for (size_t iword = 0; iword < num_common_words; ++iword) {
+    uint64_t diff = (values_[iword] ^ other.values_[iword]) | (cares_[iword] ^ other.cares_[iword]);
+    if (0 == diff) {
+      continue;
+    }
+    size_t ibit = iword * NUM_BITS_PER_WORD;
+    while (0 == (diff & 1)) {
+      diff >>= 1;
+      ++ibit;
+    }
+    /* Unused bits are all 0, so the first difference may be past the end of the shorter address */
+    if (ibit < std::min(num_bits_, other.num_bits_)) {
+      return bit(ibit) < other.bit(ibit);
+    }
+    break;
+  }
+  /* One address is a prefix of the other */
+  return num_bits_ < other.num_bits_;
+}
+
+/**************************************************
+ * Public Mutators
+ *************************************************/
+void PackedBitAddress::set_bit(const size_t& ibit, const char& bit_value) {
+  VTR_ASSERT_SAFE(ibit < num_bits_);
+  uint64_t mask = uint64_t(1) << (ibit % NUM_BITS_PER_WORD);
+  size_t iword = ibit / NUM_BITS_PER_WORD;
+  if (DONT_CARE_CHAR == bit_value) {
+    cares_[iword] &= ~mask;
+    values_[iword] &= ~mask;
+    return;
+  }
+  VTR_ASSERT('0' == bit_value || '1' == bit_value);
+  cares_[iword] |= mask;
+  if ('1' == bit_value) {
+    values_[iword] |= mask;
+  } else {
+    values_[iword] &= ~mask;
+  }
+}
+
+void PackedBitAddress::clear_ones() {
+  /* Don't care bits have a value of 0, so this keeps them untouched */
+  for (uint64_t& word : values_) {
+    word = 0;
+  }
+}
+
+void PackedBitAddress::combine(const PackedBitAddress& other) {
+  VTR_ASSERT(num_bits_ == other.num_bits_);
+  for (size_t iword = 0; iword < values_.size(); ++iword) {
+    values_[iword] = (values_[iword] & ~other.cares_[iword]) | other.values_[iword];
+    cares_[iword] |= other.cares_[iword];
+  }
+}
+
+/**************************************************
+ * Internal utilities
+ *************************************************/
+size_t PackedBitAddress::num_words(const size_t& num_bits) {
+  return (num_bits + NUM_BITS_PER_WORD - 1) / NUM_BITS_PER_WORD;
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,97 @@
+#ifndef PACKED_BIT_ADDRESS_H
+#define PACKED_BIT_ADDRESS_H
+
+/********************************************************************
+ * Include header files required by the data structure definition
+ *******************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * A compact representation of a bitstream address (or a BL/WL vector)
+ * whose bits are either '0', '1' or don't care ('x').
+ *
+ * The bits are packed into 64-bit words: a 'care' mask tells which bits
+ * are '0' or '1', and a 'value' mask gives the value of these bits
+ * (a don't care bit always has a value of 0).
+ * This is much cheaper to hash, compare and merge than a std::string
+ * with one character per bit, which matters for fabrics with millions
+ * of configuration bits.
+ *
+ * Bit index i corresponds to the i-th character of the equivalent string,
+ * and the ordering between addresses is the same as between their strings,
+ * so that the bitstreams sorted by address are the same as before.
+ * Strings are only created when the address is written, with to_string().
+ *******************************************************************/
+class PackedBitAddress {
+  public: /* Constructors */
+    PackedBitAddress() = default;
+
+    /* Create an address of num_bits bits, all set to a given bit ('0', '1' or 'x') */
+    PackedBitAddress(const size_t& num_bits, const char& fill_bit);
+
+    /* Create an address from a list of bits ('0', '1' or 'x') */
+    explicit PackedBitAddress(const std::vector<char>& bits);
+
+  public: /* Accessors */
+    /* Number of bits in the address */
+    size_t size() const;
+
+    /* Get a bit of the address: '0', '1' or 'x' */
+    char bit(const size_t& ibit) const;
+
+    /* Return true if any bit of the address is a don't care */
+    bool has_dont_care() const;
+
+    /* Expand all the don't care bits of the address to '0' and '1',
+     * i.e., return all the addresses matched by this one
+     */
+    std::vector<PackedBitAddress> expand_dont_care_bits() const;
+
+    /* Hash of the address, to use it as a key of hash tables */
+    size_t hash() const;
+
+    /* Format the address as a string, e.g., "01x1" */
+    std::string to_string() const;
+
+    bool operator==(const PackedBitAddress& other) const;
+    bool operator!=(const PackedBitAddress& other) const;
+    /* Same ordering as the strings of the addresses */
+    bool operator<(const PackedBitAddress& other) const;
+
+  public: /* Mutators */
+    void set_bit(const size_t& ibit, const char& bit_value);
+
+    /* Convert all the '1' bits to '0', keeping the don't care bits */
+    void clear_ones();
+
+    /* Merge another address of the same size into this one:
+     * the bits which are not don't care in the other address override ours.
+     * This is the word-wise equivalent of combine_two_1hot_str()
+     */
+    void combine(const PackedBitAddress& other);
+
+  private: /* Internal utilities */
+    static size_t num_words(const size_t& num_bits);
+
+  private: /* Internal data */
+    size_t num_bits_ = 0;
+    std::vector<uint64_t> values_;
+    std::vector<uint64_t> cares_;
+};
+
+/* Hash functor to use PackedBitAddress as a key of std::unordered_map */
+struct PackedBitAddressHash {
+  size_t operator()(const PackedBitAddress& address) const {
+    return address.hash();
+  }
+};
+
+} /* end namespace openfpga */
+
+#endif
@@ -14,6 +14,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_decode.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_version.h"
 
 #include "openfpga_naming.h"
@@ -34,13 +35,13 @@ void write_fabric_bitstream_text_file_head(std::fstream& fp,
                                            const bool& include_time_stamp) {
   valid_file_stream(fp);
  
-  fp << "// Fabric bitstream" << std::endl;
+  fp << "// Fabric bitstream" << "\n";
 
   if (include_time_stamp) {
     auto end = std::chrono::system_clock::now(); 
     std::time_t end_time = std::chrono::system_clock::to_time_t(end);
     /* Note that version is also a type of time stamp */
-    fp << "// Version: " << openfpga::VERSION << std::endl;
+    fp << "// Version: " << openfpga::VERSION << "\n";
     fp << "// Date: " << std::ctime(&end_time);
   }
 }
@@ -61,7 +62,7 @@ int write_flatten_fabric_bitstream_to_text_file(std::fstream& fp,
   }
 
   /* Output bitstream size information */
-  fp << "// Bitstream length: " << fabric_bitstream.num_bits() << std::endl;
+  fp << "// Bitstream length: " << fabric_bitstream.num_bits() << "\n";
 
   /* Output bitstream data */
   for (const FabricBitId& fabric_bit : fabric_bitstream.bits()) {
@@ -101,8 +102,8 @@ int write_config_chain_fabric_bitstream_to_text_file(std::fstream& fp,
   }
 
   /* Output bitstream size information */
-  fp << "// Bitstream length: " << regional_bitstream_max_size - num_bits_to_skip << std::endl;
-  fp << "// Bitstream width (LSB -> MSB): " << fabric_bitstream.num_regions() << std::endl;
+  fp << "// Bitstream length: " << regional_bitstream_max_size - num_bits_to_skip << "\n";
+  fp << "// Bitstream width (LSB -> MSB): " << fabric_bitstream.num_regions() << "\n";
 
   /* Output bitstream data */
   for (size_t ibit = num_bits_to_skip; ibit < regional_bitstream_max_size; ++ibit) { 
@@ -110,7 +111,7 @@ int write_config_chain_fabric_bitstream_to_text_file(std::fstream& fp,
       fp << region_bitstream[ibit];
     }
     if (ibit < regional_bitstream_max_size - 1) {
-      fp << std::endl;
+      fp << "\n";
     }
   }
 
@@ -144,7 +145,7 @@ int write_memory_bank_fabric_bitstream_to_text_file(std::fstream& fp,
   /* Identify and output bitstream size information */
   size_t num_bits_to_skip = 0;
   if (true == fast_configuration) {
-    num_bits_to_skip = fabric_bits_by_addr.size() - find_memory_bank_fast_configuration_fabric_bitstream_size(fabric_bitstream, bit_value_to_skip);
+    num_bits_to_skip = fabric_bits_by_addr.size() - find_memory_bank_fast_configuration_fabric_bitstream_size(fabric_bits_by_addr, bit_value_to_skip);
     VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
     VTR_LOG("Fast configuration will skip %g% (%lu/%lu) of configuration bitstream.\n",
             100. * (float) num_bits_to_skip / (float) fabric_bits_by_addr.size(),
@@ -152,12 +153,12 @@ int write_memory_bank_fabric_bitstream_to_text_file(std::fstream& fp,
   }
 
   /* Output information about how to intepret the bitstream */
-  fp << "// Bitstream length: " << fabric_bits_by_addr.size() - num_bits_to_skip << std::endl;
+  fp << "// Bitstream length: " << fabric_bits_by_addr.size() - num_bits_to_skip << "\n";
   fp << "// Bitstream width (LSB -> MSB): ";
   fp << "<bl_address " << bl_addr_size << " bits>";
   fp << "<wl_address " << wl_addr_size << " bits>";
   fp << "<data input " << din_size << " bits>";
-  fp << std::endl;
+  fp << "\n";
 
   for (const auto& addr_din_pair : fabric_bits_by_addr) {
     /* When fast configuration is enabled,
@@ -176,10 +177,8 @@ int write_memory_bank_fabric_bitstream_to_text_file(std::fstream& fp,
     /* Write WL address code */
     fp << addr_din_pair.first.second;
     /* Write data input */
-    for (const bool& din_value : addr_din_pair.second) {
-      fp << din_value;
-    }
-    fp << std::endl;
+    write_bits_to_file(fp, addr_din_pair.second);
+    fp << "\n";
   }
 
   return status;
@@ -214,22 +213,22 @@ int write_memory_bank_flatten_fabric_bitstream_to_text_file(std::fstream& fp,
   size_t wl_addr_size = fabric_bits.wl_vector_size();
 
   /* Output information about how to intepret the bitstream */
-  fp << "// Bitstream length: " << fabric_bits.size() << std::endl;
+  fp << "// Bitstream length: " << fabric_bits.size() << "\n";
   fp << "// Bitstream width (LSB -> MSB): ";
   fp << "<bl_address " << bl_addr_size << " bits>";
   fp << "<wl_address " << wl_addr_size << " bits>";
-  fp << std::endl;
+  fp << "\n";
 
   for (const auto& wl_vec : fabric_bits.wl_vectors()) {
     /* Write BL address code */
     for (const auto& bl_unit : fabric_bits.bl_vector(wl_vec)) {
-      fp << bl_unit;
+      fp << bl_unit.to_string();
     }
     /* Write WL address code */
     for (const auto& wl_unit : wl_vec) {
-      fp << wl_unit;
+      fp << wl_unit.to_string();
     }
-    fp << std::endl;
+    fp << "\n";
   }
 
   return status;
@@ -259,31 +258,31 @@ int write_memory_bank_shift_register_fabric_bitstream_to_text_file(std::fstream&
   MemoryBankShiftRegisterFabricBitstream fabric_bits = build_memory_bank_shift_register_fabric_bitstream(fabric_bitstream, blwl_sr_banks, fast_configuration, bit_value_to_skip, dont_care_bit);
 
   /* Output information about how to intepret the bitstream */
-  fp << "// Bitstream word count: " << fabric_bits.num_words() << std::endl;
-  fp << "// Bitstream bl word size: " << fabric_bits.bl_word_size() << std::endl;
-  fp << "// Bitstream wl word size: " << fabric_bits.wl_word_size() << std::endl;
+  fp << "// Bitstream word count: " << fabric_bits.num_words() << "\n";
+  fp << "// Bitstream bl word size: " << fabric_bits.bl_word_size() << "\n";
+  fp << "// Bitstream wl word size: " << fabric_bits.wl_word_size() << "\n";
   fp << "// Bitstream width (LSB -> MSB): ";
   fp << "<bl shift register heads " << fabric_bits.bl_width() << " bits>";
   fp << "<wl shift register heads " << fabric_bits.wl_width() << " bits>";
-  fp << std::endl;
+  fp << "\n";
 
   size_t word_cnt = 0;  
 
   for (const auto& word : fabric_bits.words()) {
-    fp << "// Word " << word_cnt << std::endl;
+    fp << "// Word " << word_cnt << "\n";
 
     /* Write BL address code */
-    fp << "// BL part " << std::endl;
+    fp << "// BL part " << "\n";
     for (const auto& bl_vec : fabric_bits.bl_vectors(word)) {
       fp << bl_vec;
-      fp << std::endl;
+      fp << "\n";
     }
 
     /* Write WL address code */
-    fp << "// WL part " << std::endl;
+    fp << "// WL part " << "\n";
     for (const auto& wl_vec : fabric_bits.wl_vectors(word)) {
       fp << wl_vec;
-      fp << std::endl;
+      fp << "\n";
     }
 
     word_cnt++;
@@ -318,7 +317,7 @@ int write_frame_based_fabric_bitstream_to_text_file(std::fstream& fp,
   /* Identify and output bitstream size information */
   size_t num_bits_to_skip = 0;
   if (true == fast_configuration) {
-    num_bits_to_skip = fabric_bits_by_addr.size() - find_frame_based_fast_configuration_fabric_bitstream_size(fabric_bitstream, bit_value_to_skip);
+    num_bits_to_skip = fabric_bits_by_addr.size() - find_frame_based_fast_configuration_fabric_bitstream_size(fabric_bits_by_addr, bit_value_to_skip);
     VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
     VTR_LOG("Fast configuration will skip %g% (%lu/%lu) of configuration bitstream.\n",
             100. * (float) num_bits_to_skip / (float) fabric_bits_by_addr.size(),
@@ -326,8 +325,8 @@ int write_frame_based_fabric_bitstream_to_text_file(std::fstream& fp,
   }
 
   /* Output information about how to intepret the bitstream */
-  fp << "// Bitstream length: " << fabric_bits_by_addr.size() - num_bits_to_skip << std::endl;
-  fp << "// Bitstream width (LSB -> MSB): <address " << addr_size << " bits><data input " << din_size << " bits>" << std::endl;
+  fp << "// Bitstream length: " << fabric_bits_by_addr.size() - num_bits_to_skip << "\n";
+  fp << "// Bitstream width (LSB -> MSB): <address " << addr_size << " bits><data input " << din_size << " bits>" << "\n";
 
   for (const auto& addr_din_pair : fabric_bits_by_addr) {
     /* When fast configuration is enabled,
@@ -342,13 +341,11 @@ int write_frame_based_fabric_bitstream_to_text_file(std::fstream& fp,
     }
 
     /* Write address code */
-    fp << addr_din_pair.first;
+    fp << addr_din_pair.first.to_string();
 
     /* Write data input */
-    for (const bool& din_value : addr_din_pair.second) {
-      fp << din_value;
-    }
-    fp << std::endl;
+    write_bits_to_file(fp, addr_din_pair.second);
+    fp << "\n";
   }
 
   return status;
@@ -385,8 +382,8 @@ int write_fabric_bitstream_to_text_file(const BitstreamManager& bitstream_manage
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(fname.c_str(), fp);
 
@@ -471,10 +468,10 @@ int write_fabric_bitstream_to_text_file(const BitstreamManager& bitstream_manage
 
 
   /* Print an end to the file here */
-  fp << std::endl;
+  fp << "\n";
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   VTR_LOGV(verbose,
            "Outputted %lu configuration bits to plain text file: %s\n",
@@ -13,6 +13,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from archopenfpga library */
 
@@ -32,10 +33,10 @@ void write_fabric_bitstream_xml_file_head(std::fstream& fp,
                                           const bool& include_time_stamp) {
   valid_file_stream(fp);
 
-  fp << "<!--" << std::endl;
-  fp << "\t- Fabric bitstream" << std::endl;
-  fp << "\t- Author: Xifan TANG" << std::endl;
-  fp << "\t- Organization: University of Utah" << std::endl;
+  fp << "<!--" << "\n";
+  fp << "\t- Fabric bitstream" << "\n";
+  fp << "\t- Author: Xifan TANG" << "\n";
+  fp << "\t- Organization: University of Utah" << "\n";
 
   auto end = std::chrono::system_clock::now(); 
   std::time_t end_time = std::chrono::system_clock::to_time_t(end);
@@ -43,8 +44,8 @@ void write_fabric_bitstream_xml_file_head(std::fstream& fp,
     fp << "\t- Date: " << std::ctime(&end_time) ;
   }
 
-  fp << "-->" << std::endl;
-  fp << std::endl;
+  fp << "-->" << "\n";
+  fp << "\n";
 }
 
 /********************************************************************
@@ -216,8 +217,8 @@ int write_fabric_bitstream_to_xml_file(const BitstreamManager& bitstream_manager
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(fname.c_str(), fp);
 
@@ -244,7 +245,7 @@ int write_fabric_bitstream_to_xml_file(const BitstreamManager& bitstream_manager
   fp << "</fabric_bitstream>\n";
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   VTR_LOGV(verbose,
            "Outputted %lu configuration bits to XML file: %s\n",
@@ -13,6 +13,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from archopenfpga library */
 #include "openfpga_naming.h"
@@ -33,19 +34,19 @@ void write_io_mapping_xml_file_head(std::fstream& fp,
                                     const bool& include_time_stamp) {
   valid_file_stream(fp);
  
-  fp << "<!--" << std::endl;
-  fp << "\t- I/O mapping" << std::endl;
+  fp << "<!--" << "\n";
+  fp << "\t- I/O mapping" << "\n";
 
   if (include_time_stamp) {
     auto end = std::chrono::system_clock::now(); 
     std::time_t end_time = std::chrono::system_clock::to_time_t(end);
     /* Note that version is also a type of time stamp */
-    fp << "\t- Version: " << openfpga::VERSION << std::endl;
+    fp << "\t- Version: " << openfpga::VERSION << "\n";
     fp << "\t- Date: " << std::ctime(&end_time) ;
   }
 
-  fp << "-->" << std::endl;
-  fp << std::endl;
+  fp << "-->" << "\n";
+  fp << "\n";
 }
 
 /********************************************************************
@@ -110,8 +111,8 @@ int write_io_mapping_to_xml_file(const IoMap& io_map,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(fname.c_str(), fp);
 
@@ -143,7 +144,7 @@ int write_io_mapping_to_xml_file(const IoMap& io_map,
            fname.c_str());
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   return status;
 }
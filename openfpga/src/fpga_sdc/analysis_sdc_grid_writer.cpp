@@ -48,14 +48,14 @@ void rec_print_analysis_sdc_disable_unused_pb_graph_nodes(std::fstream& fp,
   /* Disable all the ports of current module (parent_module)!
    * Hierarchy name already includes the instance name of parent_module 
    */
-  fp << "#######################################" << std::endl; 
-  fp << "# Disable all the ports for pb_graph_node " << physical_pb_graph_node->pb_type->name << "[" << physical_pb_graph_node->placement_index << "]" << std::endl;
-  fp << "#######################################" << std::endl; 
+  fp << "#######################################" << "\n"; 
+  fp << "# Disable all the ports for pb_graph_node " << physical_pb_graph_node->pb_type->name << "[" << physical_pb_graph_node->placement_index << "]" << "\n";
+  fp << "#######################################" << "\n"; 
 
   fp << "set_disable_timing ";
   fp << hierarchy_name; 
   fp << "*";
-  fp << std::endl;
+  fp << "\n";
 
   /* Return if this is the primitive pb_type */
   if (true == is_primitive_pb_type(physical_pb_type)) {
@@ -120,7 +120,7 @@ void disable_pb_graph_node_unused_pin(std::fstream& fp,
   fp << "set_disable_timing ";
   fp << hierarchy_name; 
   fp << generate_sdc_port(port_to_disable);
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -140,9 +140,9 @@ void disable_pb_graph_node_unused_pins(std::fstream& fp,
   const PhysicalPbId& pb_id = physical_pb.find_pb(physical_pb_graph_node);
   VTR_ASSERT(true == physical_pb.valid_pb_id(pb_id));
 
-  fp << "#######################################" << std::endl; 
-  fp << "# Disable unused pins for pb_graph_node " << physical_pb_graph_node->pb_type->name << "[" << physical_pb_graph_node->placement_index << "]" << std::endl;
-  fp << "#######################################" << std::endl; 
+  fp << "#######################################" << "\n"; 
+  fp << "# Disable unused pins for pb_graph_node " << physical_pb_graph_node->pb_type->name << "[" << physical_pb_graph_node->placement_index << "]" << "\n";
+  fp << "#######################################" << "\n"; 
 
   /* Disable unused input pins */
   for (int iport = 0; iport < physical_pb_graph_node->num_input_ports; ++iport) {
@@ -189,9 +189,9 @@ void disable_pb_graph_node_unused_mux_inputs(std::fstream& fp,
                                              t_pb_graph_node* physical_pb_graph_node,
                                              const PhysicalPb& physical_pb) {
 
-  fp << "#######################################" << std::endl; 
-  fp << "# Disable unused mux_inputs for pb_graph_node " << physical_pb_graph_node->pb_type->name << "[" << physical_pb_graph_node->placement_index << "]" << std::endl;
-  fp << "#######################################" << std::endl; 
+  fp << "#######################################" << "\n"; 
+  fp << "# Disable unused mux_inputs for pb_graph_node " << physical_pb_graph_node->pb_type->name << "[" << physical_pb_graph_node->placement_index << "]" << "\n";
+  fp << "#######################################" << "\n"; 
 
   t_pb_type* physical_pb_type = physical_pb_graph_node->pb_type;
 
@@ -492,16 +492,16 @@ void print_analysis_sdc_disable_pb_block_unused_resources(std::fstream& fp,
   VTR_ASSERT(true == module_manager.valid_module_id(pb_module));
 
   /* Print comments */
-  fp << "#######################################" << std::endl; 
+  fp << "#######################################" << "\n"; 
  
   if (true == unused_block) {
-    fp << "# Disable Timing for unused grid[" << grid_coordinate.x() << "][" << grid_coordinate.y() << "][" << grid_z << "]" << std::endl;
+    fp << "# Disable Timing for unused grid[" << grid_coordinate.x() << "][" << grid_coordinate.y() << "][" << grid_z << "]" << "\n";
   } else {
     VTR_ASSERT_SAFE(false == unused_block);
-    fp << "# Disable Timing for unused resources in grid[" << grid_coordinate.x() << "][" << grid_coordinate.y() << "][" << grid_z << "]" << std::endl;
+    fp << "# Disable Timing for unused resources in grid[" << grid_coordinate.x() << "][" << grid_coordinate.y() << "][" << grid_z << "]" << "\n";
   }
 
-  fp << "#######################################" << std::endl; 
+  fp << "#######################################" << "\n"; 
 
   std::string hierarchy_name = grid_instance_name + std::string("/") + pb_instance_name + std::string("/");
 
@@ -558,9 +558,9 @@ void print_analysis_sdc_disable_unused_grid(std::fstream& fp,
   VTR_ASSERT(true == module_manager.valid_module_id(grid_module));
 
   /* Print comments */
-  fp << "#######################################" << std::endl; 
-  fp << "# Disable Timing for grid[" << grid_coordinate.x() << "][" << grid_coordinate.y() << "]" << std::endl;
-  fp << "#######################################" << std::endl; 
+  fp << "#######################################" << "\n"; 
+  fp << "# Disable Timing for grid[" << grid_coordinate.x() << "][" << grid_coordinate.y() << "]" << "\n";
+  fp << "#######################################" << "\n"; 
 
   /* For used grid, find the unused rr_node in the local rr_graph 
    * and then disable each port which is not used
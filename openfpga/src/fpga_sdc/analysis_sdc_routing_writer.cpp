@@ -65,9 +65,9 @@ void print_analysis_sdc_disable_cb_unused_resources(std::fstream& fp,
   VTR_ASSERT(true == module_manager.valid_module_id(cb_module));
 
   /* Print comments */
-  fp << "##################################################" << std::endl; 
-  fp << "# Disable timing for Connection block " << cb_module_name << std::endl;
-  fp << "##################################################" << std::endl; 
+  fp << "##################################################" << "\n"; 
+  fp << "# Disable timing for Connection block " << cb_module_name << "\n";
+  fp << "##################################################" << "\n"; 
 
   /* Disable all the input port (routing tracks), which are not used by benchmark */
   for (size_t itrack = 0; itrack < rr_gsb.get_cb_chan_width(cb_type); ++itrack) {
@@ -91,7 +91,7 @@ void print_analysis_sdc_disable_cb_unused_resources(std::fstream& fp,
     fp << "set_disable_timing ";
     fp << cb_instance_name << "/";
     fp << generate_sdc_port(chan_port);
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Disable all the output port (routing tracks), which are not used by benchmark */
@@ -116,7 +116,7 @@ void print_analysis_sdc_disable_cb_unused_resources(std::fstream& fp,
     fp << "set_disable_timing ";
     fp << cb_instance_name << "/";
     fp << generate_sdc_port(chan_port);
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Build a map between mux_instance name and net_num */
@@ -168,7 +168,7 @@ void print_analysis_sdc_disable_cb_unused_resources(std::fstream& fp,
       fp << "set_disable_timing ";
       fp << cb_instance_name << "/";
       fp << generate_sdc_port(module_manager.module_port(cb_module, module_port));
-      fp << std::endl;
+      fp << "\n";
     }
   }
 
@@ -329,9 +329,9 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
   VTR_ASSERT(true == module_manager.valid_module_id(sb_module));
 
   /* Print comments */
-  fp << "##################################################" << std::endl; 
-  fp << "# Disable timing for Switch block " << sb_module_name << std::endl;
-  fp << "##################################################" << std::endl; 
+  fp << "##################################################" << "\n"; 
+  fp << "# Disable timing for Switch block " << sb_module_name << "\n";
+  fp << "##################################################" << "\n"; 
 
   /* Build a map between mux_instance name and net_num */
   std::map<std::string, AtomNetId> mux_instance_to_net_map;
@@ -339,6 +339,11 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
   /* Disable all the input/output port (routing tracks), which are not used by benchmark */
   for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
     SideManager side_manager(side);
+    /* The side of the module which is wired to this side of the instance */
+    e_side module_side = side_manager.get_side();
+    if (true == compact_routing_hierarchy) {
+      module_side = device_rr_gsb.get_sb_unique_module_side(vtr::Point<size_t>(rr_gsb.get_x(), rr_gsb.get_y()), side_manager.get_side());
+    }
 
     for (size_t itrack = 0; itrack < rr_gsb.get_chan_width(side_manager.get_side()); ++itrack) {
       const RRNodeId& chan_node = rr_gsb.get_chan_node(side_manager.get_side(), itrack);
@@ -351,9 +356,9 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
         /* Note: use GSB coordinate when inquire for unique modules!!! */
         vtr::Point<size_t> sb_coord(rr_gsb.get_x(), rr_gsb.get_y());
         const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(sb_coord);
-        port_name = generate_sb_module_track_port_name(rr_graph.node_type(unique_mirror.get_chan_node(side_manager.get_side(), itrack)),
-                                                       side_manager.get_side(),  
-                                                       unique_mirror.get_chan_node_direction(side_manager.get_side(), itrack));
+        port_name = generate_sb_module_track_port_name(rr_graph.node_type(unique_mirror.get_chan_node(module_side, itrack)),
+                                                       module_side,  
+                                                       unique_mirror.get_chan_node_direction(module_side, itrack));
       }
 
       /* Ensure we have this port in the module! */
@@ -363,7 +368,8 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
       /* Cache the net name for routing tracks which are outputs of the switch block */
       if (OUT_PORT == rr_gsb.get_chan_node_direction(side_manager.get_side(), itrack)) {
         /* Generate the name of mux instance related to this output node */
-        std::string mux_instance_name = generate_sb_memory_instance_name(SWITCH_BLOCK_MUX_INSTANCE_PREFIX, side_manager.get_side(), itrack, std::string(""));
+        /* The mux instance is named after the side of the module */
+        std::string mux_instance_name = generate_sb_memory_instance_name(SWITCH_BLOCK_MUX_INSTANCE_PREFIX, module_side, itrack, std::string(""));
         mux_instance_to_net_map[mux_instance_name] = atom_ctx.lookup.atom_net(routing_annotation.rr_node_net(chan_node));
       }
 
@@ -378,13 +384,18 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
       fp << "set_disable_timing ";
       fp << sb_instance_name << "/";
       fp << generate_sdc_port(sb_port);
-      fp << std::endl;
+      fp << "\n";
     }
   }
 
   /* Disable all the input port (grid output pins), which are not used by benchmark */
   for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
     SideManager side_manager(side);
+    /* The side of the module which is wired to this side of the instance */
+    e_side module_side = side_manager.get_side();
+    if (true == compact_routing_hierarchy) {
+      module_side = device_rr_gsb.get_sb_unique_module_side(vtr::Point<size_t>(rr_gsb.get_x(), rr_gsb.get_y()), side_manager.get_side());
+    }
 
     for (size_t inode = 0; inode < rr_gsb.get_num_opin_nodes(side_manager.get_side()); ++inode) {
       const RRNodeId& opin_node = rr_gsb.get_opin_node(side_manager.get_side(), inode);
@@ -400,9 +411,9 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
         /* Note: use GSB coordinate when inquire for unique modules!!! */
         vtr::Point<size_t> sb_coord(rr_gsb.get_x(), rr_gsb.get_y());
         const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(sb_coord);
-        const RRNodeId& unique_mirror_opin_node = unique_mirror.get_opin_node(side_manager.get_side(), inode);
+        const RRNodeId& unique_mirror_opin_node = unique_mirror.get_opin_node(module_side, inode);
 
-        port_name = generate_sb_module_grid_port_name(side_manager.get_side(),
+        port_name = generate_sb_module_grid_port_name(module_side,
                                                       rr_graph.node_side(unique_mirror_opin_node),
                                                       grids,
                                                       device_annotation,
@@ -423,7 +434,7 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
       fp << "set_disable_timing ";
       fp << sb_instance_name << "/";
       fp << generate_sdc_port(module_manager.module_port(sb_module, module_port));
-      fp << std::endl;
+      fp << "\n";
     }
   }
 
@@ -453,6 +464,11 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
   /* Iterate over input ports coming from grid output pins */
   for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
     SideManager side_manager(side);
+    /* The side of the module which is wired to this side of the instance */
+    e_side module_side = side_manager.get_side();
+    if (true == compact_routing_hierarchy) {
+      module_side = device_rr_gsb.get_sb_unique_module_side(vtr::Point<size_t>(rr_gsb.get_x(), rr_gsb.get_y()), side_manager.get_side());
+    }
 
     for (size_t inode = 0; inode < rr_gsb.get_num_opin_nodes(side_manager.get_side()); ++inode) {
       const RRNodeId& opin_node = rr_gsb.get_opin_node(side_manager.get_side(), inode);
@@ -468,9 +484,9 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
         /* Note: use GSB coordinate when inquire for unique modules!!! */
         vtr::Point<size_t> sb_coord(rr_gsb.get_x(), rr_gsb.get_y());
         const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(sb_coord);
-        const RRNodeId& unique_mirror_opin_node = unique_mirror.get_opin_node(side_manager.get_side(), inode);
+        const RRNodeId& unique_mirror_opin_node = unique_mirror.get_opin_node(module_side, inode);
 
-        port_name = generate_sb_module_grid_port_name(side_manager.get_side(),
+        port_name = generate_sb_module_grid_port_name(module_side,
                                                       rr_graph.node_side(unique_mirror_opin_node),
                                                       grids,
                                                       device_annotation,
@@ -497,6 +513,11 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
   /* Iterate over input ports coming from routing tracks */
   for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
     SideManager side_manager(side);
+    /* The side of the module which is wired to this side of the instance */
+    e_side module_side = side_manager.get_side();
+    if (true == compact_routing_hierarchy) {
+      module_side = device_rr_gsb.get_sb_unique_module_side(vtr::Point<size_t>(rr_gsb.get_x(), rr_gsb.get_y()), side_manager.get_side());
+    }
 
     for (size_t itrack = 0; itrack < rr_gsb.get_chan_width(side_manager.get_side()); ++itrack) {
       /* Skip output ports, they have already been disabled or not */
@@ -514,11 +535,11 @@ void print_analysis_sdc_disable_sb_unused_resources(std::fstream& fp,
         /* Note: use GSB coordinate when inquire for unique modules!!! */
         vtr::Point<size_t> sb_coord(rr_gsb.get_x(), rr_gsb.get_y());
         const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(sb_coord);
-        const RRNodeId& unique_mirror_chan_node = unique_mirror.get_chan_node(side_manager.get_side(), itrack);
+        const RRNodeId& unique_mirror_chan_node = unique_mirror.get_chan_node(module_side, itrack);
 
         port_name = generate_sb_module_track_port_name(rr_graph.node_type(unique_mirror_chan_node),
-                                                       side_manager.get_side(), 
-                                                       unique_mirror.get_chan_node_direction(side_manager.get_side(), itrack));
+                                                       module_side, 
+                                                       unique_mirror.get_chan_node_direction(module_side, itrack));
       }
 
 
@@ -12,6 +12,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_port.h"
 
 #include "mux_utils.h"
@@ -50,9 +51,9 @@ void print_analysis_sdc_io_delays(std::fstream& fp,
   valid_file_stream(fp);
 
   /* Print comments */
-  fp << "##################################################" << std::endl; 
-  fp << "# Create clock                                    " << std::endl;
-  fp << "##################################################" << std::endl; 
+  fp << "##################################################" << "\n"; 
+  fp << "# Create clock                                    " << "\n";
+  fp << "##################################################" << "\n"; 
 
   /* Get clock port from the global port */
   std::vector<BasicPort> operating_clock_ports;
@@ -76,10 +77,10 @@ void print_analysis_sdc_io_delays(std::fstream& fp,
     fp << generate_sdc_port(operating_clock_port);
     fp << " -period " << std::setprecision(10) << critical_path_delay / time_unit;
     fp << " -waveform {0 " << std::setprecision(10) << critical_path_delay / (2 * time_unit) << "}";
-    fp << std::endl;
+    fp << "\n";
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* There should be only one operating clock!
@@ -93,14 +94,15 @@ void print_analysis_sdc_io_delays(std::fstream& fp,
   for (const BasicPort& module_io_port : module_io_ports) {
     /* Keep tracking which I/Os have been used */
     std::vector<bool> io_used(module_io_port.get_width(), false);
+    size_t io_port_location_id = io_location_map.io_port_id(module_io_port.get_name());
 
     /* Find clock ports in benchmark */
     std::vector<std::string> benchmark_clock_port_names = find_atom_netlist_clock_port_names(atom_ctx.nlist, netlist_annotation);
 
     /* Print comments */
-    fp << "##################################################" << std::endl; 
-    fp << "# Create input and output delays for used I/Os    " << std::endl;
-    fp << "##################################################" << std::endl; 
+    fp << "##################################################" << "\n"; 
+    fp << "# Create input and output delays for used I/Os    " << "\n";
+    fp << "##################################################" << "\n"; 
 
     for (const AtomBlockId& atom_blk : atom_ctx.nlist.blocks()) {
       /* Bypass non-I/O atom blocks ! */
@@ -115,10 +117,11 @@ void print_analysis_sdc_io_delays(std::fstream& fp,
       }
 
       /* Find the index of the mapped GPIO in top-level FPGA fabric */
-      size_t io_index = io_location_map.io_index(place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.x,
-                                                 place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.y,
-                                                 place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.z,
-                                                 module_io_port.get_name());
+      const t_pl_loc& atom_blk_loc = place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc;
+      size_t io_index = io_location_map.io_index(atom_blk_loc.x,
+                                                 atom_blk_loc.y,
+                                                 atom_blk_loc.z,
+                                                 io_port_location_id);
 
       if (size_t(-1) == io_index) {
         continue;
@@ -147,12 +150,12 @@ void print_analysis_sdc_io_delays(std::fstream& fp,
     }
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
 
     /* Print comments */
-    fp << "##################################################" << std::endl; 
-    fp << "# Disable timing for unused I/Os    " << std::endl;
-    fp << "##################################################" << std::endl; 
+    fp << "##################################################" << "\n"; 
+    fp << "# Disable timing for unused I/Os    " << "\n";
+    fp << "##################################################" << "\n"; 
 
     /* Wire the unused iopads to a constant */
     for (size_t io_index = 0; io_index < io_used.size(); ++io_index) {
@@ -169,7 +172,7 @@ void print_analysis_sdc_io_delays(std::fstream& fp,
     }
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 }
 
@@ -185,9 +188,9 @@ void print_analysis_sdc_disable_global_ports(std::fstream& fp,
   valid_file_stream(fp);
 
   /* Print comments */
-  fp << "##################################################" << std::endl; 
-  fp << "# Disable timing for global ports                 " << std::endl;
-  fp << "##################################################" << std::endl; 
+  fp << "##################################################" << "\n"; 
+  fp << "# Disable timing for global ports                 " << "\n";
+  fp << "##################################################" << "\n"; 
 
   for (const FabricGlobalPortId& global_port : fabric_global_port_info.global_ports()) {
     /* Skip operating clock here! */
@@ -228,8 +231,8 @@ void print_analysis_sdc(const AnalysisSdcOption& option,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate file stream */
   check_file_stream(sdc_fname.c_str(), fp);
@@ -296,7 +299,7 @@ void print_analysis_sdc(const AnalysisSdcOption& option,
                                           openfpga_ctx.module_graph());
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 } /* end namespace openfpga */
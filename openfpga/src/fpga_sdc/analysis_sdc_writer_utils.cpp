@@ -106,7 +106,7 @@ void disable_analysis_module_input_pin_net_sinks(std::fstream& fp,
     fp << parent_instance_name << "/";
     fp << sink_instance_name << "/";
     fp << generate_sdc_port(sink_port);
-    fp << std::endl;
+    fp << "\n";
   }
 }
 
@@ -231,7 +231,7 @@ void disable_analysis_module_output_pin_net_sinks(std::fstream& fp,
     fp << parent_instance_name << "/";
     fp << sink_instance_name << "/";
     fp << generate_sdc_port(sink_port);
-    fp << std::endl;
+    fp << "\n";
   }
 }
 
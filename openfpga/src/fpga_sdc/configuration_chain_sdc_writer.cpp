@@ -19,6 +19,7 @@
 #include "openfpga_scale.h"
 #include "openfpga_port.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_naming.h"
 
@@ -144,8 +145,8 @@ void print_pnr_sdc_constrain_configurable_chain(const std::string& sdc_fname,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
 
@@ -172,7 +173,7 @@ void print_pnr_sdc_constrain_configurable_chain(const std::string& sdc_fname,
                                                  previous_module);
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 } /* end namespace openfpga */
@@ -22,6 +22,7 @@
 #include "openfpga_scale.h"
 #include "openfpga_port.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_reserved_words.h"
 #include "openfpga_naming.h"
@@ -197,8 +198,8 @@ int print_sdc_disable_timing_configure_ports(const std::string& sdc_fname,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
 
@@ -252,7 +253,7 @@ int print_sdc_disable_timing_configure_ports(const std::string& sdc_fname,
   VTR_LOGV(verbose, "Done\n");
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   return CMD_EXEC_SUCCESS;
 }
@@ -20,6 +20,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_port.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_scale.h"
 
 #include "sdc_writer_naming.h"
@@ -48,7 +49,7 @@ void print_pnr_sdc_clock_port(std::fstream& fp,
   fp << " -period " << std::setprecision(10) << clock_period;
   fp << " -waveform {0 " << std::setprecision(10) << clock_period / 2 << "}";
   fp << " [get_ports {" << generate_sdc_port(port_to_constrain) << "}]";
-  fp << std::endl;
+  fp << "\n";
 }        
 
 /********************************************************************
@@ -80,14 +81,14 @@ void print_pnr_sdc_global_clock_ports(std::fstream& fp,
     if (true == fabric_global_port_info.global_port_is_prog(global_port)) {
       clock_period =  1./sim_setting.programming_clock_frequency();
       /* Print comments */
-      fp << "##################################################" << std::endl; 
-      fp << "# Create programmable clock                       " << std::endl;
-      fp << "##################################################" << std::endl; 
+      fp << "##################################################" << "\n"; 
+      fp << "# Create programmable clock                       " << "\n";
+      fp << "##################################################" << "\n"; 
     } else {
       /* Print comments */
-      fp << "##################################################" << std::endl; 
-      fp << "# Create clock                                    " << std::endl;
-      fp << "##################################################" << std::endl; 
+      fp << "##################################################" << "\n"; 
+      fp << "# Create clock                                    " << "\n";
+      fp << "##################################################" << "\n"; 
     }
 
     BasicPort clock_port = module_manager.module_port(top_module, fabric_global_port_info.global_module_port(global_port));
@@ -135,9 +136,9 @@ void print_pnr_sdc_global_non_clock_ports(std::fstream& fp,
     }
 
     /* Print comments */
-    fp << "##################################################" << std::endl; 
-    fp << "# Constrain other global ports                    " << std::endl;
-    fp << "##################################################" << std::endl; 
+    fp << "##################################################" << "\n"; 
+    fp << "# Constrain other global ports                    " << "\n";
+    fp << "##################################################" << "\n"; 
 
     /* Reach here, it means a non-clock global port and we need print constraints */
     float clock_period = operating_critical_path_delay; 
@@ -182,8 +183,8 @@ void print_pnr_sdc_global_ports(const PnrSdcOption& options,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
 
@@ -208,7 +209,7 @@ void print_pnr_sdc_global_ports(const PnrSdcOption& options,
   }
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 } /* end namespace openfpga */
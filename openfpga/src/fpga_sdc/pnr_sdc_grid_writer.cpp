@@ -19,6 +19,7 @@
 #include "openfpga_scale.h"
 #include "openfpga_port.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_side_manager.h"
 
 #include "openfpga_interconnect_types.h"
@@ -263,8 +264,8 @@ void print_pnr_sdc_constrain_pb_graph_node_timing(const PnrSdcOption& options,
   std::string sdc_fname(sdc_dir + pb_module_name + std::string(SDC_FILE_NAME_POSTFIX));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
 
@@ -318,7 +319,7 @@ void print_pnr_sdc_constrain_pb_graph_node_timing(const PnrSdcOption& options,
   }
   
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -382,8 +383,8 @@ void print_pnr_sdc_constrain_primitive_pb_graph_node(const PnrSdcOption& options
   std::string sdc_fname(options.sdc_dir() + pb_module_name + std::string(SDC_FILE_NAME_POSTFIX));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
 
@@ -459,7 +460,7 @@ void print_pnr_sdc_constrain_primitive_pb_graph_node(const PnrSdcOption& options
   }
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -20,6 +20,7 @@
 #include "openfpga_port.h"
 #include "openfpga_side_manager.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "mux_utils.h"
 
@@ -160,8 +161,8 @@ void print_pnr_sdc_constrain_sb_timing(const PnrSdcOption& options,
   std::string sdc_fname(sdc_dir + generate_switch_block_module_name(gsb_coordinate) + std::string(SDC_FILE_NAME_POSTFIX));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate file stream */
   check_file_stream(sdc_fname.c_str(), fp);
@@ -207,7 +208,7 @@ void print_pnr_sdc_constrain_sb_timing(const PnrSdcOption& options,
   }
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -433,8 +434,8 @@ void print_pnr_sdc_constrain_cb_timing(const PnrSdcOption& options,
   std::string sdc_fname(sdc_dir + generate_connection_block_module_name(cb_type, gsb_coordinate) + std::string(SDC_FILE_NAME_POSTFIX));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate file stream */
   check_file_stream(sdc_fname.c_str(), fp);
@@ -527,7 +528,7 @@ void print_pnr_sdc_constrain_cb_timing(const PnrSdcOption& options,
   }
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
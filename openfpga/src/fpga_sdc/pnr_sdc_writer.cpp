@@ -21,6 +21,7 @@
 #include "openfpga_port.h"
 #include "openfpga_wildcard_string.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "mux_utils.h"
 
@@ -59,8 +60,8 @@ void print_pnr_sdc_constrain_configurable_memory_outputs(const std::string& sdc_
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
 
@@ -73,7 +74,7 @@ void print_pnr_sdc_constrain_configurable_memory_outputs(const std::string& sdc_
                                                               format_dir_path(module_manager.module_name(top_module)));
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -97,8 +98,8 @@ void print_pnr_sdc_flatten_routing_disable_switch_block_outputs(const std::strin
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
 
@@ -183,15 +184,15 @@ void print_pnr_sdc_flatten_routing_disable_switch_block_outputs(const std::strin
 
         fp << "set_disable_timing ";
         fp << module_path;
-        fp << port_name << std::endl;
+        fp << port_name << "\n";
 
-        fp << std::endl;
+        fp << "\n";
       }
     }
   }
   
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -215,8 +216,8 @@ void print_pnr_sdc_compact_routing_disable_switch_block_outputs(const std::strin
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
 
@@ -302,15 +303,15 @@ void print_pnr_sdc_compact_routing_disable_switch_block_outputs(const std::strin
 
         fp << "set_disable_timing ";
         fp << module_path;
-        fp << port_name << std::endl;
+        fp << port_name << "\n";
 
-        fp << std::endl;
+        fp << "\n";
       }
     }
   }
   
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
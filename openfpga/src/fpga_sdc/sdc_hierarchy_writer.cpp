@@ -8,6 +8,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_reserved_words.h"
 #include "openfpga_naming.h"
@@ -54,9 +55,9 @@ void print_pnr_sdc_routing_sb_hierarchy(const std::string& sdc_dir,
   VTR_ASSERT(true != fname.empty());
 
   /* Create a file handler*/
-  std::fstream fp;
+  BufferedFstream fp;
   /* Open a file */
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(fname.c_str(), fp);
@@ -92,7 +93,7 @@ void print_pnr_sdc_routing_sb_hierarchy(const std::string& sdc_dir,
   }
 
   /* close a file */
-  fp.close();
+  fp.close_file();
 }
 
 /***************************************************************************************
@@ -135,9 +136,9 @@ void print_pnr_sdc_routing_cb_hierarchy(const std::string& sdc_dir,
   VTR_ASSERT(true != fname.empty());
 
   /* Create a file handler*/
-  std::fstream fp;
+  BufferedFstream fp;
   /* Open a file */
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(fname.c_str(), fp);
@@ -170,7 +171,7 @@ void print_pnr_sdc_routing_cb_hierarchy(const std::string& sdc_dir,
   }
 
   /* close a file */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -280,9 +281,9 @@ void print_pnr_sdc_grid_hierarchy(const std::string& sdc_dir,
   VTR_ASSERT(true != fname.empty());
 
   /* Create a file handler*/
-  std::fstream fp;
+  BufferedFstream fp;
   /* Open a file */
-  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  fp.open_file(fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(fname.c_str(), fp);
@@ -374,7 +375,7 @@ void print_pnr_sdc_grid_hierarchy(const std::string& sdc_dir,
   }
 
   /* close a file */
-  fp.close();
+  fp.close_file();
 }
 
 
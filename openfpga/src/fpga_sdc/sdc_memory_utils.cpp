@@ -102,7 +102,7 @@ void rec_print_pnr_sdc_disable_configurable_memory_module_output(std::fstream& f
   for (const BasicPort& output_port : module_manager.module_ports_by_type(parent_module, ModuleManager::MODULE_OUTPUT_PORT)) {
     fp << "set_disable_timing ";
     fp << parent_module_path << output_port.get_name();
-    fp << std::endl;
+    fp << "\n";
   }
 }
 
@@ -13,6 +13,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_reserved_words.h"
 #include "openfpga_naming.h"
@@ -48,8 +49,8 @@ void print_sdc_disable_routing_multiplexer_outputs(const std::string& sdc_dir,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(sdc_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(sdc_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(sdc_fname.c_str(), fp);
 
@@ -90,7 +91,7 @@ void print_sdc_disable_routing_multiplexer_outputs(const std::string& sdc_dir,
   }
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
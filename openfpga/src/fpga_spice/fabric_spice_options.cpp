@@ -15,6 +15,7 @@ FabricSpiceOption::FabricSpiceOption() {
   output_directory_.clear();
   explicit_port_mapping_ = false;
   compress_routing_ = false;
+  num_jobs_ = 1;
   verbose_output_ = false;
 }
 
@@ -33,6 +34,10 @@ bool FabricSpiceOption::compress_routing() const {
   return compress_routing_;
 }
 
+size_t FabricSpiceOption::num_jobs() const {
+  return num_jobs_;
+}
+
 bool FabricSpiceOption::verbose_output() const {
   return verbose_output_;
 }
@@ -52,6 +57,10 @@ void FabricSpiceOption::set_compress_routing(const bool& enabled) {
   compress_routing_ = enabled;
 }
 
+void FabricSpiceOption::set_num_jobs(const size_t& num_jobs) {
+  num_jobs_ = num_jobs;
+}
+
 void FabricSpiceOption::set_verbose_output(const bool& enabled) {
   verbose_output_ = enabled;
 }
@@ -20,16 +20,19 @@ class FabricSpiceOption {
     std::string output_directory() const;
     bool explicit_port_mapping() const;
     bool compress_routing() const;
+    size_t num_jobs() const;
     bool verbose_output() const;
   public: /* Public mutators */
     void set_output_directory(const std::string& output_dir);
     void set_explicit_port_mapping(const bool& enabled);
     void set_compress_routing(const bool& enabled);
+    void set_num_jobs(const size_t& num_jobs);
     void set_verbose_output(const bool& enabled);
   private: /* Internal Data */
     std::string output_directory_;
     bool explicit_port_mapping_;
     bool compress_routing_;
+    size_t num_jobs_;
     bool verbose_output_;
 };
 
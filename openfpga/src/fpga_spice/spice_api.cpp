@@ -93,13 +93,17 @@ int fpga_fabric_spice(const ModuleManager& module_manager,
     print_spice_unique_routing_modules(netlist_manager,
                                        module_manager,
                                        device_rr_gsb,
-                                       rr_dir_path);
+                                       rr_dir_path,
+                                       options.num_jobs(),
+                                       options.verbose_output());
   } else {
     VTR_ASSERT(false == options.compress_routing());
     print_spice_flatten_routing_modules(netlist_manager,
                                         module_manager,
                                         device_rr_gsb,
-                                        rr_dir_path);
+                                        rr_dir_path,
+                                        options.num_jobs(),
+                                        options.verbose_output());
   }
 
   /* Generate grids */
@@ -107,6 +111,7 @@ int fpga_fabric_spice(const ModuleManager& module_manager,
                     module_manager,
                     device_ctx, device_annotation,
                     lb_dir_path,
+                    options.num_jobs(),
                     options.verbose_output());
 
   /* Generate FPGA fabric */
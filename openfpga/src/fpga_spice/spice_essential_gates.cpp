@@ -17,6 +17,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_naming.h"
 #include "circuit_library_utils.h"
@@ -87,10 +88,10 @@ int print_spice_supply_wrappers(NetlistManager& netlist_manager,
   /* Create file stream */
   std::string spice_fname = submodule_dir + std::string(SUPPLY_WRAPPER_SPICE_FILE_NAME);
   
-  std::fstream fp;
+  BufferedFstream fp;
   
   /* Create the file stream */
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
   /* Check if the file stream if valid or not */
   check_file_stream(spice_fname.c_str(), fp); 
   
@@ -106,7 +107,7 @@ int print_spice_supply_wrappers(NetlistManager& netlist_manager,
   print_spice_supply_wrapper_subckt(module_manager, fp, 1);
 
   /* Close file handler*/
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -173,10 +174,10 @@ int print_spice_essential_gates(NetlistManager& netlist_manager,
     /* Create file stream */
     std::string spice_fname = submodule_dir + circuit_lib.model_name(circuit_model) + std::string(SPICE_NETLIST_FILE_POSTFIX);
   
-    std::fstream fp;
+    BufferedFstream fp;
   
     /* Create the file stream */
-    fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+    fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
     /* Check if the file stream if valid or not */
     check_file_stream(spice_fname.c_str(), fp); 
   
@@ -269,7 +270,7 @@ int print_spice_essential_gates(NetlistManager& netlist_manager,
     }
 
     /* Close file handler*/
-    fp.close();
+    fp.close_file();
 
     /* Add fname to the netlist name list */
     NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -16,6 +16,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_side_manager.h"
 
 /* Headers from vpr library */
@@ -63,11 +64,10 @@ namespace openfpga {
  *
  *******************************************************************/
 static 
-void print_spice_primitive_block(NetlistManager& netlist_manager,
+void print_spice_primitive_block(std::vector<std::string>& netlist_names,
                                  const ModuleManager& module_manager,
                                  const std::string& subckt_dir,
-                                 t_pb_graph_node* primitive_pb_graph_node,
-                                 const bool& verbose) {
+                                 t_pb_graph_node* primitive_pb_graph_node) {
   /* Ensure a valid pb_graph_node */ 
   if (nullptr == primitive_pb_graph_node) {
     VTR_LOGF_ERROR(__FILE__, __LINE__,
@@ -81,13 +81,9 @@ void print_spice_primitive_block(NetlistManager& netlist_manager,
                           + generate_logical_tile_netlist_name(std::string(), primitive_pb_graph_node, std::string(SPICE_NETLIST_FILE_POSTFIX))
                            );
 
-  VTR_LOG("Writing SPICE netlist '%s' for primitive pb_type '%s' ...",
-          spice_fname.c_str(), primitive_pb_graph_node->pb_type->name);
-  VTR_LOGV(verbose, "\n");
-
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
 
@@ -101,22 +97,14 @@ void print_spice_primitive_block(NetlistManager& netlist_manager,
   /* Ensure that the module has been created and thus unique! */
   VTR_ASSERT(true == module_manager.valid_module_id(primitive_module));
 
-  VTR_LOGV(verbose,
-          "Writing SPICE codes of logical tile primitive block '%s'...",
-           module_manager.module_name(primitive_module).c_str());
-  
   /* Write the spice module */
   write_spice_subckt_to_file(fp, module_manager, primitive_module);
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id, NetlistManager::LOGIC_BLOCK_NETLIST);
-
-  VTR_LOGV(verbose, "Done\n");
+  netlist_names.push_back(spice_fname);
 }
 
 /********************************************************************
@@ -135,12 +123,11 @@ void print_spice_primitive_block(NetlistManager& netlist_manager,
  * to its parent in module manager  
  *******************************************************************/
 static 
-void rec_print_spice_logical_tile(NetlistManager& netlist_manager,
+void rec_print_spice_logical_tile(std::vector<std::string>& netlist_names,
                                   const ModuleManager& module_manager,
                                   const VprDeviceAnnotation& device_annotation,
                                   const std::string& subckt_dir,
-                                  t_pb_graph_node* physical_pb_graph_node,
-                                  const bool& verbose) {
+                                  t_pb_graph_node* physical_pb_graph_node) {
 
   /* Check cur_pb_graph_node*/
   if (nullptr == physical_pb_graph_node) {
@@ -161,11 +148,10 @@ void rec_print_spice_logical_tile(NetlistManager& netlist_manager,
   if (false == is_primitive_pb_type(physical_pb_type)) { 
     for (int ipb = 0; ipb < physical_mode->num_pb_type_children; ++ipb) {
       /* Go recursive to visit the children */
-      rec_print_spice_logical_tile(netlist_manager,
+      rec_print_spice_logical_tile(netlist_names,
                                    module_manager, device_annotation,
                                    subckt_dir, 
-                                   &(physical_pb_graph_node->child_pb_graph_nodes[physical_mode->index][ipb][0]),
-                                   verbose);
+                                   &(physical_pb_graph_node->child_pb_graph_nodes[physical_mode->index][ipb][0]));
     }
   }
 
@@ -174,11 +160,10 @@ void rec_print_spice_logical_tile(NetlistManager& netlist_manager,
    * explict port mapping. This aims to avoid any port sequence issues!!!
    */
   if (true == is_primitive_pb_type(physical_pb_type)) { 
-    print_spice_primitive_block(netlist_manager,
+    print_spice_primitive_block(netlist_names,
                                 module_manager,
                                 subckt_dir,
-                                physical_pb_graph_node, 
-                                verbose);
+                                physical_pb_graph_node);
     /* Finish for primitive node, return */
     return;
   }
@@ -189,13 +174,9 @@ void rec_print_spice_logical_tile(NetlistManager& netlist_manager,
                           + generate_logical_tile_netlist_name(std::string(), physical_pb_graph_node, std::string(SPICE_NETLIST_FILE_POSTFIX))
                            );
 
-  VTR_LOG("Writing SPICE netlist '%s' for pb_type '%s' ...",
-          spice_fname.c_str(), physical_pb_type->name);
-  VTR_LOGV(verbose, "\n");
-
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
 
@@ -208,10 +189,6 @@ void rec_print_spice_logical_tile(NetlistManager& netlist_manager,
   ModuleId pb_module = module_manager.find_module(pb_module_name);
   VTR_ASSERT(true == module_manager.valid_module_id(pb_module));
 
-  VTR_LOGV(verbose,
-          "Writing SPICE codes of pb_type '%s'...",
-           module_manager.module_name(pb_module).c_str());
-
   /* Comment lines */
   print_spice_comment(fp, std::string("BEGIN Physical programmable logic block SPICE subckt: " + std::string(physical_pb_type->name)));
 
@@ -221,14 +198,10 @@ void rec_print_spice_logical_tile(NetlistManager& netlist_manager,
   print_spice_comment(fp, std::string("END Physical programmable logic block SPICE subckt: " + std::string(physical_pb_type->name)));
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id, NetlistManager::LOGIC_BLOCK_NETLIST);
-
-  VTR_LOGV(verbose, "Done\n");
+  netlist_names.push_back(spice_fname);
 }
 
 /*****************************************************************************
@@ -236,16 +209,11 @@ void rec_print_spice_logical_tile(NetlistManager& netlist_manager,
  * for the logical tile (pb_graph/pb_type) 
  *****************************************************************************/
 static 
-void print_spice_logical_tile_netlist(NetlistManager& netlist_manager,
-                                        const ModuleManager& module_manager,
-                                        const VprDeviceAnnotation& device_annotation,
-                                        const std::string& subckt_dir,
-                                        t_pb_graph_node* pb_graph_head,
-                                        const bool& verbose) {
-
-  VTR_LOG("Writing Verilog netlists for logic tile '%s' ...",
-          pb_graph_head->pb_type->name);
-  VTR_LOG("\n");
+std::vector<std::string> print_spice_logical_tile_netlist(const ModuleManager& module_manager,
+                                                          const VprDeviceAnnotation& device_annotation,
+                                                          const std::string& subckt_dir,
+                                                          t_pb_graph_node* pb_graph_head) {
+  std::vector<std::string> netlist_names;
 
   /* Print SPICE subckts for all the pb_types/pb_graph_nodes
    * use a Depth-First Search Algorithm to print the sub-modules 
@@ -254,15 +222,13 @@ void print_spice_logical_tile_netlist(NetlistManager& netlist_manager,
    * to its parent in module manager  
    */
   /* Print SPICE subckts starting from the top-level pb_type/pb_graph_node, and traverse the graph in a recursive way */
-  rec_print_spice_logical_tile(netlist_manager,
+  rec_print_spice_logical_tile(netlist_names,
                                module_manager,
                                device_annotation, 
                                subckt_dir,
-                               pb_graph_head,
-                               verbose);
+                               pb_graph_head);
 
-  VTR_LOG("Done\n");
-  VTR_LOG("\n");
+  return netlist_names;
 }
 
 /*****************************************************************************
@@ -274,11 +240,10 @@ void print_spice_logical_tile_netlist(NetlistManager& netlist_manager,
  * the I/O block locates at.
  *****************************************************************************/
 static 
-void print_spice_physical_tile_netlist(NetlistManager& netlist_manager,
-                                       const ModuleManager& module_manager,
-                                       const std::string& subckt_dir,
-                                       t_physical_tile_type_ptr phy_block_type,
-                                       const e_side& border_side) {
+std::string print_spice_physical_tile_netlist(const ModuleManager& module_manager,
+                                              const std::string& subckt_dir,
+                                              t_physical_tile_type_ptr phy_block_type,
+                                              const e_side& border_side) {
   /* Check code: if this is an IO block, the border side MUST be valid */
   if (true == is_io_type(phy_block_type)) {
     VTR_ASSERT(NUM_SIDES != border_side);
@@ -293,20 +258,9 @@ void print_spice_physical_tile_netlist(NetlistManager& netlist_manager,
                                                              std::string(SPICE_NETLIST_FILE_POSTFIX))
                            );
 
-  /* Echo status */
-  if (true == is_io_type(phy_block_type)) {
-    SideManager side_manager(border_side);
-    VTR_LOG("Writing SPICE Netlist '%s' for physical tile '%s' at %s side ...",
-            spice_fname.c_str(), phy_block_type->name, 
-            side_manager.c_str());
-  } else { 
-    VTR_LOG("Writing SPICE Netlist '%s' for physical_tile '%s'...",
-            spice_fname.c_str(), phy_block_type->name);
-  }
-
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
 
@@ -324,17 +278,12 @@ void print_spice_physical_tile_netlist(NetlistManager& netlist_manager,
   print_spice_comment(fp, std::string("END Grid SPICE subckt: " + module_manager.module_name(grid_module)));
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
-  /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id, NetlistManager::LOGIC_BLOCK_NETLIST);
-
-  VTR_LOG("Done\n");
+  return spice_fname;
 }
 
 /*****************************************************************************
@@ -342,16 +291,17 @@ void print_spice_physical_tile_netlist(NetlistManager& netlist_manager,
  * 1. Only one module for each I/O on each border side (IO_TYPE)
  * 2. Only one module for each CLB (FILL_TYPE)
  * 3. Only one module for each heterogeneous block
+ *
+ * The netlists of different logical tiles and physical tiles are independent
+ * from each other, and are written with num_jobs threads
  ****************************************************************************/
 void print_spice_grids(NetlistManager& netlist_manager,
                        const ModuleManager& module_manager,
                        const DeviceContext& device_ctx,
                        const VprDeviceAnnotation& device_annotation,
                        const std::string& subckt_dir,
+                       const size_t& num_jobs,
                        const bool& verbose) {
-  /* Create a vector to contain all the Verilog netlist names that have been generated in this function */
-  std::vector<std::string> netlist_names;
-
   /* Enumerate the types of logical tiles, and build a module for each 
    * Write modules for all the pb_types/pb_graph_nodes
    * use a Depth-First Search Algorithm to print the sub-modules 
@@ -361,18 +311,25 @@ void print_spice_grids(NetlistManager& netlist_manager,
    */
   VTR_LOG("Writing logical tiles...");
   VTR_LOGV(verbose, "\n");
+
+  std::vector<t_pb_graph_node*> pb_graph_heads;
   for (const t_logical_block_type& logical_tile : device_ctx.logical_block_types) {
     /* Bypass empty pb_graph */
     if (nullptr == logical_tile.pb_graph_head) {
       continue;
     }
-    print_spice_logical_tile_netlist(netlist_manager,
-                                       module_manager,
-                                       device_annotation,
-                                       subckt_dir,
-                                       logical_tile.pb_graph_head,
-                                       verbose);
+    pb_graph_heads.push_back(logical_tile.pb_graph_head);
   }
+
+  print_spice_netlist_list(netlist_manager, NetlistManager::LOGIC_BLOCK_NETLIST,
+                           pb_graph_heads.size(), num_jobs, verbose,
+                           [&](const size_t& itile) {
+    return print_spice_logical_tile_netlist(module_manager,
+                                            device_annotation,
+                                            subckt_dir,
+                                            pb_graph_heads[itile]);
+  });
+
   VTR_LOG("Writing logical tiles...");
   VTR_LOG("Done\n");
 
@@ -383,6 +340,8 @@ void print_spice_grids(NetlistManager& netlist_manager,
    */
   VTR_LOG("Building physical tiles...");
   VTR_LOGV(verbose, "\n");
+
+  std::vector<std::pair<t_physical_tile_type_ptr, e_side>> physical_tile_sides;
   for (const t_physical_tile_type& physical_tile : device_ctx.physical_tile_types) {
     /* Bypass empty type or nullptr */
     if (true == is_empty_type(&physical_tile)) {
@@ -399,36 +358,27 @@ void print_spice_grids(NetlistManager& netlist_manager,
       std::set<e_side> io_type_sides = find_physical_io_tile_located_sides(device_ctx.grid,
                                                                            &physical_tile);
       for (const e_side& io_type_side : io_type_sides) {
-        print_spice_physical_tile_netlist(netlist_manager,
-                                          module_manager,
-                                          subckt_dir, 
-                                          &physical_tile,
-                                          io_type_side);
+        physical_tile_sides.push_back(std::make_pair(&physical_tile, io_type_side));
       } 
       continue;
     } else {
       /* For CLB and heterogenenous blocks */
-      print_spice_physical_tile_netlist(netlist_manager,
-                                        module_manager,
-                                        subckt_dir, 
-                                        &physical_tile,
-                                        NUM_SIDES);
+      physical_tile_sides.push_back(std::make_pair(&physical_tile, NUM_SIDES));
     }
   }
+
+  print_spice_netlist_list(netlist_manager, NetlistManager::LOGIC_BLOCK_NETLIST,
+                           physical_tile_sides.size(), num_jobs, verbose,
+                           [&](const size_t& itile) {
+    return std::vector<std::string>(1, print_spice_physical_tile_netlist(module_manager,
+                                                                         subckt_dir, 
+                                                                         physical_tile_sides[itile].first,
+                                                                         physical_tile_sides[itile].second));
+  });
+
   VTR_LOG("Building physical tiles...");
   VTR_LOG("Done\n");
   VTR_LOG("\n");
-
-  /* Output a header file for all the logic blocks */
-  /*
-  std::string grid_spice_fname(LOGIC_BLOCK_VERILOG_FILE_NAME);
-  VTR_LOG("Writing header file for grid SPICE subckts '%s' ...",
-          grid_spice_fname.c_str());
-  print_spice_netlist_include_header_file(netlist_names,
-                                          subckt_dir.c_str(),
-                                          grid_spice_fname.c_str());
-  VTR_LOG("Done\n");
-   */
 }
 
 } /* end namespace openfpga */
@@ -22,6 +22,7 @@ void print_spice_grids(NetlistManager& netlist_manager,
                       const DeviceContext& device_ctx,
                       const VprDeviceAnnotation& device_annotation,
                       const std::string& subckt_dir,
+                      const size_t& num_jobs,
                       const bool& verbose);
 
 
@@ -10,6 +10,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -40,10 +41,10 @@ int print_spice_submodule_luts(NetlistManager& netlist_manager,
 
   std::string spice_fname = submodule_dir + std::string(LUTS_SPICE_FILE_NAME);
 
-  std::fstream fp;
+  BufferedFstream fp;
 
   /* Create the file stream */
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
   /* Check if the file stream if valid or not */
   check_file_stream(spice_fname.c_str(), fp); 
 
@@ -67,7 +68,7 @@ int print_spice_submodule_luts(NetlistManager& netlist_manager,
   }
 
   /* Close the file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -12,6 +12,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -63,7 +64,7 @@ void print_spice_mux_memory_module(const ModuleManager& module_manager,
     write_spice_subckt_to_file(fp, module_manager, mem_module);
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
     break;
   }
   case CIRCUIT_MODEL_DESIGN_RRAM:
@@ -107,8 +108,8 @@ int print_spice_submodule_memories(NetlistManager& netlist_manager,
   std::string spice_fname(submodule_dir + std::string(MEMORIES_SPICE_FILE_NAME));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
 
@@ -177,11 +178,11 @@ int print_spice_submodule_memories(NetlistManager& netlist_manager,
     write_spice_subckt_to_file(fp, module_manager, mem_module);
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
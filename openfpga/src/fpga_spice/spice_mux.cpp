@@ -21,6 +21,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -76,7 +77,7 @@ void generate_spice_mux_branch_subckt(const ModuleManager& module_manager,
     VTR_ASSERT(true == module_manager.valid_module_id(mux_module));
     write_spice_subckt_to_file(fp, module_manager, mux_module);
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
     break;
   }
   case CIRCUIT_MODEL_DESIGN_RRAM:
@@ -119,7 +120,7 @@ void generate_spice_mux_subckt(const ModuleManager& module_manager,
     VTR_ASSERT(true == module_manager.valid_module_id(mux_module));
     write_spice_subckt_to_file(fp, module_manager, mux_module);
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
     break;
   }
   case CIRCUIT_MODEL_DESIGN_RRAM:
@@ -152,8 +153,8 @@ int print_spice_submodule_mux_primitives(NetlistManager& netlist_manager,
   std::string spice_fname(submodule_dir + std::string(MUX_PRIMITIVES_SPICE_FILE_NAME));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
 
@@ -183,7 +184,7 @@ int print_spice_submodule_mux_primitives(NetlistManager& netlist_manager,
   }
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -210,8 +211,8 @@ int print_spice_submodule_mux_top_subckt(NetlistManager& netlist_manager,
   std::string spice_fname(submodule_dir + std::string(MUXES_SPICE_FILE_NAME));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
 
@@ -230,7 +231,7 @@ int print_spice_submodule_mux_top_subckt(NetlistManager& netlist_manager,
   }
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -9,9 +9,11 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Include FPGA-Verilog header files*/
 #include "openfpga_naming.h"
+#include "device_rr_gsb_utils.h"
 #include "spice_constants.h"
 #include "spice_writer_utils.h"
 #include "spice_subckt_writer.h"
@@ -75,18 +77,17 @@ namespace openfpga {
  *              
  ********************************************************************/
 static 
-void print_spice_routing_connection_box_unique_module(NetlistManager& netlist_manager,
-                                                      const ModuleManager& module_manager, 
-                                                      const std::string& subckt_dir, 
-                                                      const RRGSB& rr_gsb,
-                                                      const t_rr_type& cb_type) {
+std::string print_spice_routing_connection_box_unique_module(const ModuleManager& module_manager, 
+                                                             const std::string& subckt_dir, 
+                                                             const RRGSB& rr_gsb,
+                                                             const t_rr_type& cb_type) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_cb_x(cb_type), rr_gsb.get_cb_y(cb_type));
   std::string spice_fname(subckt_dir + generate_connection_block_netlist_name(cb_type, gsb_coordinate, std::string(SPICE_NETLIST_FILE_POSTFIX)));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
 
@@ -100,15 +101,12 @@ void print_spice_routing_connection_box_unique_module(NetlistManager& netlist_ma
   write_spice_subckt_to_file(fp, module_manager, cb_module);
  
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
-  /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id, NetlistManager::ROUTING_MODULE_NETLIST);
+  return spice_fname;
 }
 
 /*********************************************************************
@@ -175,17 +173,16 @@ void print_spice_routing_connection_box_unique_module(NetlistManager& netlist_ma
  *
  ********************************************************************/
 static 
-void print_spice_routing_switch_box_unique_module(NetlistManager& netlist_manager,
-                                                  const ModuleManager& module_manager, 
-                                                  const std::string& subckt_dir, 
-                                                  const RRGSB& rr_gsb) {
+std::string print_spice_routing_switch_box_unique_module(const ModuleManager& module_manager, 
+                                                         const std::string& subckt_dir, 
+                                                         const RRGSB& rr_gsb) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
   std::string spice_fname(subckt_dir + generate_routing_block_netlist_name(SB_SPICE_FILE_NAME_PREFIX, gsb_coordinate, std::string(SPICE_NETLIST_FILE_POSTFIX)));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
 
@@ -199,43 +196,9 @@ void print_spice_routing_switch_box_unique_module(NetlistManager& netlist_manage
   write_spice_subckt_to_file(fp, module_manager, sb_module);
  
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
-  /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id, NetlistManager::ROUTING_MODULE_NETLIST);
-}
-
-/********************************************************************
- * Iterate over all the connection blocks in a device
- * and build a module for each of them 
- *******************************************************************/
-static 
-void print_spice_flatten_connection_block_modules(NetlistManager& netlist_manager,
-                                                  const ModuleManager& module_manager, 
-                                                  const DeviceRRGSB& device_rr_gsb,
-                                                  const std::string& subckt_dir,
-                                                  const t_rr_type& cb_type) {
-  /* Build unique X-direction connection block modules */
-  vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
-
-  for (size_t ix = 0; ix < cb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < cb_range.y(); ++iy) {
-      /* Check if the connection block exists in the device!
-       * Some of them do NOT exist due to heterogeneous blocks (height > 1) 
-       * We will skip those modules
-       */
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
-      if (true != rr_gsb.is_cb_exist(cb_type)) {
-        continue;
-      }
-      print_spice_routing_connection_box_unique_module(netlist_manager, 
-                                                       module_manager,
-                                                       subckt_dir, 
-                                                       rr_gsb, cb_type);
-    }
-  }
+  return spice_fname;
 }
 
 /********************************************************************
@@ -246,46 +209,37 @@ void print_spice_flatten_connection_block_modules(NetlistManager& netlist_manage
  * Covering:
  * 1. Connection blocks
  * 2. Switch blocks
+ *
+ * The netlists are independent from each other, and are written with num_jobs threads
  *******************************************************************/
 void print_spice_flatten_routing_modules(NetlistManager& netlist_manager,
                                          const ModuleManager& module_manager,
                                          const DeviceRRGSB& device_rr_gsb,
-                                         const std::string& subckt_dir) {
-  /* Create a vector to contain all the Verilog netlist names that have been generated in this function */
-  std::vector<std::string> netlist_names;
-
-  vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
-
+                                         const std::string& subckt_dir,
+                                         const size_t& num_jobs,
+                                         const bool& verbose) {
   /* Build unique switch block modules */
-  for (size_t ix = 0; ix < sb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < sb_range.y(); ++iy) {
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
-      if (true != rr_gsb.is_sb_exist()) {
-        continue;
-      }
-      print_spice_routing_switch_box_unique_module(netlist_manager,
-                                                   module_manager, 
-                                                   subckt_dir, 
-                                                   rr_gsb);
-    }
+  std::vector<const RRGSB*> sb_rr_gsbs = find_device_rr_gsbs_with_module(device_rr_gsb, true, NUM_RR_TYPES);
+  print_spice_netlist_list(netlist_manager, NetlistManager::ROUTING_MODULE_NETLIST,
+                           sb_rr_gsbs.size(), num_jobs, verbose,
+                           [&](const size_t& isb) {
+    return std::vector<std::string>(1, print_spice_routing_switch_box_unique_module(module_manager, 
+                                                                                    subckt_dir, 
+                                                                                    *sb_rr_gsbs[isb]));
+  });
+
+  for (const t_rr_type& cb_type : {CHANX, CHANY}) {
+    std::vector<const RRGSB*> cb_rr_gsbs = find_device_rr_gsbs_with_module(device_rr_gsb, false, cb_type);
+    print_spice_netlist_list(netlist_manager, NetlistManager::ROUTING_MODULE_NETLIST,
+                             cb_rr_gsbs.size(), num_jobs, verbose,
+                             [&](const size_t& icb) {
+      return std::vector<std::string>(1, print_spice_routing_connection_box_unique_module(module_manager,
+                                                                                          subckt_dir, 
+                                                                                          *cb_rr_gsbs[icb], cb_type));
+    });
   }
-
-  print_spice_flatten_connection_block_modules(netlist_manager, module_manager, device_rr_gsb, subckt_dir, CHANX);
-
-  print_spice_flatten_connection_block_modules(netlist_manager, module_manager, device_rr_gsb, subckt_dir, CHANY);
-
-  /*
-  VTR_LOG("Writing header file for routing submodules '%s'...",
-          ROUTING_VERILOG_FILE_NAME);
-  print_spice_netlist_include_header_file(netlist_names,
-                                          subckt_dir.c_str(),
-                                          ROUTING_VERILOG_FILE_NAME);
-  VTR_LOG("Done\n");
-  VTR_LOG("\n");
-   */
 }
 
-
 /********************************************************************
  * A top-level function of this file
  * Print all the unique modules for global routing architecture of a FPGA fabric
@@ -293,53 +247,37 @@ void print_spice_flatten_routing_modules(NetlistManager& netlist_manager,
  * 1. Connection blocks
  * 2. Switch blocks
  *
+ * The netlists are independent from each other, and are written with num_jobs threads
+ *
  * Note: this function SHOULD be called only when 
  * the option compact_routing_hierarchy is turned on!!!
  *******************************************************************/
 void print_spice_unique_routing_modules(NetlistManager& netlist_manager,
-                                          const ModuleManager& module_manager,
-                                          const DeviceRRGSB& device_rr_gsb,
-                                          const std::string& subckt_dir) {
-  /* Create a vector to contain all the Verilog netlist names that have been generated in this function */
-  std::vector<std::string> netlist_names;
-
+                                        const ModuleManager& module_manager,
+                                        const DeviceRRGSB& device_rr_gsb,
+                                        const std::string& subckt_dir,
+                                        const size_t& num_jobs,
+                                        const bool& verbose) {
   /* Build unique switch block modules */
-  for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(isb);
-    print_spice_routing_switch_box_unique_module(netlist_manager,
-                                                 module_manager,
-                                                 subckt_dir, 
-                                                 unique_mirror);
-  }
-
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANX); ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANX, icb);
-
-    print_spice_routing_connection_box_unique_module(netlist_manager,
-                                                     module_manager,
-                                                     subckt_dir, 
-                                                     unique_mirror, CHANX);
-  }
-
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANY); ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANY, icb);
-
-    print_spice_routing_connection_box_unique_module(netlist_manager, 
-                                                     module_manager,
-                                                     subckt_dir, 
-                                                     unique_mirror, CHANY);
+  print_spice_netlist_list(netlist_manager, NetlistManager::ROUTING_MODULE_NETLIST,
+                           device_rr_gsb.get_num_sb_unique_module(), num_jobs, verbose,
+                           [&](const size_t& isb) {
+    return std::vector<std::string>(1, print_spice_routing_switch_box_unique_module(module_manager,
+                                                                                    subckt_dir, 
+                                                                                    device_rr_gsb.get_sb_unique_module(isb)));
+  });
+
+  /* Build unique X-direction and Y-direction connection block modules */
+  for (const t_rr_type& cb_type : {CHANX, CHANY}) {
+    print_spice_netlist_list(netlist_manager, NetlistManager::ROUTING_MODULE_NETLIST,
+                             device_rr_gsb.get_num_cb_unique_module(cb_type), num_jobs, verbose,
+                             [&](const size_t& icb) {
+      return std::vector<std::string>(1, print_spice_routing_connection_box_unique_module(module_manager,
+                                                                                          subckt_dir, 
+                                                                                          device_rr_gsb.get_cb_unique_module(cb_type, icb), cb_type));
+    });
   }
 
-  /*
-  VTR_LOG("Writing header file for routing submodules '%s'...",
-          ROUTING_VERILOG_FILE_NAME);
-  print_spice_netlist_include_header_file(netlist_names,
-                                          subckt_dir.c_str(),
-                                          ROUTING_VERILOG_FILE_NAME);
-  VTR_LOG("Done\n");
-   */
   VTR_LOG("\n");
 }
 
@@ -375,7 +375,7 @@ void write_spice_instance_to_file(std::fstream& fp,
         new_line = false;
         if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
           pin_cnt = 0;
-          fp << std::endl;
+          fp << "\n";
           new_line = true;
           fit_one_line = false;
         }
@@ -401,7 +401,7 @@ void write_spice_instance_to_file(std::fstream& fp,
   new_line = false;
   if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
     pin_cnt = 0;
-    fp << std::endl;
+    fp << "\n";
     new_line = true;
     fit_one_line = false;
   }
@@ -410,14 +410,14 @@ void write_spice_instance_to_file(std::fstream& fp,
    * if port print cannot fit one line, we create a new line for the module for a clean format
    */
   if (false == fit_one_line) {
-    fp << std::endl;
+    fp << "\n";
     fp << "+";
   }
   write_space_to_file(fp, 1);
   fp << module_manager.module_name(child_module);
   
   /* Print an end to the instance */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -438,10 +438,10 @@ void write_spice_subckt_to_file(std::fstream& fp,
   print_spice_subckt_definition(fp, module_manager, module_id);
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Print local connection (from module inputs to output! */
   print_spice_comment(fp, std::string("BEGIN Local short connections"));
@@ -453,7 +453,7 @@ void write_spice_subckt_to_file(std::fstream& fp,
  
   print_spice_comment(fp, std::string("END Local output short connections"));
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Print instances */
   for (ModuleId child_module : module_manager.child_modules(module_id)) {
@@ -461,7 +461,7 @@ void write_spice_subckt_to_file(std::fstream& fp,
       /* Print an instance */
       write_spice_instance_to_file(fp, module_manager, module_id, child_module, instance); 
       /* Print an empty line as splitter */
-      fp << std::endl;
+      fp << "\n";
     }
   }
 
@@ -469,7 +469,7 @@ void write_spice_subckt_to_file(std::fstream& fp,
   print_spice_subckt_end(fp, module_manager.module_name(module_id)); 
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 } /* end namespace openfpga */
@@ -12,6 +12,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_naming.h"
 
@@ -49,8 +50,8 @@ void print_spice_top_module(NetlistManager& netlist_manager,
           spice_fname.c_str());
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(spice_fname.c_str(), fp);
 
@@ -60,10 +61,10 @@ void print_spice_top_module(NetlistManager& netlist_manager,
   write_spice_subckt_to_file(fp, module_manager, top_module);
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -15,6 +15,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "circuit_library_utils.h"
 
@@ -76,10 +77,10 @@ int print_spice_transistor_wrapper(NetlistManager& netlist_manager,
                                    const std::string& submodule_dir) {
   std::string spice_fname = submodule_dir + std::string(TRANSISTORS_SPICE_FILE_NAME);
 
-  std::fstream fp;
+  BufferedFstream fp;
 
   /* Create the file stream */
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+  fp.open_file(spice_fname, std::fstream::out | std::fstream::trunc);
   /* Check if the file stream if valid or not */
   check_file_stream(spice_fname.c_str(), fp); 
 
@@ -102,7 +103,7 @@ int print_spice_transistor_wrapper(NetlistManager& netlist_manager,
   } 
 
   /* Close file handler*/
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
@@ -7,10 +7,12 @@
 #include <string>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_parallel.h"
 
 /* Headers from readarchopenfpga library */
 #include "circuit_types.h"
@@ -35,14 +37,61 @@ void print_spice_file_header(std::fstream& fp,
   auto end = std::chrono::system_clock::now(); 
   std::time_t end_time = std::chrono::system_clock::to_time_t(end);
 
-  fp << "*********************************************" << std::endl;
-  fp << "*\tFPGA-SPICE Netlist" << std::endl;
-  fp << "*\tDescription: " << usage << std::endl;
-  fp << "*\tAuthor: Xifan TANG" << std::endl;
-  fp << "*\tOrganization: University of Utah" << std::endl;
-  fp << "*\tDate: " << std::ctime(&end_time) ;
-  fp << "*********************************************" << std::endl;
-  fp << std::endl;
+  /* std::ctime() returns a shared buffer, while netlists may be written by several threads */
+  static std::mutex ctime_mutex;
+  std::string end_time_str;
+  {
+    std::lock_guard<std::mutex> lock(ctime_mutex);
+    end_time_str = std::ctime(&end_time);
+  }
+
+  fp << "*********************************************" << "\n";
+  fp << "*\tFPGA-SPICE Netlist" << "\n";
+  fp << "*\tDescription: " << usage << "\n";
+  fp << "*\tAuthor: Xifan TANG" << "\n";
+  fp << "*\tOrganization: University of Utah" << "\n";
+  fp << "*\tDate: " << end_time_str;
+  fp << "*********************************************" << "\n";
+  fp << "\n";
+}
+
+/********************************************************************
+ * Print the netlists of a list of items (e.g., routing modules),
+ * with a given number of threads.
+ * print_netlists(iitem) should write the netlists of the iitem-th item
+ * and return their file names, without touching the netlist manager.
+ *
+ * The items are split into contiguous chunks, one per thread, and
+ * the netlists are registered in the netlist manager in the order of
+ * the items once all of them are written, so that the netlist manager
+ * is the same as the one of a serial run.
+ * Log messages are also printed after the netlists are written,
+ * as the threads would interleave them.
+ *******************************************************************/
+void print_spice_netlist_list(NetlistManager& netlist_manager,
+                              const NetlistManager::e_netlist_type& netlist_type,
+                              const size_t& num_items,
+                              const size_t& num_jobs,
+                              const bool& verbose,
+                              const std::function<std::vector<std::string>(const size_t&)>& print_netlists) {
+  std::vector<std::vector<std::string>> item_netlists(num_items);
+
+  vtr::parallel_for_chunks(num_items, num_jobs, [&](size_t /*ichunk*/, size_t begin, size_t end) {
+    for (size_t iitem = begin; iitem < end; ++iitem) {
+      item_netlists[iitem] = print_netlists(iitem);
+    }
+  });
+
+  for (const std::vector<std::string>& netlists : item_netlists) {
+    for (const std::string& netlist : netlists) {
+      VTR_LOGV(verbose,
+               "Written SPICE netlist '%s'\n",
+               netlist.c_str());
+      NetlistId nlist_id = netlist_manager.add_netlist(netlist);
+      VTR_ASSERT(NetlistId::INVALID() != nlist_id);
+      netlist_manager.set_netlist_type(nlist_id, netlist_type);
+    }
+  }
 }
 
 /********************************************************************
@@ -52,7 +101,7 @@ void print_spice_include_netlist(std::fstream& fp,
                                  const std::string& netlist_name) {
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << ".include \"" << netlist_name << "\"" << std::endl; 
+  fp << ".include \"" << netlist_name << "\"" << "\n"; 
 }
 
 /************************************************
@@ -63,9 +112,9 @@ void print_spice_comment(std::fstream& fp,
   VTR_ASSERT(true == valid_file_stream(fp));
 
   std::string comment_cover(comment.length() + 4, '*');
-  fp << comment_cover << std::endl;
-  fp << "* " << comment << " *" << std::endl;
-  fp << comment_cover << std::endl;
+  fp << comment_cover << "\n";
+  fp << "* " << comment << " *" << "\n";
+  fp << comment_cover << "\n";
 }
 
 
@@ -150,7 +199,7 @@ void print_spice_subckt_definition(std::fstream& fp,
         new_line = false;
         if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
           pin_cnt = 0;
-          fp << std::endl;
+          fp << "\n";
           new_line = true;
         }
       }
@@ -172,7 +221,7 @@ void print_spice_subckt_definition(std::fstream& fp,
     fp << SPICE_SUBCKT_GND_PORT_NAME;
   }
 
-  fp << std::endl;
+  fp << "\n";
 }
 
 /************************************************
@@ -182,9 +231,9 @@ void print_spice_subckt_end(std::fstream& fp,
                             const std::string& module_name) {
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << ".ends" << std::endl;
+  fp << ".ends" << "\n";
   print_spice_comment(fp, std::string("***** END SPICE module for " + module_name + " *****"));
-  fp << std::endl;
+  fp << "\n";
 }
 
 /************************************************
@@ -201,7 +250,7 @@ void print_spice_resistor(std::fstream& fp,
   fp << " " << input_port;
   fp << " " << output_port;
   fp << " " << std::setprecision(10) << resistance;
-  fp << std::endl;
+  fp << "\n";
 }
 
 /************************************************
@@ -218,7 +267,7 @@ void print_spice_capacitor(std::fstream& fp,
   fp << " " << input_port;
   fp << " " << output_port;
   fp << " " << std::setprecision(10) << capacitance;
-  fp << std::endl;
+  fp << "\n";
 }
 
 /************************************************
@@ -320,7 +369,7 @@ void print_spice_subckt_instance(std::fstream& fp,
         new_line = false;
         if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
           pin_cnt = 0;
-          fp << std::endl;
+          fp << "\n";
           new_line = true;
           fit_one_line = false;
         }
@@ -346,7 +395,7 @@ void print_spice_subckt_instance(std::fstream& fp,
   new_line = false;
   if (SPICE_NETLIST_MAX_NUM_PORTS_PER_LINE == pin_cnt) {
     pin_cnt = 0;
-    fp << std::endl;
+    fp << "\n";
     new_line = true;
     fit_one_line = false;
   }
@@ -355,14 +404,14 @@ void print_spice_subckt_instance(std::fstream& fp,
    * if port print cannot fit one line, we create a new line for the module for a clean format
    */
   if (false == fit_one_line) {
-    fp << std::endl;
+    fp << "\n";
     fp << "+";
   }
   write_space_to_file(fp, 1);
   fp << module_manager.module_name(module_id);
   
   /* Print an end to the instance */
-  fp << std::endl;
+  fp << "\n";
 }
 
 } /* end namespace openfpga */
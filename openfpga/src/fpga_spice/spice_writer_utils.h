@@ -10,11 +10,13 @@
  * Include header files that are required by function declaration
  *******************************************************************/
 #include <fstream>
+#include <functional>
 #include <vector>
 #include <string>
 #include "openfpga_port.h"
 #include "circuit_library.h"
 #include "module_manager.h"
+#include "netlist_manager.h"
 
 /********************************************************************
  * Function declaration
@@ -33,6 +35,13 @@ namespace openfpga {
 void print_spice_file_header(std::fstream& fp,
                              const std::string& usage);
 
+void print_spice_netlist_list(NetlistManager& netlist_manager,
+                              const NetlistManager::e_netlist_type& netlist_type,
+                              const size_t& num_items,
+                              const size_t& num_jobs,
+                              const bool& verbose,
+                              const std::function<std::vector<std::string>(const size_t&)>& print_netlists);
+
 void print_spice_include_netlist(std::fstream& fp, 
                                  const std::string& netlist_name);
 
@@ -10,6 +10,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_naming.h"
 #include "circuit_library_utils.h"
@@ -43,8 +44,8 @@ void print_verilog_fabric_include_netlist(const NetlistManager& netlist_manager,
   std::string verilog_fpath = src_dir_path + std::string(FABRIC_INCLUDE_VERILOG_NETLIST_FILE_NAME);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(verilog_fpath.c_str(), fp);
@@ -55,7 +56,7 @@ void print_verilog_fabric_include_netlist(const NetlistManager& netlist_manager,
   /* Print preprocessing flags */
   print_verilog_comment(fp, std::string("------ Include defines: preproc flags -----"));
   print_verilog_include_netlist(fp, std::string(src_dir + std::string(DEFINES_VERILOG_FILE_NAME)));
-  fp << std::endl;
+  fp << "\n";
 
   /* Include all the user-defined netlists */
   print_verilog_comment(fp, std::string("------ Include user-defined netlists -----"));
@@ -68,31 +69,31 @@ void print_verilog_fabric_include_netlist(const NetlistManager& netlist_manager,
   for (const NetlistId& nlist_id : netlist_manager.netlists_by_type(NetlistManager::SUBMODULE_NETLIST)) {
     print_verilog_include_netlist(fp, netlist_manager.netlist_name(nlist_id));
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Include all the CLB, heterogeneous block modules */
   print_verilog_comment(fp, std::string("------ Include logic block netlists -----"));
   for (const NetlistId& nlist_id : netlist_manager.netlists_by_type(NetlistManager::LOGIC_BLOCK_NETLIST)) {
     print_verilog_include_netlist(fp, netlist_manager.netlist_name(nlist_id));
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Include all the routing architecture modules */
   print_verilog_comment(fp, std::string("------ Include routing module netlists -----"));
   for (const NetlistId& nlist_id : netlist_manager.netlists_by_type(NetlistManager::ROUTING_MODULE_NETLIST)) {
     print_verilog_include_netlist(fp, netlist_manager.netlist_name(nlist_id));
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Include FPGA top module */
   print_verilog_comment(fp, std::string("------ Include fabric top-level netlists -----"));
   for (const NetlistId& nlist_id : netlist_manager.netlists_by_type(NetlistManager::TOP_MODULE_NETLIST)) {
     print_verilog_include_netlist(fp, netlist_manager.netlist_name(nlist_id));
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -110,8 +111,8 @@ void print_verilog_full_testbench_include_netlists(const std::string& src_dir,
   bool no_self_checking = options.no_self_checking();
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(verilog_fname.c_str(), fp);
@@ -127,19 +128,19 @@ void print_verilog_full_testbench_include_netlists(const std::string& src_dir,
     VTR_ASSERT_SAFE(false == fabric_netlist_file.empty());
     print_verilog_include_netlist(fp, fabric_netlist_file);
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Include reference benchmark netlist only when auto-check flag is enabled */
   if (!no_self_checking) {
     print_verilog_include_netlist(fp, std::string(reference_benchmark_file));
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Include top-level testbench only when auto-check flag is enabled */
   print_verilog_include_netlist(fp, src_dir + circuit_name + std::string(AUTOCHECK_TOP_TESTBENCH_VERILOG_FILE_POSTFIX));
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -157,8 +158,8 @@ void print_verilog_preconfigured_testbench_include_netlists(const std::string& s
   bool no_self_checking = options.no_self_checking();
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(verilog_fname.c_str(), fp);
@@ -174,12 +175,12 @@ void print_verilog_preconfigured_testbench_include_netlists(const std::string& s
     VTR_ASSERT_SAFE(false == fabric_netlist_file.empty());
     print_verilog_include_netlist(fp, fabric_netlist_file);
   }
-  fp << std::endl;
+  fp << "\n";
 
   /* Include reference benchmark netlist only when auto-check flag is enabled */
   if (!no_self_checking) {
     print_verilog_include_netlist(fp, std::string(reference_benchmark_file));
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Include formal verification netlists */
@@ -189,7 +190,7 @@ void print_verilog_preconfigured_testbench_include_netlists(const std::string& s
   print_verilog_include_netlist(fp, src_dir + circuit_name + std::string(RANDOM_TOP_TESTBENCH_VERILOG_FILE_POSTFIX));
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 }
 
 /********************************************************************
@@ -202,8 +203,8 @@ void print_verilog_preprocessing_flags_netlist(const std::string& src_dir,
   std::string verilog_fname = src_dir + std::string(DEFINES_VERILOG_FILE_NAME);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(verilog_fname.c_str(), fp);
@@ -216,11 +217,11 @@ void print_verilog_preprocessing_flags_netlist(const std::string& src_dir,
   /* To enable timing */
   if (true == fabric_verilog_opts.include_timing()) {
     print_verilog_define_flag(fp, std::string(VERILOG_TIMING_PREPROC_FLAG), 1);
-    fp << std::endl;
+    fp << "\n";
   } 
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 }
 
 } /* end namespace openfpga */
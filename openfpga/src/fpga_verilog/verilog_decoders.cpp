@@ -9,6 +9,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_decode.h"
 
 #include "decoder_library_utils.h"
@@ -112,19 +113,19 @@ void print_verilog_mux_local_decoder_module(std::fstream& fp,
    * The rest of addr codes 3'b110, 3'b111 will be decoded to data=8'b0_0000;
    */
 
-  fp << "\t" << "always@(" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << std::endl;
-  fp << "\t" << "case (" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << std::endl;
+  fp << "\t" << "always@(" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << "\n";
+  fp << "\t" << "case (" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << "\n";
   /* Create a string for addr and data */
   for (size_t i = 0; i < data_size; ++i) {
     fp << "\t\t" << generate_verilog_constant_values(itobin_vec(i, addr_size)); 
     fp << " : ";
     fp << generate_verilog_port_constant_values(data_port, ito1hot_vec(i, data_size)); 
-    fp << ";" << std::endl;
+    fp << ";" << "\n";
   }
   fp << "\t\t" << "default : ";
   fp << generate_verilog_port_constant_values(data_port, ito1hot_vec(data_size - 1, data_size)); 
-  fp << ";" << std::endl;
-  fp << "\t" << "endcase" << std::endl;
+  fp << ";" << "\n";
+  fp << "\t" << "endcase" << "\n";
 
   print_verilog_wire_connection(fp, data_inv_port, data_port, true);
   
@@ -172,8 +173,8 @@ void print_verilog_submodule_mux_local_decoders(const ModuleManager& module_mana
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -220,7 +221,7 @@ void print_verilog_submodule_mux_local_decoders(const ModuleManager& module_mana
   }
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -331,18 +332,18 @@ void print_verilog_arch_decoder_module(std::fstream& fp,
     if (readback_port_id) {
       fp << " or " << "~" << generate_verilog_port(VERILOG_PORT_CONKT, readback_port);
     }
-    fp << ") begin" << std::endl;
+    fp << ") begin" << "\n";
     fp << "\tif ((" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) && ("; 
     if (readback_port_id) {
       fp << generate_verilog_port(VERILOG_PORT_CONKT, readback_port) << " == 1'b0) && ("; 
     }
     fp << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << " == 1'b0))"; 
-    fp << " begin" << std::endl;
-    fp << "\t\t" << generate_verilog_port_constant_values(data_port, std::vector<size_t>(1, 1)) << ";" << std::endl; 
-    fp << "\t" << "end else begin" << std::endl;
-    fp << "\t\t" << generate_verilog_port_constant_values(data_port, std::vector<size_t>(1, 0)) << ";" << std::endl; 
-    fp << "\t" << "end" << std::endl;
-    fp << "end" << std::endl;
+    fp << " begin" << "\n";
+    fp << "\t\t" << generate_verilog_port_constant_values(data_port, std::vector<size_t>(1, 1)) << ";" << "\n"; 
+    fp << "\t" << "end else begin" << "\n";
+    fp << "\t\t" << generate_verilog_port_constant_values(data_port, std::vector<size_t>(1, 0)) << ";" << "\n"; 
+    fp << "\t" << "end" << "\n";
+    fp << "end" << "\n";
 
     /* Output logics for data readback output */
     if (data_ren_port_id) {
@@ -352,16 +353,16 @@ void print_verilog_arch_decoder_module(std::fstream& fp,
       if (readback_port_id) {
         fp << " or " << generate_verilog_port(VERILOG_PORT_CONKT, readback_port);
       }
-      fp << ") begin" << std::endl;
+      fp << ") begin" << "\n";
       fp << "\tif ((" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) && ("; 
       fp << generate_verilog_port(VERILOG_PORT_CONKT, readback_port) << " == 1'b1) && ("; 
       fp << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << " == 1'b0))"; 
-      fp << " begin" << std::endl;
-      fp << "\t\t" << generate_verilog_port_constant_values(data_ren_port, std::vector<size_t>(1, 1)) << ";" << std::endl; 
-      fp << "\t" << "end else begin" << std::endl;
-      fp << "\t\t" << generate_verilog_port_constant_values(data_ren_port, std::vector<size_t>(1, 0)) << ";" << std::endl; 
-      fp << "\t" << "end" << std::endl;
-      fp << "end" << std::endl;
+      fp << " begin" << "\n";
+      fp << "\t\t" << generate_verilog_port_constant_values(data_ren_port, std::vector<size_t>(1, 1)) << ";" << "\n"; 
+      fp << "\t" << "end else begin" << "\n";
+      fp << "\t\t" << generate_verilog_port_constant_values(data_ren_port, std::vector<size_t>(1, 0)) << ";" << "\n"; 
+      fp << "\t" << "end" << "\n";
+      fp << "end" << "\n";
     }
 
     /* Depend on if the inverted data output port is needed or not */
@@ -400,40 +401,40 @@ void print_verilog_arch_decoder_module(std::fstream& fp,
     fp << " or " << "~" << generate_verilog_port(VERILOG_PORT_CONKT, readback_port);
   }
   fp << " or " << generate_verilog_port(VERILOG_PORT_CONKT, enable_port);
-  fp << ") begin" << std::endl;
+  fp << ") begin" << "\n";
   if (readback_port_id) {
     fp << "\tif (";
     fp << "(" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) ";
     fp << "&&";
     fp << "(" << generate_verilog_port(VERILOG_PORT_CONKT, readback_port) << " == 1'b0) ";
-    fp << ") begin" << std::endl;
+    fp << ") begin" << "\n";
   } else {
-    fp << "\tif (" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) begin" << std::endl;
+    fp << "\tif (" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) begin" << "\n";
   }
-  fp << "\t\t" << "case (" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << std::endl;
+  fp << "\t\t" << "case (" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << "\n";
   /* Create a string for addr and data */
   for (size_t i = 0; i < data_size; ++i) {
     fp << "\t\t\t" << generate_verilog_constant_values(itobin_vec(i, addr_size)); 
     fp << " : ";
     fp << generate_verilog_port_constant_values(data_port, ito1hot_vec(i, data_size)); 
-    fp << ";" << std::endl;
+    fp << ";" << "\n";
   }
   /* Different from MUX decoder, we assign default values which is all zero */
   fp << "\t\t\t" << "default"; 
   fp << " : ";
   fp << generate_verilog_port_constant_values(data_port, ito1hot_vec(data_size, data_size)); 
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
-  fp << "\t\t" << "endcase" << std::endl;
-  fp << "\t" << "end" << std::endl;
+  fp << "\t\t" << "endcase" << "\n";
+  fp << "\t" << "end" << "\n";
 
   /* If enable is not active, we should give all zero */
-  fp << "\t" << "else begin" << std::endl;
+  fp << "\t" << "else begin" << "\n";
   fp << "\t\t" << generate_verilog_port_constant_values(data_port, ito1hot_vec(data_size, data_size)); 
-  fp << ";" << std::endl;
-  fp << "\t" << "end" << std::endl;
+  fp << ";" << "\n";
+  fp << "\t" << "end" << "\n";
   
-  fp << "end" << std::endl;
+  fp << "end" << "\n";
 
   /* Output logics for data readback output */
   if (data_ren_port_id) {
@@ -443,36 +444,36 @@ void print_verilog_arch_decoder_module(std::fstream& fp,
       fp << " or " << generate_verilog_port(VERILOG_PORT_CONKT, readback_port);
     }
     fp << " or " << generate_verilog_port(VERILOG_PORT_CONKT, enable_port);
-    fp << ") begin" << std::endl;
+    fp << ") begin" << "\n";
     fp << "\tif (";
     fp << "(" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) ";
     fp << "&&";
     fp << "(" << generate_verilog_port(VERILOG_PORT_CONKT, readback_port) << " == 1'b1) ";
-    fp << ") begin" << std::endl;
-    fp << "\t\t" << "case (" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << std::endl;
+    fp << ") begin" << "\n";
+    fp << "\t\t" << "case (" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << "\n";
     /* Create a string for addr and data */
     for (size_t i = 0; i < data_size; ++i) {
       fp << "\t\t\t" << generate_verilog_constant_values(itobin_vec(i, addr_size)); 
       fp << " : ";
       fp << generate_verilog_port_constant_values(data_ren_port, ito1hot_vec(i, data_size)); 
-      fp << ";" << std::endl;
+      fp << ";" << "\n";
     }
     /* Different from MUX decoder, we assign default values which is all zero */
     fp << "\t\t\t" << "default"; 
     fp << " : ";
     fp << generate_verilog_port_constant_values(data_ren_port, ito1hot_vec(data_size, data_size)); 
-    fp << ";" << std::endl;
+    fp << ";" << "\n";
 
-    fp << "\t\t" << "endcase" << std::endl;
-    fp << "\t" << "end" << std::endl;
+    fp << "\t\t" << "endcase" << "\n";
+    fp << "\t" << "end" << "\n";
 
     /* If enable is not active, we should give all zero */
-    fp << "\t" << "else begin" << std::endl;
+    fp << "\t" << "else begin" << "\n";
     fp << "\t\t" << generate_verilog_port_constant_values(data_ren_port, ito1hot_vec(data_size, data_size)); 
-    fp << ";" << std::endl;
-    fp << "\t" << "end" << std::endl;
+    fp << ";" << "\n";
+    fp << "\t" << "end" << "\n";
     
-    fp << "end" << std::endl;
+    fp << "end" << "\n";
   }
 
   if (true == decoder_lib.use_data_inv_port(decoder)) {
@@ -564,13 +565,13 @@ void print_verilog_arch_decoder_with_data_in_module(std::fstream& fp,
   if (1 == data_size) {
     fp << "always@(" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port);
     fp << " or " << generate_verilog_port(VERILOG_PORT_CONKT, enable_port);
-    fp << ") begin" << std::endl;
-    fp << "\tif (" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) begin" << std::endl;
-    fp << "\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, din_port) << ";" << std::endl; 
-    fp << "\t" << "end else begin" << std::endl;
-    fp << "\t\t" << generate_verilog_port_constant_values(data_port, std::vector<size_t>(1, 0)) << ";" << std::endl; 
-    fp << "\t" << "end" << std::endl;
-    fp << "end" << std::endl;
+    fp << ") begin" << "\n";
+    fp << "\tif (" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) begin" << "\n";
+    fp << "\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, din_port) << ";" << "\n"; 
+    fp << "\t" << "end else begin" << "\n";
+    fp << "\t\t" << generate_verilog_port_constant_values(data_port, std::vector<size_t>(1, 0)) << ";" << "\n"; 
+    fp << "\t" << "end" << "\n";
+    fp << "end" << "\n";
 
     /* Depend on if the inverted data output port is needed or not */
     if (true == decoder_lib.use_data_inv_port(decoder)) {
@@ -590,15 +591,15 @@ void print_verilog_arch_decoder_with_data_in_module(std::fstream& fp,
   fp << "always@(" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port);
   fp << ", " << generate_verilog_port(VERILOG_PORT_CONKT, enable_port);
   fp << ", " << generate_verilog_port(VERILOG_PORT_CONKT, din_port);
-  fp << ") begin" << std::endl;
+  fp << ") begin" << "\n";
 
-  fp << "\tif (" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) begin" << std::endl;
+  fp << "\tif (" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port) << " == 1'b1) begin" << "\n";
   fp << "\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, data_port); 
   fp << " = ";
   std::string high_res_str = "{" + std::to_string(data_port.get_width()) + "{1'bz}}";
   fp << high_res_str;
-  fp << ";" << std::endl;
-  fp << "\t\t" << "case (" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << std::endl;
+  fp << ";" << "\n";
+  fp << "\t\t" << "case (" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port) << ")" << "\n";
   /* Create a string for addr and data */
   for (size_t i = 0; i < data_size; ++i) {
     BasicPort cur_data_port(data_port.get_name(), i, i);
@@ -607,7 +608,7 @@ void print_verilog_arch_decoder_with_data_in_module(std::fstream& fp,
     fp << generate_verilog_port(VERILOG_PORT_CONKT, cur_data_port); 
     fp << " = ";
     fp << generate_verilog_port(VERILOG_PORT_CONKT, din_port); 
-    fp << ";" << std::endl;
+    fp << ";" << "\n";
   }
   /* Different from MUX decoder, we assign default values which is all zero */
   fp << "\t\t\t" << "default"; 
@@ -615,20 +616,20 @@ void print_verilog_arch_decoder_with_data_in_module(std::fstream& fp,
   fp << "\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, data_port); 
   fp << " = ";
   fp << high_res_str;
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
-  fp << "\t\t" << "endcase" << std::endl;
-  fp << "\t" << "end" << std::endl;
+  fp << "\t\t" << "endcase" << "\n";
+  fp << "\t" << "end" << "\n";
 
   /* If enable is not active, we should give all zero */
-  fp << "\t" << "else begin" << std::endl;
+  fp << "\t" << "else begin" << "\n";
   fp << "\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, data_port); 
   fp << " = ";
   fp << high_res_str;
-  fp << ";" << std::endl;
-  fp << "\t" << "end" << std::endl;
+  fp << ";" << "\n";
+  fp << "\t" << "end" << "\n";
   
-  fp << "end" << std::endl;
+  fp << "end" << "\n";
 
 
   if (true == decoder_lib.use_data_inv_port(decoder)) {
@@ -661,8 +662,8 @@ void print_verilog_submodule_arch_decoders(const ModuleManager& module_manager,
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -682,7 +683,7 @@ void print_verilog_submodule_arch_decoders(const ModuleManager& module_manager,
   }
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
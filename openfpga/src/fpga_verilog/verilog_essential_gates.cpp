@@ -13,6 +13,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_port.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_naming.h"
 #include "module_manager.h"
@@ -43,7 +44,7 @@ void print_verilog_power_gated_invbuf_body(std::fstream& fp,
   print_verilog_comment(fp, std::string("----- Verilog codes of a power-gated inverter -----"));
 
   /* Create a sensitive list */
-  fp << "\treg " << circuit_lib.port_lib_name(output_port) << "_reg;" << std::endl;
+  fp << "\treg " << circuit_lib.port_lib_name(output_port) << "_reg;" << "\n";
 
   fp << "\talways @(";
   /* Power-gate port first*/
@@ -55,7 +56,7 @@ void print_verilog_power_gated_invbuf_body(std::fstream& fp,
     fp << circuit_lib.port_lib_name(power_gate_port);
     fp << ", ";
   }
-  fp << circuit_lib.port_lib_name(input_port) << ") begin" << std::endl; 
+  fp << circuit_lib.port_lib_name(input_port) << ") begin" << "\n"; 
 
   /* Dump the case of power-gated */
   fp << "\t\tif (";
@@ -68,7 +69,7 @@ void print_verilog_power_gated_invbuf_body(std::fstream& fp,
     }
     for (const auto& power_gate_pin : circuit_lib.pins(power_gate_port)) {
       if (0 < port_cnt) { 
-        fp << std::endl << "\t\t&&";
+        fp << "\n" << "\t\t&&";
       }
       fp << "(";
 
@@ -85,7 +86,7 @@ void print_verilog_power_gated_invbuf_body(std::fstream& fp,
     }
   }
 
-  fp << ") begin" << std::endl;
+  fp << ") begin" << "\n";
   fp << "\t\t\tassign " << circuit_lib.port_lib_name(output_port) << "_reg = "; 
 
   /* Branch on the type of inverter/buffer: 
@@ -101,12 +102,12 @@ void print_verilog_power_gated_invbuf_body(std::fstream& fp,
     fp << "~";
   } 
 
-  fp << circuit_lib.port_lib_name(input_port) << ";" << std::endl;
-  fp << "\t\tend else begin" << std::endl;
-  fp << "\t\t\tassign " << circuit_lib.port_lib_name(output_port) << "_reg = 1'bz;" << std::endl;
-  fp << "\t\tend" << std::endl;
-  fp << "\tend" << std::endl;
-  fp << "\tassign " << circuit_lib.port_lib_name(output_port) << " = " << circuit_lib.port_lib_name(output_port) << "_reg;" << std::endl;
+  fp << circuit_lib.port_lib_name(input_port) << ";" << "\n";
+  fp << "\t\tend else begin" << "\n";
+  fp << "\t\t\tassign " << circuit_lib.port_lib_name(output_port) << "_reg = 1'bz;" << "\n";
+  fp << "\t\tend" << "\n";
+  fp << "\tend" << "\n";
+  fp << "\tassign " << circuit_lib.port_lib_name(output_port) << " = " << circuit_lib.port_lib_name(output_port) << "_reg;" << "\n";
 }
 
 /************************************************
@@ -139,7 +140,7 @@ void print_verilog_invbuf_body(std::fstream& fp,
     fp << "~";
   } 
 
-  fp << circuit_lib.port_lib_name(input_port) << ";" << std::endl;
+  fp << circuit_lib.port_lib_name(input_port) << ";" << "\n";
 }
 
 /************************************************
@@ -265,7 +266,7 @@ void print_verilog_passgate_module(const ModuleManager& module_manager,
    */
   fp << "\tassign " << circuit_lib.port_lib_name(output_ports[0]) << " = ";
   fp << circuit_lib.port_lib_name(input_ports[1]) << " ? " << circuit_lib.port_lib_name(input_ports[0]);
-  fp << " : 1'bz;" << std::endl;
+  fp << " : 1'bz;" << "\n";
 
   /* Print timing info */
   print_verilog_submodule_timing(fp, circuit_lib, circuit_model);
@@ -326,7 +327,7 @@ void print_verilog_and_or_gate_body(std::fstream& fp,
           port_cnt++;
         }
       }
-      fp << ";" << std::endl;
+      fp << ";" << "\n";
     }
   }
 }
@@ -403,7 +404,7 @@ void print_verilog_mux2_gate_body(std::fstream& fp,
   fp << generate_verilog_port(VERILOG_PORT_CONKT, in0_port_info);
   fp << " : ";
   fp << generate_verilog_port(VERILOG_PORT_CONKT, in1_port_info);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 }
 
 /************************************************
@@ -510,10 +511,10 @@ void print_verilog_submodule_essentials(const ModuleManager& module_manager,
   std::string verilog_fname(ESSENTIALS_VERILOG_FILE_NAME);
   std::string verilog_fpath = submodule_dir + verilog_fname;
 
-  std::fstream fp;
+  BufferedFstream fp;
 
   /* Create the file stream */
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
   /* Check if the file stream if valid or not */
   check_file_stream(verilog_fpath.c_str(), fp); 
 
@@ -549,7 +550,7 @@ void print_verilog_submodule_essentials(const ModuleManager& module_manager,
   }
 
   /* Close file handler*/
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
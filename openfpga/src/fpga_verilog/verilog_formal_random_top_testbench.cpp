@@ -16,6 +16,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_port.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_reserved_words.h"
 
 #include "openfpga_atom_netlist_utils.h"
@@ -65,7 +66,7 @@ void print_verilog_top_random_testbench_ports(std::fstream& fp,
                                              options.default_net_type());
  
   /* Print the declaration for the module */
-  fp << "module " << circuit_name << FORMAL_RANDOM_TOP_TESTBENCH_POSTFIX << ";" << std::endl;
+  fp << "module " << circuit_name << FORMAL_RANDOM_TOP_TESTBENCH_POSTFIX << ";" << "\n";
 
   /* Create a clock port if the benchmark does not have one! 
    * The clock is used for counting and synchronizing input stimulus 
@@ -73,11 +74,11 @@ void print_verilog_top_random_testbench_ports(std::fstream& fp,
   std::vector<BasicPort> clock_ports = generate_verilog_testbench_clock_port(clock_port_names, std::string(DEFAULT_CLOCK_NAME));
   print_verilog_comment(fp, std::string("----- Default clock port is added here since benchmark does not contain one -------"));
   for (const BasicPort& clock_port : clock_ports) {
-    fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, clock_port) << ";" << std::endl;
+    fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, clock_port) << ";" << "\n";
   }
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_testbench_shared_ports(fp, atom_ctx, netlist_annotation,
                                        clock_port_names,
@@ -91,9 +92,9 @@ void print_verilog_top_random_testbench_ports(std::fstream& fp,
    */
   if (!options.no_self_checking()) {
     print_verilog_comment(fp, std::string("----- Error counter -------"));
-    fp << "\tinteger " << ERROR_COUNTER << "= 0;" << std::endl;
+    fp << "\tinteger " << ERROR_COUNTER << "= 0;" << "\n";
     /* Add an empty line as splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 }
 
@@ -132,7 +133,7 @@ void print_verilog_top_random_testbench_benchmark_instance(std::fstream& fp,
   print_verilog_comment(fp, std::string("----- End reference Benchmark Instanication -------"));
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -164,7 +165,7 @@ void print_verilog_random_testbench_fpga_instance(std::fstream& fp,
   print_verilog_comment(fp, std::string("----- End FPGA Fabric Instanication -------"));
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -218,13 +219,13 @@ void print_verilog_random_testbench_reset_stimuli(std::fstream& fp,
       initial_value = 0;
     }
 
-    fp << "initial" << std::endl;
-    fp << "\tbegin" << std::endl;
+    fp << "initial" << "\n";
+    fp << "\tbegin" << "\n";
     fp << "\t";
     std::vector<size_t> initial_values(reset_port.get_width(), initial_value);
     fp << "\t";
     fp << generate_verilog_port_constant_values(reset_port, initial_values);
-    fp << ";" << std::endl;
+    fp << ";" << "\n";
 
     /* Flip the reset at the second negative edge of the clock port
      * So the generic reset stimuli is applicable to both synchronous reset and asynchronous reset
@@ -232,15 +233,15 @@ void print_verilog_random_testbench_reset_stimuli(std::fstream& fp,
      * This gaurantees that even for synchronous reset, the reset can be sensed in the 1st rising/falling 
      * edge of the clock signal
      */
-    fp << "\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, clock_port) << ");" << std::endl;
-    fp << "\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, clock_port) << ");" << std::endl;
+    fp << "\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, clock_port) << ");" << "\n";
+    fp << "\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, clock_port) << ");" << "\n";
     print_verilog_register_connection(fp, reset_port, reset_port, true);
-    fp << "\tend" << std::endl;
+    fp << "\tend" << "\n";
   }
 
   print_verilog_comment(fp, "----- End reset signal generation -----");
 
-  fp << std::endl;
+  fp << "\n";
 }
 
 /*********************************************************************
@@ -283,8 +284,8 @@ void print_verilog_random_top_testbench(const std::string& circuit_name,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(verilog_fname.c_str(), fp);
@@ -373,7 +374,7 @@ void print_verilog_random_top_testbench(const std::string& circuit_name,
   print_verilog_module_end(fp, std::string(circuit_name) + std::string(FORMAL_RANDOM_TOP_TESTBENCH_POSTFIX));
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 }
 
 } /* end namespace openfpga */
@@ -16,6 +16,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 #include "openfpga_side_manager.h"
 
 /* Headers from vpr library */
@@ -90,8 +91,8 @@ void print_verilog_primitive_block(NetlistManager& netlist_manager,
   VTR_LOGV(verbose, "\n");
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -119,7 +120,7 @@ void print_verilog_primitive_block(NetlistManager& netlist_manager,
                                options.default_net_type());
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -211,8 +212,8 @@ void rec_print_verilog_logical_tile(NetlistManager& netlist_manager,
   VTR_LOGV(verbose, "\n");
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -244,7 +245,7 @@ void rec_print_verilog_logical_tile(NetlistManager& netlist_manager,
   print_verilog_comment(fp, std::string("----- END Physical programmable logic block Verilog module: " + std::string(physical_pb_type->name) + " -----"));
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -335,8 +336,8 @@ void print_verilog_physical_tile_netlist(NetlistManager& netlist_manager,
   }
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -360,10 +361,10 @@ void print_verilog_physical_tile_netlist(NetlistManager& netlist_manager,
   print_verilog_comment(fp, std::string("----- END Grid Verilog module: " + module_manager.module_name(grid_module) + " -----"));
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -10,6 +10,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "mux_graph.h"
 #include "module_manager.h"
@@ -38,10 +39,10 @@ void print_verilog_submodule_luts(const ModuleManager& module_manager,
   std::string verilog_fname(LUTS_VERILOG_FILE_NAME);
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
-  std::fstream fp;
+  BufferedFstream fp;
 
   /* Create the file stream */
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
   /* Check if the file stream if valid or not */
   check_file_stream(verilog_fpath.c_str(), fp); 
 
@@ -67,7 +68,7 @@ void print_verilog_submodule_luts(const ModuleManager& module_manager,
   }
 
   /* Close the file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
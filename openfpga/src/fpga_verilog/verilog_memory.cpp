@@ -12,6 +12,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "mux_graph.h"
 #include "module_manager.h"
@@ -63,7 +64,7 @@ void print_verilog_mux_memory_module(const ModuleManager& module_manager,
                                  options.default_net_type());
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
     break;
   }
   case CIRCUIT_MODEL_DESIGN_RRAM:
@@ -109,8 +110,8 @@ void print_verilog_submodule_memories(const ModuleManager& module_manager,
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -186,11 +187,11 @@ void print_verilog_submodule_memories(const ModuleManager& module_manager,
                                  options.default_net_type());
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -397,9 +397,9 @@ void write_verilog_instance_to_file(std::fstream& fp,
    * if not, we use a default name <name>_<num_instance_in_parent_module> 
    */
   if (true == module_manager.instance_name(parent_module, child_module, instance_id).empty()) {
-    fp << generate_instance_name(module_manager.module_name(child_module), instance_id) << " (" << std::endl;
+    fp << generate_instance_name(module_manager.module_name(child_module), instance_id) << " (" << "\n";
   } else {
-    fp << module_manager.instance_name(parent_module, child_module, instance_id) << " (" << std::endl;
+    fp << module_manager.instance_name(parent_module, child_module, instance_id) << " (" << "\n";
   }
 
   /* Print each port with/without explicit port map */
@@ -421,7 +421,7 @@ void write_verilog_instance_to_file(std::fstream& fp,
       BasicPort child_port = module_manager.module_port(child_module, child_port_id);
       if (0 != port_cnt) {
         /* Do not dump a comma for the first port */
-        fp << "," << std::endl; 
+        fp << "," << "\n"; 
       }
       /* Print port */
       fp << "\t\t";
@@ -465,7 +465,7 @@ void write_verilog_instance_to_file(std::fstream& fp,
   }
   
   /* Print an end to the instance */
-  fp << ");" << std::endl;
+  fp << ");" << "\n";
 }
 
 /********************************************************************
@@ -488,7 +488,7 @@ void write_verilog_module_to_file(std::fstream& fp,
   print_verilog_module_declaration(fp, module_manager, module_id, default_net_type);
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
    
   /* Print internal wires */
   std::map<std::string, std::vector<BasicPort>> local_wires = find_verilog_module_local_wires(module_manager, module_id);
@@ -500,12 +500,12 @@ void write_verilog_module_to_file(std::fstream& fp,
         && (0 == local_wire.get_lsb())) {
         continue;
       }
-      fp << generate_verilog_port(VERILOG_PORT_WIRE, local_wire) << ";" << std::endl;
+      fp << generate_verilog_port(VERILOG_PORT_WIRE, local_wire) << ";" << "\n";
     }
   }
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Print local connection (from module inputs to output! */
   print_verilog_comment(fp, std::string("----- BEGIN Local short connections -----"));
@@ -517,7 +517,7 @@ void write_verilog_module_to_file(std::fstream& fp,
  
   print_verilog_comment(fp, std::string("----- END Local output short connections -----"));
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Print instances */
   for (ModuleId child_module : module_manager.child_modules(module_id)) {
@@ -525,7 +525,7 @@ void write_verilog_module_to_file(std::fstream& fp,
       /* Print an instance */
       write_verilog_instance_to_file(fp, module_manager, module_id, child_module, instance, use_explicit_port_map); 
       /* Print an empty line as splitter */
-      fp << std::endl;
+      fp << "\n";
     }
   }
 
@@ -533,10 +533,10 @@ void write_verilog_module_to_file(std::fstream& fp,
   print_verilog_module_end(fp, module_manager.module_name(module_id)); 
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 } /* end namespace openfpga */
@@ -21,6 +21,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "mux_graph.h"
 #include "module_manager.h"
@@ -58,11 +59,11 @@ void generate_verilog_cmos_mux_branch_body_behavioral(std::fstream& fp,
   /* Add an internal register for the output */
   BasicPort outreg_port("out_reg", mux_graph.num_outputs());
   /* Print the port */
-  fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, outreg_port) << ";" << std::endl; 
+  fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, outreg_port) << ";" << "\n"; 
 
   /* Generate the case-switch table */
-  fp << "\talways @(" << generate_verilog_port(VERILOG_PORT_CONKT, input_port) << ", " << generate_verilog_port(VERILOG_PORT_CONKT, mem_port) << ")" << std::endl; 
-  fp << "\tcase (" << generate_verilog_port(VERILOG_PORT_CONKT, mem_port) << ")" << std::endl;
+  fp << "\talways @(" << generate_verilog_port(VERILOG_PORT_CONKT, input_port) << ", " << generate_verilog_port(VERILOG_PORT_CONKT, mem_port) << ")" << "\n"; 
+  fp << "\tcase (" << generate_verilog_port(VERILOG_PORT_CONKT, mem_port) << ")" << "\n";
 
   /* Output the netlist following the connections in mux_graph */
   /* Iterate over the inputs */
@@ -93,21 +94,21 @@ void generate_verilog_cmos_mux_branch_body_behavioral(std::fstream& fp,
         case_code[size_t(mux_mem)] = '0';
       }
       fp << case_code << ": " << generate_verilog_port(VERILOG_PORT_CONKT, outreg_port) << " <= ";
-      fp << generate_verilog_port(VERILOG_PORT_CONKT, cur_input_port) << ";" << std::endl;
+      fp << generate_verilog_port(VERILOG_PORT_CONKT, cur_input_port) << ";" << "\n";
     }
   }
 
   /* Default case: outputs are at high-impedance state 'z' */
   std::string default_case(mux_graph.num_outputs(), 'z');
   fp << "\t\tdefault: " << generate_verilog_port(VERILOG_PORT_CONKT, outreg_port) << " <= ";
-  fp << mux_graph.num_outputs() << "'b" << default_case << ";" << std::endl;
+  fp << mux_graph.num_outputs() << "'b" << default_case << ";" << "\n";
 
   /* End the case */
-  fp << "\tendcase" << std::endl;
+  fp << "\tendcase" << "\n";
 
   /* Wire registers to output ports */
   fp << "\tassign " << generate_verilog_port(VERILOG_PORT_CONKT, output_port) << " = ";
-  fp << generate_verilog_port(VERILOG_PORT_CONKT, outreg_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_CONKT, outreg_port) << ";" << "\n";
 }
 
 /*********************************************************************
@@ -411,7 +412,7 @@ void generate_verilog_rram_mux_branch_body_behavioral(std::fstream& fp,
   /* Add an internal register for the output */
   BasicPort outreg_port("out_reg", mux_graph.num_inputs());
   /* Print the port */
-  fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, outreg_port) << ";" << std::endl; 
+  fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, outreg_port) << ";" << "\n"; 
 
   /* Print the internal logics */
   fp << "\t" << "always @(";
@@ -419,7 +420,7 @@ void generate_verilog_rram_mux_branch_body_behavioral(std::fstream& fp,
   fp << ", ";
   fp << generate_verilog_port(VERILOG_PORT_CONKT, wl_port); 
   fp << ")";
-  fp << " begin" << std::endl;
+  fp << " begin" << "\n";
 
   /* Only when the last bit of wl is enabled, 
    * the propagating path can be changed 
@@ -465,7 +466,7 @@ void generate_verilog_rram_mux_branch_body_behavioral(std::fstream& fp,
   }
 
   /* Finish the if clause */
-  fp << ") begin" << std::endl;
+  fp << ") begin" << "\n";
 
   for (const auto& mux_input : mux_graph.inputs()) {
     /* First if clause need tabs */
@@ -476,26 +477,26 @@ void generate_verilog_rram_mux_branch_body_behavioral(std::fstream& fp,
     /* Create a temp port of a BLB bit */
     BasicPort cur_blb_port(blb_port.get_name(), size_t(mux_graph.input_id(mux_input)), size_t(mux_graph.input_id(mux_input)));
     fp << generate_verilog_port(VERILOG_PORT_CONKT, cur_blb_port); 
-    fp << ") begin" << std::endl;
+    fp << ") begin" << "\n";
     fp << "\t\t\t\t" << "assign ";
   fp << outreg_port.get_name(); 
-    fp << " = " << size_t(mux_graph.input_id(mux_input)) << ";" << std::endl;
+    fp << " = " << size_t(mux_graph.input_id(mux_input)) << ";" << "\n";
     fp << "\t\t\t" << "end else ";
   }
-  fp << "begin" << std::endl;
+  fp << "begin" << "\n";
   fp << "\t\t\t\t" << "assign ";
   fp << outreg_port.get_name(); 
-  fp << " = 0;" << std::endl;
-  fp << "\t\t\t" << "end" << std::endl;
-  fp << "\t\t" << "end" << std::endl;
-  fp << "\t" << "end" << std::endl;
+  fp << " = 0;" << "\n";
+  fp << "\t\t\t" << "end" << "\n";
+  fp << "\t\t" << "end" << "\n";
+  fp << "\t" << "end" << "\n";
  
   fp << "\t" << "assign ";
   fp << generate_verilog_port(VERILOG_PORT_CONKT, output_port);
   fp << " = "; 
   fp << input_port.get_name() << "[";
   fp << outreg_port.get_name(); 
-  fp << "];" << std::endl;
+  fp << "];" << "\n";
 }
 
 /*********************************************************************
@@ -614,7 +615,7 @@ void generate_verilog_mux_branch_module(ModuleManager& module_manager,
                                    use_explicit_port_map || circuit_lib.dump_explicit_port_map(mux_model),
                                    default_net_type);
       /* Add an empty line as a splitter */
-      fp << std::endl;
+      fp << "\n";
     } else {
       /* Behavioral verilog requires customized generation */
       print_verilog_cmos_mux_branch_module_behavioral(module_manager,
@@ -707,7 +708,7 @@ void generate_verilog_cmos_mux_module_input_buffers(ModuleManager& module_manage
       print_verilog_comment(fp, std::string("---- BEGIN short-wire a multiplexing structure input to a constant value -----"));
       print_verilog_wire_constant_values(fp, instance_output_port, std::vector<size_t>(1, const_value));
       print_verilog_comment(fp, std::string("---- END short-wire a multiplexing structure input to a constant value -----"));
-      fp << std::endl;
+      fp << "\n";
       continue; /* Finish here */
     }
 
@@ -719,7 +720,7 @@ void generate_verilog_cmos_mux_module_input_buffers(ModuleManager& module_manage
       print_verilog_wire_connection(fp, instance_output_port, instance_input_port, false);      
 
       print_verilog_comment(fp, std::string("---- END short-wire a multiplexing structure input to MUX module input -----"));
-      fp << std::endl;
+      fp << "\n";
       continue; /* Finish here */
     }
 
@@ -734,7 +735,7 @@ void generate_verilog_cmos_mux_module_input_buffers(ModuleManager& module_manage
     print_verilog_buffer_instance(fp, module_manager, circuit_lib, module_id, buffer_model, instance_input_port, instance_output_port);
 
     print_verilog_comment(fp, std::string("---- END Instanciation of an input buffer module -----"));
-    fp << std::endl;
+    fp << "\n";
   } 
 }
 
@@ -798,7 +799,7 @@ void generate_verilog_cmos_mux_module_output_buffers(ModuleManager& module_manag
         print_verilog_wire_connection(fp, instance_output_port, instance_input_port, false);      
 
         print_verilog_comment(fp, std::string("---- END short-wire a multiplexing structure output to MUX module output -----"));
-        fp << std::endl;
+        fp << "\n";
         continue; /* Finish here */
       }
 
@@ -813,7 +814,7 @@ void generate_verilog_cmos_mux_module_output_buffers(ModuleManager& module_manag
       print_verilog_buffer_instance(fp, module_manager, circuit_lib, module_id, buffer_model, instance_input_port, instance_output_port);
 
       print_verilog_comment(fp, std::string("---- END Instanciation of an output buffer module -----"));
-      fp << std::endl;
+      fp << "\n";
     }
   }
 }
@@ -853,16 +854,16 @@ void generate_verilog_rram_mux_module_multiplexing_structure(ModuleManager& modu
   for (size_t level = 0; level < mux_graph.num_levels(); ++level) {
     /* Print the internal wires located at this level */
     BasicPort internal_wire_port(generate_mux_node_name(level, false), mux_graph.num_nodes_at_level(level));
-    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, internal_wire_port) << ";" << std::endl;
+    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, internal_wire_port) << ";" << "\n";
     /* Identify if an intermediate buffer is needed */
     if (false == inter_buffer_location_map[level]) { 
       continue;
     }
     BasicPort internal_wire_buffered_port(generate_mux_node_name(level, true), mux_graph.num_nodes_at_level(level));
-    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, internal_wire_buffered_port) << std::endl;
+    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, internal_wire_buffered_port) << "\n";
   }
   print_verilog_comment(fp, std::string("---- END Internal wires of a RRAM-based MUX module -----"));
-  fp << std::endl;
+  fp << "\n";
 
   /* Iterate over all the internal nodes and output nodes in the mux graph */
   for (const auto& node : mux_graph.non_input_nodes()) {
@@ -927,7 +928,7 @@ void generate_verilog_rram_mux_module_multiplexing_structure(ModuleManager& modu
      * output a local wire */
     if (1 < combine_verilog_ports(branch_node_input_ports).size()) {
       /* Print a local wire for the merged ports */
-      fp << "\t" << generate_verilog_local_wire(instance_input_port, branch_node_input_ports) << std::endl;
+      fp << "\t" << generate_verilog_local_wire(instance_input_port, branch_node_input_ports) << "\n";
     } else {
       /* Safety check */
       VTR_ASSERT(1 == combine_verilog_ports(branch_node_input_ports).size());
@@ -979,7 +980,7 @@ void generate_verilog_rram_mux_module_multiplexing_structure(ModuleManager& modu
      * output a local wire */
     if (1 < combine_verilog_ports(branch_node_blb_ports).size()) {
       /* Print a local wire for the merged ports */
-      fp << "\t" << generate_verilog_local_wire(instance_blb_port, branch_node_blb_ports) << std::endl;
+      fp << "\t" << generate_verilog_local_wire(instance_blb_port, branch_node_blb_ports) << "\n";
     } else {
       /* Safety check */
       VTR_ASSERT(1 == combine_verilog_ports(branch_node_blb_ports).size());
@@ -1020,7 +1021,7 @@ void generate_verilog_rram_mux_module_multiplexing_structure(ModuleManager& modu
      * output a local wire */
     if (1 < combine_verilog_ports(branch_node_wl_ports).size()) {
       /* Print a local wire for the merged ports */
-      fp << "\t" << generate_verilog_local_wire(instance_wl_port, branch_node_wl_ports) << std::endl;
+      fp << "\t" << generate_verilog_local_wire(instance_wl_port, branch_node_wl_ports) << "\n";
     } else {
       /* Safety check */
       VTR_ASSERT(1 == combine_verilog_ports(branch_node_wl_ports).size());
@@ -1041,7 +1042,7 @@ void generate_verilog_rram_mux_module_multiplexing_structure(ModuleManager& modu
     module_manager.add_child_module(module_id, branch_module_id);
 
     print_verilog_comment(fp, std::string("---- END Instanciation of a branch RRAM-based MUX module -----"));
-    fp << std::endl;
+    fp << "\n";
 
     if (false == inter_buffer_location_map[output_node_level]) {
       continue; /* No need for intermediate buffers */
@@ -1060,11 +1061,11 @@ void generate_verilog_rram_mux_module_multiplexing_structure(ModuleManager& modu
     print_verilog_buffer_instance(fp, module_manager, circuit_lib, module_id, buffer_model, buffer_instance_input_port, buffer_instance_output_port);
 
     print_verilog_comment(fp, std::string("---- END Instanciation of an intermediate buffer module -----"));
-    fp << std::endl;
+    fp << "\n";
   }
 
   print_verilog_comment(fp, std::string("---- END Internal Logic of a RRAM-based MUX module -----"));
-  fp << std::endl;
+  fp << "\n";
 }
 
 /*********************************************************************
@@ -1229,7 +1230,7 @@ void generate_verilog_mux_module(ModuleManager& module_manager,
                                  || circuit_lib.dump_explicit_port_map(circuit_lib.pass_gate_logic_model(mux_model)) ), 
                                  default_net_type);
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
     break;
   }
   case CIRCUIT_MODEL_DESIGN_RRAM:
@@ -1267,8 +1268,8 @@ void print_verilog_submodule_mux_primitives(ModuleManager& module_manager,
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -1300,7 +1301,7 @@ void print_verilog_submodule_mux_primitives(ModuleManager& module_manager,
   }
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -1332,8 +1333,8 @@ void print_verilog_submodule_mux_top_modules(ModuleManager& module_manager,
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -1358,7 +1359,7 @@ void print_verilog_submodule_mux_top_modules(ModuleManager& module_manager,
   }
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
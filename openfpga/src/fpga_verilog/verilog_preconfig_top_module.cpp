@@ -14,6 +14,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_port.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "bitstream_manager_utils.h"
 #include "openfpga_atom_netlist_utils.h"
@@ -44,7 +45,7 @@ void print_verilog_preconfig_top_module_ports(std::fstream &fp,
 
   /* Module declaration */
   fp << "module " << circuit_name << std::string(FORMAL_VERIFICATION_TOP_MODULE_POSTFIX);
-  fp << " (" << std::endl;
+  fp << " (" << "\n";
 
   /* Add module ports */
   size_t port_counter = 0;
@@ -68,7 +69,7 @@ void print_verilog_preconfig_top_module_ports(std::fstream &fp,
     }
 
     if (0 < port_counter) {
-      fp << "," << std::endl;
+      fp << "," << "\n";
     }
     /* Both input and output ports have only size of 1 */
     BasicPort module_port(std::string(block_name + std::string(FORMAL_VERIFICATION_TOP_MODULE_PORT_POSTFIX)), 1);
@@ -78,10 +79,10 @@ void print_verilog_preconfig_top_module_ports(std::fstream &fp,
     port_counter++;
   }
 
-  fp << ");" << std::endl;
+  fp << ");" << "\n";
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -100,10 +101,10 @@ void print_verilog_preconfig_top_module_internal_wires(std::fstream &fp,
   print_verilog_comment(fp, std::string("----- Local wires for FPGA fabric -----"));
   for (const ModulePortId &module_port_id : module_manager.module_ports(top_module)) {
     BasicPort module_port = module_manager.module_port(top_module, module_port_id);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << "\n";
   }
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -193,7 +194,7 @@ int print_verilog_preconfig_top_module_connect_global_ports(std::fstream &fp,
   print_verilog_comment(fp, std::string("----- End Connect Global ports of FPGA top module -----"));
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   return CMD_EXEC_SUCCESS;
 }
@@ -214,7 +215,7 @@ void print_verilog_preconfig_top_module_force_bitstream(std::fstream &fp,
 
   print_verilog_comment(fp, std::string("----- Begin assign bitstream to configuration memories -----"));
 
-  fp << "initial begin" << std::endl;
+  fp << "initial begin" << "\n";
 
   for (const ConfigBlockId &config_block_id : bitstream_manager.blocks()) {
     /* We only cares blocks with configuration bits */
@@ -259,7 +260,7 @@ void print_verilog_preconfig_top_module_force_bitstream(std::fstream &fp,
     }
   }
 
-  fp << "end" << std::endl;
+  fp << "end" << "\n";
 
   print_verilog_comment(fp, std::string("----- End assign bitstream to configuration memories -----"));
 }
@@ -279,7 +280,7 @@ void print_verilog_preconfig_top_module_deposit_bitstream(std::fstream &fp,
 
   print_verilog_comment(fp, std::string("----- Begin deposit bitstream to configuration memories -----"));
 
-  fp << "initial begin" << std::endl;
+  fp << "initial begin" << "\n";
 
   for (const ConfigBlockId &config_block_id : bitstream_manager.blocks()) {
     /* We only cares blocks with configuration bits */
@@ -327,7 +328,7 @@ void print_verilog_preconfig_top_module_deposit_bitstream(std::fstream &fp,
     print_verilog_deposit_wire_constant_values(fp, config_datab_port, config_datab_values);
   }
 
-  fp << "end" << std::endl;
+  fp << "end" << "\n";
 
   print_verilog_comment(fp, std::string("----- End deposit bitstream to configuration memories -----"));
 }
@@ -428,8 +429,8 @@ int print_verilog_preconfig_top_module(const ModuleManager &module_manager,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(verilog_fname.c_str(), fp);
@@ -501,7 +502,7 @@ int print_verilog_preconfig_top_module(const ModuleManager &module_manager,
   print_verilog_module_end(fp, std::string(circuit_name) + std::string(FORMAL_VERIFICATION_TOP_MODULE_POSTFIX));
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   return status;
 }
@@ -9,6 +9,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Include FPGA-Verilog header files*/
 #include "openfpga_naming.h"
@@ -88,8 +89,8 @@ void print_verilog_routing_connection_box_unique_module(NetlistManager& netlist_
   std::string verilog_fpath(subckt_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -108,10 +109,10 @@ void print_verilog_routing_connection_box_unique_module(NetlistManager& netlist_
                                options.default_net_type());
  
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -200,8 +201,8 @@ void print_verilog_routing_switch_box_unique_module(NetlistManager& netlist_mana
   std::string verilog_fpath(subckt_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -221,7 +222,7 @@ void print_verilog_routing_switch_box_unique_module(NetlistManager& netlist_mana
                                options.default_net_type());
  
   /* Close file handler */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
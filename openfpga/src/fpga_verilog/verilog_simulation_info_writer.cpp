@@ -126,6 +126,7 @@ void print_verilog_simulation_info(const std::string& ini_fname,
      */
     for (const BasicPort& module_io_port : module_manager.module_ports_by_type(top_module, ModuleManager::MODULE_GPIO_PORT)) {
       std::string io_direction(module_io_port.get_width(), '1');
+      size_t io_port_location_id = io_location_map.io_port_id(module_io_port.get_name());
       for (const AtomBlockId& atom_blk : atom_ctx.nlist.blocks()) {
         /* Bypass non-I/O atom blocks ! */
         if ( (AtomBlockType::INPAD != atom_ctx.nlist.block_type(atom_blk))
@@ -134,10 +135,11 @@ void print_verilog_simulation_info(const std::string& ini_fname,
         }
 
         /* Find the index of the mapped GPIO in top-level FPGA fabric */
-        size_t io_index = io_location_map.io_index(place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.x,
-                                                   place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.y,
-                                                   place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.z,
-                                                   module_io_port.get_name());
+        const t_pl_loc& atom_blk_loc = place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc;
+        size_t io_index = io_location_map.io_index(atom_blk_loc.x,
+                                                   atom_blk_loc.y,
+                                                   atom_blk_loc.z,
+                                                   io_port_location_id);
 
         if (size_t(-1) == io_index) {
           continue;
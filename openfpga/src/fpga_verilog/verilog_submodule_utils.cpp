@@ -14,6 +14,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_port.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 /* Headers from readarchopenfpga library */
 #include "circuit_types.h"
@@ -56,10 +57,10 @@ void print_verilog_submodule_timing(std::fstream& fp,
   /* Ensure a valid file handler*/
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << std::endl;
-  fp << "`ifdef " << VERILOG_TIMING_PREPROC_FLAG << std::endl;
+  fp << "\n";
+  fp << "`ifdef " << VERILOG_TIMING_PREPROC_FLAG << "\n";
   print_verilog_comment(fp, std::string("------ BEGIN Pin-to-pin Timing constraints -----"));
-  fp << "\tspecify" << std::endl;
+  fp << "\tspecify" << "\n";
 
   /* Read out pin-to-pin delays by finding out all the edges belonging to a circuit model */
   for (const auto& timing_edge : circuit_lib.timing_edges_by_model(circuit_model)) {
@@ -81,12 +82,12 @@ void print_verilog_submodule_timing(std::fstream& fp,
      fp << "(" << std::setprecision(FLOAT_PRECISION) << circuit_lib.timing_edge_delay(timing_edge, CIRCUIT_MODEL_DELAY_RISE) / VERILOG_SIM_TIMESCALE;
      fp << ", ";
      fp << std::setprecision(FLOAT_PRECISION) << circuit_lib.timing_edge_delay(timing_edge, CIRCUIT_MODEL_DELAY_FALL) / VERILOG_SIM_TIMESCALE << ")";
-     fp << ";" << std::endl;
+     fp << ";" << "\n";
   }
 
-  fp << "\tendspecify" << std::endl;
+  fp << "\tendspecify" << "\n";
   print_verilog_comment(fp, std::string("------ END Pin-to-pin Timing constraints -----"));
-  fp << "`endif" << std::endl;
+  fp << "`endif" << "\n";
 
 }
 
@@ -153,7 +154,7 @@ void print_one_verilog_template_module(const ModuleManager& module_manager,
   print_verilog_comment(fp, std::string("----- Internal logic should start here -----"));
 
   /* Add some empty lines as placeholders for the internal logic*/
-  fp << std::endl << std::endl;
+  fp << "\n" << "\n";
  
   print_verilog_comment(fp, std::string("----- Internal logic should end here -----"));
 
@@ -161,7 +162,7 @@ void print_one_verilog_template_module(const ModuleManager& module_manager,
   print_verilog_module_end(fp, module_name);
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /*********************************************************************
@@ -178,8 +179,8 @@ void print_verilog_submodule_templates(const ModuleManager& module_manager,
   std::string verilog_fname(submodule_dir + USER_DEFINED_TEMPLATE_VERILOG_FILE_NAME);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fname.c_str(), fp);
 
@@ -207,7 +208,7 @@ void print_verilog_submodule_templates(const ModuleManager& module_manager,
   }
 
   /* close file stream */
-  fp.close();
+  fp.close_file();
  
   /* No need to add the template to the subckt include files! */
   VTR_LOG("Done\n");
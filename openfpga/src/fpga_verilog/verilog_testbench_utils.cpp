@@ -6,6 +6,7 @@
  * so that we can make it free to use anywhere
  *******************************************************************/
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <map>
 
@@ -54,7 +55,7 @@ void print_verilog_testbench_fpga_instance(std::fstream& fp,
                                 explicit_port_mapping); 
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -74,7 +75,7 @@ void print_verilog_testbench_benchmark_instance(std::fstream& fp,
   /* Validate the file stream */
   valid_file_stream(fp);
 
-  fp << "\t" << module_name << " " << instance_name << "(" << std::endl;
+  fp << "\t" << module_name << " " << instance_name << "(" << "\n";
 
   size_t port_counter = 0;
   for (const AtomBlockId& atom_blk : atom_ctx.nlist.blocks()) {
@@ -92,7 +93,7 @@ void print_verilog_testbench_benchmark_instance(std::fstream& fp,
 
     /* The first port does not need a comma */
     if(0 < port_counter){
-      fp << "," << std::endl;
+      fp << "," << "\n";
     }
     /* Input port follows the logical block name while output port requires a special postfix */
     if (AtomBlockType::INPAD == atom_ctx.nlist.block_type(atom_blk)) {
@@ -140,7 +141,7 @@ void print_verilog_testbench_benchmark_instance(std::fstream& fp,
     /* Update the counter */
     port_counter++;
   }
-  fp << "\t);" << std::endl;
+  fp << "\t);" << "\n";
 }
 
 /********************************************************************
@@ -175,6 +176,26 @@ void print_verilog_testbench_connect_fpga_ios(std::fstream& fp,
     }
   }
 
+  /* Find the mappable I/Os at each location with the reverse look-up of the location map,
+   * rather than probing every I/O port at the location of each I/O block.
+   * The I/Os of a location are listed in the order of the ports,
+   * as the first suitable port is used
+   */
+  std::map<std::array<size_t, 3>, std::vector<std::pair<size_t, size_t>>> location_ios;
+  for (size_t iport = 0; iport < module_io_ports.size(); ++iport) {
+    const BasicPort& module_io_port = module_manager.module_port(top_module, module_io_ports[iport]);
+    size_t io_port_location_id = io_location_map.io_port_id(module_io_port.get_name());
+    if (size_t(-1) == io_port_location_id) {
+      continue;
+    }
+    for (size_t io_index = 0; io_index < io_location_map.num_io_indices(io_port_location_id); ++io_index) {
+      size_t io_x, io_y, io_z;
+      if (true == io_location_map.io_location(io_port_location_id, io_index, io_x, io_y, io_z)) {
+        location_ios[{{io_x, io_y, io_z}}].push_back(std::make_pair(iport, io_index));
+      }
+    }
+  }
+
   /* Keep tracking which I/Os have been used */
   std::map<ModulePortId, std::vector<bool>> io_used;
   for (const ModulePortId& module_io_port_id :  module_io_ports) {
@@ -205,19 +226,13 @@ void print_verilog_testbench_connect_fpga_ios(std::fstream& fp,
      *         or should find a GPOUT for OUTPAD
      */ 
     std::pair<ModulePortId, size_t> mapped_module_io_info = std::make_pair(ModulePortId::INVALID(), -1);
-    for (const ModulePortId& module_io_port_id : module_io_ports) {
-      const BasicPort& module_io_port = module_manager.module_port(top_module, module_io_port_id);
-
-      /* Find the index of the mapped GPIO in top-level FPGA fabric */
-      size_t temp_io_index = io_location_map.io_index(place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.x,
-                                                      place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.y,
-                                                      place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.z,
-                                                      module_io_port.get_name());
+    const t_pl_loc& atom_blk_loc = place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc;
+    const std::vector<std::pair<size_t, size_t>>& atom_blk_ios = location_ios[{{size_t(atom_blk_loc.x), size_t(atom_blk_loc.y), size_t(atom_blk_loc.z)}}];
+    for (const std::pair<size_t, size_t>& location_io : atom_blk_ios) {
+      const ModulePortId& module_io_port_id = module_io_ports[location_io.first];
 
-      /* Bypass invalid index (not mapped to this GPIO port) */
-      if (size_t(-1) == temp_io_index) {
-        continue;
-      }
+      /* Index of the mapped GPIO in top-level FPGA fabric */
+      size_t temp_io_index = location_io.second;
 
       /* If the port is an GPIO port, just use it */
       if (ModuleManager::MODULE_GPIO_PORT == module_manager.port_type(top_module, module_io_port_id)) {
@@ -272,7 +287,7 @@ void print_verilog_testbench_connect_fpga_ios(std::fstream& fp,
     io_used[mapped_module_io_info.first][io_index] = true;
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Wire the unused iopads to a constant */
@@ -299,7 +314,7 @@ void print_verilog_testbench_connect_fpga_ios(std::fstream& fp,
     }
 
     /* Add an empty line as a splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 }
 
@@ -321,45 +336,45 @@ void print_verilog_timeout_and_vcd(std::fstream& fp,
 
   print_verilog_comment(fp, std::string("----- Begin output waveform to VCD file-------"));
 
-  fp << "\tinitial begin" << std::endl;
-  fp << "\t\t$dumpfile(\"" << vcd_fname << "\");" << std::endl;
-  fp << "\t\t$dumpvars(1, " << module_name << ");" << std::endl;
-  fp << "\tend" << std::endl;
+  fp << "\tinitial begin" << "\n";
+  fp << "\t\t$dumpfile(\"" << vcd_fname << "\");" << "\n";
+  fp << "\t\t$dumpvars(1, " << module_name << ");" << "\n";
+  fp << "\tend" << "\n";
 
   print_verilog_comment(fp, std::string("----- END output waveform to VCD file -------"));
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort sim_start_port(simulation_start_counter_name, 1);
 
-  fp << "initial begin" << std::endl;
+  fp << "initial begin" << "\n";
 
   if (!no_self_checking) {
-    fp << "\t" << generate_verilog_port(VERILOG_PORT_CONKT, sim_start_port) << " <= 1'b1;" << std::endl;
+    fp << "\t" << generate_verilog_port(VERILOG_PORT_CONKT, sim_start_port) << " <= 1'b1;" << "\n";
   }
 
-  fp << "\t$timeformat(-9, 2, \"ns\", 20);" << std::endl;
-  fp << "\t$display(\"Simulation start\");" << std::endl;
+  fp << "\t$timeformat(-9, 2, \"ns\", 20);" << "\n";
+  fp << "\t$display(\"Simulation start\");" << "\n";
   print_verilog_comment(fp, std::string("----- Can be changed by the user for his/her need -------"));
-  fp << "\t#" << std::setprecision(10) << simulation_time << std::endl;
+  fp << "\t#" << std::setprecision(10) << simulation_time << "\n";
 
   if (!no_self_checking) {
-    fp << "\tif(" << error_counter_name << " == 0) begin" << std::endl;
-    fp << "\t\t$display(\"Simulation Succeed\");" << std::endl;
-    fp << "\tend else begin" << std::endl;
-    fp << "\t\t$display(\"Simulation Failed with " << std::string("%d") << " error(s)\", " << error_counter_name << ");" << std::endl;
-    fp << "\tend" << std::endl;
+    fp << "\tif(" << error_counter_name << " == 0) begin" << "\n";
+    fp << "\t\t$display(\"Simulation Succeed\");" << "\n";
+    fp << "\tend else begin" << "\n";
+    fp << "\t\t$display(\"Simulation Failed with " << std::string("%d") << " error(s)\", " << error_counter_name << ");" << "\n";
+    fp << "\tend" << "\n";
   } else {
     VTR_ASSERT_SAFE(no_self_checking);
-    fp << "\t$display(\"Simulation Succeed\");" << std::endl;
+    fp << "\t$display(\"Simulation Succeed\");" << "\n";
   }
 
-  fp << "\t$finish;" << std::endl;
-  fp << "end" << std::endl;
+  fp << "\t$finish;" << "\n";
+  fp << "end" << "\n";
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -410,8 +425,8 @@ void print_verilog_testbench_check(std::fstream& fp,
 
   BasicPort sim_start_port(simulation_start_counter_name, 1);
 
-  fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, sim_start_port) << ";" << std::endl;
-  fp << std::endl;
+  fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, sim_start_port) << ";" << "\n";
+  fp << "\n";
 
   /* TODO: This is limitation when multiple clock signals exist
    * Ideally, all the input signals are generated by different clock edges, 
@@ -420,11 +435,11 @@ void print_verilog_testbench_check(std::fstream& fp,
    */
   VTR_ASSERT(1 <= clock_ports.size());
 
-  fp << "\talways@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, clock_ports[0]) << ") begin" << std::endl;
-  fp << "\t\tif (1'b1 == " << generate_verilog_port(VERILOG_PORT_CONKT, sim_start_port) << ") begin" << std::endl;
+  fp << "\talways@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, clock_ports[0]) << ") begin" << "\n";
+  fp << "\t\tif (1'b1 == " << generate_verilog_port(VERILOG_PORT_CONKT, sim_start_port) << ") begin" << "\n";
   fp << "\t\t";
   print_verilog_register_connection(fp, sim_start_port, sim_start_port, true);
-  fp << "\t\tend else begin" << std::endl;
+  fp << "\t\tend else begin" << "\n";
 
   for (const AtomBlockId& atom_blk : atom_ctx.nlist.blocks()) {
     /* Bypass non-I/O atom blocks ! */
@@ -443,18 +458,18 @@ void print_verilog_testbench_check(std::fstream& fp,
      fp << "\t\t\tif(!(" << block_name << fpga_port_postfix;
      fp << " === " << block_name << benchmark_port_postfix;
      fp << ") && !(" << block_name << benchmark_port_postfix;
-     fp << " === 1'bx)) begin" << std::endl;
-     fp << "\t\t\t\t" << block_name << check_flag_port_postfix << " <= 1'b1;" << std::endl;
-     fp << "\t\t\tend else begin" << std::endl;
-     fp << "\t\t\t\t" << block_name << check_flag_port_postfix << "<= 1'b0;" << std::endl;
-     fp << "\t\t\tend" << std::endl; 
+     fp << " === 1'bx)) begin" << "\n";
+     fp << "\t\t\t\t" << block_name << check_flag_port_postfix << " <= 1'b1;" << "\n";
+     fp << "\t\t\tend else begin" << "\n";
+     fp << "\t\t\t\t" << block_name << check_flag_port_postfix << "<= 1'b0;" << "\n";
+     fp << "\t\t\tend" << "\n"; 
     }
   } 
-  fp << "\t\tend" << std::endl;
-  fp << "\tend" << std::endl;
+  fp << "\t\tend" << "\n";
+  fp << "\tend" << "\n";
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   for (const AtomBlockId& atom_blk : atom_ctx.nlist.blocks()) {
     /* Only care about output atom blocks ! */
@@ -468,19 +483,19 @@ void print_verilog_testbench_check(std::fstream& fp,
       block_name = netlist_annotation.block_name(atom_blk);
     } 
 
-    fp << "\talways@(posedge " << block_name << check_flag_port_postfix << ") begin" << std::endl;
-    fp << "\t\tif(" << block_name << check_flag_port_postfix << ") begin" << std::endl;
-    fp << "\t\t\t" << error_counter_name << " = " << error_counter_name << " + 1;" << std::endl;
-    fp << "\t\t\t$display(\"Mismatch on " << block_name << fpga_port_postfix << " at time = " << std::string("%t") << "\", $realtime);" << std::endl;
-    fp << "\t\tend" << std::endl;
-    fp << "\tend" << std::endl;
+    fp << "\talways@(posedge " << block_name << check_flag_port_postfix << ") begin" << "\n";
+    fp << "\t\tif(" << block_name << check_flag_port_postfix << ") begin" << "\n";
+    fp << "\t\t\t" << error_counter_name << " = " << error_counter_name << " + 1;" << "\n";
+    fp << "\t\t\t$display(\"Mismatch on " << block_name << fpga_port_postfix << " at time = " << std::string("%t") << "\", $realtime);" << "\n";
+    fp << "\t\tend" << "\n";
+    fp << "\tend" << "\n";
 
     /* Add an empty line as splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -522,21 +537,21 @@ void print_verilog_testbench_clock_stimuli(std::fstream& fp,
       }
     }
 
-    fp << "\tinitial begin" << std::endl;
+    fp << "\tinitial begin" << "\n";
     /* Create clock stimuli */
-    fp << "\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, clock_port) << " <= 1'b0;" << std::endl;
-    fp << "\t\twhile(1) begin" << std::endl;
-    fp << "\t\t\t#" << std::setprecision(10) << clk_freq_to_use << std::endl;
+    fp << "\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, clock_port) << " <= 1'b0;" << "\n";
+    fp << "\t\twhile(1) begin" << "\n";
+    fp << "\t\t\t#" << std::setprecision(10) << clk_freq_to_use << "\n";
     fp << "\t\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, clock_port);
     fp << " <= !";
     fp << generate_verilog_port(VERILOG_PORT_CONKT, clock_port);
-    fp << ";" << std::endl;
-    fp << "\t\tend" << std::endl;
+    fp << ";" << "\n";
+    fp << "\t\tend" << "\n";
 
-    fp << "\tend" << std::endl;
+    fp << "\tend" << "\n";
 
     /* Add an empty line as splitter */
-    fp << std::endl;
+    fp << "\n";
   }
 }
 
@@ -559,7 +574,7 @@ void print_verilog_testbench_random_stimuli(std::fstream& fp,
 
   print_verilog_comment(fp, std::string("----- Input Initialization -------"));
 
-  fp << "\tinitial begin" << std::endl;
+  fp << "\tinitial begin" << "\n";
 
   for (const AtomBlockId& atom_blk : atom_ctx.nlist.blocks()) {
     /* Bypass non-I/O atom blocks ! */
@@ -588,14 +603,14 @@ void print_verilog_testbench_random_stimuli(std::fstream& fp,
 
     /* TODO: find the clock inputs will be initialized later */
     if (AtomBlockType::INPAD == atom_ctx.nlist.block_type(atom_blk)) {
-      fp << "\t\t" << block_name << " <= 1'b0;" << std::endl;
+      fp << "\t\t" << block_name << " <= 1'b0;" << "\n";
     }
   }
 
   /* Set 0 to registers for checking flags */
   if (!no_self_checking) {
     /* Add an empty line as splitter */
-    fp << std::endl;
+    fp << "\n";
   
     for (const AtomBlockId& atom_blk : atom_ctx.nlist.blocks()) {
       /* Bypass non-I/O atom blocks ! */
@@ -611,15 +626,15 @@ void print_verilog_testbench_random_stimuli(std::fstream& fp,
 
       /* Each logical block assumes a single-width port */
       BasicPort output_port(std::string(block_name + check_flag_port_postfix), 1); 
-      fp << "\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, output_port) << " <= 1'b0;" << std::endl;
+      fp << "\t\t" << generate_verilog_port(VERILOG_PORT_CONKT, output_port) << " <= 1'b0;" << "\n";
     }
   }
 
-  fp << "\tend" << std::endl;
+  fp << "\tend" << "\n";
   /* Finish initialization */
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, std::string("----- Input Stimulus -------"));
   /* TODO: This is limitation when multiple clock signals exist
@@ -628,7 +643,7 @@ void print_verilog_testbench_random_stimuli(std::fstream& fp,
    * Currently, as we lack the information, we only use the first clock signal
    */
   VTR_ASSERT(1 <= clock_ports.size());
-  fp << "\talways@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, clock_ports[0]) << ") begin" << std::endl;
+  fp << "\talways@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, clock_ports[0]) << ") begin" << "\n";
 
   for (const AtomBlockId& atom_blk : atom_ctx.nlist.blocks()) {
     /* Bypass non-I/O atom blocks ! */
@@ -657,14 +672,14 @@ void print_verilog_testbench_random_stimuli(std::fstream& fp,
 
     /* TODO: find the clock inputs will be initialized later */
     if (AtomBlockType::INPAD == atom_ctx.nlist.block_type(atom_blk)) {
-      fp << "\t\t" << block_name << " <= $random;" << std::endl;
+      fp << "\t\t" << block_name << " <= $random;" << "\n";
     }
   }
 
-  fp << "\tend" << std::endl;
+  fp << "\tend" << "\n";
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -708,11 +723,11 @@ void print_verilog_testbench_shared_ports(std::fstream& fp,
    
     /* Each logical block assumes a single-width port */
     BasicPort input_port(block_name, 1); 
-    fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, input_port) << ";" << std::endl;
+    fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, input_port) << ";" << "\n";
   }
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Instantiate wires for FPGA fabric outputs */
   print_verilog_comment(fp, std::string("----- FPGA fabric outputs -------"));
@@ -731,11 +746,11 @@ void print_verilog_testbench_shared_ports(std::fstream& fp,
 
     /* Each logical block assumes a single-width port */
     BasicPort output_port(std::string(block_name + fpga_output_port_postfix), 1); 
-    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, output_port) << ";" << std::endl;
+    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, output_port) << ";" << "\n";
   }
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   if (no_self_checking) {
     return;
@@ -757,11 +772,11 @@ void print_verilog_testbench_shared_ports(std::fstream& fp,
 
     /* Each logical block assumes a single-width port */
     BasicPort output_port(std::string(block_name + benchmark_output_port_postfix), 1); 
-    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, output_port) << ";" << std::endl;
+    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, output_port) << ";" << "\n";
   }
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Instantiate register for output comparison */
   print_verilog_comment(fp, std::string("----- Output vectors checking flags -------"));
@@ -779,11 +794,11 @@ void print_verilog_testbench_shared_ports(std::fstream& fp,
 
     /* Each logical block assumes a single-width port */
     BasicPort output_port(std::string(block_name + check_flag_port_postfix), 1); 
-    fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, output_port) << ";" << std::endl;
+    fp << "\t" << generate_verilog_port(VERILOG_PORT_REG, output_port) << ";" << "\n";
   }
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -840,7 +855,7 @@ void rec_print_verilog_testbench_primitive_module_signal_initialization(std::fst
         VTR_ASSERT_SAFE(child_module == primitive_module);
 
         print_verilog_comment(fp, std::string("------ BEGIN driver initialization -----"));
-        fp << "\tinitial begin" << std::endl;
+        fp << "\tinitial begin" << "\n";
 
         for (const auto& input_port : circuit_input_ports) {
           /* Only for formal verification: deposite a zero signal values */
@@ -854,14 +869,14 @@ void rec_print_verilog_testbench_primitive_module_signal_initialization(std::fst
           if (!deposit_random_values) {
 
             fp << ", " <<  circuit_lib.port_size(input_port) << "'b" << std::string(circuit_lib.port_size(input_port), '0');
-            fp << ");" << std::endl;
+            fp << ");" << "\n";
           } else {
             VTR_ASSERT_SAFE(deposit_random_values);
-            fp << ", $random % 2 ? 1'b1 : 1'b0);" << std::endl;
+            fp << ", $random % 2 ? 1'b1 : 1'b0);" << "\n";
           }
         }
 
-        fp << "\tend" << std::endl;
+        fp << "\tend" << "\n";
         print_verilog_comment(fp, std::string("------ END driver initialization -----"));
       }
     }
@@ -918,7 +933,7 @@ void print_verilog_testbench_signal_initialization(std::fstream& fp,
   }
 
   /* Add signal initialization Verilog codes */
-  fp << std::endl;
+  fp << "\n";
   for (const CircuitModelId& signal_init_circuit_model : signal_init_circuit_models) {
     /* Find the module id corresponding to the circuit model from module graph */
     ModuleId primitive_module = module_manager.find_module(circuit_lib.model_name(signal_init_circuit_model));
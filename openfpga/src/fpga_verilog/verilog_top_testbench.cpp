@@ -17,6 +17,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_port.h"
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "bitstream_manager_utils.h"
 
@@ -65,13 +66,13 @@ void print_verilog_top_testbench_flatten_memory_port(std::fstream& fp,
   print_verilog_comment(fp, std::string("---- Bit Line ports -----"));
   ModulePortId bl_port_id = module_manager.find_module_port(top_module, std::string(MEMORY_BL_PORT_NAME));
   BasicPort bl_port = module_manager.module_port(top_module, bl_port_id);
-  fp << generate_verilog_port(VERILOG_PORT_REG, bl_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, bl_port) << ";" << "\n";
 
   /* Print the port for Word-Line */
   print_verilog_comment(fp, std::string("---- Word Line ports -----"));
   ModulePortId wl_port_id = module_manager.find_module_port(top_module, std::string(MEMORY_WL_PORT_NAME));
   BasicPort wl_port = module_manager.module_port(top_module, wl_port_id);
-  fp << generate_verilog_port(VERILOG_PORT_REG, wl_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, wl_port) << ";" << "\n";
 }
 
 
@@ -89,13 +90,13 @@ void print_verilog_top_testbench_config_chain_port(std::fstream& fp,
   print_verilog_comment(fp, std::string("---- Configuration-chain head -----"));
   ModulePortId cc_head_port_id = module_manager.find_module_port(top_module, generate_configuration_chain_head_name());
   BasicPort config_chain_head_port = module_manager.module_port(top_module, cc_head_port_id);
-  fp << generate_verilog_port(VERILOG_PORT_REG, config_chain_head_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, config_chain_head_port) << ";" << "\n";
 
   /* Print the tail of configuration-chains here */
   print_verilog_comment(fp, std::string("---- Configuration-chain tail -----"));
   ModulePortId cc_tail_port_id = module_manager.find_module_port(top_module, generate_configuration_chain_tail_name());
   BasicPort config_chain_tail_port = module_manager.module_port(top_module, cc_tail_port_id);
-  fp << generate_verilog_port(VERILOG_PORT_WIRE, config_chain_tail_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_WIRE, config_chain_tail_port) << ";" << "\n";
 }
 
 /********************************************************************
@@ -114,7 +115,7 @@ void print_verilog_top_testbench_memory_bank_port(std::fstream& fp,
                                                                  std::string(DECODER_BL_ADDRESS_PORT_NAME));
   BasicPort bl_addr_port = module_manager.module_port(top_module, bl_addr_port_id);
 
-  fp << generate_verilog_port(VERILOG_PORT_REG, bl_addr_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, bl_addr_port) << ";" << "\n";
 
   /* Print the address port for the Word-Line decoder here */
   print_verilog_comment(fp, std::string("---- Address port for Word-Line decoder -----"));
@@ -122,14 +123,14 @@ void print_verilog_top_testbench_memory_bank_port(std::fstream& fp,
                                                                  std::string(DECODER_WL_ADDRESS_PORT_NAME));
   BasicPort wl_addr_port = module_manager.module_port(top_module, wl_addr_port_id);
 
-  fp << generate_verilog_port(VERILOG_PORT_REG, wl_addr_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, wl_addr_port) << ";" << "\n";
 
   /* Print the data-input port for the frame-based decoder here */
   print_verilog_comment(fp, std::string("---- Data input port for memory decoders -----"));
   ModulePortId din_port_id = module_manager.find_module_port(top_module,
                                                              std::string(DECODER_DATA_IN_PORT_NAME));
   BasicPort din_port = module_manager.module_port(top_module, din_port_id);
-  fp << generate_verilog_port(VERILOG_PORT_REG, din_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, din_port) << ";" << "\n";
 
   /* Print the optional readback port for the decoder here */
   print_verilog_comment(fp, std::string("---- Readback port for memory decoders -----"));
@@ -137,7 +138,7 @@ void print_verilog_top_testbench_memory_bank_port(std::fstream& fp,
                                                                   std::string(DECODER_READBACK_PORT_NAME));
   if (readback_port_id) {
     BasicPort readback_port = module_manager.module_port(top_module, readback_port_id);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, readback_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, readback_port) << ";" << "\n";
     /* Disable readback in full testbenches */
     print_verilog_wire_constant_values(fp, readback_port, std::vector<size_t>(readback_port.get_width(), 0)); 
   }
@@ -153,8 +154,8 @@ void print_verilog_top_testbench_memory_bank_port(std::fstream& fp,
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
 
-  fp << generate_verilog_port(VERILOG_PORT_WIRE, en_port) << ";" << std::endl;
-  fp << generate_verilog_port(VERILOG_PORT_REG, en_register_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_WIRE, en_port) << ";" << "\n";
+  fp << generate_verilog_port(VERILOG_PORT_REG, en_register_port) << ";" << "\n";
 
   write_tab_to_file(fp, 1);
   fp << "assign ";
@@ -163,7 +164,7 @@ void print_verilog_top_testbench_memory_bank_port(std::fstream& fp,
   fp << "~" << generate_verilog_port(VERILOG_PORT_CONKT, en_register_port);
   fp << " & ";
   fp << "~" << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 }
 
 
@@ -183,14 +184,14 @@ void print_verilog_top_testbench_frame_decoder_port(std::fstream& fp,
                                                               std::string(DECODER_ADDRESS_PORT_NAME));
   BasicPort addr_port = module_manager.module_port(top_module, addr_port_id);
 
-  fp << generate_verilog_port(VERILOG_PORT_REG, addr_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, addr_port) << ";" << "\n";
 
   /* Print the data-input port for the frame-based decoder here */
   print_verilog_comment(fp, std::string("---- Data input port for frame-based decoder -----"));
   ModulePortId din_port_id = module_manager.find_module_port(top_module,
                                                              std::string(DECODER_DATA_IN_PORT_NAME));
   BasicPort din_port = module_manager.module_port(top_module, din_port_id);
-  fp << generate_verilog_port(VERILOG_PORT_REG, din_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, din_port) << ";" << "\n";
 
   /* Generate enable signal waveform here:
    * which is a 90 degree phase shift than the programming clock   
@@ -203,8 +204,8 @@ void print_verilog_top_testbench_frame_decoder_port(std::fstream& fp,
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
 
-  fp << generate_verilog_port(VERILOG_PORT_WIRE, en_port) << ";" << std::endl;
-  fp << generate_verilog_port(VERILOG_PORT_REG, en_register_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_WIRE, en_port) << ";" << "\n";
+  fp << generate_verilog_port(VERILOG_PORT_REG, en_register_port) << ";" << "\n";
 
   write_tab_to_file(fp, 1);
   fp << "assign ";
@@ -213,7 +214,7 @@ void print_verilog_top_testbench_frame_decoder_port(std::fstream& fp,
   fp << "~" << generate_verilog_port(VERILOG_PORT_CONKT, en_register_port);
   fp << " & ";
   fp << "~" << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 }
 
 /********************************************************************
@@ -664,7 +665,7 @@ void print_verilog_top_testbench_benchmark_clock_ports(std::fstream& fp,
     /* Print the clock and wire it to the clock source */
     print_verilog_comment(fp, std::string("----- Create a clock for benchmark and wire it to " + clock_source_to_connect.get_name() + " -------"));
     BasicPort clock_port(clock_port_name, 1);
-    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, clock_port) << ";" << std::endl;
+    fp << "\t" << generate_verilog_port(VERILOG_PORT_WIRE, clock_port) << ";" << "\n";
     print_verilog_wire_connection(fp, clock_port, clock_source_to_connect, false);
   }
 }
@@ -706,7 +707,7 @@ void print_verilog_top_testbench_ports(std::fstream& fp,
 
   /* Print module definition */
   fp << "module " << circuit_name << std::string(AUTOCHECK_TOP_TESTBENCH_VERILOG_MODULE_POSTFIX);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   /* Print regular local wires:
    * 1. global ports, i.e., reset, set and clock signals
@@ -715,30 +716,30 @@ void print_verilog_top_testbench_ports(std::fstream& fp,
   /* Global ports of top-level module  */
   print_verilog_comment(fp, std::string("----- Local wires for global ports of FPGA fabric -----"));
   for (const BasicPort& module_port : module_manager.module_ports_by_type(top_module, ModuleManager::MODULE_GLOBAL_PORT)) {
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << "\n";
   }
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Datapath I/Os of top-level module  */
   print_verilog_comment(fp, std::string("----- Local wires for I/Os of FPGA fabric -----"));
   for (const BasicPort& module_port : module_manager.module_ports_by_type(top_module, ModuleManager::MODULE_GPIO_PORT)) {
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << "\n";
   }
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   for (const BasicPort& module_port : module_manager.module_ports_by_type(top_module, ModuleManager::MODULE_GPIN_PORT)) {
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << "\n";
   }
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   for (const BasicPort& module_port : module_manager.module_ports_by_type(top_module, ModuleManager::MODULE_GPOUT_PORT)) {
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, module_port) << ";" << "\n";
   }
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 
   /* Add local wires/registers that drive stimulus
    * We create these general purpose ports here,
@@ -746,21 +747,21 @@ void print_verilog_top_testbench_ports(std::fstream& fp,
    */
   /* Configuration done port */
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
-  fp << generate_verilog_port(VERILOG_PORT_REG, config_done_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, config_done_port) << ";" << "\n";
 
   /* Programming clock */
   BasicPort prog_clock_port(std::string(TOP_TB_PROG_CLOCK_PORT_NAME), 1);
-  fp << generate_verilog_port(VERILOG_PORT_WIRE, prog_clock_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_WIRE, prog_clock_port) << ";" << "\n";
   BasicPort prog_clock_register_port(std::string(std::string(TOP_TB_PROG_CLOCK_PORT_NAME) + std::string(TOP_TB_CLOCK_REG_POSTFIX)), 1);
-  fp << generate_verilog_port(VERILOG_PORT_REG, prog_clock_register_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, prog_clock_register_port) << ";" << "\n";
 
   /* Multiple operating clocks based on the simulation settings */
   for (const SimulationClockId& sim_clock : simulation_parameters.operating_clocks()) {
     std::string sim_clock_port_name = generate_top_testbench_clock_name(std::string(TOP_TB_OP_CLOCK_PORT_PREFIX), simulation_parameters.clock_name(sim_clock));
     BasicPort sim_clock_port(sim_clock_port_name, 1);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, sim_clock_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, sim_clock_port) << ";" << "\n";
     BasicPort sim_clock_register_port(std::string(sim_clock_port_name + std::string(TOP_TB_CLOCK_REG_POSTFIX)), 1);
-    fp << generate_verilog_port(VERILOG_PORT_REG, sim_clock_register_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, sim_clock_register_port) << ";" << "\n";
   }
 
   /* FIXME: Actually, for multi-clock implementations, input and output ports
@@ -770,21 +771,21 @@ void print_verilog_top_testbench_ports(std::fstream& fp,
    * Create an operating clock_port to synchronize checkers stimulus generator 
    */
   BasicPort op_clock_port(std::string(TOP_TB_OP_CLOCK_PORT_NAME), 1);
-  fp << generate_verilog_port(VERILOG_PORT_WIRE, op_clock_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_WIRE, op_clock_port) << ";" << "\n";
   BasicPort op_clock_register_port(std::string(std::string(TOP_TB_OP_CLOCK_PORT_NAME) + std::string(TOP_TB_CLOCK_REG_POSTFIX)), 1);
-  fp << generate_verilog_port(VERILOG_PORT_REG, op_clock_register_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, op_clock_register_port) << ";" << "\n";
 
   /* Programming set and reset */
   BasicPort prog_reset_port(std::string(TOP_TB_PROG_RESET_PORT_NAME), 1);
-  fp << generate_verilog_port(VERILOG_PORT_REG, prog_reset_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, prog_reset_port) << ";" << "\n";
   BasicPort prog_set_port(std::string(TOP_TB_PROG_SET_PORT_NAME), 1);
-  fp << generate_verilog_port(VERILOG_PORT_REG, prog_set_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, prog_set_port) << ";" << "\n";
 
   /* Global set and reset */
   BasicPort reset_port(std::string(TOP_TB_RESET_PORT_NAME), 1);
-  fp << generate_verilog_port(VERILOG_PORT_REG, reset_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, reset_port) << ";" << "\n";
   BasicPort set_port(std::string(TOP_TB_SET_PORT_NAME), 1);
-  fp << generate_verilog_port(VERILOG_PORT_REG, set_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_REG, set_port) << ";" << "\n";
 
   /* Configuration ports depend on the organization of SRAMs */
   print_verilog_top_testbench_config_protocol_port(fp, config_protocol,
@@ -810,10 +811,67 @@ void print_verilog_top_testbench_ports(std::fstream& fp,
    */
   if (!options.no_self_checking()) {
     print_verilog_comment(fp, std::string("----- Error counter: Deposit an error for config_done signal is not raised at the beginning -----"));
-    fp << "\tinteger " << TOP_TESTBENCH_ERROR_COUNTER << "= 1;" << std::endl;
+    fp << "\tinteger " << TOP_TESTBENCH_ERROR_COUNTER << "= 1;" << "\n";
   }
 }
 
+/********************************************************************
+ * Find the length of the bitstream loaded by the full testbench
+ * For memory banks and frame-based decoders, the fabric bitstream has to be
+ * reorganized by address to find its length, which is expensive for large fabrics.
+ * The length is found once here, in a single pass on the reorganized bitstream,
+ * and then shared by the estimation of configuration clock cycles
+ * and the bitstream loading stimuli
+ * Note that the shift-register BL/WL protocols build their own bitstream
+ * for the stimuli, which is organized by words rather than by addresses
+ *******************************************************************/
+static
+FullTestbenchBitstreamLength find_full_testbench_bitstream_length(const ConfigProtocol& config_protocol,
+                                                                  const bool& fast_configuration,
+                                                                  const bool& bit_value_to_skip,
+                                                                  const BitstreamManager& bitstream_manager,
+                                                                  const FabricBitstream& fabric_bitstream) {
+  FullTestbenchBitstreamLength bitstream_length;
+
+  switch (config_protocol.type()) {
+  case CONFIG_MEM_SCAN_CHAIN:
+    bitstream_length.num_bits = find_fabric_regional_bitstream_max_size(fabric_bitstream);
+    if (true == fast_configuration) {
+      bitstream_length.num_bits_to_skip = find_configuration_chain_fabric_bitstream_size_to_be_skipped(fabric_bitstream, bitstream_manager, bit_value_to_skip);
+    }
+    break;
+  case CONFIG_MEM_QL_MEMORY_BANK:
+  case CONFIG_MEM_MEMORY_BANK: {
+    /* Flatten and shift-register BL/WLs load one data point per BL/WL of the flatten bitstream,
+     * whose builder already excludes the data points skipped by fast configuration
+     */
+    if ( (CONFIG_MEM_QL_MEMORY_BANK == config_protocol.type())
+      && (BLWL_PROTOCOL_DECODER != config_protocol.bl_protocol_type()) ) {
+      bitstream_length.num_bits = build_memory_bank_flatten_fabric_bitstream(fabric_bitstream, fast_configuration, bit_value_to_skip).size();
+      break;
+    }
+    MemoryBankFabricBitstream fabric_bits_by_addr = build_memory_bank_fabric_bitstream_by_address(fabric_bitstream);
+    bitstream_length.num_bits = fabric_bits_by_addr.size();
+    if (true == fast_configuration) {
+      bitstream_length.num_bits_to_skip = fabric_bits_by_addr.size() - find_memory_bank_fast_configuration_fabric_bitstream_size(fabric_bits_by_addr, bit_value_to_skip);
+    }
+    break;
+  }
+  case CONFIG_MEM_FRAME_BASED: {
+    FrameFabricBitstream fabric_bits_by_addr = build_frame_based_fabric_bitstream_by_address(fabric_bitstream);
+    bitstream_length.num_bits = fabric_bits_by_addr.size();
+    if (true == fast_configuration) {
+      bitstream_length.num_bits_to_skip = fabric_bits_by_addr.size() - find_frame_based_fast_configuration_fabric_bitstream_size(fabric_bits_by_addr, bit_value_to_skip);
+    }
+    break;
+  }
+  default:
+    break;
+  }
+
+  return bitstream_length;
+}
+
 /********************************************************************
  * Estimate the number of configuration clock cycles
  * by traversing the linked-list and count the number of SRAM=1 or BL=1&WL=1 in it.
@@ -825,8 +883,7 @@ void print_verilog_top_testbench_ports(std::fstream& fp,
 static
 size_t calculate_num_config_clock_cycles(const ConfigProtocol& config_protocol,
                                          const bool& fast_configuration,
-                                         const bool& bit_value_to_skip,
-                                         const BitstreamManager& bitstream_manager,
+                                         const FullTestbenchBitstreamLength& bitstream_length,
                                          const FabricBitstream& fabric_bitstream) {
   /* Find the longest regional bitstream */
   size_t regional_bitstream_max_size = find_fabric_regional_bitstream_max_size(fabric_bitstream);
@@ -852,9 +909,7 @@ size_t calculate_num_config_clock_cycles(const ConfigProtocol& config_protocol,
        *   Region 2:   0010101111000110
        * The number of bits that can be skipped is limited by Region 2
        */
-      size_t num_bits_to_skip = find_configuration_chain_fabric_bitstream_size_to_be_skipped(fabric_bitstream, bitstream_manager, bit_value_to_skip);
-
-      num_config_clock_cycles = 1 + regional_bitstream_max_size - num_bits_to_skip;
+      num_config_clock_cycles = 1 + regional_bitstream_max_size - bitstream_length.num_bits_to_skip;
 
       VTR_LOG("Fast configuration reduces number of configuration clock cycles from %lu to %lu (compression_rate = %f%)\n",
               1 + regional_bitstream_max_size,
@@ -865,28 +920,28 @@ size_t calculate_num_config_clock_cycles(const ConfigProtocol& config_protocol,
   case CONFIG_MEM_QL_MEMORY_BANK: {
     if (BLWL_PROTOCOL_DECODER == config_protocol.bl_protocol_type()) {
       /* For fast configuration, we will skip all the zero data points */
-      num_config_clock_cycles = 1 + build_memory_bank_fabric_bitstream_by_address(fabric_bitstream).size();
+      num_config_clock_cycles = 1 + bitstream_length.num_bits;
       if (true == fast_configuration) {
         size_t full_num_config_clock_cycles = num_config_clock_cycles;
-        num_config_clock_cycles = 1 + find_memory_bank_fast_configuration_fabric_bitstream_size(fabric_bitstream, bit_value_to_skip);
+        num_config_clock_cycles = 1 + bitstream_length.num_bits - bitstream_length.num_bits_to_skip;
         VTR_LOG("Fast configuration reduces number of configuration clock cycles from %lu to %lu (compression_rate = %f%)\n",
                 full_num_config_clock_cycles,
                 num_config_clock_cycles,
                 100. * ((float)num_config_clock_cycles / (float)full_num_config_clock_cycles - 1.));
       }
     } else if (BLWL_PROTOCOL_FLATTEN == config_protocol.bl_protocol_type()) {
-      num_config_clock_cycles = 1 + build_memory_bank_flatten_fabric_bitstream(fabric_bitstream, fast_configuration, bit_value_to_skip).size();
+      num_config_clock_cycles = 1 + bitstream_length.num_bits;
     } else if (BLWL_PROTOCOL_SHIFT_REGISTER == config_protocol.bl_protocol_type()) {
-      num_config_clock_cycles = 1 + build_memory_bank_flatten_fabric_bitstream(fabric_bitstream, fast_configuration, bit_value_to_skip).size();
+      num_config_clock_cycles = 1 + bitstream_length.num_bits;
     }
     break;
   }
   case CONFIG_MEM_MEMORY_BANK: {
     /* For fast configuration, we will skip all the zero data points */
-    num_config_clock_cycles = 1 + build_memory_bank_fabric_bitstream_by_address(fabric_bitstream).size();
+    num_config_clock_cycles = 1 + bitstream_length.num_bits;
     if (true == fast_configuration) {
       size_t full_num_config_clock_cycles = num_config_clock_cycles;
-      num_config_clock_cycles = 1 + find_memory_bank_fast_configuration_fabric_bitstream_size(fabric_bitstream, bit_value_to_skip);
+      num_config_clock_cycles = 1 + bitstream_length.num_bits - bitstream_length.num_bits_to_skip;
       VTR_LOG("Fast configuration reduces number of configuration clock cycles from %lu to %lu (compression_rate = %f%)\n",
               full_num_config_clock_cycles,
               num_config_clock_cycles,
@@ -895,10 +950,10 @@ size_t calculate_num_config_clock_cycles(const ConfigProtocol& config_protocol,
     break;
   }
   case CONFIG_MEM_FRAME_BASED: {
-    num_config_clock_cycles = 1 + build_frame_based_fabric_bitstream_by_address(fabric_bitstream).size();
+    num_config_clock_cycles = 1 + bitstream_length.num_bits;
     if (true == fast_configuration) {
       size_t full_num_config_clock_cycles = num_config_clock_cycles;
-      num_config_clock_cycles = 1 + find_frame_based_fast_configuration_fabric_bitstream_size(fabric_bitstream, bit_value_to_skip);
+      num_config_clock_cycles = 1 + bitstream_length.num_bits - bitstream_length.num_bits_to_skip;
       VTR_LOG("Fast configuration reduces number of configuration clock cycles from %lu to %lu (compression_rate = %f%)\n",
               full_num_config_clock_cycles,
               num_config_clock_cycles,
@@ -953,7 +1008,7 @@ void print_verilog_top_testbench_benchmark_instance(std::fstream& fp,
   print_verilog_comment(fp, std::string("----- End reference Benchmark Instanication -------"));
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -999,7 +1054,7 @@ void print_verilog_top_testbench_generic_stimulus(std::fstream& fp,
                               0, /* Initial value */
                               num_config_clock_cycles * prog_clock_period / timescale, 0);
   print_verilog_comment(fp, "----- End configuration done signal generation -----");
-  fp << std::endl;
+  fp << "\n";
 
   /* Generate stimuli waveform for programming clock signals */
   print_verilog_comment(fp, "----- Begin raw programming clock signal generation -----");
@@ -1008,7 +1063,7 @@ void print_verilog_top_testbench_generic_stimulus(std::fstream& fp,
                               0.5 * prog_clock_period / timescale,
                               std::string());
   print_verilog_comment(fp, "----- End raw programming clock signal generation -----");
-  fp << std::endl;
+  fp << "\n";
 
   /* Programming clock should be only enabled during programming phase.
    * When configuration is done (config_done is enabled), programming clock should be always zero.
@@ -1018,9 +1073,9 @@ void print_verilog_top_testbench_generic_stimulus(std::fstream& fp,
   fp << " = " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_register_port);
   fp << " & (~" << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port) << ")";
   fp << " & (~" << generate_verilog_port(VERILOG_PORT_CONKT, prog_reset_port) << ")";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
-  fp << std::endl;
+  fp << "\n";
 
   /* Generate stimuli waveform for multiple user-defined operating clock signals */
   for (const SimulationClockId& sim_clock : simulation_parameters.operating_clocks()) {
@@ -1043,9 +1098,9 @@ void print_verilog_top_testbench_generic_stimulus(std::fstream& fp,
     fp << "\tassign " << generate_verilog_port(VERILOG_PORT_CONKT, sim_clock_port);
     fp << " = " << generate_verilog_port(VERILOG_PORT_CONKT, sim_clock_register_port);
     fp << " & " << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port);
-    fp << ";" << std::endl;
+    fp << ";" << "\n";
 
-    fp << std::endl;
+    fp << "\n";
   }
 
   /* Generate stimuli waveform for operating clock signals */
@@ -1063,9 +1118,9 @@ void print_verilog_top_testbench_generic_stimulus(std::fstream& fp,
   fp << "\tassign " << generate_verilog_port(VERILOG_PORT_CONKT, op_clock_port);
   fp << " = " << generate_verilog_port(VERILOG_PORT_CONKT, op_clock_register_port);
   fp << " & " << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
-  fp << std::endl;
+  fp << "\n";
 
   /* Reset signal for configuration circuit:
    * only enable during the first clock cycle in programming phase
@@ -1076,7 +1131,7 @@ void print_verilog_top_testbench_generic_stimulus(std::fstream& fp,
                               prog_clock_period / timescale, 0);
   print_verilog_comment(fp, "----- End programming reset signal generation -----");
 
-  fp << std::endl;
+  fp << "\n";
 
   /* Programming set signal for configuration circuit : always disabled */
   print_verilog_comment(fp, "----- Begin programming set signal generation -----");
@@ -1085,7 +1140,7 @@ void print_verilog_top_testbench_generic_stimulus(std::fstream& fp,
                               prog_clock_period / timescale, 0);
   print_verilog_comment(fp, "----- End programming set signal generation -----");
 
-  fp << std::endl;
+  fp << "\n";
 
   /* Operating reset signals: only enabled during the first clock cycle in operation phase */
   std::vector<float> reset_pulse_widths;
@@ -1112,7 +1167,7 @@ void print_verilog_top_testbench_generic_stimulus(std::fstream& fp,
                               op_clock_period / timescale, 0);
   print_verilog_comment(fp, "----- End operating set signal generation: always disabled -----");
 
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -1206,7 +1261,7 @@ void print_verilog_full_testbench_vanilla_bitstream(std::fstream& fp,
   print_verilog_comment(fp, "----- Virtual memory to store the bitstream from external file -----");
   fp << "reg [0:`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " - 1] ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[0:0];";
-  fp << std::endl;
+  fp << "\n";
 
   /* Initial value should be the first configuration bits
    * In the rest of programming cycles,
@@ -1218,46 +1273,46 @@ void print_verilog_full_testbench_vanilla_bitstream(std::fstream& fp,
   std::vector<size_t> initial_wl_values(wl_port.get_width(), 0);
 
   print_verilog_comment(fp, "----- Begin bitstream loading during configuration phase -----");
-  fp << "initial" << std::endl;
-  fp << "\tbegin" << std::endl;
+  fp << "initial" << "\n";
+  fp << "\tbegin" << "\n";
   print_verilog_comment(fp, "----- Configuration chain default input -----");
   fp << "\t\t";
   fp << generate_verilog_port_constant_values(bl_port, initial_bl_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
   fp << "\t\t";
   fp << generate_verilog_port_constant_values(wl_port, initial_wl_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   print_verilog_comment(fp, "----- Preload bitstream file to a virtual memory -----");
   fp << "\t";
   fp << "$readmemb(\"" << bitstream_file << "\", " << TOP_TB_BITSTREAM_MEM_REG_NAME << ");";
-  fp << std::endl;
+  fp << "\n";
 
-  fp << "\t\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ") begin" << std::endl;
+  fp << "\t\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ") begin" << "\n";
 
   /* Enable all the WLs */
   std::vector<size_t> enabled_wl_values(wl_port.get_width(), 1);
   fp << "\t\t\t";
   fp << generate_verilog_port_constant_values(wl_port, enabled_wl_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t\t\t";
   fp << generate_verilog_port(VERILOG_PORT_CONKT, bl_port);
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[0]";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
-  fp << "\t\tend" << std::endl;
+  fp << "\t\tend" << "\n";
 
   /* Disable all the WLs */
-  fp << "\t\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ");" << std::endl;
+  fp << "\t\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ");" << "\n";
 
   fp << "\t\t\t";
   fp << generate_verilog_port_constant_values(wl_port, initial_wl_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   /* Raise the flag of configuration done when bitstream loading is complete */
-  fp << "\t\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ");" << std::endl;
+  fp << "\t\t@(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ");" << "\n";
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
   fp << "\t\t\t";
@@ -1265,9 +1320,9 @@ void print_verilog_full_testbench_vanilla_bitstream(std::fstream& fp,
   fp << " <= ";
   std::vector<size_t> config_done_enable_values(config_done_port.get_width(), 1);
   fp << generate_verilog_constant_values(config_done_enable_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
-  fp << "\tend" << std::endl;
+  fp << "\tend" << "\n";
   print_verilog_comment(fp, "----- End bitstream loading during configuration phase -----");
 }
 
@@ -1288,27 +1343,22 @@ void print_verilog_full_testbench_configuration_chain_bitstream(std::fstream& fp
                                                                 const std::string& bitstream_file,
                                                                 const bool& fast_configuration,
                                                                 const bool& bit_value_to_skip,
+                                                                const FullTestbenchBitstreamLength& bitstream_length,
                                                                 const ModuleManager& module_manager,
                                                                 const ModuleId& top_module,
-                                                                const BitstreamManager& bitstream_manager,
                                                                 const FabricBitstream& fabric_bitstream) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
   print_verilog_comment(fp, "----- Begin bitstream loading during configuration phase -----");
 
-  /* Find the longest bitstream */
-  size_t regional_bitstream_max_size = find_fabric_regional_bitstream_max_size(fabric_bitstream);
-
-  /* For fast configuration, the bitstream size counts from the first bit '1' */
-  size_t num_bits_to_skip = 0;
-  if (true == fast_configuration) {
-    num_bits_to_skip = find_configuration_chain_fabric_bitstream_size_to_be_skipped(fabric_bitstream, bitstream_manager, bit_value_to_skip);
-  }
-  VTR_ASSERT(num_bits_to_skip < regional_bitstream_max_size);
+  /* The bitstream length is the longest regional bitstream.
+   * For fast configuration, the bitstream size counts from the first bit '1'
+   */
+  VTR_ASSERT(bitstream_length.num_bits_to_skip < bitstream_length.num_bits);
 
   /* Define a constant for the bitstream length */
-  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), regional_bitstream_max_size - num_bits_to_skip); 
+  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), bitstream_length.num_bits - bitstream_length.num_bits_to_skip); 
   print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_WIDTH_VARIABLE), fabric_bitstream.num_regions()); 
 
   /* Initial value should be the first configuration bits
@@ -1325,44 +1375,44 @@ void print_verilog_full_testbench_configuration_chain_bitstream(std::fstream& fp
   print_verilog_comment(fp, "----- Virtual memory to store the bitstream from external file -----");
   fp << "reg [0:`" << TOP_TB_BITSTREAM_WIDTH_VARIABLE << " - 1] ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[0:`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " - 1];";
-  fp << std::endl;
+  fp << "\n";
 
-  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << std::endl;
+  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << "\n";
 
   BasicPort bit_skip_reg(TOP_TB_BITSTREAM_SKIP_FLAG_REG_NAME, 1);
   print_verilog_comment(fp, "----- Registers used for fast configuration logic -----");
-  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << ";" << std::endl;
-  fp << generate_verilog_port(VERILOG_PORT_REG, bit_skip_reg) << ";" << std::endl;
+  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << ";" << "\n";
+  fp << generate_verilog_port(VERILOG_PORT_REG, bit_skip_reg) << ";" << "\n";
 
   print_verilog_comment(fp, "----- Preload bitstream file to a virtual memory -----");
-  fp << "initial begin" << std::endl;
+  fp << "initial begin" << "\n";
   fp << "\t";
   fp << "$readmemb(\"" << bitstream_file << "\", " << TOP_TB_BITSTREAM_MEM_REG_NAME << ");";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Configuration chain default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(config_chain_head_port, initial_values, true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " <= 0";
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   std::vector<size_t> bit_skip_values(bit_skip_reg.get_width(), fast_configuration ? 1 : 0);
   fp << "\t";
   fp << generate_verilog_port_constant_values(bit_skip_reg, bit_skip_values, true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "for (" << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << " = 0; ";
   fp << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << " < `" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " + 1; "; 
   fp << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << " = " << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << " + 1)";
   fp << " begin"; 
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << "if (";
@@ -1371,7 +1421,7 @@ void print_verilog_full_testbench_configuration_chain_bitstream(std::fstream& fp
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[" << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << "]";
   fp << ")";
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t\t";
   fp << "if (";
@@ -1379,43 +1429,43 @@ void print_verilog_full_testbench_configuration_chain_bitstream(std::fstream& fp
   fp << " == ";
   fp << generate_verilog_port(VERILOG_PORT_CONKT, bit_skip_reg) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t\t\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME;
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " + 1";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t\t\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << "end else begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t\t";
   fp << generate_verilog_port_constant_values(bit_skip_reg, std::vector<size_t>(bit_skip_reg.get_width(), 0), true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort prog_clock_port(std::string(TOP_TB_PROG_CLOCK_PORT_NAME) + std::string(TOP_TB_CLOCK_REG_POSTFIX), 1);
   print_verilog_comment(fp, "----- 'else if' condition is required by Modelsim to synthesis the Verilog correctly -----");
   fp << "always";
   fp << " @(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "if (";
@@ -1423,13 +1473,13 @@ void print_verilog_full_testbench_configuration_chain_bitstream(std::fstream& fp
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE;
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
   fp << "\t\t";
   std::vector<size_t> config_done_final_values(config_done_port.get_width(), 1);
   fp << generate_verilog_port_constant_values(config_done_port, config_done_final_values, true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end else if (";
@@ -1439,26 +1489,26 @@ void print_verilog_full_testbench_configuration_chain_bitstream(std::fstream& fp
   fp << " < ";
   fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE;
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << generate_verilog_port(VERILOG_PORT_CONKT, config_chain_head_port); 
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[" << TOP_TB_BITSTREAM_INDEX_REG_NAME << "]";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME;
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " + 1";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- End bitstream loading during configuration phase -----");
 }
@@ -1470,23 +1520,16 @@ void print_verilog_full_testbench_configuration_chain_bitstream(std::fstream& fp
 static
 void print_verilog_full_testbench_memory_bank_bitstream(std::fstream& fp,
                                                         const std::string& bitstream_file,
-                                                        const bool& fast_configuration,
-                                                        const bool& bit_value_to_skip,
+                                                        const FullTestbenchBitstreamLength& bitstream_length,
                                                         const ModuleManager& module_manager,
-                                                        const ModuleId& top_module,
-                                                        const FabricBitstream& fabric_bitstream) {
+                                                        const ModuleId& top_module) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
-  /* Reorganize the fabric bitstream by the same address across regions */
-  MemoryBankFabricBitstream fabric_bits_by_addr = build_memory_bank_fabric_bitstream_by_address(fabric_bitstream);
-
-  /* For fast configuration, identify the final bitstream size to be used */
-  size_t num_bits_to_skip = 0;
-  if (true == fast_configuration) {
-    num_bits_to_skip = fabric_bits_by_addr.size() - find_memory_bank_fast_configuration_fabric_bitstream_size(fabric_bitstream, bit_value_to_skip);
-  }
-  VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
+  /* The bitstream length is the size of the fabric bitstream reorganized by address.
+   * For fast configuration, the data points to be skipped are excluded
+   */
+  VTR_ASSERT(bitstream_length.num_bits_to_skip < bitstream_length.num_bits);
 
   /* Feed address and data input pair one by one
    * Note: the first cycle is reserved for programming reset
@@ -1508,55 +1551,55 @@ void print_verilog_full_testbench_memory_bank_bitstream(std::fstream& fp,
   std::vector<size_t> initial_din_values(din_port.get_width(), 0);
 
   /* Define a constant for the bitstream length */
-  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), fabric_bits_by_addr.size() - num_bits_to_skip); 
+  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), bitstream_length.num_bits - bitstream_length.num_bits_to_skip); 
   print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_WIDTH_VARIABLE), bl_addr_port.get_width() + wl_addr_port.get_width() + din_port.get_width()); 
 
   /* Declare local variables for bitstream loading in Verilog */
   print_verilog_comment(fp, "----- Virtual memory to store the bitstream from external file -----");
   fp << "reg [0:`" << TOP_TB_BITSTREAM_WIDTH_VARIABLE << " - 1] ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[0:`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " - 1];";
-  fp << std::endl;
+  fp << "\n";
 
-  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << std::endl;
+  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << "\n";
 
   print_verilog_comment(fp, "----- Preload bitstream file to a virtual memory -----");
-  fp << "initial begin" << std::endl;
+  fp << "initial begin" << "\n";
   fp << "\t";
   fp << "$readmemb(\"" << bitstream_file << "\", " << TOP_TB_BITSTREAM_MEM_REG_NAME << ");";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Bit-Line Address port default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(bl_addr_port, initial_bl_addr_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Word-Line Address port default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(wl_addr_port, initial_wl_addr_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Data-input port default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(din_port, initial_din_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " <= 0";
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Begin bitstream loading during configuration phase -----");
   BasicPort prog_clock_port(std::string(TOP_TB_PROG_CLOCK_PORT_NAME) + std::string(TOP_TB_CLOCK_REG_POSTFIX), 1);
   fp << "always";
   fp << " @(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "if (";
@@ -1564,17 +1607,17 @@ void print_verilog_full_testbench_memory_bank_bitstream(std::fstream& fp,
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE;
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
   fp << "\t\t";
   std::vector<size_t> config_done_final_values(config_done_port.get_width(), 1);
   fp << generate_verilog_port_constant_values(config_done_port, config_done_final_values, true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end else begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << "{";
@@ -1586,20 +1629,20 @@ void print_verilog_full_testbench_memory_bank_bitstream(std::fstream& fp,
   fp << "}";
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[" << TOP_TB_BITSTREAM_INDEX_REG_NAME << "]";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME;
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " + 1";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- End bitstream loading during configuration phase -----");
 }
@@ -1611,23 +1654,16 @@ void print_verilog_full_testbench_memory_bank_bitstream(std::fstream& fp,
 static
 void print_verilog_full_testbench_frame_decoder_bitstream(std::fstream& fp,
                                                           const std::string& bitstream_file,
-                                                          const bool& fast_configuration,
-                                                          const bool& bit_value_to_skip,
+                                                          const FullTestbenchBitstreamLength& bitstream_length,
                                                           const ModuleManager& module_manager,
-                                                          const ModuleId& top_module,
-                                                          const FabricBitstream& fabric_bitstream) {
+                                                          const ModuleId& top_module) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
-  /* Reorganize the fabric bitstream by the same address across regions */
-  FrameFabricBitstream fabric_bits_by_addr = build_frame_based_fabric_bitstream_by_address(fabric_bitstream);
-
-  /* For fast configuration, identify the final bitstream size to be used */
-  size_t num_bits_to_skip = 0;
-  if (true == fast_configuration) {
-    num_bits_to_skip = fabric_bits_by_addr.size() - find_frame_based_fast_configuration_fabric_bitstream_size(fabric_bitstream, bit_value_to_skip);
-  }
-  VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
+  /* The bitstream length is the size of the fabric bitstream reorganized by address.
+   * For fast configuration, the data points to be skipped are excluded
+   */
+  VTR_ASSERT(bitstream_length.num_bits_to_skip < bitstream_length.num_bits);
 
   /* Feed address and data input pair one by one
    * Note: the first cycle is reserved for programming reset
@@ -1644,49 +1680,49 @@ void print_verilog_full_testbench_frame_decoder_bitstream(std::fstream& fp,
   std::vector<size_t> initial_din_values(din_port.get_width(), 0);
 
   /* Define a constant for the bitstream length */
-  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), fabric_bits_by_addr.size() - num_bits_to_skip); 
+  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), bitstream_length.num_bits - bitstream_length.num_bits_to_skip); 
   print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_WIDTH_VARIABLE), addr_port.get_width() + din_port.get_width()); 
 
   /* Declare local variables for bitstream loading in Verilog */
   print_verilog_comment(fp, "----- Virtual memory to store the bitstream from external file -----");
   fp << "reg [0:`" << TOP_TB_BITSTREAM_WIDTH_VARIABLE << " - 1] ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[0:`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " - 1];";
-  fp << std::endl;
+  fp << "\n";
 
-  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << std::endl;
+  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << "\n";
 
   print_verilog_comment(fp, "----- Preload bitstream file to a virtual memory -----");
-  fp << "initial begin" << std::endl;
+  fp << "initial begin" << "\n";
   fp << "\t";
   fp << "$readmemb(\"" << bitstream_file << "\", " << TOP_TB_BITSTREAM_MEM_REG_NAME << ");";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Address port default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(addr_port, initial_addr_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Data-input port default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(din_port, initial_din_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " <= 0";
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Begin bitstream loading during configuration phase -----");
   BasicPort prog_clock_port(std::string(TOP_TB_PROG_CLOCK_PORT_NAME) + std::string(TOP_TB_CLOCK_REG_POSTFIX), 1);
   fp << "always";
   fp << " @(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "if (";
@@ -1694,17 +1730,17 @@ void print_verilog_full_testbench_frame_decoder_bitstream(std::fstream& fp,
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE;
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
   fp << "\t\t";
   std::vector<size_t> config_done_final_values(config_done_port.get_width(), 1);
   fp << generate_verilog_port_constant_values(config_done_port, config_done_final_values, true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end else begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << "{";
@@ -1714,20 +1750,20 @@ void print_verilog_full_testbench_frame_decoder_bitstream(std::fstream& fp,
   fp << "}";
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[" << TOP_TB_BITSTREAM_INDEX_REG_NAME << "]";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME;
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " + 1";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- End bitstream loading during configuration phase -----");
 }
@@ -1744,9 +1780,9 @@ void print_verilog_full_testbench_bitstream(std::fstream& fp,
                                             const ConfigProtocol& config_protocol,
                                             const bool& fast_configuration,
                                             const bool& bit_value_to_skip,
+                                            const FullTestbenchBitstreamLength& bitstream_length,
                                             const ModuleManager& module_manager,
                                             const ModuleId& top_module,
-                                            const BitstreamManager& bitstream_manager,
                                             const FabricBitstream& fabric_bitstream,
                                             const MemoryBankShiftRegisterBanks& blwl_sr_banks) {
 
@@ -1764,31 +1800,28 @@ void print_verilog_full_testbench_bitstream(std::fstream& fp,
     print_verilog_full_testbench_configuration_chain_bitstream(fp, bitstream_file,
                                                                fast_configuration, 
                                                                bit_value_to_skip,
+                                                               bitstream_length,
                                                                module_manager, top_module,
-                                                               bitstream_manager,
                                                                fabric_bitstream);
     break;
   case CONFIG_MEM_MEMORY_BANK:
     print_verilog_full_testbench_memory_bank_bitstream(fp, bitstream_file,
-                                                       fast_configuration, 
-                                                       bit_value_to_skip,
-                                                       module_manager, top_module,
-                                                       fabric_bitstream);
+                                                       bitstream_length,
+                                                       module_manager, top_module);
     break;
   case CONFIG_MEM_QL_MEMORY_BANK:
     print_verilog_full_testbench_ql_memory_bank_bitstream(fp, bitstream_file,
                                                           config_protocol, 
                                                           fast_configuration, 
                                                           bit_value_to_skip,
+                                                          bitstream_length,
                                                           module_manager, top_module,
                                                           fabric_bitstream, blwl_sr_banks);
     break;
   case CONFIG_MEM_FRAME_BASED:
     print_verilog_full_testbench_frame_decoder_bitstream(fp, bitstream_file,
-                                                         fast_configuration, 
-                                                         bit_value_to_skip,
-                                                         module_manager, top_module,
-                                                         fabric_bitstream);
+                                                         bitstream_length,
+                                                         module_manager, top_module);
 
     break;
   default:
@@ -1868,16 +1901,16 @@ void print_verilog_top_testbench_check(std::fstream& fp,
   BasicPort config_done_port(config_done_port_name, 1);
 
   write_tab_to_file(fp, 1);
-  fp << "always@(posedge " << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port) << ") begin" << std::endl;
+  fp << "always@(posedge " << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port) << ") begin" << "\n";
 
   write_tab_to_file(fp, 2);
-  fp << error_counter_name << " = " << error_counter_name << " - 1;" << std::endl;
+  fp << error_counter_name << " = " << error_counter_name << " - 1;" << "\n";
 
   write_tab_to_file(fp, 1);
-  fp << "end" << std::endl;
+  fp << "end" << "\n";
 
   /* Add an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -1927,8 +1960,8 @@ int print_verilog_full_testbench(const ModuleManager& module_manager,
   vtr::ScopedStartFinishTimer timer(timer_message);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   /* Validate the file stream */
   check_file_stream(verilog_fname.c_str(), fp);
@@ -1975,11 +2008,17 @@ int print_verilog_full_testbench(const ModuleManager& module_manager,
     max_op_clock_period = std::max(max_op_clock_period, (float)(1./simulation_parameters.clock_frequency(clock_id)));
   }
 
+  /* Find the length of the bitstream to load, which is shared by the stimuli below */
+  FullTestbenchBitstreamLength bitstream_length = find_full_testbench_bitstream_length(config_protocol,
+                                                                                       apply_fast_configuration,
+                                                                                       bit_value_to_skip,
+                                                                                       bitstream_manager,
+                                                                                       fabric_bitstream);
+
   /* Estimate the number of configuration clock cycles */
   size_t num_config_clock_cycles = calculate_num_config_clock_cycles(config_protocol,
                                                                      apply_fast_configuration,
-                                                                     bit_value_to_skip,
-                                                                     bitstream_manager,
+                                                                     bitstream_length,
                                                                      fabric_bitstream);
 
   /* Generate stimuli for general control signals */
@@ -2068,8 +2107,9 @@ int print_verilog_full_testbench(const ModuleManager& module_manager,
                                          config_protocol,
                                          apply_fast_configuration,
                                          bit_value_to_skip,
+                                         bitstream_length,
                                          module_manager, top_module,
-                                         bitstream_manager, fabric_bitstream, blwl_sr_banks);
+                                         fabric_bitstream, blwl_sr_banks);
 
   /* Add signal initialization: 
    * Bypass writing codes to files due to the autogenerated codes are very large.
@@ -2145,7 +2185,7 @@ int print_verilog_full_testbench(const ModuleManager& module_manager,
   print_verilog_module_end(fp, std::string(circuit_name) + std::string(AUTOCHECK_TOP_TESTBENCH_VERILOG_MODULE_POSTFIX));
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   return status;
 }
@@ -67,14 +67,14 @@ void print_verilog_top_testbench_ql_memory_bank_port(std::fstream& fp,
                                                                    std::string(DECODER_BL_ADDRESS_PORT_NAME));
     BasicPort bl_addr_port = module_manager.module_port(top_module, bl_addr_port_id);
 
-    fp << generate_verilog_port(VERILOG_PORT_REG, bl_addr_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, bl_addr_port) << ";" << "\n";
   } else if (BLWL_PROTOCOL_FLATTEN == config_protocol.bl_protocol_type()) {
     print_verilog_comment(fp, std::string("---- Bit-Line ports -----"));
     for (const ConfigRegionId& region : module_manager.regions(top_module)) {
       ModulePortId bl_port_id = module_manager.find_module_port(top_module,
                                                                 generate_regional_blwl_port_name(std::string(MEMORY_BL_PORT_NAME), region));
       BasicPort bl_port = module_manager.module_port(top_module, bl_port_id);
-      fp << generate_verilog_port(VERILOG_PORT_REG, bl_port) << ";" << std::endl;
+      fp << generate_verilog_port(VERILOG_PORT_REG, bl_port) << ";" << "\n";
     }
   } else {
     VTR_ASSERT(BLWL_PROTOCOL_SHIFT_REGISTER == config_protocol.bl_protocol_type());
@@ -83,26 +83,26 @@ void print_verilog_top_testbench_ql_memory_bank_port(std::fstream& fp,
       ModulePortId sr_head_port_id = module_manager.find_module_port(top_module,
                                                                      generate_regional_blwl_port_name(std::string(BL_SHIFT_REGISTER_CHAIN_HEAD_NAME), region));
       BasicPort sr_head_port = module_manager.module_port(top_module, sr_head_port_id);
-      fp << generate_verilog_port(VERILOG_PORT_REG, sr_head_port) << ";" << std::endl;
+      fp << generate_verilog_port(VERILOG_PORT_REG, sr_head_port) << ";" << "\n";
 
       ModulePortId sr_tail_port_id = module_manager.find_module_port(top_module,
                                                                      generate_regional_blwl_port_name(std::string(BL_SHIFT_REGISTER_CHAIN_TAIL_NAME), region));
       BasicPort sr_tail_port = module_manager.module_port(top_module, sr_tail_port_id);
-      fp << generate_verilog_port(VERILOG_PORT_WIRE, sr_tail_port) << ";" << std::endl;
+      fp << generate_verilog_port(VERILOG_PORT_WIRE, sr_tail_port) << ";" << "\n";
     }
 
     /* BL Shift register clock and registers */
     BasicPort virtual_sr_clock_port(std::string(TOP_TB_VIRTUAL_BL_SHIFT_REGISTER_CLOCK_PORT_NAME), 1);
-    fp << generate_verilog_port(VERILOG_PORT_REG, virtual_sr_clock_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, virtual_sr_clock_port) << ";" << "\n";
     BasicPort sr_clock_port(std::string(TOP_TB_BL_SHIFT_REGISTER_CLOCK_PORT_NAME), 1);
-    fp << generate_verilog_port(VERILOG_PORT_REG, sr_clock_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, sr_clock_port) << ";" << "\n";
 
 
     /* Register to enable/disable bl/wl shift register clocks */
     BasicPort start_bl_sr_port(TOP_TB_START_BL_SHIFT_REGISTER_PORT_NAME, 1);
-    fp << generate_verilog_port(VERILOG_PORT_REG, start_bl_sr_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, start_bl_sr_port) << ";" << "\n";
     /* Register to count bl/wl shift register clocks */
-    fp << "integer " << TOP_TB_BL_SHIFT_REGISTER_COUNT_PORT_NAME << ";" << std::endl;
+    fp << "integer " << TOP_TB_BL_SHIFT_REGISTER_COUNT_PORT_NAME << ";" << "\n";
   }
 
   /* Print the address port for the Word-Line decoder here */
@@ -112,14 +112,14 @@ void print_verilog_top_testbench_ql_memory_bank_port(std::fstream& fp,
                                                                    std::string(DECODER_WL_ADDRESS_PORT_NAME));
     BasicPort wl_addr_port = module_manager.module_port(top_module, wl_addr_port_id);
 
-    fp << generate_verilog_port(VERILOG_PORT_REG, wl_addr_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, wl_addr_port) << ";" << "\n";
   } else if (BLWL_PROTOCOL_FLATTEN == config_protocol.wl_protocol_type()) {
     print_verilog_comment(fp, std::string("---- Word-Line ports -----"));
     for (const ConfigRegionId& region : module_manager.regions(top_module)) {
       ModulePortId wl_port_id = module_manager.find_module_port(top_module,
                                                                 generate_regional_blwl_port_name(std::string(MEMORY_WL_PORT_NAME), region));
       BasicPort wl_port = module_manager.module_port(top_module, wl_port_id);
-      fp << generate_verilog_port(VERILOG_PORT_REG, wl_port) << ";" << std::endl;
+      fp << generate_verilog_port(VERILOG_PORT_REG, wl_port) << ";" << "\n";
     }
   } else {
     VTR_ASSERT(BLWL_PROTOCOL_SHIFT_REGISTER == config_protocol.wl_protocol_type());
@@ -128,25 +128,25 @@ void print_verilog_top_testbench_ql_memory_bank_port(std::fstream& fp,
       ModulePortId sr_head_port_id = module_manager.find_module_port(top_module,
                                                                      generate_regional_blwl_port_name(std::string(WL_SHIFT_REGISTER_CHAIN_HEAD_NAME), region));
       BasicPort sr_head_port = module_manager.module_port(top_module, sr_head_port_id);
-      fp << generate_verilog_port(VERILOG_PORT_REG, sr_head_port) << ";" << std::endl;
+      fp << generate_verilog_port(VERILOG_PORT_REG, sr_head_port) << ";" << "\n";
 
       ModulePortId sr_tail_port_id = module_manager.find_module_port(top_module,
                                                                      generate_regional_blwl_port_name(std::string(WL_SHIFT_REGISTER_CHAIN_TAIL_NAME), region));
       BasicPort sr_tail_port = module_manager.module_port(top_module, sr_tail_port_id);
-      fp << generate_verilog_port(VERILOG_PORT_WIRE, sr_tail_port) << ";" << std::endl;
+      fp << generate_verilog_port(VERILOG_PORT_WIRE, sr_tail_port) << ";" << "\n";
     }
 
     /* WL Shift register clock and registers */
     BasicPort virtual_sr_clock_port(std::string(TOP_TB_VIRTUAL_WL_SHIFT_REGISTER_CLOCK_PORT_NAME), 1);
-    fp << generate_verilog_port(VERILOG_PORT_REG, virtual_sr_clock_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, virtual_sr_clock_port) << ";" << "\n";
     BasicPort sr_clock_port(std::string(TOP_TB_WL_SHIFT_REGISTER_CLOCK_PORT_NAME), 1);
-    fp << generate_verilog_port(VERILOG_PORT_REG, sr_clock_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, sr_clock_port) << ";" << "\n";
 
     /* Register to enable/disable bl/wl shift register clocks */
     BasicPort start_wl_sr_port(TOP_TB_START_WL_SHIFT_REGISTER_PORT_NAME, 1);
-    fp << generate_verilog_port(VERILOG_PORT_REG, start_wl_sr_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, start_wl_sr_port) << ";" << "\n";
     /* Register to count bl/wl shift register clocks */
-    fp << "integer " << TOP_TB_WL_SHIFT_REGISTER_COUNT_PORT_NAME << ";" << std::endl;
+    fp << "integer " << TOP_TB_WL_SHIFT_REGISTER_COUNT_PORT_NAME << ";" << "\n";
   }
 
   /* Print the data-input port: only available when BL has a decoder */
@@ -155,7 +155,7 @@ void print_verilog_top_testbench_ql_memory_bank_port(std::fstream& fp,
     ModulePortId din_port_id = module_manager.find_module_port(top_module,
                                                                std::string(DECODER_DATA_IN_PORT_NAME));
     BasicPort din_port = module_manager.module_port(top_module, din_port_id);
-    fp << generate_verilog_port(VERILOG_PORT_REG, din_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_REG, din_port) << ";" << "\n";
   }
 
   /* Print the optional readback port for the decoder here */
@@ -165,7 +165,7 @@ void print_verilog_top_testbench_ql_memory_bank_port(std::fstream& fp,
                                                                     std::string(DECODER_READBACK_PORT_NAME));
     if (readback_port_id) {
       BasicPort readback_port = module_manager.module_port(top_module, readback_port_id);
-      fp << generate_verilog_port(VERILOG_PORT_WIRE, readback_port) << ";" << std::endl;
+      fp << generate_verilog_port(VERILOG_PORT_WIRE, readback_port) << ";" << "\n";
       /* Disable readback in full testbenches */
       print_verilog_wire_constant_values(fp, readback_port, std::vector<size_t>(readback_port.get_width(), 0)); 
     }
@@ -176,7 +176,7 @@ void print_verilog_top_testbench_ql_memory_bank_port(std::fstream& fp,
                                                                  generate_regional_blwl_port_name(std::string(MEMORY_WLR_PORT_NAME), region));
       if (wlr_port_id) {
         BasicPort wlr_port = module_manager.module_port(top_module, wlr_port_id);
-        fp << generate_verilog_port(VERILOG_PORT_WIRE, wlr_port) << ";" << std::endl;
+        fp << generate_verilog_port(VERILOG_PORT_WIRE, wlr_port) << ";" << "\n";
         /* Disable readback in full testbenches */
         print_verilog_wire_constant_values(fp, wlr_port, std::vector<size_t>(wlr_port.get_width(), 0)); 
       }
@@ -197,8 +197,8 @@ void print_verilog_top_testbench_ql_memory_bank_port(std::fstream& fp,
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
 
-  fp << generate_verilog_port(VERILOG_PORT_WIRE, en_port) << ";" << std::endl;
-  fp << generate_verilog_port(VERILOG_PORT_REG, en_register_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_WIRE, en_port) << ";" << "\n";
+  fp << generate_verilog_port(VERILOG_PORT_REG, en_register_port) << ";" << "\n";
 
   write_tab_to_file(fp, 1);
   fp << "assign ";
@@ -207,7 +207,7 @@ void print_verilog_top_testbench_ql_memory_bank_port(std::fstream& fp,
   fp << "~" << generate_verilog_port(VERILOG_PORT_CONKT, en_register_port);
   fp << " & ";
   fp << "~" << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 }
 
 
@@ -266,15 +266,15 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_virtual_clock_ge
   fp << "always";
   fp << " @(posedge " << generate_verilog_port(VERILOG_PORT_CONKT, start_sr_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << generate_verilog_port_constant_values(sr_clock_port, std::vector<size_t>(sr_clock_port.get_width(), 0), true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "while (" << generate_verilog_port(VERILOG_PORT_CONKT, start_sr_port) << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << "#" << sr_clock_period << " ";
@@ -282,14 +282,14 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_virtual_clock_ge
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << generate_verilog_port_constant_values(sr_clock_port, std::vector<size_t>(sr_clock_port.get_width(), 0), true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 }
 
 
@@ -307,20 +307,20 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_clock_generator(
   fp << "always";
   fp << " @(posedge " << generate_verilog_port(VERILOG_PORT_CONKT, start_sr_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   /* Skip the first the clock cycle which is reserved for reset */
   fp << "\t";
-  fp << "#" << sr_clock_period * 2. << ";" << std::endl;
-  fp << std::endl;
+  fp << "#" << sr_clock_period * 2. << ";" << "\n";
+  fp << "\n";
 
   fp << "\t";
   fp << generate_verilog_port_constant_values(sr_clock_port, std::vector<size_t>(sr_clock_port.get_width(), 0), true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "while (" << generate_verilog_port(VERILOG_PORT_CONKT, start_sr_port) << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << "#" << sr_clock_period << " ";
@@ -328,14 +328,14 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_clock_generator(
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << generate_verilog_port_constant_values(sr_clock_port, std::vector<size_t>(sr_clock_port.get_width(), 0), true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 }
 
 /**
@@ -469,18 +469,16 @@ int print_verilog_top_testbench_configuration_protocol_ql_memory_bank_stimulus(s
 static 
 void print_verilog_full_testbench_ql_memory_bank_flatten_bitstream(std::fstream& fp,
                                                                    const std::string& bitstream_file,
-                                                                   const bool& fast_configuration,
-                                                                   const bool& bit_value_to_skip,
+                                                                   const FullTestbenchBitstreamLength& bitstream_length,
                                                                    const ModuleManager& module_manager,
-                                                                   const ModuleId& top_module,
-                                                                   const FabricBitstream& fabric_bitstream) {
+                                                                   const ModuleId& top_module) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
-  /* Reorganize the fabric bitstream by the same address across regions */
-  MemoryBankFlattenFabricBitstream fabric_bits_by_addr = build_memory_bank_flatten_fabric_bitstream(fabric_bitstream,
-                                                                                                    fast_configuration,
-                                                                                                    bit_value_to_skip);
+  /* The bitstream length is the size of the flatten fabric bitstream,
+   * which already excludes the data points skipped by fast configuration
+   */
+  VTR_ASSERT(0 == bitstream_length.num_bits_to_skip);
 
   /* Feed address and data input pair one by one
    * Note: the first cycle is reserved for programming reset
@@ -514,49 +512,49 @@ void print_verilog_full_testbench_ql_memory_bank_flatten_bitstream(std::fstream&
   std::vector<size_t> initial_wl_values(wl_port_width, 0);
 
   /* Define a constant for the bitstream length */
-  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), fabric_bits_by_addr.size()); 
+  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), bitstream_length.num_bits); 
   print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_WIDTH_VARIABLE), bl_port_width + wl_port_width); 
 
   /* Declare local variables for bitstream loading in Verilog */
   print_verilog_comment(fp, "----- Virtual memory to store the bitstream from external file -----");
   fp << "reg [0:`" << TOP_TB_BITSTREAM_WIDTH_VARIABLE << " - 1] ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[0:`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " - 1];";
-  fp << std::endl;
+  fp << "\n";
 
-  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << std::endl;
+  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << "\n";
 
   print_verilog_comment(fp, "----- Preload bitstream file to a virtual memory -----");
-  fp << "initial begin" << std::endl;
+  fp << "initial begin" << "\n";
   fp << "\t";
   fp << "$readmemb(\"" << bitstream_file << "\", " << TOP_TB_BITSTREAM_MEM_REG_NAME << ");";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Bit-Line Address port default input -----");
   fp << "\t";
   fp << generate_verilog_ports_constant_values(bl_ports, initial_bl_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Word-Line Address port default input -----");
   fp << "\t";
   fp << generate_verilog_ports_constant_values(wl_ports, initial_wl_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " <= 0";
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Begin bitstream loading during configuration phase -----");
   BasicPort prog_clock_port(std::string(TOP_TB_PROG_CLOCK_PORT_NAME) + std::string(TOP_TB_CLOCK_REG_POSTFIX), 1);
   fp << "always";
   fp << " @(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "if (";
@@ -564,17 +562,17 @@ void print_verilog_full_testbench_ql_memory_bank_flatten_bitstream(std::fstream&
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE;
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
   fp << "\t\t";
   std::vector<size_t> config_done_final_values(config_done_port.get_width(), 1);
   fp << generate_verilog_port_constant_values(config_done_port, config_done_final_values, true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end else begin";
-  fp << std::endl;
+  fp << "\n";
 
   std::vector<BasicPort> blwl_ports = bl_ports;
   blwl_ports.insert(blwl_ports.end(), wl_ports.begin(), wl_ports.end());
@@ -582,20 +580,20 @@ void print_verilog_full_testbench_ql_memory_bank_flatten_bitstream(std::fstream&
   fp << generate_verilog_ports(blwl_ports); 
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[" << TOP_TB_BITSTREAM_INDEX_REG_NAME << "]";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME;
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " + 1";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- End bitstream loading during configuration phase -----");
 }
@@ -667,32 +665,32 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[0:`";
   fp << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "*(`" << TOP_TB_BITSTREAM_BL_WORD_SIZE_VARIABLE;
   fp << " + `"<< TOP_TB_BITSTREAM_WL_WORD_SIZE_VARIABLE << ") - 1];";
-  fp << std::endl;
+  fp << "\n";
 
-  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << std::endl;
+  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << "\n";
 
   print_verilog_comment(fp, "----- Preload bitstream file to a virtual memory -----");
-  fp << "initial begin" << std::endl;
+  fp << "initial begin" << "\n";
   fp << "\t";
   fp << "$readmemb(\"" << bitstream_file << "\", " << TOP_TB_BITSTREAM_MEM_REG_NAME << ");";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Bit-Line head port default input -----");
   fp << "\t";
   fp << generate_verilog_ports_constant_values(bl_head_ports, initial_bl_head_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Word-Line head port default input -----");
   fp << "\t";
   fp << generate_verilog_ports_constant_values(wl_head_ports, initial_wl_head_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " <= 0";
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort start_bl_sr_port(TOP_TB_START_BL_SHIFT_REGISTER_PORT_NAME, 1);
   BasicPort start_wl_sr_port(TOP_TB_START_WL_SHIFT_REGISTER_PORT_NAME, 1);
@@ -700,12 +698,12 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << "\t";
   fp << generate_verilog_port_constant_values(start_bl_sr_port, std::vector<size_t>(start_bl_sr_port.get_width(), 0), true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << generate_verilog_port_constant_values(start_wl_sr_port, std::vector<size_t>(start_wl_sr_port.get_width(), 0), true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort bl_sr_clock_port(TOP_TB_BL_SHIFT_REGISTER_CLOCK_PORT_NAME, 1);
   BasicPort wl_sr_clock_port(TOP_TB_WL_SHIFT_REGISTER_CLOCK_PORT_NAME, 1);
@@ -713,12 +711,12 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << "\t";
   fp << generate_verilog_port_constant_values(bl_sr_clock_port, std::vector<size_t>(bl_sr_clock_port.get_width(), 0), true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << generate_verilog_port_constant_values(wl_sr_clock_port, std::vector<size_t>(wl_sr_clock_port.get_width(), 0), true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort virtual_bl_sr_clock_port(TOP_TB_VIRTUAL_BL_SHIFT_REGISTER_CLOCK_PORT_NAME, 1);
   BasicPort virtual_wl_sr_clock_port(TOP_TB_VIRTUAL_WL_SHIFT_REGISTER_CLOCK_PORT_NAME, 1);
@@ -726,15 +724,15 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << "\t";
   fp << generate_verilog_port_constant_values(virtual_bl_sr_clock_port, std::vector<size_t>(virtual_bl_sr_clock_port.get_width(), 0), true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << generate_verilog_port_constant_values(virtual_wl_sr_clock_port, std::vector<size_t>(virtual_wl_sr_clock_port.get_width(), 0), true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort prog_clock_port(std::string(TOP_TB_PROG_CLOCK_PORT_NAME) + std::string(TOP_TB_CLOCK_REG_POSTFIX), 1);
 
@@ -742,7 +740,7 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << "always";
   fp << " @(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   /* Finished all the configuration words, raise the configuration done signal */
   fp << "\t";
@@ -751,55 +749,55 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE;
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
   fp << "\t\t";
   std::vector<size_t> config_done_final_values(config_done_port.get_width(), 1);
   fp << generate_verilog_port_constant_values(config_done_port, config_done_final_values, true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end else begin";
-  fp << std::endl;
+  fp << "\n";
 
   /* When there are still configuration words to be load, start the BL and WL shift register clock */
   fp << "\t\t";
   fp << generate_verilog_port_constant_values(start_bl_sr_port, std::vector<size_t>(start_bl_sr_port.get_width(), 1), true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << generate_verilog_port_constant_values(start_wl_sr_port, std::vector<size_t>(start_wl_sr_port.get_width(), 1), true);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_BL_SHIFT_REGISTER_COUNT_PORT_NAME << " = 0;";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_WL_SHIFT_REGISTER_COUNT_PORT_NAME << " = 0;";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME;
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " + 1";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   /* Load data to BL shift register chains */
   fp << "always";
   fp << " @(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, virtual_bl_sr_clock_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "if (";
@@ -807,14 +805,14 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_BL_WORD_SIZE_VARIABLE << " - 1";
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << generate_verilog_port_constant_values(start_bl_sr_port, std::vector<size_t>(start_bl_sr_port.get_width(), 0), true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
-  fp << "end" << std::endl;
+  fp << "end" << "\n";
 
 
   fp << "\t";
@@ -823,39 +821,39 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_BL_WORD_SIZE_VARIABLE;
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_BL_SHIFT_REGISTER_COUNT_PORT_NAME << " = 0;";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
-  fp << "end else begin" << std::endl;
+  fp << "end else begin" << "\n";
 
   fp << "\t\t";
   fp << generate_verilog_ports(bl_head_ports); 
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[(";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << "-1)*(`" << TOP_TB_BITSTREAM_BL_WORD_SIZE_VARIABLE << " + `" << TOP_TB_BITSTREAM_WL_WORD_SIZE_VARIABLE << ") + " << TOP_TB_BL_SHIFT_REGISTER_COUNT_PORT_NAME;
-  fp << "];" << std::endl;
+  fp << "];" << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_BL_SHIFT_REGISTER_COUNT_PORT_NAME << " = ";
   fp << TOP_TB_BL_SHIFT_REGISTER_COUNT_PORT_NAME << " + 1;";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   /* Load data to WL shift register chains */
   fp << "always";
   fp << " @(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, virtual_wl_sr_clock_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "if (";
@@ -863,14 +861,14 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_WL_WORD_SIZE_VARIABLE << " - 1";
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << generate_verilog_port_constant_values(start_wl_sr_port, std::vector<size_t>(start_wl_sr_port.get_width(), 0), true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
-  fp << "end" << std::endl;
+  fp << "end" << "\n";
 
   fp << "\t";
   fp << "if (";
@@ -878,33 +876,33 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_WL_WORD_SIZE_VARIABLE;
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_WL_SHIFT_REGISTER_COUNT_PORT_NAME << " = 0;";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
-  fp << "end else begin" << std::endl;
+  fp << "end else begin" << "\n";
 
   fp << "\t\t";
   fp << generate_verilog_ports(wl_head_ports); 
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[(";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << "-1)*(`" << TOP_TB_BITSTREAM_BL_WORD_SIZE_VARIABLE << " + `" << TOP_TB_BITSTREAM_WL_WORD_SIZE_VARIABLE << ") + `" << TOP_TB_BITSTREAM_BL_WORD_SIZE_VARIABLE << " + " << TOP_TB_WL_SHIFT_REGISTER_COUNT_PORT_NAME;
-  fp << "];" << std::endl;
+  fp << "];" << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_WL_SHIFT_REGISTER_COUNT_PORT_NAME << " = ";
   fp << TOP_TB_WL_SHIFT_REGISTER_COUNT_PORT_NAME << " + 1;";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- End bitstream loading during configuration phase -----");
 }
@@ -914,23 +912,16 @@ void print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(std::f
 static 
 void print_verilog_full_testbench_ql_memory_bank_decoder_bitstream(std::fstream& fp,
                                                                    const std::string& bitstream_file,
-                                                                   const bool& fast_configuration,
-                                                                   const bool& bit_value_to_skip,
+                                                                   const FullTestbenchBitstreamLength& bitstream_length,
                                                                    const ModuleManager& module_manager,
-                                                                   const ModuleId& top_module,
-                                                                   const FabricBitstream& fabric_bitstream) {
+                                                                   const ModuleId& top_module) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
-  /* Reorganize the fabric bitstream by the same address across regions */
-  MemoryBankFabricBitstream fabric_bits_by_addr = build_memory_bank_fabric_bitstream_by_address(fabric_bitstream);
-
-  /* For fast configuration, identify the final bitstream size to be used */
-  size_t num_bits_to_skip = 0;
-  if (true == fast_configuration) {
-    num_bits_to_skip = fabric_bits_by_addr.size() - find_memory_bank_fast_configuration_fabric_bitstream_size(fabric_bitstream, bit_value_to_skip);
-  }
-  VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
+  /* The bitstream length is the size of the fabric bitstream reorganized by address.
+   * For fast configuration, the data points to be skipped are excluded
+   */
+  VTR_ASSERT(bitstream_length.num_bits_to_skip < bitstream_length.num_bits);
 
   /* Feed address and data input pair one by one
    * Note: the first cycle is reserved for programming reset
@@ -952,55 +943,55 @@ void print_verilog_full_testbench_ql_memory_bank_decoder_bitstream(std::fstream&
   std::vector<size_t> initial_din_values(din_port.get_width(), 0);
 
   /* Define a constant for the bitstream length */
-  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), fabric_bits_by_addr.size() - num_bits_to_skip); 
+  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE), bitstream_length.num_bits - bitstream_length.num_bits_to_skip); 
   print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_WIDTH_VARIABLE), bl_addr_port.get_width() + wl_addr_port.get_width() + din_port.get_width()); 
 
   /* Declare local variables for bitstream loading in Verilog */
   print_verilog_comment(fp, "----- Virtual memory to store the bitstream from external file -----");
   fp << "reg [0:`" << TOP_TB_BITSTREAM_WIDTH_VARIABLE << " - 1] ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[0:`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " - 1];";
-  fp << std::endl;
+  fp << "\n";
 
-  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << std::endl;
+  fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << ";" << "\n";
 
   print_verilog_comment(fp, "----- Preload bitstream file to a virtual memory -----");
-  fp << "initial begin" << std::endl;
+  fp << "initial begin" << "\n";
   fp << "\t";
   fp << "$readmemb(\"" << bitstream_file << "\", " << TOP_TB_BITSTREAM_MEM_REG_NAME << ");";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Bit-Line Address port default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(bl_addr_port, initial_bl_addr_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Word-Line Address port default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(wl_addr_port, initial_wl_addr_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Data-input port default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(din_port, initial_din_values);
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " <= 0";
   fp << ";";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- Begin bitstream loading during configuration phase -----");
   BasicPort prog_clock_port(std::string(TOP_TB_PROG_CLOCK_PORT_NAME) + std::string(TOP_TB_CLOCK_REG_POSTFIX), 1);
   fp << "always";
   fp << " @(negedge " << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ")"; 
   fp << " begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t";
   fp << "if (";
@@ -1008,17 +999,17 @@ void print_verilog_full_testbench_ql_memory_bank_decoder_bitstream(std::fstream&
   fp << " >= ";
   fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE;
   fp << ") begin";
-  fp << std::endl;
+  fp << "\n";
 
   BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
   fp << "\t\t";
   std::vector<size_t> config_done_final_values(config_done_port.get_width(), 1);
   fp << generate_verilog_port_constant_values(config_done_port, config_done_final_values, true);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end else begin";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "\t\t";
   fp << "{";
@@ -1030,20 +1021,20 @@ void print_verilog_full_testbench_ql_memory_bank_decoder_bitstream(std::fstream&
   fp << "}";
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[" << TOP_TB_BITSTREAM_INDEX_REG_NAME << "]";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t\t";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME;
   fp << " <= ";
   fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << " + 1";
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   fp << "\t";
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   fp << "end";
-  fp << std::endl;
+  fp << "\n";
 
   print_verilog_comment(fp, "----- End bitstream loading during configuration phase -----");
 }
@@ -1053,6 +1044,7 @@ void print_verilog_full_testbench_ql_memory_bank_bitstream(std::fstream& fp,
                                                            const ConfigProtocol& config_protocol,
                                                            const bool& fast_configuration,
                                                            const bool& bit_value_to_skip,
+                                                           const FullTestbenchBitstreamLength& bitstream_length,
                                                            const ModuleManager& module_manager,
                                                            const ModuleId& top_module,
                                                            const FabricBitstream& fabric_bitstream,
@@ -1060,17 +1052,13 @@ void print_verilog_full_testbench_ql_memory_bank_bitstream(std::fstream& fp,
   if ( (BLWL_PROTOCOL_DECODER == config_protocol.bl_protocol_type())
     && (BLWL_PROTOCOL_DECODER == config_protocol.wl_protocol_type()) ) {
     print_verilog_full_testbench_ql_memory_bank_decoder_bitstream(fp, bitstream_file,
-                                                                  fast_configuration, 
-                                                                  bit_value_to_skip,
-                                                                  module_manager, top_module,
-                                                                  fabric_bitstream);
+                                                                  bitstream_length,
+                                                                  module_manager, top_module);
   } else if ( (BLWL_PROTOCOL_FLATTEN == config_protocol.bl_protocol_type())
            && (BLWL_PROTOCOL_FLATTEN == config_protocol.wl_protocol_type()) ) {
     print_verilog_full_testbench_ql_memory_bank_flatten_bitstream(fp, bitstream_file,
-                                                                  fast_configuration, 
-                                                                  bit_value_to_skip,
-                                                                  module_manager, top_module,
-                                                                  fabric_bitstream);
+                                                                  bitstream_length,
+                                                                  module_manager, top_module);
   } else if ( (BLWL_PROTOCOL_SHIFT_REGISTER == config_protocol.bl_protocol_type())
            && (BLWL_PROTOCOL_SHIFT_REGISTER == config_protocol.wl_protocol_type()) ) {
     print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(fp, bitstream_file,
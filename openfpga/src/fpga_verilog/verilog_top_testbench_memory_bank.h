@@ -58,6 +58,16 @@ int print_verilog_top_testbench_configuration_protocol_ql_memory_bank_stimulus(s
                                                                                const float& prog_clock_period,
                                                                                const float& timescale);
 
+/**
+ * @brief Length of the bitstream loaded by the full testbench, i.e.,
+ *        the number of programming clock cycles except the reset cycle,
+ *        and the number of bits which are skipped by fast configuration
+ */
+struct FullTestbenchBitstreamLength {
+  size_t num_bits = 0;
+  size_t num_bits_to_skip = 0;
+};
+
 /**
  * @brief Print stimulus for a FPGA fabric with a memory bank configuration protocol
  *        where configuration bits are programming in serial (one by one)
@@ -67,6 +77,7 @@ void print_verilog_full_testbench_ql_memory_bank_bitstream(std::fstream& fp,
                                                            const ConfigProtocol& config_protocol,
                                                            const bool& fast_configuration,
                                                            const bool& bit_value_to_skip,
+                                                           const FullTestbenchBitstreamLength& bitstream_length,
                                                            const ModuleManager& module_manager,
                                                            const ModuleId& top_module,
                                                            const FabricBitstream& fabric_bitstream,
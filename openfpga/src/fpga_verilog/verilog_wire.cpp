@@ -11,6 +11,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "module_manager.h"
 #include "module_manager_utils.h"
@@ -74,8 +75,8 @@ void print_verilog_wire_module(const ModuleManager& module_manager,
   BasicPort module_output_port = module_manager.module_port(wire_module, module_output_port_id);
 
   /* Print wire declaration for the inputs and outputs */
-  fp << generate_verilog_port(VERILOG_PORT_WIRE, module_input_port) << ";" << std::endl;
-  fp << generate_verilog_port(VERILOG_PORT_WIRE, module_output_port) << ";" << std::endl;
+  fp << generate_verilog_port(VERILOG_PORT_WIRE, module_input_port) << ";" << "\n";
+  fp << generate_verilog_port(VERILOG_PORT_WIRE, module_output_port) << ";" << "\n";
 
   /* Direct shortcut */
   print_verilog_wire_connection(fp, module_output_port, module_input_port, false);
@@ -87,7 +88,7 @@ void print_verilog_wire_module(const ModuleManager& module_manager,
   print_verilog_module_end(fp, circuit_lib.model_name(wire_model));
 
   /* Add an empty line as a splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -103,8 +104,8 @@ void print_verilog_submodule_wires(const ModuleManager& module_manager,
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
   check_file_stream(verilog_fpath.c_str(), fp);
 
@@ -126,7 +127,7 @@ void print_verilog_submodule_wires(const ModuleManager& module_manager,
   print_verilog_comment(fp, std::string("----- END Verilog modules for regular wires -----"));
 
   /* Close the file stream */
-  fp.close();
+  fp.close_file();
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
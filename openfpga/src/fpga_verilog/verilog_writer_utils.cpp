@@ -17,6 +17,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_buffered_fstream.h"
 
 #include "openfpga_naming.h"
 #include "circuit_library_utils.h"
@@ -33,9 +34,9 @@ void print_verilog_default_net_type_declaration(std::fstream& fp,
                                                 const e_verilog_default_net_type& default_net_type) {
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << "//----- Default net type -----" << std::endl;
-  fp << "`default_nettype " << VERILOG_DEFAULT_NET_TYPE_STRING[default_net_type] << std::endl;
-  fp << std::endl;
+  fp << "//----- Default net type -----" << "\n";
+  fp << "`default_nettype " << VERILOG_DEFAULT_NET_TYPE_STRING[default_net_type] << "\n";
+  fp << "\n";
 }
 
 /************************************************
@@ -47,11 +48,11 @@ void print_verilog_file_header(std::fstream& fp,
                                const bool& include_time_stamp) {
   VTR_ASSERT(true == valid_file_stream(fp));
  
-  fp << "//-------------------------------------------" << std::endl;
-  fp << "//\tFPGA Synthesizable Verilog Netlist" << std::endl;
-  fp << "//\tDescription: " << usage << std::endl;
-  fp << "//\tAuthor: Xifan TANG" << std::endl;
-  fp << "//\tOrganization: University of Utah" << std::endl;
+  fp << "//-------------------------------------------" << "\n";
+  fp << "//\tFPGA Synthesizable Verilog Netlist" << "\n";
+  fp << "//\tDescription: " << usage << "\n";
+  fp << "//\tAuthor: Xifan TANG" << "\n";
+  fp << "//\tOrganization: University of Utah" << "\n";
 
   if (include_time_stamp) {
     auto end = std::chrono::system_clock::now(); 
@@ -59,11 +60,11 @@ void print_verilog_file_header(std::fstream& fp,
     fp << "//\tDate: " << std::ctime(&end_time) ;
   }
 
-  fp << "//-------------------------------------------" << std::endl;
+  fp << "//-------------------------------------------" << "\n";
 
-  fp << "//----- Time scale -----" << std::endl;
-  fp << "`timescale 1ns / 1ps" << std::endl;
-  fp << std::endl;
+  fp << "//----- Time scale -----" << "\n";
+  fp << "`timescale 1ns / 1ps" << "\n";
+  fp << "\n";
 }
 
 /********************************************************************
@@ -73,7 +74,7 @@ void print_verilog_include_netlist(std::fstream& fp,
                                    const std::string& netlist_name) {
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << "`include \"" << netlist_name << "\"" << std::endl; 
+  fp << "`include \"" << netlist_name << "\"" << "\n"; 
 }
 
 /********************************************************************
@@ -84,7 +85,7 @@ void print_verilog_define_flag(std::fstream& fp,
                                const int& flag_value) {
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << "`define " << flag_name << " " << flag_value << std::endl; 
+  fp << "`define " << flag_name << " " << flag_value << "\n"; 
 }
 
 /************************************************
@@ -107,7 +108,7 @@ void print_verilog_comment(std::fstream& fp,
                            const std::string& comment) {
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << "// " << comment << std::endl;
+  fp << "// " << comment << "\n";
 }
 
 /************************************************
@@ -117,7 +118,7 @@ void print_verilog_preprocessing_flag(std::fstream& fp,
                                       const std::string& preproc_flag) {
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << "`ifdef " << preproc_flag << std::endl;
+  fp << "`ifdef " << preproc_flag << "\n";
 }
 
 /************************************************
@@ -126,7 +127,7 @@ void print_verilog_preprocessing_flag(std::fstream& fp,
 void print_verilog_endif(std::fstream& fp) {
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << "`endif" << std::endl;
+  fp << "`endif" << "\n";
 }
 
 /************************************************
@@ -161,7 +162,7 @@ void print_verilog_module_definition(std::fstream& fp,
     for (const auto& port : module_manager.module_ports_by_type(module_id, kv.first)) {
       if (0 != port_cnt) {
         /* Do not dump a comma for the first port */
-        fp << "," << std::endl; 
+        fp << "," << "\n"; 
       }
 
       if (true == printed_ifdef) {
@@ -194,7 +195,7 @@ void print_verilog_module_definition(std::fstream& fp,
       port_cnt++;
     }
   }
-  fp << ");" << std::endl;
+  fp << ");" << "\n";
 }
 
 /************************************************
@@ -230,9 +231,9 @@ void print_verilog_module_ports(std::fstream& fp,
       }
 
       /* Print port */
-      fp << "//----- " << module_manager.module_port_type_str(kv.first)  << " -----" << std::endl; 
+      fp << "//----- " << module_manager.module_port_type_str(kv.first)  << " -----" << "\n"; 
       fp << generate_verilog_port(kv.second, port);
-      fp << ";" << std::endl;
+      fp << ";" << "\n";
 
       if (false == preproc_flag.empty()) {
         /* Print an endif to pair the ifdef */
@@ -243,8 +244,8 @@ void print_verilog_module_ports(std::fstream& fp,
 
   /* Output any port that is also wire connection when default net type is not wire! */
   if (VERILOG_DEFAULT_NET_TYPE_WIRE != default_net_type) {
-    fp << std::endl;
-    fp << "//----- BEGIN wire-connection ports -----" << std::endl; 
+    fp << "\n";
+    fp << "//----- BEGIN wire-connection ports -----" << "\n"; 
     for (const auto& kv : port_type2type_map) {
       for (const auto& port : module_manager.module_ports_by_type(module_id, kv.first)) {
         /* Skip the ports that are not registered */
@@ -263,7 +264,7 @@ void print_verilog_module_ports(std::fstream& fp,
 
         /* Print port */
         fp << generate_verilog_port(VERILOG_PORT_WIRE, port);
-        fp << ";" << std::endl;
+        fp << ";" << "\n";
 
         if (false == preproc_flag.empty()) {
           /* Print an endif to pair the ifdef */
@@ -271,13 +272,13 @@ void print_verilog_module_ports(std::fstream& fp,
         }
       }
     }
-    fp << "//----- END wire-connection ports -----" << std::endl; 
-    fp << std::endl;
+    fp << "//----- END wire-connection ports -----" << "\n"; 
+    fp << "\n";
   }
  
   /* Output any port that is registered */
-  fp << std::endl;
-  fp << "//----- BEGIN Registered ports -----" << std::endl; 
+  fp << "\n";
+  fp << "//----- BEGIN Registered ports -----" << "\n"; 
   for (const auto& kv : port_type2type_map) {
     for (const auto& port : module_manager.module_ports_by_type(module_id, kv.first)) {
       /* Skip the ports that are not registered */
@@ -296,7 +297,7 @@ void print_verilog_module_ports(std::fstream& fp,
 
       /* Print port */
       fp << generate_verilog_port(VERILOG_PORT_REG, port);
-      fp << ";" << std::endl;
+      fp << ";" << "\n";
 
       if (false == preproc_flag.empty()) {
         /* Print an endif to pair the ifdef */
@@ -304,8 +305,8 @@ void print_verilog_module_ports(std::fstream& fp,
       }
     }
   }
-  fp << "//----- END Registered ports -----" << std::endl; 
-  fp << std::endl;
+  fp << "//----- END Registered ports -----" << "\n"; 
+  fp << "\n";
 }
 
 /************************************************
@@ -368,7 +369,7 @@ void print_verilog_module_instance(std::fstream& fp,
   /* Print module name */
   fp << "\t" << module_manager.module_name(module_id) << " ";
   /* Print instance name */
-  fp << instance_name << " (" << std::endl;
+  fp << instance_name << " (" << "\n";
   
   /* Print each port with/without explicit port map */
   /* port type2type mapping */
@@ -388,7 +389,7 @@ void print_verilog_module_instance(std::fstream& fp,
     for (const auto& port : module_manager.module_ports_by_type(module_id, kv.first)) {
       if (0 != port_cnt) {
         /* Do not dump a comma for the first port */
-        fp << "," << std::endl; 
+        fp << "," << "\n"; 
       }
       /* Print port */
       fp << "\t\t";
@@ -418,7 +419,7 @@ void print_verilog_module_instance(std::fstream& fp,
   }
   
   /* Print an end to the instance */
-  fp << ");" << std::endl;
+  fp << ");" << "\n";
 }
 
 
@@ -452,9 +453,9 @@ void print_verilog_module_end(std::fstream& fp,
                               const std::string& module_name) {
   VTR_ASSERT(true == valid_file_stream(fp));
 
-  fp << "endmodule" << std::endl;
+  fp << "endmodule" << "\n";
   print_verilog_comment(fp, std::string("----- END Verilog module for " + module_name + " -----"));
-  fp << std::endl;
+  fp << "\n";
 
   /* Reset default net type to be none */
   print_verilog_default_net_type_declaration(fp,
@@ -786,7 +787,7 @@ void print_verilog_wire_constant_values(std::fstream& fp,
   fp << "\t";
   fp << "assign ";
   fp << generate_verilog_port_constant_values(output_port, const_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 }
 
 /********************************************************************
@@ -803,7 +804,7 @@ void print_verilog_deposit_wire_constant_values(std::fstream& fp,
   fp << generate_verilog_port(VERILOG_PORT_CONKT, output_port);
   fp << ", ";
   fp << generate_verilog_constant_values(const_values);
-  fp << ");" << std::endl;
+  fp << ");" << "\n";
 }
 
 /********************************************************************
@@ -819,7 +820,7 @@ void print_verilog_force_wire_constant_values(std::fstream& fp,
   fp << "\t";
   fp << "force ";
   fp << generate_verilog_port_constant_values(output_port, const_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 }
 
 /********************************************************************
@@ -846,7 +847,7 @@ void print_verilog_wire_connection(std::fstream& fp,
   }
 
   fp << generate_verilog_port(VERILOG_PORT_CONKT, input_port);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 }
 
 /********************************************************************
@@ -872,7 +873,7 @@ void print_verilog_register_connection(std::fstream& fp,
   }
 
   fp << generate_verilog_port(VERILOG_PORT_CONKT, input_port);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 }
 
 
@@ -1028,7 +1029,7 @@ void print_verilog_local_sram_wires(std::fstream& fp,
     /* Generate the name of local wire for the CCFF inputs, CCFF output and inverted output */
     /* [0] => CCFF input */
     BasicPort ccff_config_bus_port(generate_local_config_bus_port_name(), port_size);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, ccff_config_bus_port) << ";" << std::endl; 
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, ccff_config_bus_port) << ";" << "\n"; 
     /* Connect first CCFF to the head */
     /* Head is always a 1-bit port */
     BasicPort ccff_head_port(generate_sram_port_name(sram_orgz_type, CIRCUIT_MODEL_PORT_INPUT), 1); 
@@ -1051,7 +1052,7 @@ void print_verilog_local_sram_wires(std::fstream& fp,
     sram_ports.push_back(BasicPort(generate_sram_local_port_name(circuit_lib, sram_model, sram_orgz_type, CIRCUIT_MODEL_PORT_OUTPUT), port_size));
     /* Print local wire definition */
     for (const auto& sram_port : sram_ports) {
-      fp << generate_verilog_port(VERILOG_PORT_WIRE, sram_port) << ";" << std::endl; 
+      fp << generate_verilog_port(VERILOG_PORT_WIRE, sram_port) << ";" << "\n"; 
     }
 
     break;
@@ -1140,10 +1141,10 @@ void print_verilog_local_config_bus(std::fstream& fp,
      */
     BasicPort config_port(generate_local_sram_port_name(prefix, instance_id, CIRCUIT_MODEL_PORT_INPUT), 
                           num_conf_bits);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, config_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, config_port) << ";" << "\n";
     BasicPort inverted_config_port(generate_local_sram_port_name(prefix, instance_id, CIRCUIT_MODEL_PORT_OUTPUT), 
                                    num_conf_bits); 
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, inverted_config_port) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, inverted_config_port) << ";" << "\n";
     break;
   }
   default:
@@ -1212,26 +1213,26 @@ void print_verilog_rram_mux_config_bus(std::fstream& fp,
     /* Print configuration bus to group reserved BL/WLs */
     BasicPort reserved_bl_bus(generate_reserved_sram_port_name(CIRCUIT_MODEL_PORT_BL), 
                               num_reserved_conf_bits);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, reserved_bl_bus) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, reserved_bl_bus) << ";" << "\n";
     BasicPort reserved_wl_bus(generate_reserved_sram_port_name(CIRCUIT_MODEL_PORT_WL), 
                               num_reserved_conf_bits);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, reserved_wl_bus) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, reserved_wl_bus) << ";" << "\n";
 
     /* Print configuration bus to group BL/WLs */
     BasicPort bl_bus(generate_mux_config_bus_port_name(circuit_lib, mux_model, mux_size, 0, false), 
                      num_conf_bits + num_reserved_conf_bits);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, bl_bus) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, bl_bus) << ";" << "\n";
     BasicPort wl_bus(generate_mux_config_bus_port_name(circuit_lib, mux_model, mux_size, 1, false), 
                      num_conf_bits + num_reserved_conf_bits);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, wl_bus) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, wl_bus) << ";" << "\n";
 
     /* Print bus to group SRAM outputs, this is to interface memory cells to routing multiplexers */
     BasicPort sram_output_bus(generate_mux_sram_port_name(circuit_lib, mux_model, mux_size, mux_instance_id, CIRCUIT_MODEL_PORT_INPUT), 
                           num_conf_bits);
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, sram_output_bus) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, sram_output_bus) << ";" << "\n";
     BasicPort inverted_sram_output_bus(generate_mux_sram_port_name(circuit_lib, mux_model, mux_size, mux_instance_id, CIRCUIT_MODEL_PORT_OUTPUT), 
                                        num_conf_bits); 
-    fp << generate_verilog_port(VERILOG_PORT_WIRE, inverted_sram_output_bus) << ";" << std::endl;
+    fp << generate_verilog_port(VERILOG_PORT_WIRE, inverted_sram_output_bus) << ";" << "\n";
 
     /* Get the SRAM model of the mux_model */
     std::vector<CircuitModelId> sram_models = find_circuit_sram_models(circuit_lib, mux_model);
@@ -1351,13 +1352,13 @@ void print_verilog_pulse_stimuli(std::fstream& fp,
   VTR_ASSERT(true == valid_file_stream(fp));
 
   /* Config_done signal: indicate when configuration is finished */
-  fp << "initial" << std::endl;
-  fp << "\tbegin" << std::endl;
+  fp << "initial" << "\n";
+  fp << "\tbegin" << "\n";
   fp << "\t";
   std::vector<size_t> initial_values(port.get_width(), initial_value);
   fp << "\t";
   fp << generate_verilog_port_constant_values(port, initial_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
   
   /* if flip_value is the same as initial value, we do not need to flip the signal ! */
   if (flip_value != initial_value) {
@@ -1365,13 +1366,13 @@ void print_verilog_pulse_stimuli(std::fstream& fp,
     std::vector<size_t> port_flip_values(port.get_width(), flip_value);
     fp << "\t";
     fp << generate_verilog_port_constant_values(port, port_flip_values);
-    fp << ";" << std::endl;
+    fp << ";" << "\n";
   }
 
-  fp << "\tend" << std::endl;
+  fp << "\tend" << "\n";
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 
@@ -1394,21 +1395,21 @@ void print_verilog_shifted_clock_stimuli(std::fstream& fp,
   VTR_ASSERT(true == valid_file_stream(fp));
 
   /* Config_done signal: indicate when configuration is finished */
-  fp << "initial" << std::endl;
+  fp << "initial" << "\n";
 
   write_tab_to_file(fp, 1);
-  fp << "begin" << std::endl;
+  fp << "begin" << "\n";
 
   write_tab_to_file(fp, 1);
   std::vector<size_t> initial_values(port.get_width(), initial_value);
 
   write_tab_to_file(fp, 1);
   fp << generate_verilog_port_constant_values(port, initial_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   write_tab_to_file(fp, 2);
   fp << "#" << std::setprecision(10) << initial_delay;
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   write_tab_to_file(fp, 2);
   fp << "forever "; 
@@ -1416,13 +1417,13 @@ void print_verilog_shifted_clock_stimuli(std::fstream& fp,
   fp << " = "; 
   fp << "#" << std::setprecision(10) << pulse_width;
   fp << " ~" << generate_verilog_port(VERILOG_PORT_CONKT, port);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
   
   write_tab_to_file(fp, 1);
-  fp << "end" << std::endl;
+  fp << "end" << "\n";
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -1446,17 +1447,17 @@ void print_verilog_pulse_stimuli(std::fstream& fp,
   VTR_ASSERT(true == valid_file_stream(fp));
 
   /* Config_done signal: indicate when configuration is finished */
-  fp << "initial" << std::endl;
-  fp << "\tbegin" << std::endl;
+  fp << "initial" << "\n";
+  fp << "\tbegin" << "\n";
   fp << "\t";
   std::vector<size_t> initial_values(port.get_width(), initial_value);
   fp << "\t";
   fp << generate_verilog_port_constant_values(port, initial_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
   /* Set a wait condition if specified */
   if (false == wait_condition.empty()) {
-    fp << "\twait(" << wait_condition << ")" << std::endl;
+    fp << "\twait(" << wait_condition << ")" << "\n";
   }
   
   /* Number of flip conditions and values should match */
@@ -1466,13 +1467,13 @@ void print_verilog_pulse_stimuli(std::fstream& fp,
     std::vector<size_t> port_flip_value(port.get_width(), flip_values[ipulse]);
     fp << "\t";
     fp << generate_verilog_port_constant_values(port, port_flip_value);
-    fp << ";" << std::endl;
+    fp << ";" << "\n";
   }
 
-  fp << "\tend" << std::endl;
+  fp << "\tend" << "\n";
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -1496,25 +1497,25 @@ void print_verilog_clock_stimuli(std::fstream& fp,
   VTR_ASSERT(true == valid_file_stream(fp));
 
   /* Config_done signal: indicate when configuration is finished */
-  fp << "initial" << std::endl;
-  fp << "\tbegin" << std::endl;
+  fp << "initial" << "\n";
+  fp << "\tbegin" << "\n";
 
   std::vector<size_t> initial_values(port.get_width(), initial_value);
   fp << "\t\t";
   fp << generate_verilog_port_constant_values(port, initial_values);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
-  fp << "\tend" << std::endl;
+  fp << "\tend" << "\n";
   fp << "always";
 
   /* Set a wait condition if specified */
   if (true == wait_condition.empty()) {
-    fp << std::endl;
+    fp << "\n";
   } else {
-    fp << " wait(" << wait_condition << ")" << std::endl;
+    fp << " wait(" << wait_condition << ")" << "\n";
   }
 
-  fp << "\tbegin" << std::endl;
+  fp << "\tbegin" << "\n";
   fp << "\t\t" << "#" << std::setprecision(10) << pulse_width;
 
   fp << "\t";
@@ -1522,12 +1523,12 @@ void print_verilog_clock_stimuli(std::fstream& fp,
   fp << " = ";
   fp << "~";
   fp << generate_verilog_port(VERILOG_PORT_CONKT, port);
-  fp << ";" << std::endl;
+  fp << ";" << "\n";
 
-  fp << "\tend" << std::endl;
+  fp << "\tend" << "\n";
 
   /* Print an empty line as splitter */
-  fp << std::endl;
+  fp << "\n";
 }
 
 /********************************************************************
@@ -1542,8 +1543,8 @@ void print_verilog_netlist_include_header_file(const std::vector<std::string>& n
   std::string verilog_fname(std::string(subckt_dir) + std::string(header_file_name));
 
   /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
+  BufferedFstream fp;
+  fp.open_file(verilog_fname, std::fstream::out | std::fstream::trunc);
 
   VTR_ASSERT(true == valid_file_stream(fp));
 
@@ -1552,11 +1553,11 @@ void print_verilog_netlist_include_header_file(const std::vector<std::string>& n
 
   /* Output file names */
   for (const std::string& netlist_name : netlists_to_be_included) {
-    fp << "`include \"" << netlist_name << "\"" << std::endl;
+    fp << "`include \"" << netlist_name << "\"" << "\n";
   }
 
   /* close file stream */
-  fp.close();
+  fp.close_file();
 }
 
 } /* end namespace openfpga */
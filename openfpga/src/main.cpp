@@ -45,6 +45,12 @@ int main(int argc, char** argv) {
   openfpga::CommandOptionId opt_batch_exec = start_cmd.add_option("batch_execution", false, "Launch OpenFPGA in batch  mode when running scripts");
   start_cmd.set_option_short_name(opt_batch_exec, "batch");
 
+  /* '--server': launch the server mode on a UNIX socket.
+   * The script of the script mode, if any, is executed first to build the fabric
+   */
+  openfpga::CommandOptionId opt_server_mode = start_cmd.add_option("server", false, "Launch OpenFPGA in server mode, listening to a UNIX socket");
+  start_cmd.set_option_require_value(opt_server_mode, openfpga::OPT_STRING);
+
   /* '--version', -v': print version information */
   openfpga::CommandOptionId opt_version = start_cmd.add_option("version", false, "Show OpenFPGA version");
   start_cmd.set_option_short_name(opt_version, "v");
@@ -114,6 +120,21 @@ int main(int argc, char** argv) {
       return shell.exit_code();
     } 
 
+    if (true == start_cmd_context.option_enable(start_cmd, opt_server_mode)) {
+      /* The fabric is built by the script in batch mode, before any session */
+      if (true == start_cmd_context.option_enable(start_cmd, opt_script_mode)) {
+        shell.run_script_mode(start_cmd_context.option_value(start_cmd, opt_script_mode).c_str(),
+                              openfpga_context,
+                              true);
+      }
+      if (false == shell.run_server_mode(start_cmd_context.option_value(start_cmd, opt_server_mode).c_str(),
+                                         openfpga_context,
+                                         [](OpenfpgaContext& context) { context.reset_design_data(); })) {
+        return 1;
+      }
+      return shell.exit_code();
+    }
+
     if (true == start_cmd_context.option_enable(start_cmd, opt_script_mode)) {
       shell.run_script_mode(start_cmd_context.option_value(start_cmd, opt_script_mode).c_str(),
                             openfpga_context,
@@ -3,7 +3,6 @@
  * data structures in mux_graph.h
  *************************************************/
 #include <cmath>
-#include <list>
 #include <map>
 #include <algorithm>
 
@@ -63,7 +62,7 @@ std::vector<MuxNodeId> MuxGraph::non_input_nodes() const {
         continue;
       }
       /* Reach here, this is either an OUTPUT or INTERNAL node */ 
-      for (auto node : node_lookup_[level][node_type]) { 
+      for (auto node : nodes_by_type(e_mux_graph_node_type(node_type), level)) { 
         node_list.push_back(node); 
       }
     }
@@ -104,48 +103,28 @@ std::vector<size_t> MuxGraph::node_levels() const {
 size_t MuxGraph::num_inputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Sum up the number of INPUT nodes in each level */
-  size_t num_inputs = 0;
-  for (auto node_per_level : node_lookup_) {
-    num_inputs += node_per_level[MUX_INPUT_NODE].size();
-  }
-  return num_inputs;
+  return input_nodes_.size();
 }
 
-/* Return the node ids of all the inputs of the multiplexer */
-std::vector<MuxNodeId> MuxGraph::inputs() const {
-  std::vector<MuxNodeId> input_nodes; 
+/* Return the node ids of all the inputs of the multiplexer, level by level */
+MuxGraph::node_range MuxGraph::inputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Add the input nodes in each level */
-  for (auto node_per_level : node_lookup_) {
-    input_nodes.insert(input_nodes.end(), node_per_level[MUX_INPUT_NODE].begin(), node_per_level[MUX_INPUT_NODE].end());
-  }
-  return input_nodes;
+  return nodes_by_type(MUX_INPUT_NODE);
 }
 
 /* Find the number of outputs in the MUX graph */
 size_t MuxGraph::num_outputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Sum up the number of INPUT nodes in each level */
-  size_t num_outputs = 0;
-  for (auto node_per_level : node_lookup_) {
-    num_outputs += node_per_level[MUX_OUTPUT_NODE].size();
-  }
-  return num_outputs;
+  return nodes_by_type(MUX_OUTPUT_NODE).size();
 }
 
-/* Return the node ids of all the outputs of the multiplexer */
-std::vector<MuxNodeId> MuxGraph::outputs() const {
-  std::vector<MuxNodeId> output_nodes; 
+/* Return the node ids of all the outputs of the multiplexer, level by level */
+MuxGraph::node_range MuxGraph::outputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Add the output nodes in each level */
-  for (auto node_per_level : node_lookup_) {
-    output_nodes.insert(output_nodes.end(), node_per_level[MUX_OUTPUT_NODE].begin(), node_per_level[MUX_OUTPUT_NODE].end());
-  }
-  return output_nodes;
+  return nodes_by_type(MUX_OUTPUT_NODE);
 }
 
 /* Find the edge between two MUX nodes */
@@ -155,12 +134,10 @@ std::vector<MuxEdgeId> MuxGraph::find_edges(const MuxNodeId& from_node, const Mu
   VTR_ASSERT(valid_node_id(from_node));
   VTR_ASSERT(valid_node_id(to_node));
 
-  for (const auto& edge : node_out_edges_[from_node]) {
-    for (const auto& cand : edge_sink_nodes_[edge]) {
-      if (cand == to_node) {
-        /* This is the wanted edge, add to list */
-        edges.push_back(edge);
-      }
+  for (const auto& edge : node_out_edges(from_node)) {
+    if (edge_sink_nodes_[edge] == to_node) {
+      /* This is the wanted edge, add to list */
+      edges.push_back(edge);
     }
   }
 
@@ -172,14 +149,17 @@ size_t MuxGraph::num_levels() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
   /* The num_levels by definition excludes the level for outputs, so a deduection is applied */
-  return node_lookup_.size() - 1; 
+  return num_node_levels() - 1; 
 }
 
 /* Find the actual number of levels in the MUX graph */
 size_t MuxGraph::num_node_levels() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  return node_lookup_.size(); 
+  if (level_node_offsets_.empty()) {
+    return 0;
+  }
+  return level_node_offsets_.size() - 1; 
 }
 
 /* Find the number of configuration memories in the MUX graph */
@@ -194,15 +174,20 @@ size_t MuxGraph::num_memory_bits_at_level(const size_t& level) const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_level(level));
   VTR_ASSERT_SAFE(valid_mux_graph());
-  return mem_lookup_[level].size(); 
+  return memories_at_level(level).size(); 
 }
 
 /* Return memory id at level */
-std::vector<MuxMemId> MuxGraph::memories_at_level(const size_t& level) const {
+MuxGraph::mem_range MuxGraph::memories_at_level(const size_t& level) const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_level(level));
   VTR_ASSERT_SAFE(valid_mux_graph());
-  return mem_lookup_[level]; 
+  /* There is no memory at the output level */
+  if (level + 1 >= mem_lookup_offsets_.size()) {
+    return vtr::make_range(mem_lookup_.end(), mem_lookup_.end());
+  }
+  return vtr::make_range(mem_lookup_.begin() + mem_lookup_offsets_[level],
+                         mem_lookup_.begin() + mem_lookup_offsets_[level + 1]);
 }
 
 /* Find the number of nodes at a given level in the MUX graph */
@@ -213,7 +198,7 @@ size_t MuxGraph::num_nodes_at_level(const size_t& level) const {
   
   size_t num_nodes = 0;
   for (size_t node_type = 0; node_type < size_t(NUM_MUX_NODE_TYPES); ++node_type) {
-    num_nodes += node_lookup_[level][node_type].size(); 
+    num_nodes += nodes_by_type(e_mux_graph_node_type(node_type), level).size(); 
   }
   return num_nodes; 
 }
@@ -233,17 +218,27 @@ size_t MuxGraph::node_index_at_level(const MuxNodeId& node) const {
 }
 
 /* Find the  input edges for a node */
-std::vector<MuxEdgeId> MuxGraph::node_in_edges(const MuxNodeId& node) const {
+MuxGraph::edge_range MuxGraph::node_in_edges(const MuxNodeId& node) const {
   /* validate the node */
   VTR_ASSERT(valid_node_id(node));
-  return node_in_edges_[node];
+  return vtr::make_range(node_in_edges_.begin() + node_in_edge_offsets_[size_t(node)],
+                         node_in_edges_.begin() + node_in_edge_offsets_[size_t(node) + 1]);
 }
 
-/* Find the input nodes for a edge */
-std::vector<MuxNodeId> MuxGraph::edge_src_nodes(const MuxEdgeId& edge) const {
+/* Find the output edges for a node */
+MuxGraph::edge_range MuxGraph::node_out_edges(const MuxNodeId& node) const {
+  /* validate the node */
+  VTR_ASSERT(valid_node_id(node));
+  return vtr::make_range(node_out_edges_.begin() + node_out_edge_offsets_[size_t(node)],
+                         node_out_edges_.begin() + node_out_edge_offsets_[size_t(node) + 1]);
+}
+
+/* Find the input nodes for a edge: there is only one in a multiplexer */
+MuxGraph::node_range MuxGraph::edge_src_nodes(const MuxEdgeId& edge) const {
   /* validate the edge */
   VTR_ASSERT(valid_edge_id(edge));
-  return edge_src_nodes_[edge];
+  return vtr::make_range(edge_src_nodes_.begin() + size_t(edge),
+                         edge_src_nodes_.begin() + size_t(edge) + 1);
 }
 
 /* Find the mem that control the edge */
@@ -271,7 +266,7 @@ std::vector<size_t> MuxGraph::branch_sizes() const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -307,7 +302,7 @@ std::vector<size_t> MuxGraph::branch_sizes(const size_t& level) const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -356,10 +351,9 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
 
   /* Add input nodes and edges to subgraph */
   size_t input_cnt = 0;
-  for (auto edge_origin : this->node_in_edges_[root_node]) {
-    VTR_ASSERT_SAFE(1 == edge_src_nodes_[edge_origin].size());
+  for (auto edge_origin : this->node_in_edges(root_node)) {
     /* Add nodes */
-    MuxNodeId from_node_origin = this->edge_src_nodes_[edge_origin][0];
+    MuxNodeId from_node_origin = this->edge_src_nodes_[edge_origin];
     MuxNodeId from_node_subgraph = mux_graph.add_node(MUX_INPUT_NODE);
     /* Configure the nodes */
     mux_graph.node_levels_[from_node_subgraph] = 0;
@@ -381,7 +375,7 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
   std::map<MuxMemId, MuxMemId> mem2mem_map;
 
   /* Add memory bits and configure edges */
-  for (auto edge_origin : this->node_in_edges_[root_node]) {
+  for (auto edge_origin : this->node_in_edges(root_node)) {
     MuxMemId mem_origin = this->edge_mem_ids_[edge_origin];
     /* Try to find if the mem is already in the list */
     std::map<MuxMemId, MuxMemId>::iterator it = mem2mem_map.find(mem_origin);
@@ -402,6 +396,7 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
 
   /* Since the graph is finalized, it is time to build the fast look-up */
   mux_graph.build_node_lookup();
+  mux_graph.build_edge_lookup();
   mux_graph.build_mem_lookup();
 
   return mux_graph; 
@@ -427,7 +422,7 @@ std::vector<MuxGraph> MuxGraph::build_mux_branch_graphs() const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -484,33 +479,20 @@ bool MuxGraph::is_node_output(const MuxNodeId& node_id) const {
 
 /* Get the node id of a given input */
 MuxNodeId MuxGraph::node_id(const MuxInputId& input_id) const {
-  /* Use the node_lookup to accelerate the search */
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& cand_node : lvl[MUX_INPUT_NODE]) {
-      if (input_id == node_input_ids_[cand_node]) {
-        return cand_node; 
-      }
-    }
-  } 
-
-  return MuxNodeId::INVALID();
+  if (false == valid_input_id(input_id)) {
+    return MuxNodeId::INVALID();
+  }
+  return input_nodes_[input_id];
 }
 
 /* Get the node id of a given output */
 MuxNodeId MuxGraph::node_id(const MuxOutputId& output_id) const {
-  /* Use the node_lookup to accelerate the search */
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& cand_node : lvl[MUX_OUTPUT_NODE]) {
-      if (output_id == node_output_ids_[cand_node]) {
-        return cand_node; 
-      }
-    }
-  } 
-
-  return MuxNodeId::INVALID();
+  if (false == valid_output_id(output_id)) {
+    return MuxNodeId::INVALID();
+  }
+  return output_nodes_[output_id];
 }
 
-
 /* Get the node id w.r.t. the node level and node_index at the level
  * Return an invalid value if not found 
  */
@@ -518,31 +500,17 @@ MuxNodeId MuxGraph::node_id(const size_t& node_level, const size_t& node_index_a
   /* Ensure we have a valid node_look-up */
   VTR_ASSERT_SAFE(valid_node_lookup());
 
-  MuxNodeId ret_node = MuxNodeId::INVALID(); 
-
   /* Search in the fast look up */
-  if (node_level >= node_lookup_.size()) {
-    return ret_node; 
-  }
-  
-  size_t node_cnt = 0;
-  /* Node level is valid, search in the node list */
-  for (const auto& nodes_by_type : node_lookup_[node_level]) {
-    /* Search the node_index_at_level of each node */
-    for (const auto& node : nodes_by_type) {
-      if (node_index_at_level != node_ids_at_level_[node]) {
-        continue;
-      } 
-      /* Find the node, assign value and update the counter */
-      ret_node = node;
-      node_cnt++; 
-    }
+  if (node_level >= num_node_levels()) {
+    return MuxNodeId::INVALID(); 
   }
 
-  /* We should either find a node or nothing */
-  VTR_ASSERT((0 == node_cnt) || (1 == node_cnt));
+  size_t index = level_node_offsets_[node_level] + node_index_at_level;
+  if (index >= level_node_offsets_[node_level + 1]) {
+    return MuxNodeId::INVALID(); 
+  }
 
-  return ret_node;
+  return level_nodes_[index];
 }
 
 /* Decode memory bits based on an input id and an output id */
@@ -555,31 +523,17 @@ vtr::vector<MuxMemId, bool> MuxGraph::decode_memory_bits(const MuxInputId& input
   VTR_ASSERT_SAFE(valid_input_id(input_id));
   VTR_ASSERT_SAFE(valid_output_id(output_id));
 
-  /* Mark all the nodes as not visited */
-  vtr::vector<MuxNodeId, bool> visited(nodes().size(), false); 
-
-  /* Create a queue for Breadth-First Search */ 
-  std::list<MuxNodeId> queue; 
+  MuxNodeId output_node = node_id(output_id);
 
-  /* Mark the input node as visited and enqueue it */
-  visited[node_id(input_id)] = true; 
-  queue.push_back(node_id(input_id)); 
-
-  /* Create a flag to indicate if the route is success or not */
-  bool route_success = false;
-
-  while(!queue.empty()) { 
-    /* Dequeue a mux node from queue, 
-     * we will walk through all the fan-in of this node in this loop
-     */
-    MuxNodeId node_to_expand = queue.front(); 
-    queue.pop_front(); 
-                                                                                                               /* Get all fan-in nodes of the dequeued node
-     * If the node has not been visited,  
-     * then mark it visited and enqueue it
-     */
-    VTR_ASSERT_SAFE (1 == node_out_edges_[node_to_expand].size());
-    MuxEdgeId edge = node_out_edges_[node_to_expand][0];
+  /* Every node except the outputs has 1 fan-out, 
+   * so there is a single path from the input node,
+   * which is walked until reaching the output node 
+   */
+  MuxNodeId node_to_expand = node_id(input_id);
+  while (node_to_expand != output_node) {
+    /* Routing must be success! */
+    VTR_ASSERT(1 == node_out_edge_offsets_[size_t(node_to_expand) + 1] - node_out_edge_offsets_[size_t(node_to_expand)]);
+    MuxEdgeId edge = node_out_edges_[node_out_edge_offsets_[size_t(node_to_expand)]];
 
     /* Configure the mem bits: 
      * if inv_mem is enabled, it means 0 to enable this edge 
@@ -587,34 +541,12 @@ vtr::vector<MuxMemId, bool> MuxGraph::decode_memory_bits(const MuxInputId& input
      */
     MuxMemId mem = edge_mem_ids_[edge];
     VTR_ASSERT_SAFE (valid_mem_id(mem));
-    if (true == edge_inv_mem_[edge]) {
-      mem_bits[mem] = false;
-    } else {
-      mem_bits[mem] = true;
-    }
-
-    /* each edge must have 1 fan-out */
-    VTR_ASSERT_SAFE (1 == edge_sink_nodes_[edge].size());
+    mem_bits[mem] = !edge_inv_mem_[edge];
 
     /* Get the fan-out node */
-    MuxNodeId next_node = edge_sink_nodes_[edge][0]; 
-
-    /* If next node is the output node we want, we can finish here */
-    if (next_node == node_id(output_id)) {
-      route_success = true;
-      break;
-    }
-
-    /* Add next node to the queue if not visited yet */
-    if (false == visited[next_node]) { 
-       visited[next_node] = true; 
-       queue.push_back(next_node); 
-    }
+    node_to_expand = edge_sink_nodes_[edge]; 
   }
 
-  /* Routing must be success! */
-  VTR_ASSERT(true == route_success);
-
   return mem_bits;
 }
 
@@ -630,32 +562,17 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(const std::map<MuxMem
   /* valid the output */
   VTR_ASSERT_SAFE(valid_output_id(output_id));
 
-  /* Start from the output node */
-  /* Mark all the nodes as not visited */
-  vtr::vector<MuxNodeId, bool> visited(nodes().size(), false); 
-
-  /* Create a queue for Breadth-First Search */ 
-  std::list<MuxNodeId> queue; 
-
-  /* Mark the output node as visited and enqueue it */
-  visited[node_id(output_id)] = true; 
-  queue.push_back(node_id(output_id)); 
+  /* Start from the output node, and walk backward 
+   * through the edges enabled by the memory bits
+   */
+  MuxNodeId node_to_expand = node_id(output_id);
 
   /* Record the destination input id */
   MuxInputId des_input_id = MuxInputId::INVALID();
 
-  while(!queue.empty()) { 
-    /* Dequeue a mux node from queue, 
-     * we will walk through all the fan-in of this node in this loop
-     */
-    MuxNodeId node_to_expand = queue.front(); 
-    queue.pop_front(); 
-                                                                                                               /* Get all fan-in nodes of the dequeued node
-     * If the node has not been visited,  
-     * then mark it visited and enqueue it
-     */
+  while (MuxInputId::INVALID() == des_input_id) { 
     MuxEdgeId next_edge = MuxEdgeId::INVALID(); 
-    for (const MuxEdgeId& edge : node_in_edges_[node_to_expand]) {
+    for (const MuxEdgeId& edge : node_in_edges(node_to_expand)) {
       /* Configure the mem bits and find the edge that will propagate the signal 
        * if inv_mem is enabled, it means false to enable this edge 
        * otherwise, it is true to enable this edge
@@ -667,31 +584,18 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(const std::map<MuxMem
         break;
       }
     }
-    /* We must have a valid next edge */
+    /* We must have a valid next edge, i.e., routing must be success! */
     VTR_ASSERT(MuxEdgeId::INVALID() != next_edge);
 
-    /* each edge must have 1 fan-out */
-    VTR_ASSERT_SAFE (1 == edge_src_nodes_[next_edge].size());
-
     /* Get the fan-in node */
-    MuxNodeId next_node = edge_src_nodes_[next_edge][0]; 
+    node_to_expand = edge_src_nodes_[next_edge]; 
 
     /* If next node is an input node, we can finish here */
-    if (true == is_node_input(next_node)) {
-      des_input_id = input_id(next_node);
-      break;
-    }
-
-    /* Add next node to the queue if not visited yet */
-    if (false == visited[next_node]) { 
-       visited[next_node] = true; 
-       queue.push_back(next_node); 
+    if (true == is_node_input(node_to_expand)) {
+      des_input_id = input_id(node_to_expand);
     }
   }
 
-  /* Routing must be success! */
-  VTR_ASSERT(MuxInputId::INVALID() != des_input_id);
-
   return des_input_id;
 }
 
@@ -709,8 +613,6 @@ MuxNodeId MuxGraph::add_node(const enum e_mux_graph_node_type& node_type) {
   node_output_ids_.push_back(MuxOutputId::INVALID());
   node_levels_.push_back(-1);
   node_ids_at_level_.push_back(-1);
-  node_in_edges_.emplace_back();
-  node_out_edges_.emplace_back();
 
   return node;
 }
@@ -725,16 +627,14 @@ MuxEdgeId MuxGraph::add_edge(const MuxNodeId& from_node, const MuxNodeId& to_nod
   edge_mem_ids_.push_back(MuxMemId::INVALID());
   edge_inv_mem_.push_back(false);
 
-  /* update the edge-node connections */
+  /* update the edge-node connections 
+   * The edges of each node are found by build_edge_lookup() once the graph is finalized
+   */
   VTR_ASSERT(valid_node_id(from_node));
-  edge_src_nodes_.emplace_back();
-  edge_src_nodes_[edge].push_back(from_node);
-  node_out_edges_[from_node].push_back(edge);
+  edge_src_nodes_.push_back(from_node);
 
   VTR_ASSERT(valid_node_id(to_node));
-  edge_sink_nodes_.emplace_back();
-  edge_sink_nodes_[edge].push_back(to_node);
-  node_in_edges_[to_node].push_back(edge);
+  edge_sink_nodes_.push_back(to_node);
 
   return edge;
 }
@@ -1012,7 +912,7 @@ void MuxGraph::add_fracturable_outputs(const CircuitLibrary& circuit_lib,
     for (const auto& output_idx : circuit_lib.port_lut_output_mask(port)) {
       size_t num_matched_nodes = 0;
       /* Iterate over node and find the internal nodes, which match the frac_level and output_idx */
-      for (const auto& node : node_lookup_[frac_level][MUX_INTERNAL_NODE]) {
+      for (const auto& node : nodes_by_type(MUX_INTERNAL_NODE, frac_level)) {
         if (node_ids_at_level_[node] != output_idx) {
           /* Bypass condition */
           continue;
@@ -1033,7 +933,7 @@ void MuxGraph::add_fracturable_outputs(const CircuitLibrary& circuit_lib,
         continue; /* Finish here, go to next */
       }
       /* Sometime the wanted node is already an output, do a double check */
-      for (const auto& node : node_lookup_[frac_level][MUX_OUTPUT_NODE]) {
+      for (const auto& node : nodes_by_type(MUX_OUTPUT_NODE, frac_level)) {
         if (node_ids_at_level_[node] != output_idx) {
           /* Bypass condition */
           continue;
@@ -1100,6 +1000,7 @@ void MuxGraph::build_mux_graph(const CircuitLibrary& circuit_lib,
 
   /* Since the graph is finalized, it is time to build the fast look-up */
   build_node_lookup();
+  build_edge_lookup();
   build_mem_lookup();
 
   /* For fracturable LUTs, we need to add more outputs to the MUX graph */
@@ -1117,19 +1018,83 @@ void MuxGraph::build_node_lookup() {
   /* Find the maximum number of levels */
   size_t num_levels = 0;
   for (auto node : nodes()) {
-    num_levels = std::max((int)node_levels_[node], (int)num_levels);
+    num_levels = std::max(node_levels_[node] + 1, num_levels);
   }
 
-  /* Resize node_lookup */
-  node_lookup_.resize(num_levels + 1);
-  for (size_t lvl = 0; lvl < node_lookup_.size(); ++lvl) {
-    /* Resize by number of node types */
-    node_lookup_[lvl].resize(NUM_MUX_NODE_TYPES);
+  /* Sort the nodes by type and level, keeping the order of node ids: 
+   * count the nodes of each type at each level, 
+   * and then place the nodes after the nodes of the previous types/levels
+   */
+  node_lookup_offsets_.resize(size_t(NUM_MUX_NODE_TYPES) * num_levels + 1, 0);
+  for (auto node : nodes()) {
+    node_lookup_offsets_[size_t(node_types_[node]) * num_levels + node_levels_[node] + 1]++;
+  }
+  for (size_t i = 1; i < node_lookup_offsets_.size(); ++i) {
+    node_lookup_offsets_[i] += node_lookup_offsets_[i - 1];
+  }
+  node_lookup_.resize(node_ids_.size());
+  std::vector<size_t> node_lookup_cursors(node_lookup_offsets_.begin(), node_lookup_offsets_.end() - 1);
+  for (auto node : nodes()) {
+    node_lookup_[node_lookup_cursors[size_t(node_types_[node]) * num_levels + node_levels_[node]]++] = node;
   }
 
-  /* Fill the node lookup */
+  /* Index the nodes by level and index at the level */
+  level_node_offsets_.resize(num_levels + 1, 0);
   for (auto node : nodes()) {
-    node_lookup_[node_levels_[node]][size_t(node_types_[node])].push_back(node);
+    level_node_offsets_[node_levels_[node] + 1] = std::max(level_node_offsets_[node_levels_[node] + 1], node_ids_at_level_[node] + 1);
+  }
+  for (size_t lvl = 1; lvl < level_node_offsets_.size(); ++lvl) {
+    level_node_offsets_[lvl] += level_node_offsets_[lvl - 1];
+  }
+  level_nodes_.resize(level_node_offsets_.back(), MuxNodeId::INVALID());
+  for (auto node : nodes()) {
+    MuxNodeId& level_node = level_nodes_[level_node_offsets_[node_levels_[node]] + node_ids_at_level_[node]];
+    /* Each node should have a unique index at its level */
+    VTR_ASSERT(MuxNodeId::INVALID() == level_node);
+    level_node = node;
+  }
+
+  /* Index the inputs and outputs by their ids */
+  for (auto node : nodes()) {
+    if (MUX_INPUT_NODE == node_types_[node]) {
+      VTR_ASSERT(MuxInputId::INVALID() != node_input_ids_[node]);
+      if (size_t(node_input_ids_[node]) >= input_nodes_.size()) {
+        input_nodes_.resize(size_t(node_input_ids_[node]) + 1, MuxNodeId::INVALID());
+      }
+      input_nodes_[node_input_ids_[node]] = node;
+    }
+    if (MUX_OUTPUT_NODE == node_types_[node]) {
+      VTR_ASSERT(MuxOutputId::INVALID() != node_output_ids_[node]);
+      if (size_t(node_output_ids_[node]) >= output_nodes_.size()) {
+        output_nodes_.resize(size_t(node_output_ids_[node]) + 1, MuxNodeId::INVALID());
+      }
+      output_nodes_[node_output_ids_[node]] = node;
+    }
+  }
+}
+
+/* Build the incoming and outgoing edges of each node in compressed sparse rows,
+ * where the edges of a node are in the order of their ids 
+ */
+void MuxGraph::build_edge_lookup() {
+  node_in_edge_offsets_.assign(node_ids_.size() + 1, 0);
+  node_out_edge_offsets_.assign(node_ids_.size() + 1, 0);
+  for (auto edge : edges()) {
+    node_in_edge_offsets_[size_t(edge_sink_nodes_[edge]) + 1]++;
+    node_out_edge_offsets_[size_t(edge_src_nodes_[edge]) + 1]++;
+  }
+  for (size_t inode = 1; inode < node_in_edge_offsets_.size(); ++inode) {
+    node_in_edge_offsets_[inode] += node_in_edge_offsets_[inode - 1];
+    node_out_edge_offsets_[inode] += node_out_edge_offsets_[inode - 1];
+  }
+
+  node_in_edges_.resize(edge_ids_.size());
+  node_out_edges_.resize(edge_ids_.size());
+  std::vector<size_t> in_edge_cursors(node_in_edge_offsets_.begin(), node_in_edge_offsets_.end() - 1);
+  std::vector<size_t> out_edge_cursors(node_out_edge_offsets_.begin(), node_out_edge_offsets_.end() - 1);
+  for (auto edge : edges()) {
+    node_in_edges_[in_edge_cursors[size_t(edge_sink_nodes_[edge])]++] = edge;
+    node_out_edges_[out_edge_cursors[size_t(edge_src_nodes_[edge])]++] = edge;
   }
 }
 
@@ -1141,26 +1106,67 @@ void MuxGraph::build_mem_lookup() {
   /* Find the maximum number of levels */
   size_t num_levels = 0;
   for (auto mem : memories()) {
-    num_levels = std::max((int)mem_levels_[mem], (int)num_levels);
+    num_levels = std::max(mem_levels_[mem] + 1, num_levels);
   }
 
-  /* Resize mem_lookup */
-  mem_lookup_.resize(num_levels + 1);
+  /* Sort the memories by level, keeping the order of memory ids */
+  mem_lookup_offsets_.resize(num_levels + 1, 0);
   for (auto mem : memories()) {
-    /* Categorize mem nodes into mem_lookup */
-    mem_lookup_[mem_levels_[mem]].push_back(mem);
+    mem_lookup_offsets_[mem_levels_[mem] + 1]++;
+  }
+  for (size_t lvl = 1; lvl < mem_lookup_offsets_.size(); ++lvl) {
+    mem_lookup_offsets_[lvl] += mem_lookup_offsets_[lvl - 1];
+  }
+  mem_lookup_.resize(mem_ids_.size());
+  std::vector<size_t> mem_lookup_cursors(mem_lookup_offsets_.begin(), mem_lookup_offsets_.end() - 1);
+  for (auto mem : memories()) {
+    mem_lookup_[mem_lookup_cursors[mem_levels_[mem]]++] = mem;
   }
 }
 
 /* Invalidate (empty) the node fast lookup*/
 void MuxGraph::invalidate_node_lookup() {
+  node_lookup_offsets_.clear();
   node_lookup_.clear();
+  level_node_offsets_.clear();
+  level_nodes_.clear();
+  input_nodes_.clear();
+  output_nodes_.clear();
 }
 
 /* Invalidate (empty) the mem fast lookup*/
 void MuxGraph::invalidate_mem_lookup() {
+  mem_lookup_offsets_.clear();
   mem_lookup_.clear();
 }
+
+/**************************************************
+ * Private accessors on the fast look-ups
+ *************************************************/
+/* Find the nodes of a type at a level */
+MuxGraph::node_range MuxGraph::nodes_by_type(const enum e_mux_graph_node_type& node_type, const size_t& level) const {
+  /* No node has been indexed yet */
+  if (node_lookup_offsets_.empty()) {
+    return vtr::make_range(node_lookup_.end(), node_lookup_.end());
+  }
+  size_t index = size_t(node_type) * num_node_levels() + level;
+  VTR_ASSERT_SAFE(index + 1 < node_lookup_offsets_.size());
+  return vtr::make_range(node_lookup_.begin() + node_lookup_offsets_[index],
+                         node_lookup_.begin() + node_lookup_offsets_[index + 1]);
+}
+
+/* Find the nodes of a type at all the levels, level by level */
+MuxGraph::node_range MuxGraph::nodes_by_type(const enum e_mux_graph_node_type& node_type) const {
+  /* No node has been indexed yet */
+  if (node_lookup_offsets_.empty()) {
+    return vtr::make_range(node_lookup_.end(), node_lookup_.end());
+  }
+  size_t begin_index = size_t(node_type) * num_node_levels();
+  size_t end_index = (size_t(node_type) + 1) * num_node_levels();
+  VTR_ASSERT_SAFE(end_index < node_lookup_offsets_.size());
+  return vtr::make_range(node_lookup_.begin() + node_lookup_offsets_[begin_index],
+                         node_lookup_.begin() + node_lookup_offsets_[end_index]);
+}
  
 /**************************************************
  * Private validators
@@ -1181,28 +1187,12 @@ bool MuxGraph::valid_mem_id(const MuxMemId& mem) const {
 
 /* validate an input id (from which data path signal will be progagated to the output) */
 bool MuxGraph::valid_input_id(const MuxInputId& input_id) const {
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& node : lvl[MUX_INPUT_NODE]) {
-      if (size_t(input_id) > size_t(node_input_ids_[node])) {
-        return false;
-      }
-    }
-  } 
-
-  return true;
+  return size_t(input_id) < input_nodes_.size();
 }
 
 /* validate an output id */
 bool MuxGraph::valid_output_id(const MuxOutputId& output_id) const {
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& node : lvl[MUX_OUTPUT_NODE]) {
-      if (size_t(output_id) > size_t(node_output_ids_[node])) {
-        return false;
-      }
-    }
-  } 
-
-  return true;
+  return size_t(output_id) < output_nodes_.size();
 }
 
 bool MuxGraph::valid_level(const size_t& level) const {
@@ -1210,7 +1200,7 @@ bool MuxGraph::valid_level(const size_t& level) const {
 }
 
 bool MuxGraph::valid_node_lookup() const {
-  return node_lookup_.empty();
+  return !node_lookup_offsets_.empty();
 }
 
 /* validate a mux graph and see if it is valid */
@@ -1219,13 +1209,18 @@ bool MuxGraph::valid_mux_graph() const {
    * 1. every node has 1 fan-out except output node
    * 2. every input can be routed to the output node 
    */
+  /* The edges of each node must have been built */
+  if (node_ids_.size() + 1 != node_out_edge_offsets_.size()) {
+    return false;
+  }
+
   for (const auto& node : nodes()) {
     /* output node has 0 fan-out*/
     if (MUX_OUTPUT_NODE == node_types_[node]) {
       continue;
     }
     /* other nodes should have 1 fan-out */
-    if (1 != node_out_edges_[node].size()) {
+    if (1 != node_out_edges(node).size()) {
       return false;
     }
   }
@@ -1234,13 +1229,9 @@ bool MuxGraph::valid_mux_graph() const {
   for (const auto& node : nodes()) {
     if (MUX_INPUT_NODE == node_types_[node]) {
       MuxNodeId next_node = node;
-      while ( 0 < node_out_edges_[next_node].size() ) {
-        MuxEdgeId edge = node_out_edges_[next_node][0];
-        /* each edge must have 1 fan-out */
-        if (1 != edge_sink_nodes_[edge].size()) {
-          return false;
-        }
-        next_node = edge_sink_nodes_[edge][0]; 
+      while ( 0 < node_out_edges(next_node).size() ) {
+        MuxEdgeId edge = *node_out_edges(next_node).begin();
+        next_node = edge_sink_nodes_[edge]; 
       }
       if (MUX_OUTPUT_NODE != node_types_[next_node]) {
         return false;
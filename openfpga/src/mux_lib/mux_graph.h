@@ -37,6 +37,11 @@ namespace openfpga {
  * mux_inputs--->| Branch[N] |--->|        |
  *               +-----------+    +--------+
  *
+ * The graph is built once and then frozen: the connectivity and
+ * the fast look-ups are stored as flat arrays (edges of each node
+ * in compressed sparse rows, nodes and memories sorted by level), 
+ * so that the accessors return ranges on them without any copy
+ *
  *************************************************/
 class MuxGraph {
   private: /* data types used only in this class */
@@ -75,10 +80,10 @@ class MuxGraph {
   public: /* Public accessors: Data query */
     /* Find the number of inputs in the MUX graph */
     size_t num_inputs() const;
-    std::vector<MuxNodeId> inputs() const;
+    node_range inputs() const;
     /* Find the number of outputs in the MUX graph */
     size_t num_outputs() const;
-    std::vector<MuxNodeId> outputs() const;
+    node_range outputs() const;
     /* Find the edge between two MUX nodes */
     std::vector<MuxEdgeId> find_edges(const MuxNodeId& from_node, const MuxNodeId& to_node) const;
     /* Find the number of levels in the MUX graph */
@@ -89,7 +94,7 @@ class MuxGraph {
     /* Find the number of SRAMs at a level in the MUX graph */
     size_t num_memory_bits_at_level(const size_t& level) const;
     /* Return memory id at level */
-    std::vector<MuxMemId> memories_at_level(const size_t& level) const;
+    mem_range memories_at_level(const size_t& level) const;
     /* Find the number of nodes at a given level in the MUX graph */
     size_t num_nodes_at_level(const size_t& level) const;
     /* Find the level of a node */
@@ -97,9 +102,11 @@ class MuxGraph {
     /* Find the index of a node at its level */
     size_t node_index_at_level(const MuxNodeId& node) const;
     /* Find the input edges for a node */
-    std::vector<MuxEdgeId> node_in_edges(const MuxNodeId& node) const;
+    edge_range node_in_edges(const MuxNodeId& node) const;
+    /* Find the output edges for a node */
+    edge_range node_out_edges(const MuxNodeId& node) const;
     /* Find the input nodes for a edge */
-    std::vector<MuxNodeId> edge_src_nodes(const MuxEdgeId& edge) const;
+    node_range edge_src_nodes(const MuxEdgeId& edge) const;
     /* Find the mem that control the edge */
     MuxMemId find_edge_mem(const MuxEdgeId& edge) const;
     /* Identify if the edge is controlled by the inverted output of a mem */
@@ -165,8 +172,14 @@ class MuxGraph {
                                  const CircuitModelId& circuit_model);
     /* Build fast node lookup */
     void build_node_lookup();
+    /* Build the incoming and outgoing edges of each node */
+    void build_edge_lookup();
     /* Build fast mem lookup */
     void build_mem_lookup();
+  private: /* Private accessors on the fast look-ups */
+    /* Find the nodes of a type at a level, or at all the levels */
+    node_range nodes_by_type(const enum e_mux_graph_node_type& node_type, const size_t& level) const;
+    node_range nodes_by_type(const enum e_mux_graph_node_type& node_type) const;
   private: /* Private validators */
     /* valid ids */
     bool valid_node_id(const MuxNodeId& node) const;
@@ -188,12 +201,10 @@ class MuxGraph {
     vtr::vector<MuxNodeId, MuxOutputId> node_output_ids_;                 /* Unique ids for each node as an input of the MUX */
     vtr::vector<MuxNodeId, size_t> node_levels_;                       /* at which level, each node belongs to */
     vtr::vector<MuxNodeId, size_t> node_ids_at_level_;                       /* the index at the level that each node belongs to */
-    vtr::vector<MuxNodeId, std::vector<MuxEdgeId>> node_in_edges_;       /* ids of incoming edges to each node */
-    vtr::vector<MuxNodeId, std::vector<MuxEdgeId>> node_out_edges_;      /* ids of outgoing edges from each node */
 
     vtr::vector<MuxEdgeId, MuxEdgeId> edge_ids_;                        /* Unique ids for each edge */
-    vtr::vector<MuxEdgeId, std::vector<MuxNodeId>> edge_src_nodes_;     /* source nodes drive this edge */
-    vtr::vector<MuxEdgeId, std::vector<MuxNodeId>> edge_sink_nodes_;    /* sink nodes this edge drives */
+    vtr::vector<MuxEdgeId, MuxNodeId> edge_src_nodes_;                  /* source node which drives this edge */
+    vtr::vector<MuxEdgeId, MuxNodeId> edge_sink_nodes_;                 /* sink node this edge drives */
     vtr::vector<MuxEdgeId, CircuitModelId> edge_models_; /* type of each edge: tgate/pass-gate */
     vtr::vector<MuxEdgeId, MuxMemId> edge_mem_ids_;                   /* ids of memory bit that control the edge */
     vtr::vector<MuxEdgeId, bool> edge_inv_mem_;                       /* if the edge is controlled by an inverted output of a memory bit */
@@ -201,11 +212,33 @@ class MuxGraph {
     vtr::vector<MuxMemId, MuxMemId> mem_ids_;                        /* ids of configuration memories */
     vtr::vector<MuxMemId, size_t> mem_levels_;                        /* ids of configuration memories */
 
+    /* Edges of each node in compressed sparse rows:
+     * the incoming edges of node i are node_in_edges_[node_in_edge_offsets_[i] .. node_in_edge_offsets_[i + 1] - 1] 
+     */
+    std::vector<size_t> node_in_edge_offsets_;
+    std::vector<MuxEdgeId> node_in_edges_;
+    std::vector<size_t> node_out_edge_offsets_;
+    std::vector<MuxEdgeId> node_out_edges_;
+
     /* fast look-up */
-    typedef std::vector<std::vector<std::vector<MuxNodeId>>> NodeLookup;
-    mutable NodeLookup node_lookup_; /* [num_levels][num_types][num_nodes_per_level] */ 
-    typedef std::vector<std::vector<MuxMemId>> MemLookup;
-    mutable MemLookup mem_lookup_; /* [num_levels][num_mems_per_level] */ 
+    /* Nodes sorted by type, level and id:
+     * the nodes of type t at level l start at node_lookup_offsets_[t * num_node_levels + l] 
+     */
+    std::vector<size_t> node_lookup_offsets_;
+    std::vector<MuxNodeId> node_lookup_;
+    /* Nodes indexed by level and index at the level: 
+     * [level_node_offsets_[level] + node_index_at_level] 
+     */
+    std::vector<size_t> level_node_offsets_;
+    std::vector<MuxNodeId> level_nodes_;
+    /* Nodes indexed by input/output ids */
+    vtr::vector<MuxInputId, MuxNodeId> input_nodes_;
+    vtr::vector<MuxOutputId, MuxNodeId> output_nodes_;
+    /* Memories sorted by level:
+     * the memories at level l start at mem_lookup_offsets_[l] 
+     */
+    std::vector<size_t> mem_lookup_offsets_;
+    std::vector<MuxMemId> mem_lookup_;
 };
 
 } /* End namespace openfpga*/
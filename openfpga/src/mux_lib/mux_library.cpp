@@ -32,7 +32,18 @@ MuxId MuxLibrary::mux_graph(const CircuitModelId& circuit_model,
   /* Validate circuit model id and mux_size */
   VTR_ASSERT_SAFE(valid_mux_size(circuit_model, mux_size));
 
-  return mux_lookup_[circuit_model][mux_size];
+  /* Do not use operator[] here: it would insert missing entries,
+   * and the look-up may be read by several threads at the same time
+   */
+  auto model_it = mux_lookup_.find(circuit_model);
+  if (model_it == mux_lookup_.end()) {
+    return MuxId::INVALID();
+  }
+  auto mux_it = model_it->second.find(mux_size);
+  if (mux_it == model_it->second.end()) {
+    return MuxId::INVALID();
+  }
+  return mux_it->second;
 }
 
 const MuxGraph& MuxLibrary::mux_graph(const MuxId& mux_id) const {
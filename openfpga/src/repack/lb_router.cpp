@@ -48,6 +48,16 @@ AtomNetId LbRouter::net_atom_net_id(const NetId& net) const {
   return lb_net_atom_net_ids_[net]; 
 }
 
+const std::vector<LbRRNodeId>& LbRouter::net_sources(const NetId& net) const {
+  VTR_ASSERT(true == valid_net_id(net));
+  return lb_net_sources_[net]; 
+}
+
+const std::vector<LbRRNodeId>& LbRouter::net_sinks(const NetId& net) const {
+  VTR_ASSERT(true == valid_net_id(net));
+  return lb_net_sinks_[net]; 
+}
+
 std::vector<LbRRNodeId> LbRouter::find_congested_rr_nodes(const LbRRGraph& lb_rr_graph) const {
   /* Validate if the rr_graph is the one we used to initialize the router */
   VTR_ASSERT(true == matched_lb_rr_graph(lb_rr_graph));
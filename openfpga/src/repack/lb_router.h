@@ -216,6 +216,10 @@ class LbRouter {
     /* Return the atom net id for a net to be routed */
     AtomNetId net_atom_net_id(const NetId& net) const;    
 
+    /* Return the source and sink nodes of a net to be routed */
+    const std::vector<LbRRNodeId>& net_sources(const NetId& net) const;
+    const std::vector<LbRRNodeId>& net_sinks(const NetId& net) const;
+
     /**
      * Find all the routing resource nodes that are over-used, which they are used more than their capacity
      * This function is call to collect the nodes and router can reroute these net
@@ -1,6 +1,8 @@
 /******************************************************************************
  * Memember functions for data structure PhysicalPb
  ******************************************************************************/
+#include <algorithm>
+
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
@@ -9,73 +11,112 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/******************************************************************************
+ * Find the first entry whose key is not less than a given key
+ * in a list of (key, value) sorted by key
+ ******************************************************************************/
+template<class K, class V>
+static
+typename std::vector<std::pair<K, V>>::const_iterator lower_bound_entry(const std::vector<std::pair<K, V>>& entries,
+                                                                         const K& key) {
+  return std::lower_bound(entries.begin(), entries.end(), key,
+                          [](const std::pair<K, V>& entry, const K& entry_key) {
+                            return entry.first < entry_key;
+                          });
+}
+
+/******************************************************************************
+ * Find the entry of a key in a list of (key, value) sorted by key,
+ * return the end of the list if not found
+ ******************************************************************************/
+template<class K, class V>
+static
+typename std::vector<std::pair<K, V>>::const_iterator find_entry(const std::vector<std::pair<K, V>>& entries,
+                                                                  const K& key) {
+  auto it = lower_bound_entry(entries, key);
+  if ( (it != entries.end()) && (it->first == key) ) {
+    return it;
+  }
+  return entries.end();
+}
+
+/******************************************************************************
+ * Set the value of a key in a list of (key, value) sorted by key,
+ * the entry is inserted if not found
+ ******************************************************************************/
+template<class K, class V>
+static
+void set_entry(std::vector<std::pair<K, V>>& entries,
+               const K& key, const V& value) {
+  auto it = entries.begin() + (lower_bound_entry(entries, key) - entries.cbegin());
+  if ( (it != entries.end()) && (it->first == key) ) {
+    it->second = value;
+    return;
+  }
+  entries.insert(it, std::make_pair(key, value));
+}
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+PhysicalPb::PhysicalPb(const std::shared_ptr<const PhysicalPbSkeleton>& skeleton)
+  : skeleton_(skeleton) {
+  VTR_ASSERT(nullptr != skeleton_);
+}
+
 /**************************************************
- * Public Accessors 
+ * Public Accessors
  *************************************************/
 PhysicalPb::physical_pb_range PhysicalPb::pbs() const {
-  return vtr::make_range(pb_ids_.begin(), pb_ids_.end());
+  return skeleton().pbs();
 }
 
 std::vector<PhysicalPbId> PhysicalPb::primitive_pbs() const {
-  std::vector<PhysicalPbId> results; 
-  /* The primitive pbs are those without any children */
-  for (auto pb : pbs()) {
-    if (true == child_pbs_[pb].empty()) {
-      results.push_back(pb);
-    } 
-  }
-  return results;
+  return skeleton().primitive_pbs();
 }
 
 std::string PhysicalPb::name(const PhysicalPbId& pb) const {
-  VTR_ASSERT(true == valid_pb_id(pb));
-  return names_[pb];
+  return skeleton().name(pb);
 }
 
 const t_pb_graph_node* PhysicalPb::pb_graph_node(const PhysicalPbId& pb) const {
-  VTR_ASSERT(true == valid_pb_id(pb));
-  return pb_graph_nodes_[pb];
+  return skeleton().pb_graph_node(pb);
 }
 
 /* Find the module id by a given name, return invalid if not found */
 PhysicalPbId PhysicalPb::find_pb(const t_pb_graph_node* pb_graph_node) const {
-  if (type2id_map_.find(pb_graph_node) != type2id_map_.end()) {
-    /* Find it, return the id */
-    return type2id_map_.at(pb_graph_node); 
-  }
-  /* Not found, return an invalid id */
-  return PhysicalPbId::INVALID();
+  return skeleton().find_pb(pb_graph_node);
 }
 
 PhysicalPbId PhysicalPb::parent(const PhysicalPbId& pb) const {
-  VTR_ASSERT(true == valid_pb_id(pb));
-  return parent_pbs_[pb];
+  return skeleton().parent(pb);
 }
 
 PhysicalPbId PhysicalPb::child(const PhysicalPbId& pb,
-                               const t_pb_type* pb_type, 
+                               const t_pb_type* pb_type,
                                const size_t& index) const {
-  VTR_ASSERT(true == valid_pb_id(pb));
-  if (0 < child_pbs_[pb].count(pb_type)) {
-    if (index < child_pbs_[pb].at(pb_type).size()) {
-      return child_pbs_[pb].at(pb_type)[index]; 
-    }
-  }
-  return PhysicalPbId::INVALID();
+  return skeleton().child(pb, pb_type, index);
 }
 
 std::vector<AtomBlockId> PhysicalPb::atom_blocks(const PhysicalPbId& pb) const {
   VTR_ASSERT(true == valid_pb_id(pb));
-  
-  return atom_blocks_[pb];
+
+  std::vector<AtomBlockId> results;
+  for (auto it = lower_bound_entry(atom_blocks_, pb);
+       (it != atom_blocks_.end()) && (it->first == pb);
+       ++it) {
+    results.push_back(it->second);
+  }
+  return results;
 }
 
 AtomNetId PhysicalPb::pb_graph_pin_atom_net(const PhysicalPbId& pb,
                                             const t_pb_graph_pin* pb_graph_pin) const {
   VTR_ASSERT(true == valid_pb_id(pb));
-  if (pin_atom_nets_[pb].find(pb_graph_pin) != pin_atom_nets_[pb].end()) {
+  auto it = find_entry(pin_atom_nets_, pin_key(pb, pb_graph_pin));
+  if (it != pin_atom_nets_.end()) {
     /* Find it, return the id */
-    return pin_atom_nets_[pb].at(pb_graph_pin); 
+    return it->second;
   }
   /* Not found, return an invalid id */
   return AtomNetId::INVALID();
@@ -84,186 +125,200 @@ AtomNetId PhysicalPb::pb_graph_pin_atom_net(const PhysicalPbId& pb,
 bool PhysicalPb::is_wire_lut_output(const PhysicalPbId& pb,
                                     const t_pb_graph_pin* pb_graph_pin) const {
   VTR_ASSERT(true == valid_pb_id(pb));
-  if (wire_lut_outputs_[pb].find(pb_graph_pin) != wire_lut_outputs_[pb].end()) {
+  auto it = find_entry(wire_lut_outputs_, pin_key(pb, pb_graph_pin));
+  if (it != wire_lut_outputs_.end()) {
     /* Find it, return the status */
-    return wire_lut_outputs_[pb].at(pb_graph_pin); 
+    return it->second;
   }
   /* Not found, return false */
   return false;
 }
 
-std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable> PhysicalPb::truth_tables(const PhysicalPbId& pb) const {
+PhysicalPb::truth_table_range PhysicalPb::truth_tables(const PhysicalPbId& pb) const {
   VTR_ASSERT(true == valid_pb_id(pb));
-  return truth_tables_[pb];
+  auto pb_less = [](const PhysicalPbTruthTable& lhs, const PhysicalPbTruthTable& rhs) {
+    return lhs.pb < rhs.pb;
+  };
+  PhysicalPbTruthTable pb_key = {pb, nullptr, AtomNetlist::TruthTable()};
+  auto range = std::equal_range(truth_tables_.begin(), truth_tables_.end(), pb_key, pb_less);
+  return vtr::make_range(range.first, range.second);
 }
 
-std::vector<size_t> PhysicalPb::mode_bits(const PhysicalPbId& pb) const {
+const std::vector<size_t>& PhysicalPb::mode_bits(const PhysicalPbId& pb) const {
   VTR_ASSERT(true == valid_pb_id(pb));
-  return mode_bits_[pb];
+  auto it = find_entry(mode_bits_, pb);
+  if (it != mode_bits_.end()) {
+    return it->second;
+  }
+  /* Not overwritten, use the default one */
+  return skeleton().mode_bits(pb);
 }
 
 std::string PhysicalPb::fixed_bitstream(const PhysicalPbId& pb) const {
   VTR_ASSERT(true == valid_pb_id(pb));
-  return fixed_bitstreams_[pb];
+  auto it = find_entry(fixed_bitstreams_, pb);
+  if (it != fixed_bitstreams_.end()) {
+    return it->second;
+  }
+  return std::string();
 }
 
 size_t PhysicalPb::fixed_bitstream_offset(const PhysicalPbId& pb) const {
   VTR_ASSERT(true == valid_pb_id(pb));
-  return fixed_bitstream_offsets_[pb];
+  auto it = find_entry(fixed_bitstream_offsets_, pb);
+  if (it != fixed_bitstream_offsets_.end()) {
+    return it->second;
+  }
+  return 0;
 }
 
 std::string PhysicalPb::fixed_mode_select_bitstream(const PhysicalPbId& pb) const {
   VTR_ASSERT(true == valid_pb_id(pb));
-  return fixed_mode_select_bitstreams_[pb];
+  auto it = find_entry(fixed_mode_select_bitstreams_, pb);
+  if (it != fixed_mode_select_bitstreams_.end()) {
+    return it->second;
+  }
+  return std::string();
 }
 
 size_t PhysicalPb::fixed_mode_select_bitstream_offset(const PhysicalPbId& pb) const {
   VTR_ASSERT(true == valid_pb_id(pb));
-  return fixed_mode_select_bitstream_offsets_[pb];
+  auto it = find_entry(fixed_mode_select_bitstream_offsets_, pb);
+  if (it != fixed_mode_select_bitstream_offsets_.end()) {
+    return it->second;
+  }
+  return 0;
 }
 
 /******************************************************************************
  * Private Mutators
  ******************************************************************************/
-PhysicalPbId PhysicalPb::create_pb(const t_pb_graph_node* pb_graph_node) {
-  /* Find if the name has been used. If used, return an invalid Id and report error! */
-  std::map<const t_pb_graph_node*, PhysicalPbId>::iterator it = type2id_map_.find(pb_graph_node);
-  if (it != type2id_map_.end()) {
-    return PhysicalPbId::INVALID();
-  }
-
-  /* Create an new id */
-  PhysicalPbId pb = PhysicalPbId(pb_ids_.size());
-  pb_ids_.push_back(pb);
-
-  /* Allocate other attributes */
-  names_.emplace_back();
-  pb_graph_nodes_.push_back(pb_graph_node);
-  atom_blocks_.emplace_back();
-  pin_atom_nets_.emplace_back();
-  wire_lut_outputs_.emplace_back();
-
-  child_pbs_.emplace_back();
-  parent_pbs_.emplace_back();
-
-  truth_tables_.emplace_back();
-  mode_bits_.emplace_back();
-
-  fixed_bitstreams_.emplace_back();
-  fixed_bitstream_offsets_.push_back(0);
-  fixed_mode_select_bitstreams_.emplace_back();
-  fixed_mode_select_bitstream_offsets_.push_back(0);
-
-  /* Register in the name2id map */
-  type2id_map_[pb_graph_node] = pb;
-
-  return pb;
-}
-
-void PhysicalPb::add_child(const PhysicalPbId& parent,
-                           const PhysicalPbId& child,
-                           const t_pb_type* child_type) {
-  VTR_ASSERT(true == valid_pb_id(parent)); 
-  VTR_ASSERT(true == valid_pb_id(child)); 
-
-  child_pbs_[parent][child_type].push_back(child);
-
-  if (PhysicalPbId::INVALID() != parent_pbs_[child]) {
-    VTR_LOGF_WARN(__FILE__, __LINE__,
-                  "Overwrite parent '%s' for physical pb '%s' with a new one '%s'!\n",
-                  pb_graph_nodes_[parent_pbs_[child]]->hierarchical_type_name().c_str(),
-                  pb_graph_nodes_[child]->hierarchical_type_name().c_str(),
-                  pb_graph_nodes_[parent]->hierarchical_type_name().c_str());
-  }
-  parent_pbs_[child] = parent;
-}
-
 void PhysicalPb::set_truth_table(const PhysicalPbId& pb,
                                  const t_pb_graph_pin* pb_graph_pin,
                                  const AtomNetlist::TruthTable& truth_table) {
-  VTR_ASSERT(true == valid_pb_id(pb)); 
+  VTR_ASSERT(true == valid_pb_id(pb));
 
-  if (0 < truth_tables_[pb].count(pb_graph_pin)) {
+  t_pin_key key = pin_key(pb, pb_graph_pin);
+  auto it = std::lower_bound(truth_tables_.begin(), truth_tables_.end(), key,
+                             [&](const PhysicalPbTruthTable& entry, const t_pin_key& entry_key) {
+                               return pin_key(entry.pb, entry.pb_graph_pin) < entry_key;
+                             });
+  if ( (it != truth_tables_.end()) && (key == pin_key(it->pb, it->pb_graph_pin)) ) {
     VTR_LOG_WARN("Overwrite truth tables mapped to pb_graph_pin '%s[%ld]!\n",
                   pb_graph_pin->port->name, pb_graph_pin->pin_number);
+    it->truth_table = truth_table;
+    return;
   }
-   
-  truth_tables_[pb][pb_graph_pin] = truth_table;
+
+  truth_tables_.insert(it, {pb, pb_graph_pin, truth_table});
 }
 
 void PhysicalPb::set_mode_bits(const PhysicalPbId& pb,
                                const std::vector<size_t>& mode_bits) {
-  VTR_ASSERT(true == valid_pb_id(pb)); 
-   
-  mode_bits_[pb] = mode_bits;
+  VTR_ASSERT(true == valid_pb_id(pb));
+
+  /* Mode bits same as the default ones are not stored */
+  if (mode_bits == skeleton().mode_bits(pb)) {
+    auto it = find_entry(mode_bits_, pb);
+    if (it != mode_bits_.end()) {
+      mode_bits_.erase(mode_bits_.begin() + (it - mode_bits_.cbegin()));
+    }
+    return;
+  }
+
+  set_entry(mode_bits_, pb, mode_bits);
 }
 
 void PhysicalPb::add_atom_block(const PhysicalPbId& pb,
                                 const AtomBlockId& atom_block) {
-  VTR_ASSERT(true == valid_pb_id(pb)); 
-  
-  atom_blocks_[pb].push_back(atom_block);
+  VTR_ASSERT(true == valid_pb_id(pb));
+
+  /* Add after the atom blocks of the pb which are already added */
+  auto it = std::upper_bound(atom_blocks_.begin(), atom_blocks_.end(), pb,
+                             [](const PhysicalPbId& entry_key, const std::pair<PhysicalPbId, AtomBlockId>& entry) {
+                               return entry_key < entry.first;
+                             });
+  atom_blocks_.insert(it, std::make_pair(pb, atom_block));
 }
 
 void PhysicalPb::set_pb_graph_pin_atom_net(const PhysicalPbId& pb,
                                            const t_pb_graph_pin* pb_graph_pin,
                                            const AtomNetId& atom_net) {
-  VTR_ASSERT(true == valid_pb_id(pb)); 
-  if (pin_atom_nets_[pb].end() != pin_atom_nets_[pb].find(pb_graph_pin)) {
+  VTR_ASSERT(true == valid_pb_id(pb));
+  t_pin_key key = pin_key(pb, pb_graph_pin);
+  auto it = find_entry(pin_atom_nets_, key);
+  if (pin_atom_nets_.end() != it) {
     VTR_LOG_WARN("Overwrite pb_graph_pin '%s[%d]' atom net '%lu' with '%lu'\n",
                  pb_graph_pin->port->name, pb_graph_pin->pin_number,
-                 size_t(pin_atom_nets_[pb][pb_graph_pin]),
+                 size_t(it->second),
                  size_t(atom_net));
   }
 
-  pin_atom_nets_[pb][pb_graph_pin] = atom_net;
+  set_entry(pin_atom_nets_, key, atom_net);
 }
 
 void PhysicalPb::set_wire_lut_output(const PhysicalPbId& pb,
                                      const t_pb_graph_pin* pb_graph_pin,
                                      const bool& wire_lut_output) {
-  VTR_ASSERT(true == valid_pb_id(pb)); 
-  if (wire_lut_outputs_[pb].end() != wire_lut_outputs_[pb].find(pb_graph_pin)) {
+  VTR_ASSERT(true == valid_pb_id(pb));
+  t_pin_key key = pin_key(pb, pb_graph_pin);
+  if (wire_lut_outputs_.end() != find_entry(wire_lut_outputs_, key)) {
     VTR_LOG_WARN("Overwrite pb_graph_pin '%s[%d]' status on wire LUT output\n",
                  pb_graph_pin->port->name, pb_graph_pin->pin_number);
   }
 
-  wire_lut_outputs_[pb][pb_graph_pin] = wire_lut_output;
+  set_entry(wire_lut_outputs_, key, wire_lut_output);
 }
 
 void PhysicalPb::set_fixed_bitstream(const PhysicalPbId& pb,
                                      const std::string& fixed_bitstream) {
-  VTR_ASSERT(true == valid_pb_id(pb)); 
-  fixed_bitstreams_[pb] = fixed_bitstream;
+  VTR_ASSERT(true == valid_pb_id(pb));
+  set_entry(fixed_bitstreams_, pb, fixed_bitstream);
 }
 
 void PhysicalPb::set_fixed_bitstream_offset(const PhysicalPbId& pb,
                                             const size_t& offset) {
-  VTR_ASSERT(true == valid_pb_id(pb)); 
-  fixed_bitstream_offsets_[pb] = offset;
+  VTR_ASSERT(true == valid_pb_id(pb));
+  set_entry(fixed_bitstream_offsets_, pb, offset);
 }
 
 void PhysicalPb::set_fixed_mode_select_bitstream(const PhysicalPbId& pb,
                                                  const std::string& fixed_bitstream) {
-  VTR_ASSERT(true == valid_pb_id(pb)); 
-  fixed_mode_select_bitstreams_[pb] = fixed_bitstream;
+  VTR_ASSERT(true == valid_pb_id(pb));
+  set_entry(fixed_mode_select_bitstreams_, pb, fixed_bitstream);
 }
 
 void PhysicalPb::set_fixed_mode_select_bitstream_offset(const PhysicalPbId& pb,
                                                         const size_t& offset) {
-  VTR_ASSERT(true == valid_pb_id(pb)); 
-  fixed_mode_select_bitstream_offsets_[pb] = offset;
+  VTR_ASSERT(true == valid_pb_id(pb));
+  set_entry(fixed_mode_select_bitstream_offsets_, pb, offset);
 }
 
 /******************************************************************************
  * Private validators/invalidators
  ******************************************************************************/
 bool PhysicalPb::valid_pb_id(const PhysicalPbId& pb_id) const {
-  return ( size_t(pb_id) < pb_ids_.size() ) && ( pb_id == pb_ids_[pb_id] ); 
+  return skeleton().valid_pb_id(pb_id);
 }
 
 bool PhysicalPb::empty() const {
-  return 0 == pb_ids_.size();
+  return skeleton().empty();
+}
+
+/******************************************************************************
+ * Private utility
+ ******************************************************************************/
+PhysicalPb::t_pin_key PhysicalPb::pin_key(const PhysicalPbId& pb,
+                                          const t_pb_graph_pin* pb_graph_pin) const {
+  return std::make_pair(pb, pb_graph_pin->pin_count_in_cluster);
+}
+
+const PhysicalPbSkeleton& PhysicalPb::skeleton() const {
+  static const PhysicalPbSkeleton empty_skeleton;
+  if (nullptr == skeleton_) {
+    return empty_skeleton;
+  }
+  return *skeleton_;
 }
 
 } /* end namespace openfpga */
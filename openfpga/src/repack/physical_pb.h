@@ -4,6 +4,9 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
+#include <memory>
+#include <utility>
+
 /* Headers from vtrutil library */
 #include "vtr_geometry.h"
 #include "vtr_vector.h"
@@ -15,6 +18,7 @@
 #include "atom_netlist.h"
 
 #include "physical_pb_fwd.h"
+#include "physical_pb_skeleton.h"
 
 /* Begin namespace openfpga */
 namespace openfpga {
@@ -32,11 +36,30 @@ namespace openfpga {
  *    circuit in the correct mode
  *  - A primitive LUT can be mapped to various truth tables. 
  *    This is true for any fracturable LUTs.
+ *
+ * The hierarchy of physical pbs is stored in a PhysicalPbSkeleton,
+ * which is shared by all the clustered blocks mapped to the same pb_graph_head.
+ * A PhysicalPb only stores the mapping results, i.e., the nets, mode bits,
+ * truth tables and fixed bitstreams of the pbs and pins which are used.
+ * They are stored in flat vectors sorted by pb and then by pin index
+ * (pin_count_in_cluster), instead of one map per physical pb.
  *******************************************************************/
+struct PhysicalPbTruthTable {
+  PhysicalPbId pb;
+  const t_pb_graph_pin* pb_graph_pin;
+  AtomNetlist::TruthTable truth_table;
+};
+
 class PhysicalPb {
   public: /* Types and ranges */
-    typedef vtr::vector<PhysicalPbId, PhysicalPbId>::const_iterator physical_pb_iterator;
-    typedef vtr::Range<physical_pb_iterator> physical_pb_range;
+    typedef PhysicalPbSkeleton::physical_pb_iterator physical_pb_iterator;
+    typedef PhysicalPbSkeleton::physical_pb_range physical_pb_range;
+    typedef std::vector<PhysicalPbTruthTable>::const_iterator truth_table_iterator;
+    typedef vtr::Range<truth_table_iterator> truth_table_range;
+  public: /* Constructors */
+    PhysicalPb() = default;
+    /* Create an empty mapping result on the hierarchy of a skeleton */
+    explicit PhysicalPb(const std::shared_ptr<const PhysicalPbSkeleton>& skeleton);
   public: /* Public aggregators */
     physical_pb_range pbs() const;
     std::vector<PhysicalPbId> primitive_pbs() const;
@@ -52,17 +75,14 @@ class PhysicalPb {
                                     const t_pb_graph_pin* pb_graph_pin) const;
     bool is_wire_lut_output(const PhysicalPbId& pb,
                             const t_pb_graph_pin* pb_graph_pin) const;
-    std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable> truth_tables(const PhysicalPbId& pb) const;
-    std::vector<size_t> mode_bits(const PhysicalPbId& pb) const;
+    /* Truth tables of a pb, sorted by the pin index of output pins */
+    truth_table_range truth_tables(const PhysicalPbId& pb) const;
+    const std::vector<size_t>& mode_bits(const PhysicalPbId& pb) const;
     std::string fixed_bitstream(const PhysicalPbId& pb) const;
     size_t fixed_bitstream_offset(const PhysicalPbId& pb) const;
     std::string fixed_mode_select_bitstream(const PhysicalPbId& pb) const;
     size_t fixed_mode_select_bitstream_offset(const PhysicalPbId& pb) const;
   public: /* Public mutators */
-    PhysicalPbId create_pb(const t_pb_graph_node* pb_graph_node);
-    void add_child(const PhysicalPbId& parent,
-                   const PhysicalPbId& child,
-                   const t_pb_type* child_type);
     void add_atom_block(const PhysicalPbId& pb,
                         const AtomBlockId& atom_block);
     void set_truth_table(const PhysicalPbId& pb,
@@ -87,33 +107,37 @@ class PhysicalPb {
   public: /* Public validators/invalidators */
     bool valid_pb_id(const PhysicalPbId& pb_id) const;
     bool empty() const;
+  private: /* Internal utility */
+    /* Pins are sorted by pb, and then by pin index */
+    typedef std::pair<PhysicalPbId, int> t_pin_key;
+    t_pin_key pin_key(const PhysicalPbId& pb,
+                      const t_pb_graph_pin* pb_graph_pin) const;
+    /* Return the hierarchy, or an empty one if the object is not created from a skeleton */
+    const PhysicalPbSkeleton& skeleton() const;
   private: /* Internal Data */
-    vtr::vector<PhysicalPbId, PhysicalPbId> pb_ids_;
-    vtr::vector<PhysicalPbId, const t_pb_graph_node*> pb_graph_nodes_;
-    vtr::vector<PhysicalPbId, std::string> names_;
-    vtr::vector<PhysicalPbId, std::vector<AtomBlockId>> atom_blocks_;
-    vtr::vector<PhysicalPbId, std::map<const t_pb_graph_pin*, AtomNetId>> pin_atom_nets_;
-    vtr::vector<PhysicalPbId, std::map<const t_pb_graph_pin*, bool>> wire_lut_outputs_;
+    /* The hierarchy shared by all the clustered blocks of the same type */
+    std::shared_ptr<const PhysicalPbSkeleton> skeleton_;
 
-    /* Child pbs are organized as [0..num_child_pb_types-1][0..child_pb_type->num_pb-1] */
-    vtr::vector<PhysicalPbId, std::map<const t_pb_type*, std::vector<PhysicalPbId>>> child_pbs_;
-    vtr::vector<PhysicalPbId, PhysicalPbId> parent_pbs_;
+    /* Mapping results, sorted by pb.
+     * The atom blocks of a pb are kept in the order they are added.
+     */
+    std::vector<std::pair<PhysicalPbId, AtomBlockId>> atom_blocks_;
+    std::vector<std::pair<t_pin_key, AtomNetId>> pin_atom_nets_;
+    std::vector<std::pair<t_pin_key, bool>> wire_lut_outputs_;
 
     /* configuration bits 
      * Truth tables and mode selection
+     * Mode bits are stored only when they differ from the default ones of the skeleton
      */
-    vtr::vector<PhysicalPbId, std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable>> truth_tables_;
-
-    vtr::vector<PhysicalPbId, std::vector<size_t>> mode_bits_;
+    std::vector<PhysicalPbTruthTable> truth_tables_;
 
-    vtr::vector<PhysicalPbId, std::string> fixed_bitstreams_;
-    vtr::vector<PhysicalPbId, size_t> fixed_bitstream_offsets_;
+    std::vector<std::pair<PhysicalPbId, std::vector<size_t>>> mode_bits_;
 
-    vtr::vector<PhysicalPbId, std::string> fixed_mode_select_bitstreams_;
-    vtr::vector<PhysicalPbId, size_t> fixed_mode_select_bitstream_offsets_;
+    std::vector<std::pair<PhysicalPbId, std::string>> fixed_bitstreams_;
+    std::vector<std::pair<PhysicalPbId, size_t>> fixed_bitstream_offsets_;
 
-    /* Fast lookup */
-    std::map<const t_pb_graph_node*, PhysicalPbId> type2id_map_;
+    std::vector<std::pair<PhysicalPbId, std::string>> fixed_mode_select_bitstreams_;
+    std::vector<std::pair<PhysicalPbId, size_t>> fixed_mode_select_bitstream_offsets_;
 };
 
 } /* End namespace openfpga*/
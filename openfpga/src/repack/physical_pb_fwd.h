@@ -17,6 +17,7 @@ struct physical_pb_id_tag;
 typedef vtr::StrongId<physical_pb_id_tag> PhysicalPbId;
 
 class PhysicalPb;
+class PhysicalPbSkeleton;
 
 } /* end namespace openfpga */
 
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Memember functions for data structure PhysicalPbSkeleton
+ ******************************************************************************/
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+#include "physical_pb_skeleton.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Public Accessors 
+ *************************************************/
+PhysicalPbSkeleton::physical_pb_range PhysicalPbSkeleton::pbs() const {
+  return vtr::make_range(pb_ids_.begin(), pb_ids_.end());
+}
+
+std::vector<PhysicalPbId> PhysicalPbSkeleton::primitive_pbs() const {
+  std::vector<PhysicalPbId> results; 
+  /* The primitive pbs are those without any children */
+  for (auto pb : pbs()) {
+    if (true == child_pbs_[pb].empty()) {
+      results.push_back(pb);
+    } 
+  }
+  return results;
+}
+
+std::string PhysicalPbSkeleton::name(const PhysicalPbId& pb) const {
+  VTR_ASSERT(true == valid_pb_id(pb));
+  return names_[pb];
+}
+
+const t_pb_graph_node* PhysicalPbSkeleton::pb_graph_node(const PhysicalPbId& pb) const {
+  VTR_ASSERT(true == valid_pb_id(pb));
+  return pb_graph_nodes_[pb];
+}
+
+/* Find the module id by a given name, return invalid if not found */
+PhysicalPbId PhysicalPbSkeleton::find_pb(const t_pb_graph_node* pb_graph_node) const {
+  if (type2id_map_.find(pb_graph_node) != type2id_map_.end()) {
+    /* Find it, return the id */
+    return type2id_map_.at(pb_graph_node); 
+  }
+  /* Not found, return an invalid id */
+  return PhysicalPbId::INVALID();
+}
+
+PhysicalPbId PhysicalPbSkeleton::parent(const PhysicalPbId& pb) const {
+  VTR_ASSERT(true == valid_pb_id(pb));
+  return parent_pbs_[pb];
+}
+
+PhysicalPbId PhysicalPbSkeleton::child(const PhysicalPbId& pb,
+                                       const t_pb_type* pb_type, 
+                                       const size_t& index) const {
+  VTR_ASSERT(true == valid_pb_id(pb));
+  if (0 < child_pbs_[pb].count(pb_type)) {
+    if (index < child_pbs_[pb].at(pb_type).size()) {
+      return child_pbs_[pb].at(pb_type)[index]; 
+    }
+  }
+  return PhysicalPbId::INVALID();
+}
+
+const std::vector<size_t>& PhysicalPbSkeleton::mode_bits(const PhysicalPbId& pb) const {
+  VTR_ASSERT(true == valid_pb_id(pb));
+  return mode_bits_[pb];
+}
+
+/******************************************************************************
+ * Private Mutators
+ ******************************************************************************/
+PhysicalPbId PhysicalPbSkeleton::create_pb(const t_pb_graph_node* pb_graph_node) {
+  /* Find if the name has been used. If used, return an invalid Id and report error! */
+  std::map<const t_pb_graph_node*, PhysicalPbId>::iterator it = type2id_map_.find(pb_graph_node);
+  if (it != type2id_map_.end()) {
+    return PhysicalPbId::INVALID();
+  }
+
+  /* Create an new id */
+  PhysicalPbId pb = PhysicalPbId(pb_ids_.size());
+  pb_ids_.push_back(pb);
+
+  /* Allocate other attributes */
+  names_.emplace_back();
+  pb_graph_nodes_.push_back(pb_graph_node);
+
+  child_pbs_.emplace_back();
+  parent_pbs_.emplace_back();
+
+  mode_bits_.emplace_back();
+
+  /* Register in the name2id map */
+  type2id_map_[pb_graph_node] = pb;
+
+  return pb;
+}
+
+void PhysicalPbSkeleton::add_child(const PhysicalPbId& parent,
+                                   const PhysicalPbId& child,
+                                   const t_pb_type* child_type) {
+  VTR_ASSERT(true == valid_pb_id(parent)); 
+  VTR_ASSERT(true == valid_pb_id(child)); 
+
+  child_pbs_[parent][child_type].push_back(child);
+
+  if (PhysicalPbId::INVALID() != parent_pbs_[child]) {
+    VTR_LOGF_WARN(__FILE__, __LINE__,
+                  "Overwrite parent '%s' for physical pb '%s' with a new one '%s'!\n",
+                  pb_graph_nodes_[parent_pbs_[child]]->hierarchical_type_name().c_str(),
+                  pb_graph_nodes_[child]->hierarchical_type_name().c_str(),
+                  pb_graph_nodes_[parent]->hierarchical_type_name().c_str());
+  }
+  parent_pbs_[child] = parent;
+}
+
+void PhysicalPbSkeleton::set_mode_bits(const PhysicalPbId& pb,
+                                       const std::vector<size_t>& mode_bits) {
+  VTR_ASSERT(true == valid_pb_id(pb)); 
+   
+  mode_bits_[pb] = mode_bits;
+}
+
+/******************************************************************************
+ * Private validators/invalidators
+ ******************************************************************************/
+bool PhysicalPbSkeleton::valid_pb_id(const PhysicalPbId& pb_id) const {
+  return ( size_t(pb_id) < pb_ids_.size() ) && ( pb_id == pb_ids_[pb_id] ); 
+}
+
+bool PhysicalPbSkeleton::empty() const {
+  return 0 == pb_ids_.size();
+}
+
+} /* end namespace openfpga */
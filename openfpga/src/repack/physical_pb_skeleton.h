@@ -0,0 +1,75 @@
+#ifndef PHYSICAL_PB_SKELETON_H
+#define PHYSICAL_PB_SKELETON_H
+
+/********************************************************************
+ * Include header files required by the data structure definition
+ *******************************************************************/
+#include <map>
+#include <string>
+#include <vector>
+
+/* Headers from vtrutil library */
+#include "vtr_range.h"
+#include "vtr_vector.h"
+
+/* Headers from readarch library */
+#include "physical_types.h"
+
+#include "physical_pb_fwd.h"
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * PhysicalPbSkeleton stores the hierarchy of the physical pbs of
+ * a programmable logical block, i.e., all the pbs of the physical modes
+ * of a pb_graph_head, and the default mode-selection bits of the primitive pbs.
+ *
+ * The hierarchy does not depend on the mapping results, so a skeleton is
+ * built once per pb_graph_head and shared by the PhysicalPb objects of all
+ * the clustered blocks of the same type, which store only the mapping results
+ *******************************************************************/
+class PhysicalPbSkeleton {
+  public: /* Types and ranges */
+    typedef vtr::vector<PhysicalPbId, PhysicalPbId>::const_iterator physical_pb_iterator;
+    typedef vtr::Range<physical_pb_iterator> physical_pb_range;
+  public: /* Public aggregators */
+    physical_pb_range pbs() const;
+    std::vector<PhysicalPbId> primitive_pbs() const;
+    std::string name(const PhysicalPbId& pb) const;
+    const t_pb_graph_node* pb_graph_node(const PhysicalPbId& pb) const;
+    PhysicalPbId find_pb(const t_pb_graph_node* name) const;
+    PhysicalPbId parent(const PhysicalPbId& pb) const;
+    PhysicalPbId child(const PhysicalPbId& pb,
+                       const t_pb_type* pb_type, 
+                       const size_t& index) const;
+    const std::vector<size_t>& mode_bits(const PhysicalPbId& pb) const;
+  public: /* Public mutators */
+    PhysicalPbId create_pb(const t_pb_graph_node* pb_graph_node);
+    void add_child(const PhysicalPbId& parent,
+                   const PhysicalPbId& child,
+                   const t_pb_type* child_type);
+    void set_mode_bits(const PhysicalPbId& pb,
+                       const std::vector<size_t>& mode_bits);
+  public: /* Public validators/invalidators */
+    bool valid_pb_id(const PhysicalPbId& pb_id) const;
+    bool empty() const;
+  private: /* Internal Data */
+    vtr::vector<PhysicalPbId, PhysicalPbId> pb_ids_;
+    vtr::vector<PhysicalPbId, const t_pb_graph_node*> pb_graph_nodes_;
+    vtr::vector<PhysicalPbId, std::string> names_;
+
+    /* Child pbs are organized as [0..num_child_pb_types-1][0..child_pb_type->num_pb-1] */
+    vtr::vector<PhysicalPbId, std::map<const t_pb_type*, std::vector<PhysicalPbId>>> child_pbs_;
+    vtr::vector<PhysicalPbId, PhysicalPbId> parent_pbs_;
+
+    /* Default mode selection bits */
+    vtr::vector<PhysicalPbId, std::vector<size_t>> mode_bits_;
+
+    /* Fast lookup */
+    std::map<const t_pb_graph_node*, PhysicalPbId> type2id_map_;
+};
+
+} /* End namespace openfpga*/
+
+#endif
@@ -1,11 +1,15 @@
 /***************************************************************************************
  * This file includes functions that are used to redo packing for physical pbs
  ***************************************************************************************/
+#include <map>
+#include <memory>
+#include <unordered_map>
 
 /* Headers from vtrutil library */
 #include "vtr_log.h"
 #include "vtr_assert.h"
 #include "vtr_time.h"
+#include "vtr_hash.h"
 
 /* Headers from vpr library */
 #include "vpr_utils.h"
@@ -20,6 +24,36 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/***************************************************************************************
+ * The routing problem of a clustered block: the routing resource graph of its type
+ * and the source and sink nodes of each net to route, in the order of the nets.
+ * The design constraints are already applied when the nets are created.
+ * As the router only depends on these, the clustered blocks with the same routing problem
+ * are routed in the same way, whatever the atom nets they are mapped to
+ ***************************************************************************************/
+struct LbRouteProblem {
+  const LbRRGraph* lb_rr_graph;
+  /* For each net: the number of sources, the sources, the number of sinks and the sinks */
+  std::vector<size_t> net_terminals;
+
+  bool operator==(const LbRouteProblem& other) const {
+    return (lb_rr_graph == other.lb_rr_graph) && (net_terminals == other.net_terminals);
+  }
+};
+
+struct LbRouteProblemHash {
+  size_t operator()(const LbRouteProblem& problem) const {
+    size_t seed = std::hash<const LbRRGraph*>()(problem.lb_rr_graph);
+    for (const size_t& terminal : problem.net_terminals) {
+      vtr::hash_combine(seed, terminal);
+    }
+    return seed;
+  }
+};
+
+/* The routing nodes used by each net for the routing problems already solved */
+typedef std::unordered_map<LbRouteProblem, std::vector<std::vector<LbRRNodeId>>, LbRouteProblemHash> LbRouteCache;
+
 /***************************************************************************************
  * Try to find sink pb graph pins through walking through the fan-out edges from
  * the source pb graph pin
@@ -662,7 +696,8 @@ void add_lb_router_nets(LbRouter& lb_router,
  *   and initilize the logcial tile router 
  * - Create nets to be routed, including the source nodes and terminals
  *   This should consider the net remapping in the clustering_annotation 
- * - Run the router to finish the repacking
+ * - Run the router to finish the repacking, 
+ *   unless a clustered block with the same routing problem has been routed already
  * - Output routing results to data structure PhysicalPb and store it in clustering annotation
  ***************************************************************************************/
 static 
@@ -672,6 +707,8 @@ void repack_cluster(const AtomContext& atom_ctx,
                     VprClusteringAnnotation& clustering_annotation,
                     const VprBitstreamAnnotation& bitstream_annotation,
                     const RepackDesignConstraints& design_constraints,
+                    std::map<const t_pb_graph_node*, std::shared_ptr<const PhysicalPbSkeleton>>& phy_pb_skeletons,
+                    LbRouteCache& lb_route_cache,
                     const ClusterBlockId& block_id,
                     const bool& verbose) {
   /* Get the pb graph that current clustered block is mapped to */
@@ -696,24 +733,57 @@ void repack_cluster(const AtomContext& atom_ctx,
                      design_constraints,
                      block_id, verbose);
 
-  /* Initialize the modes to expand routing trees with the physical modes in device annotation
-   * This is a must-do before running the routeri in the purpose of repacking!!!
-   */
-  lb_router.set_physical_pb_modes(lb_rr_graph, device_annotation); 
+  /* Canonicalize the routing problem and find if it has been solved already */
+  LbRouteProblem route_problem;
+  route_problem.lb_rr_graph = &lb_rr_graph;
+  std::vector<AtomNetId> net_atom_nets;
+  for (const LbRouter::NetId& net : lb_router.nets()) {
+    route_problem.net_terminals.push_back(lb_router.net_sources(net).size());
+    for (const LbRRNodeId& source : lb_router.net_sources(net)) {
+      route_problem.net_terminals.push_back(size_t(source));
+    }
+    route_problem.net_terminals.push_back(lb_router.net_sinks(net).size());
+    for (const LbRRNodeId& sink : lb_router.net_sinks(net)) {
+      route_problem.net_terminals.push_back(size_t(sink));
+    }
+    net_atom_nets.push_back(lb_router.net_atom_net_id(net));
+  }
+
+  auto cached_route = lb_route_cache.find(route_problem);
+  if (lb_route_cache.end() != cached_route) {
+    VTR_LOGV(verbose, "Reuse the routing results of an identical clustered block\n");
+  } else {
+    /* Initialize the modes to expand routing trees with the physical modes in device annotation
+     * This is a must-do before running the routeri in the purpose of repacking!!!
+     */
+    lb_router.set_physical_pb_modes(lb_rr_graph, device_annotation); 
 
-  /* Run the router */
-  bool route_success = lb_router.try_route(lb_rr_graph, atom_ctx.nlist, verbose);
+    /* Run the router */
+    bool route_success = lb_router.try_route(lb_rr_graph, atom_ctx.nlist, verbose);
 
-  if (false == route_success) {
-    VTR_LOGV(verbose, "Reroute failed\n");
-    exit(1);
+    if (false == route_success) {
+      VTR_LOGV(verbose, "Reroute failed\n");
+      exit(1);
+    }
+    VTR_ASSERT(true == route_success);
+    VTR_LOGV(verbose, "Reroute succeed\n");
+
+    std::vector<std::vector<LbRRNodeId>> net_routed_nodes;
+    for (const LbRouter::NetId& net : lb_router.nets()) {
+      net_routed_nodes.push_back(lb_router.net_routed_nodes(net));
+    }
+    cached_route = lb_route_cache.emplace(std::move(route_problem), std::move(net_routed_nodes)).first;
   }
-  VTR_ASSERT(true == route_success);
-  VTR_LOGV(verbose, "Reroute succeed\n");
 
-  /* Annotate routing results to physical pb */
-  PhysicalPb phy_pb;
-  alloc_physical_pb_from_pb_graph(phy_pb, pb_graph_head, device_annotation);
+  /* Annotate routing results to physical pb
+   * The hierarchy of physical pbs is built once for each type of clustered blocks
+   */
+  if (phy_pb_skeletons.end() == phy_pb_skeletons.find(pb_graph_head)) {
+    std::shared_ptr<PhysicalPbSkeleton> phy_pb_skeleton = std::make_shared<PhysicalPbSkeleton>();
+    alloc_physical_pb_skeleton_from_pb_graph(*phy_pb_skeleton, pb_graph_head, device_annotation);
+    phy_pb_skeletons[pb_graph_head] = phy_pb_skeleton;
+  }
+  PhysicalPb phy_pb(phy_pb_skeletons.at(pb_graph_head));
   rec_update_physical_pb_from_operating_pb(phy_pb,
                                            clustering_ctx.clb_nlist.block_pb(block_id),
                                            clustering_ctx.clb_nlist.block_pb(block_id)->pb_route,
@@ -721,8 +791,8 @@ void repack_cluster(const AtomContext& atom_ctx,
                                            device_annotation,
                                            bitstream_annotation,
                                            verbose);
-  /* Save routing results */
-  save_lb_router_results_to_physical_pb(phy_pb, lb_router, lb_rr_graph);
+  /* Save routing results, with the nets of this clustered block */
+  save_lb_routed_nodes_to_physical_pb(phy_pb, net_atom_nets, cached_route->second, lb_rr_graph);
   VTR_LOGV(verbose, "Saved results in physical pb\n");
 
   /* Add the pb to clustering context */
@@ -744,14 +814,27 @@ void repack_clusters(const AtomContext& atom_ctx,
                      const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Repack clustered blocks to physical implementation of logical tile");
 
+  /* Hierarchy of physical pbs shared by the clustered blocks of the same type */
+  std::map<const t_pb_graph_node*, std::shared_ptr<const PhysicalPbSkeleton>> phy_pb_skeletons;
+
+  /* Routing results shared by the clustered blocks with the same routing problem */
+  LbRouteCache lb_route_cache;
+
   for (auto blk_id : clustering_ctx.clb_nlist.blocks()) {
     repack_cluster(atom_ctx, clustering_ctx, 
                    device_annotation,
                    clustering_annotation, 
                    bitstream_annotation,
                    design_constraints,
+                   phy_pb_skeletons,
+                   lb_route_cache,
                    blk_id, verbose);
   }
+
+  /* Each routing problem which is not found in the cache is routed and added to it */
+  VTR_LOG("Reused the routing results for %lu out of %lu clustered blocks\n",
+          clustering_ctx.clb_nlist.blocks().size() - lb_route_cache.size(),
+          clustering_ctx.clb_nlist.blocks().size());
 }
 
 /***************************************************************************************
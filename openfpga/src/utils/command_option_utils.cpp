@@ -0,0 +1,51 @@
+/********************************************************************
+ * This file includes functions to read the values of the options
+ * which are shared by several OpenFPGA commands
+ *******************************************************************/
+#include <cstdlib>
+#include <string>
+
+/* Headers from vtrutil library */
+#include "vtr_log.h"
+
+/* Headers from openfpgashell library */
+#include "command_exit_codes.h"
+
+#include "command_option_utils.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * Read the number of threads given by the option '--jobs' of a command
+ * The number of jobs is 1 when the option is not enabled, and 0 means
+ * all the cores (see vtr::parallel_for_chunks())
+ * Error out if the value is negative or not a number
+ *******************************************************************/
+int read_num_jobs_option(const Command& cmd,
+                         const CommandContext& cmd_context,
+                         size_t& num_jobs) {
+  num_jobs = 1;
+
+  CommandOptionId opt_jobs = cmd.option("jobs");
+  if (false == cmd_context.option_enable(cmd, opt_jobs)) {
+    return CMD_EXEC_SUCCESS;
+  }
+
+  std::string value = cmd_context.option_value(cmd, opt_jobs);
+  char* end = nullptr;
+  long jobs = std::strtol(value.c_str(), &end, 10);
+  if ( (true == value.empty())
+    || ('\0' != *end)
+    || (0 > jobs) ) {
+    VTR_LOG_ERROR("Invalid number of jobs '%s' which should be 0 or a positive number!\n",
+                  value.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  num_jobs = jobs;
+
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,23 @@
+#ifndef COMMAND_OPTION_UTILS_H
+#define COMMAND_OPTION_UTILS_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include "command.h"
+#include "command_context.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+int read_num_jobs_option(const Command& cmd,
+                         const CommandContext& cmd_context,
+                         size_t& num_jobs);
+
+} /* end namespace openfpga */
+
+#endif
@@ -65,4 +65,34 @@ size_t find_device_rr_gsb_num_gsb_modules(const DeviceRRGSB& device_rr_gsb) {
 
 }
 
+/********************************************************************
+ * Find all the GSBs of a device which include a switch block
+ * or a given type of connection block
+ *******************************************************************/
+std::vector<const RRGSB*> find_device_rr_gsbs_with_module(const DeviceRRGSB& device_rr_gsb,
+                                                          const bool& sb_module,
+                                                          const t_rr_type& cb_type) {
+  std::vector<const RRGSB*> rr_gsbs;
+
+  vtr::Point<size_t> gsb_range = device_rr_gsb.get_gsb_range();
+  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
+    for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
+      /* Check if the block exists in the device!
+       * Some of them do NOT exist due to heterogeneous blocks (height > 1) 
+       * We will skip those modules
+       */
+      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
+      if ( (true == sb_module) && (false == rr_gsb.is_sb_exist()) ) {
+        continue;
+      }
+      if ( (false == sb_module) && (false == rr_gsb.is_cb_exist(cb_type)) ) {
+        continue;
+      }
+      rr_gsbs.push_back(&rr_gsb);
+    }
+  }
+
+  return rr_gsbs;
+}
+
 } /* end namespace openfpga */
@@ -22,6 +22,10 @@ size_t find_device_rr_gsb_num_sb_modules(const DeviceRRGSB& device_rr_gsb);
 
 size_t find_device_rr_gsb_num_gsb_modules(const DeviceRRGSB& device_rr_gsb);
 
+std::vector<const RRGSB*> find_device_rr_gsbs_with_module(const DeviceRRGSB& device_rr_gsb,
+                                                          const bool& sb_module,
+                                                          const t_rr_type& cb_type);
+
 } /* end namespace openfpga */
 
 #endif
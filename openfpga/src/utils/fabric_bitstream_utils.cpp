@@ -6,6 +6,7 @@
  ***********************************************************************/
 
 #include <algorithm>
+#include <unordered_map>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -118,31 +119,42 @@ ConfigChainFabricBitstream build_config_chain_fabric_bitstream_by_region(const B
  *******************************************************************/
 FrameFabricBitstream build_frame_based_fabric_bitstream_by_address(const FabricBitstream& fabric_bitstream) {
   FrameFabricBitstream fabric_bits_by_addr;
+  /* Index of each address in fabric_bits_by_addr */
+  std::unordered_map<PackedBitAddress, size_t, PackedBitAddressHash> addr_indices;
+  addr_indices.reserve(fabric_bitstream.num_bits());
+
   for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
     for (const FabricBitId& bit_id : fabric_bitstream.region_bits(region)) {
-      /* Create string for address */
-      std::string addr_str;
-      for (const char& addr_bit : fabric_bitstream.bit_address(bit_id)) {
-        addr_str.push_back(addr_bit);
-      }
+      PackedBitAddress addr(fabric_bitstream.bit_address(bit_id));
 
       /* Expand all the don't care bits */
-      for (const std::string& curr_addr_str : expand_dont_care_bin_str(addr_str)) {
+      std::vector<PackedBitAddress> curr_addrs;
+      if (addr.has_dont_care()) {
+        curr_addrs = addr.expand_dont_care_bits();
+      } else {
+        curr_addrs.push_back(addr);
+      }
+
+      for (const PackedBitAddress& curr_addr : curr_addrs) {
         /* Place the config bit */
-        auto result = fabric_bits_by_addr.find(curr_addr_str);
-        if (result == fabric_bits_by_addr.end()) {
+        auto result = addr_indices.emplace(curr_addr, fabric_bits_by_addr.size());
+        if (true == result.second) {
           /* This is a new bit, resize the vector to the number of regions
            * and deposit '0' to all the bits
            */
-          fabric_bits_by_addr[curr_addr_str] = std::vector<bool>(fabric_bitstream.regions().size(), false);
-          fabric_bits_by_addr[curr_addr_str][size_t(region)] = fabric_bitstream.bit_din(bit_id);
-        } else {
-          VTR_ASSERT_SAFE(result != fabric_bits_by_addr.end());
-          result->second[size_t(region)] = fabric_bitstream.bit_din(bit_id);
+          fabric_bits_by_addr.emplace_back(curr_addr, std::vector<bool>(fabric_bitstream.regions().size(), false));
         }
+        fabric_bits_by_addr[result.first->second].second[size_t(region)] = fabric_bitstream.bit_din(bit_id);
       }
     }
   }
+
+  /* Output the bits in the order of their addresses */
+  std::sort(fabric_bits_by_addr.begin(), fabric_bits_by_addr.end(),
+            [](const std::pair<PackedBitAddress, std::vector<bool>>& lhs,
+               const std::pair<PackedBitAddress, std::vector<bool>>& rhs) {
+              return lhs.first < rhs.first;
+            });
   
   return fabric_bits_by_addr;
 }
@@ -167,8 +179,17 @@ FrameFabricBitstream build_frame_based_fabric_bitstream_by_address(const FabricB
  *******************************************************************/
 size_t find_frame_based_fast_configuration_fabric_bitstream_size(const FabricBitstream& fabric_bitstream,
                                                                  const bool& bit_value_to_skip) {
-  FrameFabricBitstream fabric_bits_by_addr = build_frame_based_fabric_bitstream_by_address(fabric_bitstream);
+  return find_frame_based_fast_configuration_fabric_bitstream_size(build_frame_based_fabric_bitstream_by_address(fabric_bitstream),
+                                                              bit_value_to_skip);
+}
 
+/********************************************************************
+ * Same as above, but for a fabric bitstream which is already reorganized by address.
+ * Building the reorganized bitstream is much more expensive than counting,
+ * so callers which also need the reorganized bitstream should use this one
+ *******************************************************************/
+size_t find_frame_based_fast_configuration_fabric_bitstream_size(const FrameFabricBitstream& fabric_bits_by_addr,
+                                                                 const bool& bit_value_to_skip) {
   size_t num_bits = 0;
 
   for (const auto& addr_din_pair : fabric_bits_by_addr) {
@@ -234,72 +255,53 @@ MemoryBankFabricBitstream build_memory_bank_fabric_bitstream_by_address(const Fa
 }
 
 MemoryBankFlattenFabricBitstream build_memory_bank_flatten_fabric_bitstream(const FabricBitstream& fabric_bitstream,
-                                                                            const bool& fast_configuration,
+                                                                            const bool& /*fast_configuration*/,
                                                                             const bool& bit_value_to_skip,
                                                                             const char& dont_care_bit) {
-  /* If fast configuration is not enabled, we need all the wl address even some of them have all-dont-care-bits BLs */
-  if (!fast_configuration) {
-    vtr::vector<FabricBitRegionId, std::map<std::string, std::string>> fabric_bits_per_region;
-    fabric_bits_per_region.resize(fabric_bitstream.num_regions());
-    for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
-      for (const FabricBitId& bit_id : fabric_bitstream.region_bits(region)) {
-        /* Create string for BL address with complete don't care bits */
-        std::string bl_addr_str(fabric_bitstream.bit_bl_address(bit_id).size(), dont_care_bit);
-
-        /* Create string for WL address */
-        std::string wl_addr_str;
-        for (const char& addr_bit : fabric_bitstream.bit_wl_address(bit_id)) {
-          wl_addr_str.push_back(addr_bit);
-        }
-
-        /* Deposit the config bit */
-        fabric_bits_per_region[region][wl_addr_str] = bl_addr_str;
-      }
-    }
-  }
-
-  /* Build the bitstream by each region, here we use (WL, BL) pairs when storing bitstreams */
-  vtr::vector<FabricBitRegionId, std::map<std::string, std::string>> fabric_bits_per_region;
+  /* Note: all the WL addresses are kept whether fast configuration is enabled or not,
+   * since a WL whose BLs are all skipped still appears with all-'0' BLs.
+   * So fast configuration does not change the bitstream here
+   */
+  /* Build the bitstream by each region, here we use (WL, BL) pairs when storing bitstreams
+   * The addresses are bucketed in hash tables, and sorted only once all the bits are merged
+   */
+  typedef std::unordered_map<PackedBitAddress, PackedBitAddress, PackedBitAddressHash> RegionalBitstream;
+  vtr::vector<FabricBitRegionId, RegionalBitstream> fabric_bits_per_region;
   fabric_bits_per_region.resize(fabric_bitstream.num_regions());
   for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
     for (const FabricBitId& bit_id : fabric_bitstream.region_bits(region)) {
-      /* Create string for BL address */
-      std::string bl_addr_str;
-      for (const char& addr_bit : fabric_bitstream.bit_bl_address(bit_id)) {
-        bl_addr_str.push_back(addr_bit);
-      }
+      PackedBitAddress bl_addr(fabric_bitstream.bit_bl_address(bit_id));
 
       /* If this bit should be programmed to 0, convert the 1s in BL to 0s  */
       if (fabric_bitstream.bit_din(bit_id) == bit_value_to_skip) {
-        replace_str_bits(bl_addr_str, '1', '0');
+        bl_addr.clear_ones();
       }
 
-      /* Create string for WL address */
-      std::string wl_addr_str;
-      for (const char& addr_bit : fabric_bitstream.bit_wl_address(bit_id)) {
-        wl_addr_str.push_back(addr_bit);
-      }
+      PackedBitAddress wl_addr(fabric_bitstream.bit_wl_address(bit_id));
 
       /* Place the config bit */
-      auto result = fabric_bits_per_region[region].find(wl_addr_str);
+      auto result = fabric_bits_per_region[region].find(wl_addr);
       if (result == fabric_bits_per_region[region].end()) {
-        fabric_bits_per_region[region][wl_addr_str] = bl_addr_str;
+        fabric_bits_per_region[region].emplace(std::move(wl_addr), std::move(bl_addr));
       } else {
-        VTR_ASSERT_SAFE(result != fabric_bits_per_region[region].end());
-        result->second = combine_two_1hot_str(result->second, bl_addr_str);
+        result->second.combine(bl_addr);
       }
     }
   }
 
-  /* Find all the keys for the hash tables containing bitstream of each region */
-  vtr::vector<FabricBitRegionId, std::vector<std::string>> fabric_bits_per_region_keys;
+  /* Find all the keys for the hash tables containing bitstream of each region, in the order of the WL addresses */
+  vtr::vector<FabricBitRegionId, std::vector<const PackedBitAddress*>> fabric_bits_per_region_keys;
   fabric_bits_per_region_keys.resize(fabric_bitstream.num_regions());
   for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
     /* Pre-allocate memory, because the key size may be large */
     fabric_bits_per_region_keys[region].reserve(fabric_bits_per_region[region].size());
     for (const auto& pair : fabric_bits_per_region[region]) {
-      fabric_bits_per_region_keys[region].push_back(pair.first);
+      fabric_bits_per_region_keys[region].push_back(&pair.first);
     } 
+    std::sort(fabric_bits_per_region_keys[region].begin(), fabric_bits_per_region_keys[region].end(),
+              [](const PackedBitAddress* lhs, const PackedBitAddress* rhs) {
+                return *lhs < *rhs;
+              });
   }
 
   /* Find the maxium key size */
@@ -323,18 +325,19 @@ MemoryBankFlattenFabricBitstream build_memory_bank_flatten_fabric_bitstream(cons
   MemoryBankFlattenFabricBitstream fabric_bits;
   for (size_t ikey = 0; ikey < max_key_size; ikey++) {
     /* Prepare the final BL/WL vectors to be added to the bitstream database */
-    std::vector<std::string> cur_bl_vectors;
-    std::vector<std::string> cur_wl_vectors;
+    std::vector<PackedBitAddress> cur_bl_vectors;
+    std::vector<PackedBitAddress> cur_wl_vectors;
     for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
       /* If the key id is in bound for the key list in this region, find the BL and WL and add to the final bitstream database
        * If the key id is out of bound for the key list in this region, we append an all-'x' string for both BL and WLs
        */
       if (ikey < fabric_bits_per_region_keys[region].size()) {
-        cur_wl_vectors.push_back(fabric_bits_per_region_keys[region][ikey]);
-        cur_bl_vectors.push_back(fabric_bits_per_region[region].at(fabric_bits_per_region_keys[region][ikey]));
+        const PackedBitAddress& wl_addr = *fabric_bits_per_region_keys[region][ikey];
+        cur_wl_vectors.push_back(wl_addr);
+        cur_bl_vectors.push_back(fabric_bits_per_region[region].at(wl_addr));
       } else {
-        cur_wl_vectors.push_back(std::string(max_blwl_sizes_per_region[region].second, dont_care_bit));
-        cur_bl_vectors.push_back(std::string(max_blwl_sizes_per_region[region].first, dont_care_bit));
+        cur_wl_vectors.push_back(PackedBitAddress(max_blwl_sizes_per_region[region].second, dont_care_bit));
+        cur_bl_vectors.push_back(PackedBitAddress(max_blwl_sizes_per_region[region].first, dont_care_bit));
       }
     }
     /* Add the pair to std map */
@@ -407,7 +410,7 @@ std::vector<std::string> reshape_bitstream_vectors_to_first_element(const std::v
  *   10xxx1 
  */
 static 
-std::vector<std::string> redistribute_bl_vectors_to_shift_register_banks(const std::vector<std::string> bl_vectors, 
+std::vector<std::string> redistribute_bl_vectors_to_shift_register_banks(const std::vector<PackedBitAddress>& bl_vectors, 
                                                                          const MemoryBankShiftRegisterBanks& blwl_sr_banks,
                                                                          const char& dont_care_bit) {
   std::vector<std::string> multi_bank_bl_vec;
@@ -433,7 +436,7 @@ std::vector<std::string> redistribute_bl_vectors_to_shift_register_banks(const s
     }
   }
 
-  for (const std::string& region_bl_vec : bl_vectors) {
+  for (const PackedBitAddress& region_bl_vec : bl_vectors) {
     ConfigRegionId region = ConfigRegionId(&region_bl_vec - &bl_vectors[0]);
     for (size_t ibit = 0; ibit < region_bl_vec.size(); ++ibit) {
       /* Find the shift register bank id and the offset in data lines */
@@ -443,7 +446,7 @@ std::vector<std::string> redistribute_bl_vectors_to_shift_register_banks(const s
       VTR_ASSERT(1 == sr_port.get_width());
       
       size_t vec_index = region_start_index[region] + size_t(bank_id);
-      multi_bank_bl_vec[vec_index][sr_port.get_lsb()] = region_bl_vec[ibit];
+      multi_bank_bl_vec[vec_index][sr_port.get_lsb()] = region_bl_vec.bit(ibit);
     }
   }
 
@@ -458,7 +461,7 @@ std::vector<std::string> redistribute_bl_vectors_to_shift_register_banks(const s
  *   10xxx1 
  */
 static 
-std::vector<std::string> redistribute_wl_vectors_to_shift_register_banks(const std::vector<std::string> wl_vectors, 
+std::vector<std::string> redistribute_wl_vectors_to_shift_register_banks(const std::vector<PackedBitAddress>& wl_vectors, 
                                                                          const MemoryBankShiftRegisterBanks& blwl_sr_banks,
                                                                          const char& dont_care_bit) {
   std::vector<std::string> multi_bank_wl_vec;
@@ -484,7 +487,7 @@ std::vector<std::string> redistribute_wl_vectors_to_shift_register_banks(const s
     }
   }
 
-  for (const std::string& region_wl_vec : wl_vectors) {
+  for (const PackedBitAddress& region_wl_vec : wl_vectors) {
     ConfigRegionId region = ConfigRegionId(&region_wl_vec - &wl_vectors[0]);
     for (size_t ibit = 0; ibit < region_wl_vec.size(); ++ibit) {
       /* Find the shift register bank id and the offset in data lines */
@@ -494,7 +497,7 @@ std::vector<std::string> redistribute_wl_vectors_to_shift_register_banks(const s
       VTR_ASSERT(1 == sr_port.get_width());
       
       size_t vec_index = region_start_index[region] + size_t(bank_id);
-      multi_bank_wl_vec[vec_index][sr_port.get_lsb()] = region_wl_vec[ibit];
+      multi_bank_wl_vec[vec_index][sr_port.get_lsb()] = region_wl_vec.bit(ibit);
     }
   }
 
@@ -511,7 +514,7 @@ MemoryBankShiftRegisterFabricBitstream build_memory_bank_shift_register_fabric_b
 
   /* Iterate over each word */   
   for (const auto& wl_vec : raw_fabric_bits.wl_vectors()) {
-    std::vector<std::string> bl_vec = raw_fabric_bits.bl_vector(wl_vec);
+    const std::vector<PackedBitAddress>& bl_vec = raw_fabric_bits.bl_vector(wl_vec);
 
     MemoryBankShiftRegisterFabricBitstreamWordId word_id = fabric_bits.create_word();
 
@@ -563,8 +566,17 @@ MemoryBankShiftRegisterFabricBitstream build_memory_bank_shift_register_fabric_b
  *******************************************************************/
 size_t find_memory_bank_fast_configuration_fabric_bitstream_size(const FabricBitstream& fabric_bitstream,
                                                                  const bool& bit_value_to_skip) {
-  MemoryBankFabricBitstream fabric_bits_by_addr = build_memory_bank_fabric_bitstream_by_address(fabric_bitstream);
+  return find_memory_bank_fast_configuration_fabric_bitstream_size(build_memory_bank_fabric_bitstream_by_address(fabric_bitstream),
+                                                              bit_value_to_skip);
+}
 
+/********************************************************************
+ * Same as above, but for a fabric bitstream which is already reorganized by address.
+ * Building the reorganized bitstream is much more expensive than counting,
+ * so callers which also need the reorganized bitstream should use this one
+ *******************************************************************/
+size_t find_memory_bank_fast_configuration_fabric_bitstream_size(const MemoryBankFabricBitstream& fabric_bits_by_addr,
+                                                                 const bool& bit_value_to_skip) {
   size_t num_bits = 0;
 
   for (const auto& addr_din_pair : fabric_bits_by_addr) {
@@ -15,6 +15,7 @@
 #include "memory_bank_shift_register_banks.h"
 #include "memory_bank_shift_register_fabric_bitstream.h"
 #include "fabric_bitstream.h"
+#include "packed_bit_address.h"
 
 /********************************************************************
  * Function declaration
@@ -34,13 +35,18 @@ typedef std::vector<std::vector<bool>> ConfigChainFabricBitstream;
 ConfigChainFabricBitstream build_config_chain_fabric_bitstream_by_region(const BitstreamManager& bitstream_manager,
                                                                          const FabricBitstream& fabric_bitstream);
 
-/* Alias to a specific organization of bitstreams for frame-based configuration protocol */
-typedef std::map<std::string, std::vector<bool>> FrameFabricBitstream;
+/* Alias to a specific organization of bitstreams for frame-based configuration protocol:
+ * (address, data inputs of each region) pairs, sorted by address
+ */
+typedef std::vector<std::pair<PackedBitAddress, std::vector<bool>>> FrameFabricBitstream;
 FrameFabricBitstream build_frame_based_fabric_bitstream_by_address(const FabricBitstream& fabric_bitstream);
 
 size_t find_frame_based_fast_configuration_fabric_bitstream_size(const FabricBitstream& fabric_bitstream,
                                                                  const bool& bit_value_to_skip);
 
+size_t find_frame_based_fast_configuration_fabric_bitstream_size(const FrameFabricBitstream& fabric_bits_by_addr,
+                                                                 const bool& bit_value_to_skip);
+
 /********************************************************************
  * @ brief Reorganize the fabric bitstream for memory banks which use flatten BL and WLs
  * For each configuration region, we will merge BL address (which are 1-hot codes) under the same WL address
@@ -107,6 +113,9 @@ MemoryBankFabricBitstream build_memory_bank_fabric_bitstream_by_address(const Fa
 size_t find_memory_bank_fast_configuration_fabric_bitstream_size(const FabricBitstream& fabric_bitstream,
                                                                  const bool& bit_value_to_skip);
 
+size_t find_memory_bank_fast_configuration_fabric_bitstream_size(const MemoryBankFabricBitstream& fabric_bits_by_addr,
+                                                                 const bool& bit_value_to_skip);
+
 } /* end namespace openfpga */
 
 #endif
@@ -11,6 +11,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_decode.h"
 
+#include "packed_truth_table.h"
 #include "lut_utils.h"
 
 /* begin namespace openfpga */
@@ -263,118 +264,6 @@ bool lut_truth_table_use_on_set(const AtomNetlist::TruthTable& truth_table) {
   return on_set;
 }
 
-/********************************************************************
- * Complete a line in truth table with a given lut size
- * Due to the size of truth table may be less than the lut size.
- * i.e. in LUT-6 architecture, there exists LUT1-6 in technology-mapped netlists
- * So, in truth table line, there may be 10- 1
- * In this case, we should complete it by --10- 1
- *******************************************************************/
-static 
-std::vector<vtr::LogicValue> complete_truth_table_line(const size_t& lut_size,
-                                                       const std::vector<vtr::LogicValue>& tt_line) {
-  std::vector<vtr::LogicValue> ret;
-
-  VTR_ASSERT(0 < tt_line.size());
-
-  /* Complete the truth table line*/
-  size_t cover_len = tt_line.size() - 1; 
-  VTR_ASSERT(cover_len <= lut_size);
-
-  /* Copy the original truth table line */ 
-  ret = tt_line;
-  /* Kick out the last value for now as it is the output value */
-  ret.pop_back();
-
-  /* Add the number of '-' we should add in the back !!! */
-  for (size_t j = cover_len; j < lut_size; ++j) {
-    ret.push_back(vtr::LogicValue::DONT_CARE);
-  }
-
-  /* Copy the original truth table line */ 
-  ret.push_back(tt_line.back());
-
-  /* Check if the size of ret matches our expectation */
-  VTR_ASSERT(lut_size + 1 == ret.size());
-  
-  return ret;
-}
-
-/********************************************************************
- * For each lut_bit_lines, we should recover the truth table,
- * and then set the sram bits to "1" if the truth table defines so.
- * Start_point: the position we start converting don't care sign '-'
- *              to explicit '0' or '1'
- *******************************************************************/
-static 
-void rec_build_lut_bitstream_per_line(std::vector<bool>& lut_bitstream, 
-                                      const size_t& lut_size,
-                                      const std::vector<vtr::LogicValue>& tt_line,
-                                      const size_t& start_point) {
-  std::vector<vtr::LogicValue> temp_line = tt_line;
-
-  /* Check the length of sram bits and truth table line */
-  VTR_ASSERT(lut_size + 1 == tt_line.size()); /* lut_size + '1|0' */
-
-  /* End of truth_table_line should be "space" and "1" */ 
-  VTR_ASSERT( (vtr::LogicValue::TRUE == tt_line.back())
-           || (vtr::LogicValue::FALSE == tt_line.back()) );
-
-  /* Make sure before start point there is no '-' */
-  VTR_ASSERT(start_point < tt_line.size());
-  for (size_t i = 0; i < start_point; ++i) {
-    VTR_ASSERT(vtr::LogicValue::DONT_CARE != tt_line[i]);
-  }
-
-  /* Configure sram bits recursively */
-  for (size_t i = start_point; i < lut_size; ++i) {
-    if (vtr::LogicValue::DONT_CARE == tt_line[i]) {
-      /* if we find a dont_care, we don't do configure now but recursively*/
-      /* '0' branch */
-      temp_line[i] = vtr::LogicValue::FALSE; 
-      rec_build_lut_bitstream_per_line(lut_bitstream, lut_size, temp_line, start_point + 1);
-      /* '1' branch */
-      temp_line[i] = vtr::LogicValue::TRUE; 
-      rec_build_lut_bitstream_per_line(lut_bitstream, lut_size, temp_line, start_point + 1);
-      return; 
-    }
-  }
-
-  /* TODO: Use MuxGraph to decode this!!! */
-  /* Decode bitstream only when there are only 0 or 1 in the truth table */
-  size_t sram_id = 0;
-  for (size_t i = 0; i < lut_size; ++i) {
-    /* Should be either '0' or '1' */
-    switch (tt_line[i]) {
-    case vtr::LogicValue::FALSE :
-      /* We assume the 1-lut pass sram1 when input = 0 */
-      sram_id += (size_t)pow(2., (double)(i));
-      break;
-    case vtr::LogicValue::TRUE :
-      /* We assume the 1-lut pass sram0 when input = 1 */
-      break;
-    case vtr::LogicValue::DONT_CARE :
-    default :
-      VTR_LOGF_ERROR(__FILE__, __LINE__, 
-                     "Invalid truth_table bit '%s', should be [0|1|]!\n",
-                     vtr::LOGIC_VALUE_STRING[size_t(tt_line[i])]); 
-      exit(1);
-    }
-  }
-  /* Set the sram bit to '1'*/
-  VTR_ASSERT(sram_id < lut_bitstream.size());
-  if (vtr::LogicValue::TRUE == tt_line.back()) {
-    lut_bitstream[sram_id] = true; /* on set*/
-  } else if (vtr::LogicValue::FALSE == tt_line.back()) {
-    lut_bitstream[sram_id] = false; /* off set */
-  } else {
-    VTR_LOGF_ERROR(__FILE__, __LINE__, 
-                   "Invalid truth_table_line ending '%s'!\n",
-                   vtr::LOGIC_VALUE_STRING[size_t(tt_line.back())]);
-    exit(1);
-  }
-}
-
 /********************************************************************
  * Generate the bitstream for a single-output LUT with a given truth table
  * As truth tables may come from different logic blocks, truth tables could be in on and off sets
@@ -387,21 +276,17 @@ std::vector<bool> build_single_output_lut_bitstream(const AtomNetlist::TruthTabl
                                                     const size_t& default_sram_bit_value) {
   size_t lut_size = lut_mux_graph.num_memory_bits();
   size_t bitstream_size = lut_mux_graph.num_inputs();
-  std::vector<bool> lut_bitstream(bitstream_size, false);
-  AtomNetlist::TruthTable completed_truth_table;
+  VTR_ASSERT((size_t(1) << lut_size) == bitstream_size);
   bool on_set = false;
-  bool off_set = false;
 
   /* if No truth_table, do default*/
   if (0 == truth_table.size()) {
     switch (default_sram_bit_value) {
     case 0:
       on_set = true;
-      off_set = false;
       break;
     case 1:
       on_set = false;
-      off_set = true;
       break;
     default:
       VTR_LOGF_ERROR(__FILE__, __LINE__,
@@ -411,27 +296,22 @@ std::vector<bool> build_single_output_lut_bitstream(const AtomNetlist::TruthTabl
     }
   } else {
     on_set = lut_truth_table_use_on_set(truth_table);
-    off_set = !on_set;
-  }
-
-  /* Read in truth table lines, decode one by one */
-  for (const std::vector<vtr::LogicValue>& tt_line : truth_table) {
-    /* Complete the truth table line by line*/
-    completed_truth_table.push_back(complete_truth_table_line(lut_size, tt_line));
   }
 
-  /* Initial all the bits in the bitstream */
-  if (true == off_set) {
-    /* By default, the lut_bitstream is initialize for on_set
-     * For off set, it should be flipped
-     */
-    lut_bitstream.clear(); 
-    lut_bitstream.resize(bitstream_size, true);
-  }
+  /* Expand the truth table lines to minterms.
+   * By default, the bits are initialized for on_set
+   * For off set, they should be flipped
+   */
+  PackedTruthTable packed_truth_table(lut_size, truth_table);
+  std::vector<uint64_t> minterms = packed_truth_table.expand_minterms(!on_set);
 
-  for (const std::vector<vtr::LogicValue>& tt_line : completed_truth_table) {
-    /* Update the truth table, sram_bits */
-    rec_build_lut_bitstream_per_line(lut_bitstream, lut_size, tt_line, 0);
+  /* TODO: Use MuxGraph to decode this!!! */
+  /* We assume the 1-lut pass sram1 when input = 0 and sram0 when input = 1,
+   * so the sram bit of a minterm is its complement 
+   */
+  std::vector<bool> lut_bitstream(bitstream_size, false);
+  for (size_t sram_id = 0; sram_id < bitstream_size; ++sram_id) {
+    lut_bitstream[sram_id] = PackedTruthTable::minterm_output(minterms, bitstream_size - 1 - sram_id);
   }
 
   return lut_bitstream;
@@ -446,14 +326,14 @@ std::vector<bool> build_single_output_lut_bitstream(const AtomNetlist::TruthTabl
 std::vector<bool> build_frac_lut_bitstream(const CircuitLibrary& circuit_lib,
                                            const MuxGraph& lut_mux_graph, 
                                            const VprDeviceAnnotation& device_annotation, 
-                                           const std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable>& truth_tables,
+                                           PhysicalPb::truth_table_range truth_tables,
                                            const size_t& default_sram_bit_value) {
   /* Initialization */
   std::vector<bool> lut_bitstream(lut_mux_graph.num_inputs(), default_sram_bit_value);
 
-  for (const std::pair<const t_pb_graph_pin*, AtomNetlist::TruthTable>& element : truth_tables) {
+  for (const PhysicalPbTruthTable& element : truth_tables) {
     /* Find the corresponding circuit model output port and assoicated lut_output_mask */
-    CircuitPortId lut_model_output_port = device_annotation.pb_circuit_port(element.first->port);
+    CircuitPortId lut_model_output_port = device_annotation.pb_circuit_port(element.pb_graph_pin->port);
     size_t lut_frac_level = circuit_lib.port_lut_frac_level(lut_model_output_port);
     /* By default, lut_frac_level will be the lut_size, i.e., number of levels of the mux graph */
     if (size_t(-1) == lut_frac_level) {
@@ -461,13 +341,13 @@ std::vector<bool> build_frac_lut_bitstream(const CircuitLibrary& circuit_lib,
     }
 
     /* Find the corresponding circuit model output port and assoicated lut_output_mask */
-    size_t lut_output_mask = circuit_lib.port_lut_output_mask(lut_model_output_port)[element.first->pin_number];
+    size_t lut_output_mask = circuit_lib.port_lut_output_mask(lut_model_output_port)[element.pb_graph_pin->pin_number];
 
     /* Decode lut sram bits */
-    std::vector<bool> temp_bitstream = build_single_output_lut_bitstream(element.second, lut_mux_graph, default_sram_bit_value); 
+    std::vector<bool> temp_bitstream = build_single_output_lut_bitstream(element.truth_table, lut_mux_graph, default_sram_bit_value); 
 
     /* Depending on the frac-level, we get the location(starting/end points) of sram bits */
-    size_t length_of_temp_bitstream_to_copy = (size_t)pow(2., (double)(lut_frac_level)); 
+    size_t length_of_temp_bitstream_to_copy = size_t(1) << lut_frac_level; 
     size_t bitstream_offset = length_of_temp_bitstream_to_copy * lut_output_mask; 
     /* Ensure the offset is in range */        
     VTR_ASSERT(bitstream_offset < lut_bitstream.size());
@@ -476,7 +356,7 @@ std::vector<bool> build_frac_lut_bitstream(const CircuitLibrary& circuit_lib,
     /* Print debug information 
     bool verbose = true;
     VTR_LOGV(verbose, "Full truth table\n");
-    for (const std::string& tt_line : truth_table_to_string(element.second)) {
+    for (const std::string& tt_line : truth_table_to_string(element.truth_table)) {
       VTR_LOGV(verbose, "\t%s\n", tt_line.c_str());
     }
     VTR_LOGV(verbose, "\n");
@@ -11,6 +11,7 @@
 #include "mux_graph.h"
 #include "physical_types.h"
 #include "vpr_device_annotation.h"
+#include "physical_pb.h"
 
 /********************************************************************
  * Function declaration
@@ -36,7 +37,7 @@ bool lut_truth_table_use_on_set(const AtomNetlist::TruthTable& truth_table);
 std::vector<bool> build_frac_lut_bitstream(const CircuitLibrary& circuit_lib,
                                            const MuxGraph& lut_mux_graph, 
                                            const VprDeviceAnnotation& device_annotation, 
-                                           const std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable>& truth_tables,
+                                           PhysicalPb::truth_table_range truth_tables,
                                            const size_t& default_sram_bit_value);
 
 bool is_wired_lut(const std::vector<AtomNetId>& input_nets,
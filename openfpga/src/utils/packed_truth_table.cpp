@@ -0,0 +1,161 @@
+/******************************************************************************
+ * Memember functions for data structure PackedTruthTable
+ ******************************************************************************/
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+#include "packed_truth_table.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+constexpr size_t NUM_BITS_PER_WORD = 64;
+constexpr size_t NUM_INPUTS_PER_WORD = 6;
+
+/* The minterms of a word where input i is '1', for the first inputs.
+ * The other inputs are constant in a word
+ */
+constexpr uint64_t INPUT_MINTERM_MASKS[NUM_INPUTS_PER_WORD] = {
+  0xAAAAAAAAAAAAAAAAULL,
+  0xCCCCCCCCCCCCCCCCULL,
+  0xF0F0F0F0F0F0F0F0ULL,
+  0xFF00FF00FF00FF00ULL,
+  0xFFFF0000FFFF0000ULL,
+  0xFFFFFFFF00000000ULL
+};
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+PackedTruthTable::PackedTruthTable(const size_t& num_inputs, const AtomNetlist::TruthTable& truth_table)
+  : num_inputs_(num_inputs) {
+  VTR_ASSERT(num_inputs_ < NUM_BITS_PER_WORD);
+
+  care_masks_.reserve(truth_table.size());
+  value_masks_.reserve(truth_table.size());
+  outputs_.reserve(truth_table.size());
+
+  for (const std::vector<vtr::LogicValue>& tt_line : truth_table) {
+    /* Last element is the output */
+    VTR_ASSERT(0 < tt_line.size());
+    VTR_ASSERT(tt_line.size() - 1 <= num_inputs_);
+
+    uint64_t care_mask = 0;
+    uint64_t value_mask = 0;
+    for (size_t i = 0; i < tt_line.size() - 1; ++i) {
+      switch (tt_line[i]) {
+      case vtr::LogicValue::FALSE :
+        care_mask |= uint64_t(1) << i;
+        break;
+      case vtr::LogicValue::TRUE :
+        care_mask |= uint64_t(1) << i;
+        value_mask |= uint64_t(1) << i;
+        break;
+      case vtr::LogicValue::DONT_CARE :
+        break;
+      default :
+        VTR_LOGF_ERROR(__FILE__, __LINE__,
+                       "Invalid truth_table bit '%s', should be [0|1|-]!\n",
+                       vtr::LOGIC_VALUE_STRING[size_t(tt_line[i])]);
+        exit(1);
+      }
+    }
+
+    if ( (vtr::LogicValue::TRUE != tt_line.back())
+      && (vtr::LogicValue::FALSE != tt_line.back()) ) {
+      VTR_LOGF_ERROR(__FILE__, __LINE__,
+                     "Invalid truth_table_line ending '%s'!\n",
+                     vtr::LOGIC_VALUE_STRING[size_t(tt_line.back())]);
+      exit(1);
+    }
+
+    add_cube(care_mask, value_mask, vtr::LogicValue::TRUE == tt_line.back());
+  }
+}
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+size_t PackedTruthTable::num_inputs() const {
+  return num_inputs_;
+}
+
+size_t PackedTruthTable::num_cubes() const {
+  return care_masks_.size();
+}
+
+uint64_t PackedTruthTable::cube_care_mask(const size_t& icube) const {
+  VTR_ASSERT_SAFE(icube < num_cubes());
+  return care_masks_[icube];
+}
+
+uint64_t PackedTruthTable::cube_value_mask(const size_t& icube) const {
+  VTR_ASSERT_SAFE(icube < num_cubes());
+  return value_masks_[icube];
+}
+
+bool PackedTruthTable::cube_output(const size_t& icube) const {
+  VTR_ASSERT_SAFE(icube < num_cubes());
+  return 0 != outputs_[icube];
+}
+
+std::vector<uint64_t> PackedTruthTable::expand_minterms(const bool& default_output) const {
+  size_t num_minterms = size_t(1) << num_inputs_;
+  size_t num_words = (num_minterms + NUM_BITS_PER_WORD - 1) / NUM_BITS_PER_WORD;
+
+  /* The unused bits of the last word, if any, are always 0 */
+  uint64_t word_mask = ~uint64_t(0);
+  if (num_minterms < NUM_BITS_PER_WORD) {
+    word_mask = (uint64_t(1) << num_minterms) - 1;
+  }
+
+  std::vector<uint64_t> minterms(num_words, default_output ? word_mask : 0);
+
+  for (size_t icube = 0; icube < num_cubes(); ++icube) {
+    for (size_t iword = 0; iword < num_words; ++iword) {
+      /* Find the minterms of the word which are covered by the cube,
+       * by intersecting the minterms where each cared input has its value
+       */
+      uint64_t covered = word_mask;
+      for (size_t i = 0; (i < num_inputs_) && (0 != covered); ++i) {
+        uint64_t input_mask = uint64_t(1) << i;
+        if (0 == (care_masks_[icube] & input_mask)) {
+          continue;
+        }
+        uint64_t input_minterms;
+        if (i < NUM_INPUTS_PER_WORD) {
+          input_minterms = INPUT_MINTERM_MASKS[i];
+        } else {
+          input_minterms = (0 != ((iword >> (i - NUM_INPUTS_PER_WORD)) & 1)) ? ~uint64_t(0) : 0;
+        }
+        covered &= (0 != (value_masks_[icube] & input_mask)) ? input_minterms : ~input_minterms;
+      }
+
+      if (0 != outputs_[icube]) {
+        minterms[iword] |= covered;
+      } else {
+        minterms[iword] &= ~covered;
+      }
+    }
+  }
+
+  return minterms;
+}
+
+bool PackedTruthTable::minterm_output(const std::vector<uint64_t>& minterms, const size_t& minterm) {
+  VTR_ASSERT_SAFE(minterm / NUM_BITS_PER_WORD < minterms.size());
+  return 0 != ((minterms[minterm / NUM_BITS_PER_WORD] >> (minterm % NUM_BITS_PER_WORD)) & 1);
+}
+
+/**************************************************
+ * Public Mutators
+ *************************************************/
+void PackedTruthTable::add_cube(const uint64_t& care_mask, const uint64_t& value_mask, const bool& output) {
+  /* A don't care input always has a value of 0 */
+  VTR_ASSERT(0 == (value_mask & ~care_mask));
+  care_masks_.push_back(care_mask);
+  value_masks_.push_back(value_mask);
+  outputs_.push_back(output ? 1 : 0);
+}
+
+} /* end namespace openfpga */
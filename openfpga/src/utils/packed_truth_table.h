@@ -0,0 +1,67 @@
+#ifndef PACKED_TRUTH_TABLE_H
+#define PACKED_TRUTH_TABLE_H
+
+/********************************************************************
+ * Include header files required by the data structure definition
+ *******************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "atom_netlist.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * A compact representation of the truth table of a LUT,
+ * i.e., a list of cubes in the BLIF cover format, e.g., "1-0 1"
+ *
+ * Each cube is packed into two 64-bit masks: a 'care' mask tells which
+ * inputs are '0' or '1', and a 'value' mask gives the value of these inputs
+ * (a don't care input always has a value of 0).
+ * Input i of a cube corresponds to bit i of the masks.
+ *
+ * The cubes are expanded to the 2^num_inputs minterms of the LUT
+ * with word-wise mask operations, instead of enumerating the don't cares
+ * of each cube one by one.
+ * Minterm m is the combination of inputs where input i is bit i of m.
+ *******************************************************************/
+class PackedTruthTable {
+  public: /* Constructors */
+    PackedTruthTable() = default;
+
+    /* Create from a truth table of the atom netlist.
+     * Lines may have less inputs than num_inputs: the missing inputs are don't cares
+     */
+    PackedTruthTable(const size_t& num_inputs, const AtomNetlist::TruthTable& truth_table);
+
+  public: /* Accessors */
+    size_t num_inputs() const;
+    size_t num_cubes() const;
+
+    uint64_t cube_care_mask(const size_t& icube) const;
+    uint64_t cube_value_mask(const size_t& icube) const;
+    bool cube_output(const size_t& icube) const;
+
+    /* Find the output of each minterm, as a bit vector of 64-bit words:
+     * the output of the last cube covering the minterm,
+     * or the default output if no cube covers it
+     */
+    std::vector<uint64_t> expand_minterms(const bool& default_output) const;
+
+    /* Get the output of a minterm from the result of expand_minterms() */
+    static bool minterm_output(const std::vector<uint64_t>& minterms, const size_t& minterm);
+
+  public: /* Mutators */
+    void add_cube(const uint64_t& care_mask, const uint64_t& value_mask, const bool& output);
+
+  private: /* Internal data */
+    size_t num_inputs_ = 0;
+    std::vector<uint64_t> care_masks_;
+    std::vector<uint64_t> value_masks_;
+    std::vector<char> outputs_;
+};
+
+} /* end namespace openfpga */
+
+#endif
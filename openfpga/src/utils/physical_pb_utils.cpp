@@ -20,26 +20,26 @@
 namespace openfpga {
 
 /************************************************************************
- * Allocate an empty physical pb graph based on pb_graph 
- * This function should start with an empty physical pb object!!!
+ * Allocate the hierarchy of physical pbs based on pb_graph 
+ * This function should start with an empty physical pb skeleton!!!
  * Suggest to check this before executing this function
- *   VTR_ASSERT(true == phy_pb.empty());
+ *   VTR_ASSERT(true == phy_pb_skeleton.empty());
  ***********************************************************************/
 static 
-void rec_alloc_physical_pb_from_pb_graph(PhysicalPb& phy_pb,
-                                         const t_pb_graph_node* pb_graph_node,
-                                         const VprDeviceAnnotation& device_annotation) {
+void rec_alloc_physical_pb_skeleton_from_pb_graph(PhysicalPbSkeleton& phy_pb_skeleton,
+                                                  const t_pb_graph_node* pb_graph_node,
+                                                  const VprDeviceAnnotation& device_annotation) {
   t_pb_type* pb_type = pb_graph_node->pb_type;
 
   t_mode* physical_mode = device_annotation.physical_mode(pb_type);
 
-  PhysicalPbId cur_phy_pb_id = phy_pb.create_pb(pb_graph_node);
-  VTR_ASSERT(true == phy_pb.valid_pb_id(cur_phy_pb_id));
+  PhysicalPbId cur_phy_pb_id = phy_pb_skeleton.create_pb(pb_graph_node);
+  VTR_ASSERT(true == phy_pb_skeleton.valid_pb_id(cur_phy_pb_id));
 
   /* Finish for primitive node */
   if (true == is_primitive_pb_type(pb_type)) {
     /* Deposite mode bits here */
-    phy_pb.set_mode_bits(cur_phy_pb_id, device_annotation.pb_type_mode_bits(pb_type));
+    phy_pb_skeleton.set_mode_bits(cur_phy_pb_id, device_annotation.pb_type_mode_bits(pb_type));
     return;
   } 
 
@@ -51,9 +51,9 @@ void rec_alloc_physical_pb_from_pb_graph(PhysicalPb& phy_pb,
    */
   for (int ipb = 0; ipb < physical_mode->num_pb_type_children; ++ipb) {
     for (int jpb = 0; jpb < physical_mode->pb_type_children[ipb].num_pb; ++jpb) {
-      rec_alloc_physical_pb_from_pb_graph(phy_pb,
-                                          &(pb_graph_node->child_pb_graph_nodes[physical_mode->index][ipb][jpb]),
-                                          device_annotation);
+      rec_alloc_physical_pb_skeleton_from_pb_graph(phy_pb_skeleton,
+                                                   &(pb_graph_node->child_pb_graph_nodes[physical_mode->index][ipb][jpb]),
+                                                   device_annotation);
     }
   }
 }
@@ -61,12 +61,12 @@ void rec_alloc_physical_pb_from_pb_graph(PhysicalPb& phy_pb,
 /************************************************************************
  * Build all the relationships between parent and children 
  * inside a physical pb graph 
- * This function must be executed after rec_alloc_physical_pb_from_pb_graph()!!!
+ * This function must be executed after rec_alloc_physical_pb_skeleton_from_pb_graph()!!!
  ***********************************************************************/
 static 
-void rec_build_physical_pb_children_from_pb_graph(PhysicalPb& phy_pb,
-                                                  const t_pb_graph_node* pb_graph_node,
-                                                  const VprDeviceAnnotation& device_annotation) {
+void rec_build_physical_pb_skeleton_children_from_pb_graph(PhysicalPbSkeleton& phy_pb_skeleton,
+                                                           const t_pb_graph_node* pb_graph_node,
+                                                           const VprDeviceAnnotation& device_annotation) {
   t_pb_type* pb_type = pb_graph_node->pb_type;
 
   /* Finish for primitive node */
@@ -78,15 +78,15 @@ void rec_build_physical_pb_children_from_pb_graph(PhysicalPb& phy_pb,
   VTR_ASSERT(nullptr != physical_mode);
 
   /* Please use the openfpga naming function so that you can build the link to module manager */
-  PhysicalPbId parent_pb_id = phy_pb.find_pb(pb_graph_node);
-  VTR_ASSERT(true == phy_pb.valid_pb_id(parent_pb_id));
+  PhysicalPbId parent_pb_id = phy_pb_skeleton.find_pb(pb_graph_node);
+  VTR_ASSERT(true == phy_pb_skeleton.valid_pb_id(parent_pb_id));
 
   /* Add all the children */
   for (int ipb = 0; ipb < physical_mode->num_pb_type_children; ++ipb) {
     for (int jpb = 0; jpb < physical_mode->pb_type_children[ipb].num_pb; ++jpb) {
-      PhysicalPbId child_pb_id = phy_pb.find_pb(&(pb_graph_node->child_pb_graph_nodes[physical_mode->index][ipb][jpb]));
-      VTR_ASSERT(true == phy_pb.valid_pb_id(child_pb_id));
-      phy_pb.add_child(parent_pb_id, child_pb_id, &(physical_mode->pb_type_children[ipb]));
+      PhysicalPbId child_pb_id = phy_pb_skeleton.find_pb(&(pb_graph_node->child_pb_graph_nodes[physical_mode->index][ipb][jpb]));
+      VTR_ASSERT(true == phy_pb_skeleton.valid_pb_id(child_pb_id));
+      phy_pb_skeleton.add_child(parent_pb_id, child_pb_id, &(physical_mode->pb_type_children[ipb]));
     }
   }
 
@@ -95,26 +95,26 @@ void rec_build_physical_pb_children_from_pb_graph(PhysicalPb& phy_pb,
    */
   for (int ipb = 0; ipb < physical_mode->num_pb_type_children; ++ipb) {
     for (int jpb = 0; jpb < physical_mode->pb_type_children[ipb].num_pb; ++jpb) {
-      rec_build_physical_pb_children_from_pb_graph(phy_pb,
-                                                   &(pb_graph_node->child_pb_graph_nodes[physical_mode->index][ipb][jpb]),
-                                                   device_annotation);
+      rec_build_physical_pb_skeleton_children_from_pb_graph(phy_pb_skeleton,
+                                                            &(pb_graph_node->child_pb_graph_nodes[physical_mode->index][ipb][jpb]),
+                                                            device_annotation);
     }
   }
 }
 
 /************************************************************************
- * Allocate an empty physical pb graph based on pb_graph 
- * This function should start with an empty physical pb object!!!
+ * Allocate the hierarchy of physical pbs based on pb_graph 
+ * This function should start with an empty physical pb skeleton!!!
  * Suggest to check this before executing this function
- *   VTR_ASSERT(true == phy_pb.empty());
+ *   VTR_ASSERT(true == phy_pb_skeleton.empty());
  ***********************************************************************/
-void alloc_physical_pb_from_pb_graph(PhysicalPb& phy_pb,
-                                     const t_pb_graph_node* pb_graph_head,
-                                     const VprDeviceAnnotation& device_annotation) {
-  VTR_ASSERT(true == phy_pb.empty());
+void alloc_physical_pb_skeleton_from_pb_graph(PhysicalPbSkeleton& phy_pb_skeleton,
+                                              const t_pb_graph_node* pb_graph_head,
+                                              const VprDeviceAnnotation& device_annotation) {
+  VTR_ASSERT(true == phy_pb_skeleton.empty());
 
-  rec_alloc_physical_pb_from_pb_graph(phy_pb, pb_graph_head, device_annotation);
-  rec_build_physical_pb_children_from_pb_graph(phy_pb, pb_graph_head, device_annotation);
+  rec_alloc_physical_pb_skeleton_from_pb_graph(phy_pb_skeleton, pb_graph_head, device_annotation);
+  rec_build_physical_pb_skeleton_children_from_pb_graph(phy_pb_skeleton, pb_graph_head, device_annotation);
 }
 
 /************************************************************************
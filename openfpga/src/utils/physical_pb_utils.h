@@ -15,6 +15,7 @@
 #include "vpr_context.h"
 #include "circuit_library.h"
 #include "physical_pb.h"
+#include "physical_pb_skeleton.h"
 
 /********************************************************************
  * Function declaration
@@ -23,9 +24,9 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-void alloc_physical_pb_from_pb_graph(PhysicalPb& phy_pb,
-                                     const t_pb_graph_node* pb_graph_head,
-                                     const VprDeviceAnnotation& device_annotation);
+void alloc_physical_pb_skeleton_from_pb_graph(PhysicalPbSkeleton& phy_pb_skeleton,
+                                              const t_pb_graph_node* pb_graph_head,
+                                              const VprDeviceAnnotation& device_annotation);
 
 void rec_update_physical_pb_from_operating_pb(PhysicalPb& phy_pb, 
                                               const t_pb* op_pb,
@@ -55,4 +55,57 @@ std::vector<RRNodeId> get_rr_gsb_chan_node_configurable_driver_nodes(const RRGra
   return driver_nodes;
 }
 
+/************************************************************************
+ * Find if a side map keeps each side of a GSB unchanged,
+ * i.e., the GSB is neither rotated nor reflected
+ ***********************************************************************/
+bool is_rr_gsb_side_map_identity(const t_rr_gsb_side_map& side_map) {
+  for (size_t side = 0; side < NUM_SIDES; ++side) {
+    if (SideManager(side).get_side() != side_map[side]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/************************************************************************
+ * Find the configurable driver nodes for a routing track of a GSB,
+ * in the order of the inputs of the routing multiplexer in the module
+ * of another GSB, which is a rotation or a reflection of the GSB.
+ * The sides of the GSB are mapped to the sides of the module GSB by side_map.
+ *
+ * The inputs of a routing multiplexer are sorted by the sides of the module GSB,
+ * so the drivers of the GSB are found from the drivers of the module GSB
+ * with the same index on the mapped side
+ ***********************************************************************/
+std::vector<RRNodeId> get_rr_gsb_chan_node_configurable_driver_nodes_in_module(const RRGraph& rr_graph,
+                                                                               const RRGSB& rr_gsb,
+                                                                               const RRGSB& module_gsb,
+                                                                               const t_rr_gsb_side_map& side_map,
+                                                                               const e_side& chan_side,
+                                                                               const size_t& track_id) {
+  /* Find the sides of the GSB from the sides of the module GSB */
+  t_rr_gsb_side_map inv_side_map;
+  for (size_t side = 0; side < NUM_SIDES; ++side) {
+    inv_side_map[size_t(side_map[side])] = SideManager(side).get_side();
+  }
+
+  std::vector<RRNodeId> driver_nodes;
+  for (const RRNodeId& module_driver_node : get_rr_gsb_chan_node_configurable_driver_nodes(rr_graph, module_gsb, side_map[size_t(chan_side)], track_id)) {
+    e_side module_driver_side = NUM_SIDES;
+    int module_driver_index = -1;
+    module_gsb.get_node_side_and_index(rr_graph, module_driver_node, IN_PORT, module_driver_side, module_driver_index);
+    VTR_ASSERT(NUM_SIDES != module_driver_side);
+
+    e_side driver_side = inv_side_map[size_t(module_driver_side)];
+    if (OPIN == rr_graph.node_type(module_driver_node)) {
+      driver_nodes.push_back(rr_gsb.get_opin_node(driver_side, module_driver_index));
+    } else {
+      driver_nodes.push_back(rr_gsb.get_chan_node(driver_side, module_driver_index));
+    }
+  }
+
+  return driver_nodes;
+}
+
 } /* end namespace openfpga */
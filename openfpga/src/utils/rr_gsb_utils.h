@@ -23,6 +23,15 @@ std::vector<RRNodeId> get_rr_gsb_chan_node_configurable_driver_nodes(const RRGra
                                                                      const e_side& chan_side,
                                                                      const size_t& track_id);
 
+bool is_rr_gsb_side_map_identity(const t_rr_gsb_side_map& side_map);
+
+std::vector<RRNodeId> get_rr_gsb_chan_node_configurable_driver_nodes_in_module(const RRGraph& rr_graph,
+                                                                               const RRGSB& rr_gsb,
+                                                                               const RRGSB& module_gsb,
+                                                                               const t_rr_gsb_side_map& side_map,
+                                                                               const e_side& chan_side,
+                                                                               const size_t& track_id);
+
 } /* end namespace openfpga */
 
 #endif
@@ -0,0 +1,223 @@
+/********************************************************************
+ * Unit test and micro-benchmark of the name generators
+ * 1. the names generated for a set of blocks and ports are compared
+ *    to known-good names, which are the names of released fabrics
+ * 2. the generators called for each routing track when building and 
+ *    writing the fabric are timed
+ *
+ * Usage: test_openfpga_naming [<number of iterations of the benchmark>]
+ *******************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_port.h"
+
+#include "openfpga_naming.h"
+
+using namespace openfpga;
+
+/********************************************************************
+ * Known-good names, in the order of generate_test_names()
+ *******************************************************************/
+static const std::vector<std::string> KNOWN_GOOD_NAMES = {
+  "mux_2level_3_",
+  "mem_*_",
+  "mux_l2_in",
+  "mux_l0_in_buf",
+  "mux_l1_in_5_",
+  "mux_l3_in_buf_0_",
+  "local_encoder3to8",
+  "decoder4to16",
+  "decoder_with_data_in_4to16",
+  "wire_seg2",
+  "sb_12",
+  "cbx_3__4__",
+  "cbx_1__2_",
+  "cby_0__10__",
+  "chanx_7_",
+  "chany2_5_",
+  "chanx_10__3__in_27_",
+  "chany_0__120__out_0_",
+  "chanx_top_in",
+  "chanx_top_out",
+  "chanx_right_in",
+  "chanx_right_out",
+  "chanx_bottom_in",
+  "chanx_bottom_out",
+  "chanx_left_in",
+  "chanx_left_out",
+  "chany_top_in",
+  "chany_top_out",
+  "chany_right_in",
+  "chany_right_out",
+  "chany_bottom_in",
+  "chany_bottom_out",
+  "chany_left_in",
+  "chany_left_out",
+  "chanx_right_in",
+  "chanx_left_in",
+  "chanx_right_out",
+  "chanx_left_out",
+  "chany_top_in",
+  "chany_bottom_in",
+  "chany_top_out",
+  "chany_bottom_out",
+  "chanx_4__9__midout_13_",
+  "sb_0__11_",
+  "cbx_7__0_",
+  "cby_5__6_",
+  "left_width_0_height_1_subtile_0__pin_I_3_",
+  "top_width_2_height_0_subtile_3__pin_O_0_",
+  "right_width_1_height_1_subtile_2__pin_O_5_upper",
+  "bottom_width_0_height_0_subtile_0__pin_O_5_lower",
+  "grid_bottom_width_0_height_2_subtile_1__pin_clk_0_",
+  "mux_top_track_4_",
+  "mem_left_track_31",
+  "mux_left_ipin_2",
+  "mem_bottom_ipin_9_",
+  "grid_clb_1__1_",
+  "grid_io_top_3__12_",
+};
+
+/********************************************************************
+ * Generate names for a set of blocks and ports, covering 
+ * every branch of the generators
+ *******************************************************************/
+static 
+std::vector<std::string> generate_test_names() {
+  std::vector<std::string> names;
+  names.push_back(generate_instance_name("mux_2level", 3));
+  names.push_back(generate_instance_wildcard_name("mem", "*"));
+  names.push_back(generate_mux_node_name(2, false));
+  names.push_back(generate_mux_node_name(0, true));
+  names.push_back(generate_mux_branch_instance_name(1, 5, false));
+  names.push_back(generate_mux_branch_instance_name(3, 0, true));
+  names.push_back(generate_mux_local_decoder_subckt_name(3, 8));
+  names.push_back(generate_memory_decoder_subckt_name(4, 16));
+  names.push_back(generate_memory_decoder_with_data_in_subckt_name(4, 16));
+  names.push_back(generate_segment_wire_subckt_name("wire", 2));
+  names.push_back(generate_routing_block_netlist_name("sb_", 12, ""));
+  names.push_back(generate_routing_block_netlist_name("cbx_", vtr::Point<size_t>(3, 4), "_"));
+  names.push_back(generate_connection_block_netlist_name(CHANX, vtr::Point<size_t>(1, 2), ""));
+  names.push_back(generate_connection_block_netlist_name(CHANY, vtr::Point<size_t>(0, 10), "_"));
+  names.push_back(generate_routing_channel_module_name(CHANX, 7));
+  names.push_back(generate_routing_channel_module_name(CHANY, vtr::Point<size_t>(2, 5)));
+  names.push_back(generate_routing_track_port_name(CHANX, vtr::Point<size_t>(10, 3), 27, IN_PORT));
+  names.push_back(generate_routing_track_port_name(CHANY, vtr::Point<size_t>(0, 120), 0, OUT_PORT));
+  for (const t_rr_type& chan_type : {CHANX, CHANY}) {
+    for (const e_side& side : {TOP, RIGHT, BOTTOM, LEFT}) {
+      for (const PORTS& port_direction : {IN_PORT, OUT_PORT}) {
+        names.push_back(generate_sb_module_track_port_name(chan_type, side, port_direction));
+      }
+    }
+  }
+  for (const t_rr_type& chan_type : {CHANX, CHANY}) {
+    for (const PORTS& port_direction : {IN_PORT, OUT_PORT}) {
+      for (const bool& upper_location : {false, true}) {
+        names.push_back(generate_cb_module_track_port_name(chan_type, port_direction, upper_location));
+      }
+    }
+  }
+  names.push_back(generate_routing_track_middle_output_port_name(CHANX, vtr::Point<size_t>(4, 9), 13));
+  names.push_back(generate_switch_block_module_name(vtr::Point<size_t>(0, 11)));
+  names.push_back(generate_connection_block_module_name(CHANX, vtr::Point<size_t>(7, 0)));
+  names.push_back(generate_connection_block_module_name(CHANY, vtr::Point<size_t>(5, 6)));
+  names.push_back(generate_grid_port_name(0, 1, 0, LEFT, BasicPort("I", 3, 3)));
+  names.push_back(generate_grid_port_name(2, 0, 3, TOP, BasicPort("O", 0, 0)));
+  names.push_back(generate_grid_duplicated_port_name(1, 1, 2, RIGHT, BasicPort("O", 5, 5), true));
+  names.push_back(generate_grid_duplicated_port_name(0, 0, 0, BOTTOM, BasicPort("O", 5, 5), false));
+  names.push_back(generate_routing_module_grid_port_name(0, 2, 1, BOTTOM, BasicPort("clk", 0, 0)));
+  names.push_back(generate_sb_mux_instance_name("mux_", TOP, 4, "_"));
+  names.push_back(generate_sb_memory_instance_name("mem_", LEFT, 31, ""));
+  names.push_back(generate_cb_mux_instance_name("mux_", LEFT, 2, ""));
+  names.push_back(generate_cb_memory_instance_name("mem_", BOTTOM, 9, "_"));
+  names.push_back(generate_grid_block_instance_name("grid_", "clb", false, NUM_SIDES, vtr::Point<size_t>(1, 1)));
+  names.push_back(generate_grid_block_instance_name("grid_", "io", true, TOP, vtr::Point<size_t>(3, 12)));
+  return names;
+}
+
+/********************************************************************
+ * Time a name generator, and return the number of characters generated
+ * so that the calls cannot be optimized out
+ *******************************************************************/
+template<typename Generator>
+static 
+size_t benchmark_name_generator(const char* generator_name,
+                                const size_t& num_iterations,
+                                Generator generator) {
+  size_t num_chars = 0;
+  std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+  for (size_t iter = 0; iter < num_iterations; ++iter) {
+    num_chars += generator(iter).size();
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+
+  VTR_LOG("%s: %lu names in %g seconds (%g ns per name)\n",
+          generator_name, num_iterations, elapsed.count(),
+          1e9 * elapsed.count() / std::max(num_iterations, size_t(1)));
+  return num_chars;
+}
+
+int main(int argc, const char** argv) {
+  /* Ensure we have at most one argument */
+  VTR_ASSERT((1 == argc) || (2 == argc));
+
+  size_t num_iterations = 1000000;
+  if (2 == argc) {
+    num_iterations = std::strtoul(argv[1], nullptr, 10);
+  }
+
+  /* Compare the generated names to the known-good names */
+  std::vector<std::string> names = generate_test_names();
+  VTR_ASSERT(KNOWN_GOOD_NAMES.size() == names.size());
+
+  size_t num_errors = 0;
+  for (size_t iname = 0; iname < names.size(); ++iname) {
+    if (KNOWN_GOOD_NAMES[iname] != names[iname]) {
+      VTR_LOG_ERROR("Generated name '%s' differs from known-good name '%s'!\n",
+                    names[iname].c_str(), KNOWN_GOOD_NAMES[iname].c_str());
+      num_errors++;
+    }
+  }
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("%lu names differ from the known-good names!\n",
+                  num_errors);
+    return 1;
+  }
+  VTR_LOG("All the %lu generated names match the known-good names.\n",
+          names.size());
+
+  /* Time the generators called for each routing track */
+  size_t num_chars = 0;
+  num_chars += benchmark_name_generator("generate_routing_track_port_name", num_iterations,
+                                        [](const size_t& iter) {
+                                          return generate_routing_track_port_name(CHANX, vtr::Point<size_t>(iter % 64, iter % 37), iter % 300, IN_PORT);
+                                        });
+  num_chars += benchmark_name_generator("generate_sb_module_track_port_name", num_iterations,
+                                        [](const size_t& iter) {
+                                          return generate_sb_module_track_port_name(CHANY, e_side(iter % NUM_SIDES), OUT_PORT);
+                                        });
+  num_chars += benchmark_name_generator("generate_cb_module_track_port_name", num_iterations,
+                                        [](const size_t& iter) {
+                                          return generate_cb_module_track_port_name(CHANX, IN_PORT, 0 == iter % 2);
+                                        });
+  num_chars += benchmark_name_generator("generate_connection_block_module_name", num_iterations,
+                                        [](const size_t& iter) {
+                                          return generate_connection_block_module_name(CHANY, vtr::Point<size_t>(iter % 64, iter % 37));
+                                        });
+  num_chars += benchmark_name_generator("generate_sb_mux_instance_name", num_iterations,
+                                        [](const size_t& iter) {
+                                          return generate_sb_mux_instance_name("mux_", e_side(iter % NUM_SIDES), iter % 300, "_");
+                                        });
+  VTR_LOG("Generated %lu characters in total.\n", num_chars);
+
+  return 0;
+}
@@ -0,0 +1,206 @@
+/********************************************************************
+ * Unit test of the packed truth tables of LUTs
+ * The minterms expanded by PackedTruthTable are compared to the bits
+ * found by enumerating the don't cares of each line of the
+ * AtomNetlist::TruthTable one by one, which is how the LUT bitstreams
+ * used to be built, for:
+ * 1. a set of truth tables with don't cares, off-set covers,
+ *    overlapping cubes and lines shorter than the LUT
+ * 2. random truth tables of LUTs with up to 8 inputs
+ *
+ * Usage: test_packed_truth_table [<number of random truth tables>]
+ *******************************************************************/
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+#include "lut_utils.h"
+#include "packed_truth_table.h"
+
+using namespace openfpga;
+
+constexpr vtr::LogicValue L0 = vtr::LogicValue::FALSE;
+constexpr vtr::LogicValue L1 = vtr::LogicValue::TRUE;
+constexpr vtr::LogicValue DC = vtr::LogicValue::DONT_CARE;
+
+/********************************************************************
+ * Reference: set the bits of the minterms covered by a truth table line
+ * by enumerating its don't cares recursively. The missing inputs of a
+ * line shorter than the LUT are don't cares.
+ * Later lines overwrite the minterms of the earlier lines
+ *******************************************************************/
+static
+void rec_set_reference_minterms(std::vector<bool>& minterms,
+                                const size_t& lut_size,
+                                const std::vector<vtr::LogicValue>& tt_line,
+                                const size_t& input,
+                                const size_t& minterm) {
+  if (input == lut_size) {
+    minterms[minterm] = (L1 == tt_line.back());
+    return;
+  }
+
+  vtr::LogicValue value = DC;
+  if (input < tt_line.size() - 1) {
+    value = tt_line[input];
+  }
+
+  if (L1 != value) {
+    rec_set_reference_minterms(minterms, lut_size, tt_line, input + 1, minterm);
+  }
+  if (L0 != value) {
+    rec_set_reference_minterms(minterms, lut_size, tt_line, input + 1, minterm | (size_t(1) << input));
+  }
+}
+
+static
+std::vector<bool> build_reference_minterms(const size_t& lut_size,
+                                           const AtomNetlist::TruthTable& truth_table,
+                                           const bool& default_output) {
+  std::vector<bool> minterms(size_t(1) << lut_size, default_output);
+  for (const std::vector<vtr::LogicValue>& tt_line : truth_table) {
+    rec_set_reference_minterms(minterms, lut_size, tt_line, 0, 0);
+  }
+  return minterms;
+}
+
+/********************************************************************
+ * Compare the minterms of a packed truth table to the reference,
+ * with the default output used by the LUT bitstream builder,
+ * and return the number of minterms which differ
+ *******************************************************************/
+static
+size_t check_packed_truth_table(const size_t& lut_size,
+                                const AtomNetlist::TruthTable& truth_table) {
+  bool default_output = true;
+  if (0 < truth_table.size()) {
+    default_output = !lut_truth_table_use_on_set(truth_table);
+  }
+
+  PackedTruthTable packed_truth_table(lut_size, truth_table);
+  VTR_ASSERT(truth_table.size() == packed_truth_table.num_cubes());
+  std::vector<uint64_t> minterms = packed_truth_table.expand_minterms(default_output);
+  std::vector<bool> ref_minterms = build_reference_minterms(lut_size, truth_table, default_output);
+
+  size_t num_errors = 0;
+  for (size_t minterm = 0; minterm < ref_minterms.size(); ++minterm) {
+    if (ref_minterms[minterm] != PackedTruthTable::minterm_output(minterms, minterm)) {
+      num_errors++;
+    }
+  }
+
+  /* The unused bits of the last word must be zero */
+  if ( (ref_minterms.size() < 64)
+    && (0 != (minterms.back() >> ref_minterms.size())) ) {
+    num_errors++;
+  }
+
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("%lu minterms of a %lu-input LUT with %lu lines differ from the reference!\n",
+                  num_errors, lut_size, truth_table.size());
+  }
+  return num_errors;
+}
+
+/********************************************************************
+ * Truth tables of a 4-input LUT covering the usual BLIF covers
+ *******************************************************************/
+static
+std::vector<AtomNetlist::TruthTable> generate_test_truth_tables() {
+  std::vector<AtomNetlist::TruthTable> truth_tables;
+  /* Constant outputs: no line, and a line with no input */
+  truth_tables.push_back({});
+  truth_tables.push_back({{L1}});
+  truth_tables.push_back({{L0}});
+  /* On-set with don't cares: 1-0- 1 and --11 1 */
+  truth_tables.push_back({{L1, DC, L0, DC, L1}, {DC, DC, L1, L1, L1}});
+  /* Off-set covers: 11-- 0 and 0--0 0 */
+  truth_tables.push_back({{L1, L1, DC, DC, L0}, {L0, DC, DC, L0, L0}});
+  /* Lines shorter than the LUT, i.e. a LUT2 mapped to a LUT4: 10 1 and 01 1 */
+  truth_tables.push_back({{L1, L0, L1}, {L0, L1, L1}});
+  /* Overlapping cubes: ---- 1 then 1-1- 0, where the last line wins */
+  truth_tables.push_back({{DC, DC, DC, DC, L1}, {L1, DC, L1, DC, L0}});
+  /* All the minterms listed */
+  AtomNetlist::TruthTable full_truth_table;
+  for (size_t minterm = 0; minterm < 16; ++minterm) {
+    std::vector<vtr::LogicValue> tt_line;
+    for (size_t input = 0; input < 4; ++input) {
+      tt_line.push_back((minterm >> input) & 1 ? L1 : L0);
+    }
+    tt_line.push_back(1 == minterm % 3 ? L1 : L0);
+    full_truth_table.push_back(tt_line);
+  }
+  truth_tables.push_back(full_truth_table);
+  return truth_tables;
+}
+
+/********************************************************************
+ * A random truth table, in on-set or off-set, whose lines may be
+ * shorter than the LUT
+ *******************************************************************/
+static
+AtomNetlist::TruthTable generate_random_truth_table(std::mt19937& rng,
+                                                    const size_t& lut_size) {
+  std::uniform_int_distribution<size_t> num_lines_dist(1, 12);
+  std::uniform_int_distribution<size_t> num_inputs_dist(0, lut_size);
+  std::uniform_int_distribution<int> value_dist(0, 2);
+  vtr::LogicValue output = value_dist(rng) ? L1 : L0;
+  size_t num_inputs = num_inputs_dist(rng);
+
+  AtomNetlist::TruthTable truth_table;
+  size_t num_lines = num_lines_dist(rng);
+  for (size_t iline = 0; iline < num_lines; ++iline) {
+    std::vector<vtr::LogicValue> tt_line;
+    for (size_t input = 0; input < num_inputs; ++input) {
+      int value = value_dist(rng);
+      tt_line.push_back(0 == value ? L0 : (1 == value ? L1 : DC));
+    }
+    tt_line.push_back(output);
+    truth_table.push_back(tt_line);
+  }
+  return truth_table;
+}
+
+int main(int argc, const char** argv) {
+  /* Ensure we have at most one argument */
+  VTR_ASSERT((1 == argc) || (2 == argc));
+
+  size_t num_random_truth_tables = 1000;
+  if (2 == argc) {
+    num_random_truth_tables = std::strtoul(argv[1], nullptr, 10);
+  }
+
+  size_t num_failures = 0;
+  size_t num_truth_tables = 0;
+  for (const AtomNetlist::TruthTable& truth_table : generate_test_truth_tables()) {
+    if (0 < check_packed_truth_table(4, truth_table)) {
+      num_failures++;
+    }
+    num_truth_tables++;
+  }
+
+  /* A fixed seed, so that failures can be reproduced */
+  std::mt19937 rng(1);
+  for (size_t lut_size = 1; lut_size <= 8; ++lut_size) {
+    for (size_t itt = 0; itt < num_random_truth_tables; ++itt) {
+      if (0 < check_packed_truth_table(lut_size, generate_random_truth_table(rng, lut_size))) {
+        num_failures++;
+      }
+      num_truth_tables++;
+    }
+  }
+
+  if (0 < num_failures) {
+    VTR_LOG_ERROR("%lu of %lu truth tables differ from the reference!\n",
+                  num_failures, num_truth_tables);
+    return 1;
+  }
+  VTR_LOG("All the %lu packed truth tables match the reference.\n",
+          num_truth_tables);
+
+  return 0;
+}
@@ -0,0 +1,116 @@
+/********************************************************************
+ * Unit test of the rotatable switch blocks
+ * The unique switch blocks of a tileable fabric are identified
+ * with and without the rotations and reflections, and
+ * 1. the numbers of unique switch blocks must be the expected ones
+ * 2. each switch block must be a mirror of its unique module,
+ *    once the sides of the module are mapped
+ *
+ * Usage: test_rotatable_sb <VPR architecture> <BLIF> <fixed layout> <channel width>
+ *                          <number of unique switch blocks>
+ *                          <number of unique switch blocks with rotation>
+ *******************************************************************/
+#include <cstdlib>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from vpr library */
+#include "globals.h"
+#include "vpr_api.h"
+
+#include "annotate_rr_graph.h"
+#include "device_rr_gsb.h"
+
+using namespace openfpga;
+
+/********************************************************************
+ * Check that each switch block is a mirror of its unique module
+ * with the side map found when building the unique modules,
+ * and return the number of switch blocks which are not
+ *******************************************************************/
+static
+size_t check_sb_unique_modules(const RRGraph& rr_graph,
+                               const DeviceRRGSB& device_rr_gsb) {
+  size_t num_errors = 0;
+  vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
+  for (size_t ix = 0; ix < sb_range.x(); ++ix) {
+    for (size_t iy = 0; iy < sb_range.y(); ++iy) {
+      vtr::Point<size_t> sb_coordinate(ix, iy);
+      t_rr_gsb_side_map side_map;
+      for (size_t side = 0; side < NUM_SIDES; ++side) {
+        side_map[side] = device_rr_gsb.get_sb_unique_module_side(sb_coordinate, e_side(side));
+      }
+      if (false == device_rr_gsb.get_gsb(sb_coordinate).is_sb_mirror(rr_graph, device_rr_gsb.get_sb_unique_module(sb_coordinate), side_map)) {
+        VTR_LOG_ERROR("Switch block [%lu][%lu] is not a mirror of its unique module!\n",
+                      ix, iy);
+        num_errors++;
+      }
+    }
+  }
+  return num_errors;
+}
+
+int main(int argc, const char** argv) {
+  /* Ensure we have the architecture, the netlist, the layout, the channel width
+   * and the expected numbers of unique switch blocks
+   */
+  VTR_ASSERT(7 == argc);
+  size_t expected_num_sb_unique_modules = std::strtoul(argv[5], nullptr, 10);
+  size_t expected_num_rotatable_sb_unique_modules = std::strtoul(argv[6], nullptr, 10);
+
+  /* Create the device of the fixed layout */
+  std::vector<const char*> vpr_argv = {argv[0], argv[1], argv[2],
+                                       "--device", argv[3],
+                                       "--route_chan_width", argv[4]};
+  t_options vpr_options;
+  t_vpr_setup vpr_setup;
+  t_arch vpr_arch;
+  vpr_init(vpr_argv.size(), vpr_argv.data(), &vpr_options, &vpr_setup, &vpr_arch);
+  vpr_create_device(vpr_setup, vpr_arch);
+
+  const RRGraph& rr_graph = g_vpr_ctx.device().rr_graph;
+
+  DeviceRRGSB device_rr_gsb;
+  annotate_device_rr_gsb(g_vpr_ctx.device(), device_rr_gsb, false);
+
+  size_t num_errors = 0;
+
+  device_rr_gsb.build_unique_module(rr_graph, false);
+  size_t num_sb_unique_modules = device_rr_gsb.get_num_sb_unique_module();
+  size_t num_gsb_unique_modules = device_rr_gsb.get_num_gsb_unique_module();
+  num_errors += check_sb_unique_modules(rr_graph, device_rr_gsb);
+
+  device_rr_gsb.build_unique_module(rr_graph, true);
+  size_t num_rotatable_sb_unique_modules = device_rr_gsb.get_num_sb_unique_module();
+  size_t num_rotatable_gsb_unique_modules = device_rr_gsb.get_num_gsb_unique_module();
+  num_errors += check_sb_unique_modules(rr_graph, device_rr_gsb);
+
+  vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
+  VTR_LOG("Layout '%s' with %lu switch blocks:\n",
+          argv[3], sb_range.x() * sb_range.y());
+  VTR_LOG("\t%lu unique switch blocks (%lu unique GSBs) without rotation\n",
+          num_sb_unique_modules, num_gsb_unique_modules);
+  VTR_LOG("\t%lu unique switch blocks (%lu unique GSBs) with rotation\n",
+          num_rotatable_sb_unique_modules, num_rotatable_gsb_unique_modules);
+
+  if ( (expected_num_sb_unique_modules != num_sb_unique_modules)
+    || (expected_num_rotatable_sb_unique_modules != num_rotatable_sb_unique_modules) ) {
+    VTR_LOG_ERROR("Expected %lu unique switch blocks without rotation and %lu with rotation!\n",
+                  expected_num_sb_unique_modules, expected_num_rotatable_sb_unique_modules);
+    num_errors++;
+  }
+
+  vpr_free_all(vpr_arch, vpr_setup);
+
+  if (0 < num_errors) {
+    VTR_LOG_ERROR("%lu errors found in the unique switch blocks!\n",
+                  num_errors);
+    return 1;
+  }
+  VTR_LOG("All the switch blocks are mirrors of their unique modules.\n");
+
+  return 0;
+}
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+#
+# Compares the quality and run-time of the serial placer against the
+# batched placer (--place_move_batch_size/--place_jobs) on one circuit.
+#
+# Example:
+#   compare_placer_batching.py --vpr ./vpr arch.xml circuit.blif --batch_size 16 --jobs 4 --route_chan_width 100
+#
+# Options which are not known by this script (here --route_chan_width) are passed to VPR.
+#
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+def parse_args():
+
+    parser = argparse.ArgumentParser(epilog="Unknown arguments are passed to VPR")
+
+    parser.add_argument("arch")
+    parser.add_argument("circuit")
+
+    parser.add_argument("--vpr",
+                        default="vpr",
+                        help="VPR executable")
+    parser.add_argument("--batch_size",
+                        type=int,
+                        default=16,
+                        help="Move batch size of the batched placer")
+    parser.add_argument("--jobs",
+                        type=int,
+                        default=0,
+                        help="Threads used by the batched placer (0: all cores)")
+    parser.add_argument("--seed",
+                        type=int,
+                        default=1,
+                        help="Placer seed")
+
+    args, vpr_args = parser.parse_known_args()
+
+    #An explicit separator may be used before the VPR arguments
+    if vpr_args and vpr_args[0] == "--":
+        vpr_args = vpr_args[1:]
+    args.vpr_args = vpr_args
+
+    return args
+
+def main():
+
+    args = parse_args()
+
+    runs = [
+        ("serial", ["--place_move_batch_size", "1"]),
+        ("batched", ["--place_move_batch_size", str(args.batch_size),
+                     "--place_jobs", str(args.jobs)]),
+    ]
+
+    results = []
+    for name, run_args in runs:
+        print("Running {} placer".format(name))
+        results.append((name, run_vpr(args, run_args)))
+
+    print_results(results)
+
+def run_vpr(args, run_args):
+
+    cmd = [os.path.abspath(args.vpr), os.path.abspath(args.arch), os.path.abspath(args.circuit),
+           "--pack", "--place",
+           "--seed", str(args.seed)] + run_args + args.vpr_args
+
+    with tempfile.TemporaryDirectory() as run_dir:
+        proc = subprocess.run(cmd, cwd=run_dir,
+                              stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                              universal_newlines=True)
+
+    if proc.returncode != 0:
+        print(proc.stdout)
+        print("VPR failed: {}".format(" ".join(cmd)))
+        sys.exit(1)
+
+    return parse_vpr_log(proc.stdout)
+
+def parse_vpr_log(log):
+
+    regexes = {
+        "cost": re.compile(r"^Placement cost: (?P<value>\S+),"),
+        "bb_cost": re.compile(r"^Placement cost: \S+, bb_cost: (?P<value>\S+),"),
+        "cpd_ns": re.compile(r"^Placement estimated critical path delay: (?P<value>\S+) ns"),
+        "time_s": re.compile(r"^#+ Placement took (?P<value>\S+) seconds"),
+    }
+
+    metrics = {}
+    for line in log.splitlines():
+        for metric, regex in regexes.items():
+            match = regex.match(line)
+            if match:
+                metrics[metric] = float(match.group("value"))
+
+    return metrics
+
+def print_results(results):
+
+    metrics = ["cost", "bb_cost", "cpd_ns", "time_s"]
+
+    print("{:<10}".format("placer") + "".join("{:>14}".format(metric) for metric in metrics))
+    for name, values in results:
+        print("{:<10}".format(name) + "".join("{:>14}".format(format_value(values.get(metric))) for metric in metrics))
+
+    #Ratio of the batched placer to the serial one
+    serial = results[0][1]
+    batched = results[1][1]
+    ratios = []
+    for metric in metrics:
+        if metric in serial and metric in batched and serial[metric] != 0.:
+            ratios.append(batched[metric] / serial[metric])
+        else:
+            ratios.append(None)
+    print("{:<10}".format("ratio") + "".join("{:>14}".format(format_value(ratio)) for ratio in ratios))
+
+def format_value(value):
+    if value is None:
+        return "-"
+    return "{:.4g}".format(value)
+
+if __name__ == "__main__":
+    main()
@@ -38,6 +38,11 @@ void CheckSetup(const t_packer_opts& PackerOpts,
                         "Timing analysis must be enabled for timing-driven placement.\n");
     }
 
+    if (0 == PlacerOpts.move_batch_size) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The placer move batch size must be at least 1.\n");
+    }
+
     if (!PlacerOpts.doPlacement && (USER == PlacerOpts.pad_loc_type)) {
         VPR_FATAL_ERROR(VPR_ERROR_OTHER,
                         "A pad location file requires that placement is enabled.\n");
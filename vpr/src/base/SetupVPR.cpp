@@ -42,6 +42,7 @@ static void SetupSwitches(const t_arch& Arch,
 static void SetupAnalysisOpts(const t_options& Options, t_analysis_opts& analysis_opts);
 static void SetupPowerOpts(const t_options& Options, t_power_opts* power_opts, t_arch* Arch);
 static int find_ipin_cblock_switch_index(const t_arch& Arch);
+static size_t timing_update_jobs(const t_options& Options);
 
 /* Sets VPR parameters and defaults. Does not do any error checking
  * as this should have been done by the various input checkers */
@@ -167,6 +168,9 @@ void SetupVPR(const t_options* Options,
     SetupPackerOpts(*Options, PackerOpts);
     RoutingArch->write_rr_graph_filename = Options->write_rr_graph_file;
     RoutingArch->read_rr_graph_filename = Options->read_rr_graph_file;
+    RoutingArch->read_device_snapshot_filename = Options->read_device_snapshot_file;
+    RoutingArch->write_device_snapshot_filename = Options->write_device_snapshot_file;
+    RoutingArch->check_jobs = Options->check_jobs;
 
     //Setup the default flow, if no specific stages specified
     //do all
@@ -379,6 +383,8 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->first_iteration_timing_report_file = Options.router_first_iteration_timing_report_file;
 
     RouterOpts->strict_checks = Options.strict_checks;
+    RouterOpts->timing_update_jobs = timing_update_jobs(Options);
+    RouterOpts->check_jobs = Options.check_jobs;
 
     RouterOpts->write_router_lookahead = Options.write_router_lookahead;
     RouterOpts->read_router_lookahead = Options.read_router_lookahead;
@@ -509,8 +515,11 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
 
     PlacerOpts->rlim_escape_fraction = Options.place_rlim_escape_fraction;
     PlacerOpts->move_stats_file = Options.place_move_stats_file;
+    PlacerOpts->move_batch_size = Options.place_move_batch_size;
+    PlacerOpts->place_jobs = Options.place_jobs;
 
     PlacerOpts->strict_checks = Options.strict_checks;
+    PlacerOpts->timing_update_jobs = timing_update_jobs(Options);
 
     PlacerOpts->write_placement_delay_lookup = Options.write_placement_delay_lookup;
     PlacerOpts->read_placement_delay_lookup = Options.read_placement_delay_lookup;
@@ -565,3 +574,12 @@ static int find_ipin_cblock_switch_index(const t_arch& Arch) {
     }
     return ipin_cblock_switch_index;
 }
+
+//Returns the number of threads used to update timing during placement and routing.
+//Unless explicitly specified, timing updates use as many threads as VPR workers.
+static size_t timing_update_jobs(const t_options& Options) {
+    if (Options.timing_update_jobs.provenance() == argparse::Provenance::SPECIFIED) {
+        return Options.timing_update_jobs;
+    }
+    return Options.num_workers;
+}
@@ -107,19 +107,18 @@ AtomBlockId AtomNetlist::find_atom_pin_driver(const AtomBlockId blk_id, const t_
  * Mutators
  *
  */
-AtomBlockId AtomNetlist::create_block(const std::string name, const t_model* model, const TruthTable truth_table) {
+AtomBlockId AtomNetlist::create_block(const std::string name, const t_model* model, TruthTable truth_table) {
     AtomBlockId blk_id = Netlist::create_block(name);
 
     //Initialize the data
     block_models_.push_back(model);
-    block_truth_tables_.push_back(truth_table);
+    block_truth_tables_.push_back(std::move(truth_table));
 
     //Check post-conditions: size
     VTR_ASSERT(validate_block_sizes());
 
     //Check post-conditions: values
     VTR_ASSERT(block_model(blk_id) == model);
-    VTR_ASSERT(block_truth_table(blk_id) == truth_table);
 
     return blk_id;
 }
@@ -247,6 +246,15 @@ void AtomNetlist::clean_nets_impl(const vtr::vector_map<AtomNetId, AtomNetId>& /
     //Unused
 }
 
+void AtomNetlist::reserve_impl(size_t num_blocks, size_t num_ports, size_t /*num_pins*/, size_t /*num_nets*/) {
+    //Block data
+    block_models_.reserve(num_blocks);
+    block_truth_tables_.reserve(num_blocks);
+
+    //Port data
+    port_models_.reserve(num_ports);
+}
+
 void AtomNetlist::shrink_to_fit_impl() {
     //Block data
     block_models_.shrink_to_fit();
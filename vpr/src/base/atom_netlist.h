@@ -139,7 +139,7 @@ class AtomNetlist : public Netlist<AtomBlockId, AtomPortId, AtomPinId, AtomNetId
     //  truth_table : The single-output cover defining the block's logic function
     //                The truth_table is optional and only relevant for LUTs (where it describes the logic function)
     //                and Flip-Flops/latches (where it consists of a single entry defining the initial state).
-    AtomBlockId create_block(const std::string name, const t_model* model, const TruthTable truth_table = TruthTable());
+    AtomBlockId create_block(const std::string name, const t_model* model, TruthTable truth_table = TruthTable());
 
     //Create or return an existing port in the netlist
     //  blk_id      : The block the port is associated with
@@ -187,6 +187,9 @@ class AtomNetlist : public Netlist<AtomBlockId, AtomPortId, AtomPinId, AtomNetId
     void rebuild_pin_refs_impl(const vtr::vector_map<AtomPortId, AtomPortId>& port_id_map, const vtr::vector_map<AtomNetId, AtomNetId>& net_id_map) override;
     void rebuild_net_refs_impl(const vtr::vector_map<AtomPinId, AtomPinId>& pin_id_map) override;
 
+    //Pre-allocates internal data structures for the expected netlist size
+    void reserve_impl(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets) override;
+
     //Shrinks internal data structures to required size to reduce memory consumption
     void shrink_to_fit_impl() override;
 
@@ -210,6 +210,9 @@ class ClusteredNetlist : public Netlist<ClusterBlockId, ClusterPortId, ClusterPi
     void clean_pins_impl(const vtr::vector_map<ClusterPinId, ClusterPinId>& pin_id_map) override;
     void clean_nets_impl(const vtr::vector_map<ClusterNetId, ClusterNetId>& net_id_map) override;
 
+    //Pre-allocates internal data structures for the expected netlist size
+    void reserve_impl(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets) override;
+
     //Shrinks internal data structures to required size to reduce memory consumption
     void shrink_to_fit_impl() override;
 
@@ -407,6 +407,7 @@
  *       remove_*()
  *       clean_*()
  *       validate_*_sizes()
+ *       reserve()
  *       shrink_to_fit()
  *    The derived functions based off of the virtual functions have suffix *_impl()
  *
@@ -757,6 +758,16 @@ class Netlist {
     //NOTE: this invalidates all existing IDs!
     IdRemapper compress();
 
+    //Pre-allocates the internal data structures for the expected number of netlist
+    //components, to avoid repeated re-allocations while a large netlist is created
+    //(e.g. when the sizes are known from a first pass over the netlist file).
+    //The numbers are hints: more components can still be created afterwards.
+    //  num_blocks: The expected number of blocks
+    //  num_ports : The expected number of ports
+    //  num_pins  : The expected number of pins
+    //  num_nets  : The expected number of nets
+    void reserve(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets);
+
   protected: //Protected Mutators
     //Create or return an existing block in the netlist
     //  name        : The unique name of the block
@@ -900,6 +911,7 @@ class Netlist {
   protected: //Protected virtual functions implemented in derived classes
     //The functions follow the Non-Virtual Interface (NVI) idiom, and
     //are called from this class in their respective non-impl() functions.
+    virtual void reserve_impl(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets) = 0;
     virtual void shrink_to_fit_impl() = 0;
 
     virtual bool validate_block_sizes_impl(size_t num_blocks) const = 0;
@@ -1346,6 +1346,55 @@ void Netlist<BlockId, PortId, PinId, NetId>::rebuild_net_refs(const vtr::vector_
     VTR_ASSERT(validate_net_sizes());
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::reserve(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets) {
+    //Block data
+    block_ids_.reserve(num_blocks);
+    block_names_.reserve(num_blocks);
+    block_pins_.reserve(num_blocks);
+    block_num_input_pins_.reserve(num_blocks);
+    block_num_output_pins_.reserve(num_blocks);
+    block_num_clock_pins_.reserve(num_blocks);
+    block_ports_.reserve(num_blocks);
+    block_num_input_ports_.reserve(num_blocks);
+    block_num_output_ports_.reserve(num_blocks);
+    block_num_clock_ports_.reserve(num_blocks);
+    block_attrs_.reserve(num_blocks);
+    block_params_.reserve(num_blocks);
+
+    //Port data
+    port_ids_.reserve(num_ports);
+    port_names_.reserve(num_ports);
+    port_blocks_.reserve(num_ports);
+    port_widths_.reserve(num_ports);
+    port_types_.reserve(num_ports);
+    port_pins_.reserve(num_ports);
+
+    //Pin data
+    pin_ids_.reserve(num_pins);
+    pin_ports_.reserve(num_pins);
+    pin_port_bits_.reserve(num_pins);
+    pin_nets_.reserve(num_pins);
+    pin_net_indices_.reserve(num_pins);
+    pin_is_constant_.reserve(num_pins);
+
+    //Net data
+    net_ids_.reserve(num_nets);
+    net_names_.reserve(num_nets);
+    net_pins_.reserve(num_nets);
+
+    //String data
+    // Block and net names are most of the strings
+    size_t num_strings = num_blocks + num_nets;
+    string_ids_.reserve(num_strings);
+    strings_.reserve(num_strings);
+    block_name_to_block_id_.reserve(num_strings);
+    net_name_to_net_id_.reserve(num_strings);
+    string_to_string_id_.reserve(num_strings);
+
+    reserve_impl(num_blocks, num_ports, num_pins, num_nets);
+}
+
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::shrink_to_fit() {
     //Block data
@@ -60,7 +60,7 @@ int binary_search_place_and_route(const t_placer_opts& placer_opts_ref,
      * tracks per channel required to successfully route a circuit, and returns *
      * that minimum width_fac.                                                  */
 
-    vtr::vector<ClusterNetId, t_trace*> best_routing; /* Saves the best routing found so far. */
+    vtr::vector<ClusterNetId, t_traceback> best_routing; /* Saves the best routing found so far. */
     int current, low, high, final;
     bool success, prev_success, prev2_success, Fc_clipped = false;
     bool using_minw_hint = false;
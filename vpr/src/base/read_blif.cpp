@@ -14,6 +14,13 @@
  * primitives are encountered by the parser.  The callback methods then create the associated
  * netlist data structures.
  *
+ * Netlists are first loaded through the BlifFastReader, which works directly on
+ * the memory mapped file: a first pass checks that the file only uses the plain subset of
+ * BLIF/EBLIF that it handles (falling back to blifparse otherwise, which also reports any
+ * syntax errors), and counts the netlist components of each .model so that the netlist
+ * can be pre-sized. A second pass then calls the same BlifAllocCallback methods, re-using
+ * the same name buffers for every statement and building the truth tables directly.
+ *
  */
 #include <cstdio>
 #include <cstring>
@@ -21,6 +28,10 @@
 #include <sstream>
 #include <unordered_set>
 #include <cctype> //std::isdigit
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "blifparse.hpp"
 #include "atom_netlist.h"
@@ -77,6 +88,29 @@ struct BlifAllocCallback : public blifparse::Callback {
     }
 
     void inputs(std::vector<std::string> input_names) override {
+        add_inputs(input_names);
+    }
+
+    void outputs(std::vector<std::string> output_names) override {
+        add_outputs(output_names);
+    }
+
+    void names(std::vector<std::string> nets, std::vector<std::vector<blifparse::LogicValue>> so_cover) override {
+        //Convert the single-output cover to a netlist truth table
+        AtomNetlist::TruthTable truth_table;
+        for (const auto& row : so_cover) {
+            truth_table.emplace_back();
+            for (auto val : row) {
+                truth_table[truth_table.size() - 1].push_back(to_vtr_logic_value(val));
+            }
+        }
+
+        add_names(nets, std::move(truth_table));
+    }
+
+    //The add_*() methods are also called directly by the BlifFastReader,
+    //which passes the same name buffers for every statement
+    void add_inputs(const std::vector<std::string>& input_names) {
         const t_model* blk_model = find_model(MODEL_INPUT);
 
         VTR_ASSERT_MSG(!blk_model->inputs, "Inpad model has an input port");
@@ -94,7 +128,7 @@ struct BlifAllocCallback : public blifparse::Callback {
         set_curr_block(AtomBlockId::INVALID()); //This statement doesn't define a block, so mark invalid
     }
 
-    void outputs(std::vector<std::string> output_names) override {
+    void add_outputs(const std::vector<std::string>& output_names) {
         const t_model* blk_model = find_model(MODEL_OUTPUT);
 
         VTR_ASSERT_MSG(!blk_model->outputs, "Outpad model has an output port");
@@ -114,7 +148,7 @@ struct BlifAllocCallback : public blifparse::Callback {
         set_curr_block(AtomBlockId::INVALID()); //This statement doesn't define a block, so mark invalid
     }
 
-    void names(std::vector<std::string> nets, std::vector<std::vector<blifparse::LogicValue>> so_cover) override {
+    void add_names(const std::vector<std::string>& nets, AtomNetlist::TruthTable&& new_truth_table) {
         const t_model* blk_model = find_model(MODEL_NAMES);
 
         VTR_ASSERT_MSG(nets.size() > 0, "BLIF .names has no connections");
@@ -130,17 +164,9 @@ struct BlifAllocCallback : public blifparse::Callback {
         VTR_ASSERT_MSG(!blk_model->outputs->next, ".names model has multiple output ports");
         VTR_ASSERT_MSG(blk_model->outputs->size == 1, ".names model has non-single-bit output");
 
-        //Convert the single-output cover to a netlist truth table
-        AtomNetlist::TruthTable truth_table;
-        for (const auto& row : so_cover) {
-            truth_table.emplace_back();
-            for (auto val : row) {
-                truth_table[truth_table.size() - 1].push_back(to_vtr_logic_value(val));
-            }
-        }
-
-        AtomBlockId blk_id = curr_model().create_block(nets[nets.size() - 1], blk_model, truth_table);
+        AtomBlockId blk_id = curr_model().create_block(nets[nets.size() - 1], blk_model, std::move(new_truth_table));
         set_curr_block(blk_id);
+        const AtomNetlist::TruthTable& truth_table = curr_model().block_truth_table(blk_id);
 
         //Create inputs
         AtomPortId input_port_id = curr_model().create_port(blk_id, blk_model->inputs);
@@ -222,7 +248,7 @@ struct BlifAllocCallback : public blifparse::Callback {
         AtomNetlist::TruthTable truth_table(1);
         truth_table[0].push_back(to_vtr_logic_value(init));
 
-        AtomBlockId blk_id = curr_model().create_block(output, blk_model, truth_table);
+        AtomBlockId blk_id = curr_model().create_block(output, blk_model, std::move(truth_table));
         set_curr_block(blk_id);
 
         //The input
@@ -242,6 +268,10 @@ struct BlifAllocCallback : public blifparse::Callback {
     }
 
     void subckt(std::string subckt_model, std::vector<std::string> ports, std::vector<std::string> nets) override {
+        add_subckt(subckt_model, ports, nets);
+    }
+
+    void add_subckt(const std::string& subckt_model, const std::vector<std::string>& ports, const std::vector<std::string>& nets) {
         VTR_ASSERT(ports.size() == nets.size());
 
         const t_model* blk_model = find_model(subckt_model);
@@ -396,6 +426,11 @@ struct BlifAllocCallback : public blifparse::Callback {
     }
 
   public:
+    //Pre-allocates the currently active .model for the expected number of netlist components
+    void reserve_curr_model(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets) {
+        curr_model().reserve(num_blocks, num_ports, num_pins, num_nets);
+    }
+
     //Retrieve the netlist
     size_t determine_main_netlist_index() {
         //Look through all the models loaded, to find the one which is non-blackbox (i.e. has real blocks
@@ -655,15 +690,481 @@ vtr::LogicValue to_vtr_logic_value(blifparse::LogicValue val) {
     return new_val;
 }
 
+//A token of a BLIF statement, pointing into the memory mapped file
+struct BlifToken {
+    const char* text = nullptr;
+    size_t size = 0;
+
+    bool operator==(const char* str) const {
+        return 0 == std::strncmp(text, str, size) && '\0' == str[size];
+    }
+    bool operator!=(const char* str) const { return !(*this == str); }
+};
+
+//Loads a BLIF/EBLIF file memory mapped, without the per-token allocations of
+//the blifparse lexer and parser.
+//
+//Only the plain subset of BLIF/EBLIF is supported: read() returns false before
+//calling any netlist construction method if the file uses anything else (or has
+//a syntax error), so that the caller can fall back to blifparse.
+class BlifFastReader {
+  public:
+    BlifFastReader(const char* blif_file, BlifAllocCallback& callback)
+        : blif_file_(blif_file)
+        , callback_(callback) {
+        int fd = open(blif_file, O_RDONLY);
+        if (-1 == fd) {
+            return;
+        }
+        struct stat file_stat;
+        if ((0 == fstat(fd, &file_stat)) && (0 < file_stat.st_size)) {
+            void* data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != data) {
+                data_ = static_cast<const char*>(data);
+                size_ = file_stat.st_size;
+                madvise(data, size_, MADV_SEQUENTIAL);
+            }
+        }
+        close(fd);
+    }
+
+    ~BlifFastReader() {
+        if (nullptr != data_) {
+            munmap(const_cast<char*>(data_), size_);
+        }
+    }
+
+    //Loads the netlist through the callback.
+    //Returns false if the file could not be loaded by this reader
+    bool read() {
+        if (nullptr == data_ || !count_models()) {
+            return false;
+        }
+        build_models();
+        return true;
+    }
+
+  private:
+    //Expected number of netlist components of each .model
+    struct ModelSize {
+        size_t num_blocks = 0;
+        size_t num_ports = 0;
+        size_t num_pins = 0;
+        size_t num_nets = 0;
+    };
+
+    //First pass: checks that every statement is supported, and counts the components of each .model
+    bool count_models() {
+        rewind();
+        bool in_names = false;
+        size_t names_width = 0;
+        while (next_statement()) {
+            const BlifToken& cmd = tokens_[0];
+
+            if ('.' != cmd.text[0]) {
+                //Only the single-output cover rows of a .names are not statements
+                if (!in_names || !is_cover_row(names_width)) {
+                    return false;
+                }
+                continue;
+            }
+            in_names = false;
+
+            //Keywords and '=' are only supported where expected
+            for (size_t i = 1; i < tokens_.size(); ++i) {
+                if (is_keyword(tokens_[i]) || (tokens_[i] == "=" && cmd != ".subckt")) {
+                    return false;
+                }
+            }
+
+            if (cmd == ".model") {
+                if (2 != tokens_.size()) {
+                    return false;
+                }
+                model_sizes_.emplace_back();
+                continue;
+            }
+            if (model_sizes_.empty()) {
+                return false;
+            }
+            ModelSize& model_size = model_sizes_.back();
+
+            size_t num_args = tokens_.size() - 1;
+            if (cmd == ".inputs" || cmd == ".outputs") {
+                model_size.num_blocks += num_args;
+                model_size.num_ports += num_args;
+                model_size.num_pins += num_args;
+                if (cmd == ".inputs") {
+                    model_size.num_nets += num_args;
+                }
+            } else if (cmd == ".names") {
+                in_names = true;
+                names_width = num_args;
+                model_size.num_blocks += 1;
+                model_size.num_ports += 2;
+                model_size.num_pins += num_args;
+                model_size.num_nets += 1;
+            } else if (cmd == ".latch") {
+                if (!is_supported_latch()) {
+                    return false;
+                }
+                model_size.num_blocks += 1;
+                model_size.num_ports += 3;
+                model_size.num_pins += 3;
+                model_size.num_nets += 1;
+            } else if (cmd == ".subckt") {
+                //.subckt <model> <port>=<net> ...
+                if (0 == num_args || 0 != (num_args - 1) % 3) {
+                    return false;
+                }
+                for (size_t i = 2; i < tokens_.size(); i += 3) {
+                    if (tokens_[i] == "=" || tokens_[i + 1] != "=" || tokens_[i + 2] == "=") {
+                        return false;
+                    }
+                }
+                size_t num_conns = (num_args - 1) / 3;
+                model_size.num_blocks += 1;
+                model_size.num_ports += num_conns;
+                model_size.num_pins += num_conns;
+                model_size.num_nets += 1;
+            } else if (cmd == ".blackbox" || cmd == ".end") {
+                if (0 != num_args) {
+                    return false;
+                }
+            } else if (cmd == ".conn") {
+                if (2 != num_args) {
+                    return false;
+                }
+            } else if (cmd == ".cname") {
+                if (1 != num_args) {
+                    return false;
+                }
+            } else if (cmd == ".attr" || cmd == ".param") {
+                if (1 != num_args && 2 != num_args) {
+                    return false;
+                }
+            } else {
+                return false;
+            }
+        }
+
+        return !unsupported_;
+    }
+
+    //Second pass: builds the netlist of each .model through the callback
+    void build_models() {
+        rewind();
+        callback_.start_parse();
+        callback_.filename(blif_file_);
+
+        size_t imodel = 0;
+        bool in_names = false;
+        int names_lineno = -1;
+        AtomNetlist::TruthTable truth_table;
+        while (next_statement()) {
+            const BlifToken& cmd = tokens_[0];
+
+            if ('.' != cmd.text[0]) {
+                //A single-output cover row of the current .names
+                truth_table.emplace_back();
+                std::vector<vtr::LogicValue>& row = truth_table.back();
+                row.reserve(names_.size());
+                for (const BlifToken& token : tokens_) {
+                    for (size_t i = 0; i < token.size; ++i) {
+                        row.push_back(to_cover_value(token.text[i]));
+                    }
+                }
+                continue;
+            }
+
+            if (in_names) {
+                //The .names ends with its last cover row
+                callback_.lineno(names_lineno);
+                callback_.add_names(names_, std::move(truth_table));
+                truth_table.clear();
+                in_names = false;
+            }
+
+            callback_.lineno(lineno_);
+            if (cmd == ".model") {
+                callback_.begin_model(to_string(tokens_[1]));
+                const ModelSize& model_size = model_sizes_[imodel++];
+                callback_.reserve_curr_model(model_size.num_blocks, model_size.num_ports,
+                                             model_size.num_pins, model_size.num_nets);
+            } else if (cmd == ".inputs") {
+                callback_.add_inputs(load_strings(names_, 1, 1));
+            } else if (cmd == ".outputs") {
+                callback_.add_outputs(load_strings(names_, 1, 1));
+            } else if (cmd == ".names") {
+                load_strings(names_, 1, 1);
+                in_names = true;
+                names_lineno = lineno_;
+            } else if (cmd == ".latch") {
+                build_latch();
+            } else if (cmd == ".subckt") {
+                callback_.add_subckt(to_string(tokens_[1]),
+                                     load_strings(ports_, 2, 3),
+                                     load_strings(names_, 4, 3));
+            } else if (cmd == ".blackbox") {
+                callback_.blackbox();
+            } else if (cmd == ".end") {
+                callback_.end_model();
+            } else if (cmd == ".conn") {
+                callback_.conn(to_string(tokens_[1]), to_string(tokens_[2]));
+            } else if (cmd == ".cname") {
+                callback_.cname(to_string(tokens_[1]));
+            } else if (cmd == ".attr") {
+                callback_.attr(to_string(tokens_[1]), 3 == tokens_.size() ? to_string(tokens_[2]) : "");
+            } else {
+                VTR_ASSERT(cmd == ".param");
+                callback_.param(to_string(tokens_[1]), 3 == tokens_.size() ? to_string(tokens_[2]) : "");
+            }
+        }
+
+        if (in_names) {
+            callback_.lineno(names_lineno);
+            callback_.add_names(names_, std::move(truth_table));
+        }
+
+        callback_.finish_parse();
+    }
+
+    //Latch arguments: <input> <output> [<type> <control>] [<init>]
+    bool is_supported_latch() const {
+        if (3 > tokens_.size() || 6 < tokens_.size()) {
+            return false;
+        }
+        //The input and output must not be latch keywords
+        for (size_t i = 1; i < 3; ++i) {
+            if (is_latch_type(tokens_[i]) || is_latch_init(tokens_[i]) || tokens_[i] == "NIL") {
+                return false;
+            }
+        }
+        if (4 == tokens_.size()) {
+            return is_latch_init(tokens_[3]);
+        }
+        if (5 <= tokens_.size()) {
+            if (!is_latch_type(tokens_[3])
+                || is_latch_type(tokens_[4]) || is_latch_init(tokens_[4])) {
+                return false;
+            }
+        }
+        if (6 == tokens_.size()) {
+            return is_latch_init(tokens_[5]);
+        }
+        return true;
+    }
+
+    void build_latch() {
+        blifparse::LatchType type = blifparse::LatchType::UNSPECIFIED;
+        std::string control;
+        blifparse::LogicValue init = blifparse::LogicValue::UNKOWN;
+        if (5 <= tokens_.size()) {
+            type = to_latch_type(tokens_[3]);
+            if (tokens_[4] != "NIL") {
+                control = to_string(tokens_[4]);
+            }
+        }
+        if (4 == tokens_.size() || 6 == tokens_.size()) {
+            init = to_latch_init(tokens_.back());
+        }
+        callback_.latch(to_string(tokens_[1]), to_string(tokens_[2]), type, control, init);
+    }
+
+    //A cover row has the same width as its .names, and only contains '0', '1' and '-'
+    bool is_cover_row(size_t width) const {
+        size_t row_width = 0;
+        for (const BlifToken& token : tokens_) {
+            for (size_t i = 0; i < token.size; ++i) {
+                if ('0' != token.text[i] && '1' != token.text[i] && '-' != token.text[i]) {
+                    return false;
+                }
+            }
+            row_width += token.size;
+        }
+        return row_width == width;
+    }
+
+    static bool is_keyword(const BlifToken& token) {
+        for (const char* keyword : {".model", ".inputs", ".outputs", ".names", ".latch", ".subckt",
+                                    ".blackbox", ".end", ".conn", ".cname", ".attr", ".param"}) {
+            if (token == keyword) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool is_latch_type(const BlifToken& token) {
+        return token == "fe" || token == "re" || token == "ah" || token == "al" || token == "as";
+    }
+
+    static bool is_latch_init(const BlifToken& token) {
+        return 1 == token.size && '0' <= token.text[0] && token.text[0] <= '3';
+    }
+
+    static blifparse::LatchType to_latch_type(const BlifToken& token) {
+        if (token == "fe") return blifparse::LatchType::FALLING_EDGE;
+        if (token == "re") return blifparse::LatchType::RISING_EDGE;
+        if (token == "ah") return blifparse::LatchType::ACTIVE_HIGH;
+        if (token == "al") return blifparse::LatchType::ACTIVE_LOW;
+        VTR_ASSERT(token == "as");
+        return blifparse::LatchType::ASYNCHRONOUS;
+    }
+
+    static blifparse::LogicValue to_latch_init(const BlifToken& token) {
+        switch (token.text[0]) {
+            case '0':
+                return blifparse::LogicValue::FALSE;
+            case '1':
+                return blifparse::LogicValue::TRUE;
+            case '2':
+                return blifparse::LogicValue::DONT_CARE;
+            default:
+                VTR_ASSERT(token.text[0] == '3');
+                return blifparse::LogicValue::UNKOWN;
+        }
+    }
+
+    static vtr::LogicValue to_cover_value(char c) {
+        switch (c) {
+            case '0':
+                return vtr::LogicValue::FALSE;
+            case '1':
+                return vtr::LogicValue::TRUE;
+            default:
+                VTR_ASSERT(c == '-');
+                return vtr::LogicValue::DONT_CARE;
+        }
+    }
+
+    static std::string to_string(const BlifToken& token) {
+        return std::string(token.text, token.size);
+    }
+
+    //Loads every stride'th token from the first one into the strings,
+    //re-using the memory of the strings from the previous statements
+    const std::vector<std::string>& load_strings(std::vector<std::string>& strings, size_t first, size_t stride) const {
+        size_t num_strings = 0;
+        for (size_t i = first; i < tokens_.size(); i += stride) {
+            if (num_strings == strings.size()) {
+                strings.emplace_back();
+            }
+            strings[num_strings++].assign(tokens_[i].text, tokens_[i].size);
+        }
+        strings.resize(num_strings);
+        return strings;
+    }
+
+    void rewind() {
+        pos_ = 0;
+        next_lineno_ = 1;
+    }
+
+    //Splits the next statement into tokens, joining continued lines and skipping
+    //comments and blank lines. Returns false at the end of the file
+    bool next_statement() {
+        tokens_.clear();
+        lineno_ = next_lineno_;
+        while (pos_ < size_) {
+            char c = data_[pos_];
+            if ('\n' == c) {
+                ++pos_;
+                ++next_lineno_;
+                if (!tokens_.empty()) {
+                    return true;
+                }
+                lineno_ = next_lineno_;
+            } else if (' ' == c || '\t' == c || '\r' == c) {
+                ++pos_;
+            } else if ('#' == c) {
+                //Comment up to the end of the line
+                const void* end = std::memchr(data_ + pos_, '\n', size_ - pos_);
+                pos_ = end ? static_cast<const char*>(end) - data_ : size_;
+            } else if ('\\' == c && skip_continuation(pos_ + 1)) {
+                continue;
+            } else if ('=' == c) {
+                tokens_.push_back({data_ + pos_, 1});
+                ++pos_;
+            } else {
+                size_t begin = pos_;
+                while (pos_ < size_ && !is_delimiter(data_[pos_])) {
+                    ++pos_;
+                }
+                size_t end = pos_;
+                //A continuation may directly follow a token
+                if ('\\' == data_[end - 1] && skip_continuation(end)) {
+                    --end;
+                }
+                if ('\\' == data_[end - 1]) {
+                    //Left to blifparse
+                    unsupported_ = true;
+                }
+                tokens_.push_back({data_ + begin, end - begin});
+            }
+        }
+        return !tokens_.empty();
+    }
+
+    //Skips the end of line after a '\' at pos-1, if any
+    bool skip_continuation(size_t pos) {
+        if (pos < size_ && '\r' == data_[pos]) {
+            ++pos;
+        }
+        if (pos < size_ && '\n' == data_[pos]) {
+            pos_ = pos + 1;
+            ++next_lineno_;
+            return true;
+        }
+        return false;
+    }
+
+    static bool is_delimiter(char c) {
+        return ' ' == c || '\t' == c || '\r' == c || '\n' == c || '=' == c;
+    }
+
+  private:
+    const char* blif_file_;
+    BlifAllocCallback& callback_;
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    size_t pos_ = 0;
+    int lineno_ = 1;      //Line of the current statement
+    int next_lineno_ = 1; //Line at the current position
+    bool unsupported_ = false;
+
+    std::vector<BlifToken> tokens_;
+    std::vector<std::string> names_;
+    std::vector<std::string> ports_;
+    std::vector<ModelSize> model_sizes_;
+};
+
 AtomNetlist read_blif(e_circuit_format circuit_format,
                       const char* blif_file,
                       const t_model* user_models,
-                      const t_model* library_models) {
+                      const t_model* library_models,
+                      e_blif_reader blif_reader) {
     AtomNetlist netlist;
     std::string netlist_id = vtr::secure_digest_file(blif_file);
 
     BlifAllocCallback alloc_callback(circuit_format, netlist, netlist_id, user_models, library_models);
-    blifparse::blif_parse_filename(blif_file, alloc_callback);
+
+    if (blif_reader == e_blif_reader::BLIFPARSE) {
+        blifparse::blif_parse_filename(blif_file, alloc_callback);
+        return netlist;
+    }
+
+    //Files using more than the plain subset of BLIF/EBLIF (or with syntax errors)
+    //are left to blifparse
+    BlifFastReader fast_reader(blif_file, alloc_callback);
+    if (!fast_reader.read()) {
+        if (blif_reader == e_blif_reader::FAST) {
+            VPR_FATAL_ERROR(VPR_ERROR_BLIF_F,
+                            "'%s' is not supported by the fast BLIF reader", blif_file);
+        }
+        blifparse::blif_parse_filename(blif_file, alloc_callback);
+    }
 
     return netlist;
 }
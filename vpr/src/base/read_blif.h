@@ -4,9 +4,16 @@
 #include "atom_netlist_fwd.h"
 #include "read_circuit.h"
 
+enum class e_blif_reader {
+    FAST_WITH_FALLBACK, //BlifFastReader, falling back to blifparse for the files it does not support
+    FAST,               //BlifFastReader only (an error for the files it does not support)
+    BLIFPARSE           //blifparse only
+};
+
 AtomNetlist read_blif(e_circuit_format circuit_format,
                       const char* blif_file,
                       const t_model* user_models,
-                      const t_model* library_models);
+                      const t_model* library_models,
+                      e_blif_reader blif_reader = e_blif_reader::FAST_WITH_FALLBACK);
 
 #endif /*READ_BLIF_H*/
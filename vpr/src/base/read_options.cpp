@@ -876,6 +876,17 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
             "environment variable; otherwise the default is used.")
         .default_value("1");
 
+    gen_grp.add_argument<size_t>(args.timing_update_jobs, "--timing_update_jobs")
+        .help(
+            "Controls how many threads are used to update timing (static timing analysis)"
+            " during placement and routing:\n"
+            " *  1 implies timing is updated serially,\n"
+            " * >1 implies the nodes of each timing graph level are split across up to\n"
+            "      the specified number of threads, and\n"
+            " *  0 implies as many threads as the host machine supports are used.\n"
+            "If this option is not specified, the value of --num_workers is used.")
+        .default_value("1");
+
     gen_grp.add_argument<bool, ParseOnOff>(args.timing_analysis, "--timing_analysis")
         .help("Controls whether timing analysis (and timing driven optimizations) are enabled.")
         .default_value("on");
@@ -948,6 +959,17 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("on")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    gen_grp.add_argument<size_t>(args.check_jobs, "--check_jobs")
+        .help(
+            "Controls how many threads are used to run the routing resource graph"
+            " and routing legality checks:\n"
+            " *  1 implies the checks are run serially,\n"
+            " * >1 implies the checks are split across up to the specified number of threads, and\n"
+            " *  0 implies the checks use as many threads as the host machine supports.\n"
+            "Errors are always reported in the same (net/node) order, whatever the number of threads.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     gen_grp.add_argument<std::string>(args.disable_errors, "--disable_errors")
         .help(
             "Parses a list of functions for which the errors are going to be treated as warnings.\n"
@@ -1023,6 +1045,22 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .metavar("RR_GRAPH_FILE")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument(args.read_device_snapshot_file, "--read_device_snapshot")
+        .help(
+            "Loads the routing resource graph from a binary device snapshot instead of building it."
+            " The snapshot is only used if it was written for the same architecture file content,"
+            " routing resource graph options, grid and channel widths;"
+            " otherwise the routing resource graph is built as usual.")
+        .metavar("SNAPSHOT_FILE")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    file_grp.add_argument(args.write_device_snapshot_file, "--write_device_snapshot")
+        .help(
+            "Writes the routing resource graph to a binary device snapshot after it is built,"
+            " which can be loaded by later runs with --read_device_snapshot")
+        .metavar("SNAPSHOT_FILE")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     file_grp.add_argument(args.read_router_lookahead, "--read_router_lookahead")
         .help(
             "Reads the lookahead data from the specified file instead of computing it.")
@@ -1310,6 +1348,24 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument<size_t>(args.place_move_batch_size, "--place_move_batch_size")
+        .help(
+            "Number of moves the annealer proposes at once."
+            " With a value larger than 1, the moves of a batch which affect disjoint nets"
+            " are evaluated concurrently (see --place_jobs) and then accepted or rejected in proposal order;"
+            " moves conflicting with an earlier move of the same batch are dropped and proposed again."
+            " The placement only depends on the batch size, not on the number of threads."
+            " A value of 1 uses the classic one-move-at-a-time annealer.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<size_t>(args.place_jobs, "--place_jobs")
+        .help(
+            "Number of threads used to evaluate the moves of a batch (see --place_move_batch_size)."
+            " 0 uses all the hardware threads available.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& place_timing_grp = parser.add_argument_group("timing-driven placement options");
 
     place_timing_grp.add_argument(args.PlaceTimingTradeoff, "--timing_tradeoff")
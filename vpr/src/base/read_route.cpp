@@ -52,7 +52,7 @@ static std::string format_name(std::string name);
 
 /*************Global Functions****************************/
 bool read_route(const char* route_file, const t_router_opts& router_opts, bool verify_file_digests) {
-    /* Reads in the routing file to fill in the trace.head and t_clb_opins_used data structure.
+    /* Reads in the routing file to fill in the traceback and t_clb_opins_used data structure.
      * Perform a series of verification tests to ensure the netlist, placement, and routing
      * files match */
     auto& device_ctx = g_vpr_ctx.mutable_device();
@@ -190,15 +190,13 @@ static void process_nets(std::ifstream& fp, ClusterNetId inet, std::string name,
 }
 
 static void process_nodes(std::ifstream& fp, ClusterNetId inet, const char* filename, int& lineno) {
-    /* Not a global net. Goes through every node and add it into trace.head*/
+    /* Not a global net. Goes through every node and add it into the traceback*/
 
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
     auto& device_ctx = g_vpr_ctx.mutable_device();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
     auto& place_ctx = g_vpr_ctx.placement();
 
-    t_trace* tptr = route_ctx.trace[inet].head;
-
     /*remember the position of the last line in order to go back*/
     std::streampos oldpos = fp.tellg();
     int inode, x, y, x2, y2, ptc, switch_id, offset;
@@ -315,22 +313,9 @@ static void process_nodes(std::ifstream& fp, ClusterNetId inet, const char* file
                 switch_id = atoi(tokens[7 + offset].c_str());
             }
 
-            /* Allocate and load correct values to trace.head*/
-            if (node_count == 0) {
-                route_ctx.trace[inet].head = alloc_trace_data();
-                route_ctx.trace[inet].head->index = node;
-                route_ctx.trace[inet].head->iswitch = switch_id;
-                route_ctx.trace[inet].head->next = nullptr;
-                tptr = route_ctx.trace[inet].head;
-                node_count++;
-            } else {
-                tptr->next = alloc_trace_data();
-                tptr = tptr->next;
-                tptr->index = node;
-                tptr->iswitch = switch_id;
-                tptr->next = nullptr;
-                node_count++;
-            }
+            /* Load correct values to the traceback*/
+            route_ctx.trace[inet].push_back({node, (short)switch_id});
+            node_count++;
         }
         /*stores last line so can easily go back to read*/
         oldpos = fp.tellg();
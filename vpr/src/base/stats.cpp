@@ -216,7 +216,6 @@ static void get_channel_occupancy_stats() {
  * channel segments in the FPGA.                                           */
 static void load_channel_occupancies(vtr::Matrix<int>& chanx_occ, vtr::Matrix<int>& chany_occ) {
     int i, j;
-    t_trace* tptr;
     t_rr_type rr_type;
 
     auto& device_ctx = g_vpr_ctx.device();
@@ -233,15 +232,13 @@ static void load_channel_occupancies(vtr::Matrix<int>& chanx_occ, vtr::Matrix<in
         if (cluster_ctx.clb_nlist.net_is_ignored(net_id) && cluster_ctx.clb_nlist.net_sinks(net_id).size() != 0)
             continue;
 
-        tptr = route_ctx.trace[net_id].head;
-        while (tptr != nullptr) {
-            const RRNodeId& inode = tptr->index;
+        const t_traceback& traceback = route_ctx.trace[net_id];
+        for (size_t itrace = 0; itrace < traceback.size(); ++itrace) {
+            const RRNodeId& inode = traceback[itrace].index;
             rr_type = device_ctx.rr_graph.node_type(inode);
 
             if (rr_type == SINK) {
-                tptr = tptr->next; /* Skip next segment. */
-                if (tptr == nullptr)
-                    break;
+                ++itrace; /* Skip next segment. */
             }
 
             else if (rr_type == CHANX) {
@@ -255,8 +252,6 @@ static void load_channel_occupancies(vtr::Matrix<int>& chanx_occ, vtr::Matrix<in
                 for (j = device_ctx.rr_graph.node_ylow(inode); j <= device_ctx.rr_graph.node_yhigh(inode); j++)
                     chany_occ[i][j]++;
             }
-
-            tptr = tptr->next;
         }
     }
 }
@@ -267,7 +262,6 @@ void get_num_bends_and_length(ClusterNetId inet, int* bends_ptr, int* len_ptr, i
     auto& route_ctx = g_vpr_ctx.routing();
     auto& device_ctx = g_vpr_ctx.device();
 
-    t_trace *tptr, *prevptr;
     t_rr_type curr_type, prev_type;
     int bends, length, segments;
 
@@ -275,26 +269,24 @@ void get_num_bends_and_length(ClusterNetId inet, int* bends_ptr, int* len_ptr, i
     length = 0;
     segments = 0;
 
-    prevptr = route_ctx.trace[inet].head; /* Should always be SOURCE. */
-    if (prevptr == nullptr) {
+    const t_traceback& traceback = route_ctx.trace[inet];
+    if (traceback.empty()) {
         VPR_FATAL_ERROR(VPR_ERROR_OTHER,
                         "in get_num_bends_and_length: net #%lu has no traceback.\n", size_t(inet));
     }
-    RRNodeId inode = prevptr->index;
+    RRNodeId inode = traceback[0].index; /* Should always be SOURCE. */
     prev_type = device_ctx.rr_graph.node_type(inode);
 
-    tptr = prevptr->next;
-
-    while (tptr != nullptr) {
-        inode = tptr->index;
+    for (size_t itrace = 1; itrace < traceback.size(); ++itrace) {
+        inode = traceback[itrace].index;
         curr_type = device_ctx.rr_graph.node_type(inode);
 
         if (curr_type == SINK) { /* Starting a new segment */
-            tptr = tptr->next;   /* Link to existing path - don't add to len. */
-            if (tptr == nullptr)
+            ++itrace;            /* Link to existing path - don't add to len. */
+            if (itrace == traceback.size())
                 break;
 
-            curr_type = device_ctx.rr_graph.node_type(tptr->index);
+            curr_type = device_ctx.rr_graph.node_type(traceback[itrace].index);
         }
 
         else if (curr_type == CHANX || curr_type == CHANY) {
@@ -307,7 +299,6 @@ void get_num_bends_and_length(ClusterNetId inet, int* bends_ptr, int* len_ptr, i
         }
 
         prev_type = curr_type;
-        tptr = tptr->next;
     }
 
     *bends_ptr = bends;
@@ -661,7 +661,7 @@ RouteStatus vpr_route_flow(t_vpr_setup& vpr_setup, const t_arch& arch) {
 
             routing_delay_calc = std::make_shared<RoutingDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, net_delay);
 
-            timing_info = make_setup_hold_timing_info(routing_delay_calc);
+            timing_info = make_setup_hold_timing_info(routing_delay_calc, router_opts.timing_update_jobs);
         }
 
         if (router_opts.doRouting == STAGE_DO) {
@@ -688,7 +688,7 @@ RouteStatus vpr_route_flow(t_vpr_setup& vpr_setup, const t_arch& arch) {
         std::string graphics_msg;
         if (route_status.success()) {
             //Sanity check the routing
-            check_route(router_opts.route_type);
+            check_route(router_opts.route_type, router_opts.check_jobs);
             get_serial_num();
 
             //Update status
@@ -983,7 +983,6 @@ void free_device(const t_det_routing_arch& routing_arch) {
     delete[] device_ctx.arch_switch_inf;
     device_ctx.arch_switch_inf = nullptr;
     free_complex_block_types();
-    free_chunk_memory_trace();
 }
 
 static void free_complex_block_types() {
@@ -794,6 +794,8 @@ struct t_placer_opts {
     e_stage_action doPlacement;
     float rlim_escape_fraction;
     std::string move_stats_file;
+    size_t move_batch_size; //Number of moves proposed at once (1: classic serial annealer)
+    size_t place_jobs;      //Number of threads evaluating the moves of a batch (0: all available)
 
     PlaceDelayModelType delay_model_type;
     e_reducer delay_model_reducer;
@@ -808,6 +810,8 @@ struct t_placer_opts {
 
     bool strict_checks;
 
+    size_t timing_update_jobs; //Number of threads used to update timing (0: all available)
+
     std::string write_placement_delay_lookup;
     std::string read_placement_delay_lookup;
 
@@ -950,6 +954,8 @@ struct t_router_opts {
     float reconvergence_cpd_threshold;
     std::string first_iteration_timing_report_file;
     bool strict_checks;
+    size_t check_jobs; //Number of threads used by the routing legality checks (0: all available)
+    size_t timing_update_jobs; //Number of threads used to update timing (0: all available)
 
     std::string write_router_lookahead;
     std::string read_router_lookahead;
@@ -996,6 +1002,11 @@ struct t_analysis_opts {
  * read_rr_graph_filename: File to read the RR graph from (overrides        *
  *                         architecture)                                    *
  * write_rr_graph_filename: File to write the RR graph to after generation  *
+ * read_device_snapshot_filename: Binary snapshot to load the RR graph from *
+ *                                (ignored if built for another device)     *
+ * write_device_snapshot_filename: Binary snapshot to write the RR graph to *
+ * check_jobs: Number of threads used to check the RR graph (0: all those   *
+ *             available on the host)                                       *
  *                                                                          */
 
 struct t_det_routing_arch {
@@ -1023,6 +1034,10 @@ struct t_det_routing_arch {
 
     std::string read_rr_graph_filename;
     std::string write_rr_graph_filename;
+    std::string read_device_snapshot_filename;
+    std::string write_device_snapshot_filename;
+
+    size_t check_jobs;
 };
 
 
@@ -1138,14 +1153,13 @@ struct t_linked_f_pointer {
 typedef std::vector<std::vector<std::vector<std::vector<std::vector<int>>>>> t_rr_node_indices; //[0..num_rr_types-1][0..grid_width-1][0..grid_height-1][0..NUM_SIDES-1][0..max_ptc-1]
 
 /* Basic element used to store the traceback (routing) of each net.        *
+ * The elements of a net are stored contiguously (see t_traceback).        *
  * index:   Array index (ID) of this routing resource node.                *
  * iswitch: Index of the switch type used to go from this rr_node to       *
  *          the next one in the routing.  OPEN if there is no next node    *
  *          (i.e. this node is the last one (a SINK) in a branch of the    *
- *          net's routing).                                                *
- * next:    Pointer to the next traceback element in this route.           */
+ *          net's routing).                                                */
 struct t_trace {
-    t_trace* next;
     RRNodeId index;
     short iswitch;
 };
@@ -1,18 +1,53 @@
 #include <map>
 
 #include "vtr_log.h"
+#include "vtr_parallel.h"
 
 #include "check_rr_graph_obj.h"
 
 /*********************************************************************** 
- * This function aims at checking any duplicated edges (with same EdgeId) 
+ * Walk through all the valid nodes of a RRGraph and collect those
+ * for which the given predicate is true.
+ * The nodes are split into contiguous chunks which are checked by
+ * up to num_jobs threads. The per-chunk results are concatenated
+ * in chunk order, so that the returned nodes are always sorted by id,
+ * whatever the number of jobs is.
+ * The predicate must be read-only on the RRGraph and must not log anything.
+ **********************************************************************/
+template<typename Predicate>
+static std::vector<RRNodeId> find_rr_graph_nodes(const RRGraph& rr_graph,
+                                                 const size_t& num_jobs,
+                                                 Predicate&& predicate) {
+    size_t num_nodes = rr_graph.nodes().size();
+    std::vector<std::vector<RRNodeId>> chunk_nodes(vtr::num_parallel_chunks(num_nodes, num_jobs));
+
+    vtr::parallel_for_chunks(num_nodes, num_jobs, [&](size_t ichunk, size_t begin, size_t end) {
+        for (size_t inode = begin; inode < end; ++inode) {
+            RRNodeId node(inode);
+            if (false == rr_graph.valid_node_id(node)) {
+                continue;
+            }
+            if (true == predicate(node)) {
+                chunk_nodes[ichunk].push_back(node);
+            }
+        }
+    });
+
+    std::vector<RRNodeId> found_nodes;
+    for (const std::vector<RRNodeId>& nodes : chunk_nodes) {
+        found_nodes.insert(found_nodes.end(), nodes.begin(), nodes.end());
+    }
+    return found_nodes;
+}
+
+/*********************************************************************** 
+ * This function aims at finding any duplicated edges (with same EdgeId) 
  * of a given node. 
  * We will walkthrough the input edges of a node and see if there is any duplication
+ * Return the edges which appear more than once
  **********************************************************************/
-static bool check_rr_graph_node_duplicated_edges(const RRGraph& rr_graph,
-                                                 const RRNodeId& node) {
-    bool no_duplication = true;
-
+static std::map<RREdgeId, size_t> find_rr_graph_node_duplicated_edges(const RRGraph& rr_graph,
+                                                                      const RRNodeId& node) {
     /* Create a map for each input edge */
     std::map<RREdgeId, size_t> edge_counter;
 
@@ -24,119 +59,126 @@ static bool check_rr_graph_node_duplicated_edges(const RRGraph& rr_graph,
         }
     }
 
+    std::map<RREdgeId, size_t> duplicated_edges;
     for (auto& elem : edge_counter) {
         if (elem.second > 1) {
-            /* Reach here it means we find some duplicated edges and report errors */
-            /* Print a warning! */
-            VTR_LOG_WARN("Node %d has duplicated input edges (id = %d)!\n",
-                         size_t(node), size_t(elem.first));
-            rr_graph.print_node(node);
-            no_duplication = false;
+            duplicated_edges.insert(elem);
         }
     }
 
-    return no_duplication;
+    return duplicated_edges;
 }
 
 /*********************************************************************** 
  * Check the whole Routing Resource Graph  
  * identify and report any duplicated edges between two nodes 
  **********************************************************************/
-static bool check_rr_graph_duplicated_edges(const RRGraph& rr_graph) {
-    bool no_duplication = true;
+static bool check_rr_graph_duplicated_edges(const RRGraph& rr_graph,
+                                            const size_t& num_jobs) {
     /* For each node:
      * Search input edges, see there are two edges with same id or address 
      */
-    for (const auto& node : rr_graph.nodes()) {
-        if (false == check_rr_graph_node_duplicated_edges(rr_graph, node)) {
-            no_duplication = false;
+    std::vector<RRNodeId> invalid_nodes = find_rr_graph_nodes(rr_graph, num_jobs, [&](const RRNodeId& node) {
+        return false == find_rr_graph_node_duplicated_edges(rr_graph, node).empty();
+    });
+
+    for (const RRNodeId& node : invalid_nodes) {
+        for (auto& elem : find_rr_graph_node_duplicated_edges(rr_graph, node)) {
+            /* Reach here it means we find some duplicated edges and report errors */
+            /* Print a warning! */
+            VTR_LOG_WARN("Node %d has duplicated input edges (id = %d)!\n",
+                         size_t(node), size_t(elem.first));
+            rr_graph.print_node(node);
         }
     }
 
-    return no_duplication;
+    return invalid_nodes.empty();
 }
 
 /*********************************************************************** 
  * Identify and report any dangling node (nodes without any fan-in or fan-out)
  * in the RRGraph
  **********************************************************************/
-static bool check_rr_graph_dangling_nodes(const RRGraph& rr_graph) {
-    bool no_dangling = true;
+static bool check_rr_graph_dangling_nodes(const RRGraph& rr_graph,
+                                          const size_t& num_jobs) {
     /* For each node: 
      * check if the number of input edges and output edges are both 0
      * If so, this is a dangling nodes and report 
      */
-    for (auto node : rr_graph.nodes()) {
-        if ((0 == rr_graph.node_fan_in(node))
-            && (0 == rr_graph.node_fan_out(node))) {
-            /* Print a warning! */
-            VTR_LOG_WARN("Node %d is dangling (zero fan-in and zero fan-out)!\n",
-                         node);
-            VTR_LOG_WARN("Node details for debugging:\n");
-            rr_graph.print_node(node);
-            no_dangling = false;
-        }
+    std::vector<RRNodeId> invalid_nodes = find_rr_graph_nodes(rr_graph, num_jobs, [&](const RRNodeId& node) {
+        return (0 == rr_graph.node_fan_in(node))
+               && (0 == rr_graph.node_fan_out(node));
+    });
+
+    for (const RRNodeId& node : invalid_nodes) {
+        /* Print a warning! */
+        VTR_LOG_WARN("Node %d is dangling (zero fan-in and zero fan-out)!\n",
+                     size_t(node));
+        VTR_LOG_WARN("Node details for debugging:\n");
+        rr_graph.print_node(node);
     }
 
-    return no_dangling;
+    return invalid_nodes.empty();
 }
 
 /*********************************************************************** 
  * check if all the source nodes are in the right condition:
  * 1. zero fan-in and non-zero fanout
  **********************************************************************/
-static bool check_rr_graph_source_nodes(const RRGraph& rr_graph) {
-    bool invalid_sources = false;
+static bool check_rr_graph_source_nodes(const RRGraph& rr_graph,
+                                        const size_t& num_jobs) {
     /* For each node: 
      * check if the number of input edges and output edges are both 0
      * If so, this is a dangling nodes and report 
      */
-    for (auto node : rr_graph.nodes()) {
+    std::vector<RRNodeId> invalid_nodes = find_rr_graph_nodes(rr_graph, num_jobs, [&](const RRNodeId& node) {
         /* Pass nodes whose types are not SOURCE */
         if (SOURCE != rr_graph.node_type(node)) {
-            continue;
-        }
-        if ((0 != rr_graph.node_fan_in(node))
-            || (0 == rr_graph.node_fan_out(node))) {
-            /* Print a warning! */
-            VTR_LOG_WARN("Source node %d is invalid (should have zero fan-in and non-zero fan-out)!\n",
-                         size_t(node));
-            VTR_LOG_WARN("Node details for debugging:\n");
-            rr_graph.print_node(node);
-            invalid_sources = true;
+            return false;
         }
+        return (0 != rr_graph.node_fan_in(node))
+               || (0 == rr_graph.node_fan_out(node));
+    });
+
+    for (const RRNodeId& node : invalid_nodes) {
+        /* Print a warning! */
+        VTR_LOG_WARN("Source node %d is invalid (should have zero fan-in and non-zero fan-out)!\n",
+                     size_t(node));
+        VTR_LOG_WARN("Node details for debugging:\n");
+        rr_graph.print_node(node);
     }
 
-    return !invalid_sources;
+    return invalid_nodes.empty();
 }
 
 /*********************************************************************** 
  * check if all the sink nodes are in the right condition:
  * 1. non-zero fan-in and zero fanout
  **********************************************************************/
-static bool check_rr_graph_sink_nodes(const RRGraph& rr_graph) {
-    bool invalid_sinks = false;
+static bool check_rr_graph_sink_nodes(const RRGraph& rr_graph,
+                                      const size_t& num_jobs) {
     /* For each node: 
      * check if the number of input edges and output edges are both 0
      * If so, this is a dangling nodes and report 
      */
-    for (auto node : rr_graph.nodes()) {
+    std::vector<RRNodeId> invalid_nodes = find_rr_graph_nodes(rr_graph, num_jobs, [&](const RRNodeId& node) {
         /* Pass nodes whose types are not SINK */
         if (SINK != rr_graph.node_type(node)) {
-            continue;
-        }
-        if ((0 == rr_graph.node_fan_in(node))
-            || (0 != rr_graph.node_fan_out(node))) {
-            /* Print a warning! */
-            VTR_LOG_WARN("Sink node %s is invalid (should have non-zero fan-in and zero fan-out)!\n",
-                         node);
-            VTR_LOG_WARN("Node details for debugging:\n");
-            rr_graph.print_node(node);
-            invalid_sinks = true;
+            return false;
         }
+        return (0 == rr_graph.node_fan_in(node))
+               || (0 != rr_graph.node_fan_out(node));
+    });
+
+    for (const RRNodeId& node : invalid_nodes) {
+        /* Print a warning! */
+        VTR_LOG_WARN("Sink node %d is invalid (should have non-zero fan-in and zero fan-out)!\n",
+                     size_t(node));
+        VTR_LOG_WARN("Node details for debugging:\n");
+        rr_graph.print_node(node);
     }
 
-    return !invalid_sinks;
+    return invalid_nodes.empty();
 }
 
 /*********************************************************************** 
@@ -151,36 +193,41 @@ static bool check_rr_graph_sink_nodes(const RRGraph& rr_graph) {
  * On the other hand, it is suggested that developers to create their 
  * own checking function for the rr_graph, to guarantee their routers
  * will work properly.
+ *
+ * The per-node checks can be run by up to num_jobs threads (0 means
+ * as many as the host supports). Problems are always reported in 
+ * the order of node ids, whatever the number of jobs is.
  **********************************************************************/
-bool check_rr_graph(const RRGraph& rr_graph) {
+bool check_rr_graph(const RRGraph& rr_graph,
+                    const size_t& num_jobs) {
     size_t num_err = 0;
 
-    if (false == check_rr_graph_duplicated_edges(rr_graph)) {
+    if (false == check_rr_graph_duplicated_edges(rr_graph, num_jobs)) {
         VTR_LOG_WARN("Fail in checking duplicated edges !\n");
         num_err++;
     }
 
-    if (false == check_rr_graph_dangling_nodes(rr_graph)) {
+    if (false == check_rr_graph_dangling_nodes(rr_graph, num_jobs)) {
         VTR_LOG_WARN("Fail in checking dangling nodes !\n");
         num_err++;
     }
 
-    if (false == check_rr_graph_source_nodes(rr_graph)) {
+    if (false == check_rr_graph_source_nodes(rr_graph, num_jobs)) {
         VTR_LOG_WARN("Fail in checking source nodes!\n");
         num_err++;
     }
 
-    if (false == check_rr_graph_sink_nodes(rr_graph)) {
+    if (false == check_rr_graph_sink_nodes(rr_graph, num_jobs)) {
         VTR_LOG_WARN("Fail in checking sink nodes!\n");
         num_err++;
     }
 
-    if (false == check_rr_graph_source_nodes(rr_graph)) {
+    if (false == check_rr_graph_source_nodes(rr_graph, num_jobs)) {
         VTR_LOG_WARN("Fail in checking source nodes!\n");
         num_err++;
     }
 
-    if (false == check_rr_graph_sink_nodes(rr_graph)) {
+    if (false == check_rr_graph_sink_nodes(rr_graph, num_jobs)) {
         VTR_LOG_WARN("Fail in checking sink nodes!\n");
         num_err++;
     }
@@ -6,6 +6,7 @@
  */
 #include "rr_graph_obj.h"
 
-bool check_rr_graph(const RRGraph& rr_graph);
+bool check_rr_graph(const RRGraph& rr_graph,
+                    const size_t& num_jobs);
 
 #endif
@@ -128,7 +128,7 @@ void convert_rr_graph(std::vector<t_segment_inf>& vpr_segments) {
     }
 
     /* Error out if advanced checker of rr_graph fails */
-    if (false == check_rr_graph(device_ctx.rr_graph)) {
+    if (false == check_rr_graph(device_ctx.rr_graph, 1)) {
         vpr_throw(VPR_ERROR_ROUTE,
                   __FILE__,
                   __LINE__,
@@ -543,6 +543,11 @@ class RRGraph {
     std::vector<RREdgeId> find_edges(const RRNodeId& src_node, const RRNodeId& sink_node) const;
     /* Find a node with given features from internal fast look-up */
     RRNodeId find_node(const short& x, const short& y, const t_rr_type& type, const int& ptc, const e_side& side = NUM_SIDES) const;
+    /* Build the internal fast look-up if it is not built yet.
+     * find_node() builds it on its first call, which is not thread-safe:
+     * call this function before calling find_node() from several threads
+     */
+    void initialize_fast_node_lookup() const;
     /* Find the number of routing tracks in a routing channel with a given coordinate */
     short chan_num_tracks(const short& x, const short& y, const t_rr_type& type) const;
 
@@ -805,6 +810,10 @@ class RRGraph {
         const std::unordered_set<ID>& invalid_ids_;
     };
 
+  private: /* Serialization */
+    /* The binary snapshot of the device copies the internal data directly, see device_snapshot.cpp */
+    friend class RRGraphSnapshotIO;
+
   private: /* Internal free functions */
     void clear_nodes();
     void clear_edges();
@@ -825,7 +834,6 @@ class RRGraph {
     void build_fast_node_lookup() const;
     void invalidate_fast_node_lookup() const;
     bool valid_fast_node_lookup() const;
-    void initialize_fast_node_lookup() const;
 
     /* Graph property Validation */
     bool validate_sizes() const;
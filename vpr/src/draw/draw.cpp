@@ -2142,17 +2142,16 @@ static void draw_routed_net(ClusterNetId net_id, ezgl::renderer* g) {
     if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) /* Don't draw. */
         return;
 
-    if (route_ctx.trace[net_id].head == nullptr) /* No routing->  Skip.  (Allows me to draw */
-        return;                                  /* partially complete routes).            */
+    const t_traceback& traceback = route_ctx.trace[net_id];
+    if (traceback.empty()) /* No routing->  Skip.  (Allows me to draw */
+        return;            /* partially complete routes).            */
 
-    t_trace* tptr = route_ctx.trace[net_id].head; /* SOURCE to start */
-    RRNodeId inode = tptr->index;
+    RRNodeId inode = traceback[0].index; /* SOURCE to start */
 
     std::vector<RRNodeId> rr_nodes_to_draw;
     rr_nodes_to_draw.push_back(inode);
-    for (;;) {
-        tptr = tptr->next;
-        inode = tptr->index;
+    for (size_t itrace = 1; itrace < traceback.size(); ++itrace) {
+        inode = traceback[itrace].index;
 
         if (draw_if_net_highlighted(net_id)) {
             /* If a net has been highlighted, highlight the whole net in *
@@ -2166,15 +2165,15 @@ static void draw_routed_net(ClusterNetId net_id, ezgl::renderer* g) {
 
         rr_nodes_to_draw.push_back(inode);
 
-        if (tptr->iswitch == OPEN) { //End of branch
+        if (traceback[itrace].iswitch == OPEN) { //End of branch
             draw_partial_route(rr_nodes_to_draw, g);
             rr_nodes_to_draw.clear();
 
             /* Skip the next segment */
-            tptr = tptr->next;
-            if (tptr == nullptr)
+            ++itrace;
+            if (itrace == traceback.size())
                 break;
-            inode = tptr->index;
+            inode = traceback[itrace].index;
             rr_nodes_to_draw.push_back(inode);
         }
 
@@ -2359,22 +2358,21 @@ static bool draw_if_net_highlighted(ClusterNetId inet) {
  * If so, and toggle nets is selected, highlight the whole net in that colour.
  */
 void highlight_nets(char* message, const RRNodeId& hit_node) {
-    t_trace* tptr;
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.routing();
 
     t_draw_state* draw_state = get_draw_state_vars();
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        for (tptr = route_ctx.trace[net_id].head; tptr != nullptr; tptr = tptr->next) {
-            if (draw_state->draw_rr_node[tptr->index].color == ezgl::MAGENTA) {
-                draw_state->net_color[net_id] = draw_state->draw_rr_node[tptr->index].color;
-                if (tptr->index == hit_node) {
+        for (const t_trace& trace : route_ctx.trace[net_id]) {
+            if (draw_state->draw_rr_node[trace.index].color == ezgl::MAGENTA) {
+                draw_state->net_color[net_id] = draw_state->draw_rr_node[trace.index].color;
+                if (trace.index == hit_node) {
                     std::string orig_msg(message);
                     sprintf(message, "%s  ||  Net: %zu (%s)", orig_msg.c_str(), size_t(net_id),
                             cluster_ctx.clb_nlist.net_name(net_id).c_str());
                 }
-            } else if (draw_state->draw_rr_node[tptr->index].color == ezgl::WHITE) {
+            } else if (draw_state->draw_rr_node[trace.index].color == ezgl::WHITE) {
                 // If node is de-selected.
                 draw_state->net_color[net_id] = ezgl::BLACK;
                 break;
@@ -248,14 +248,13 @@ void highlight_blocks(ClusterBlockId clb_index) {
 }
 
 void highlight_nets(ClusterNetId net_id) {
-    t_trace* tptr;
     auto& route_ctx = g_vpr_ctx.routing();
 
     t_draw_state* draw_state = get_draw_state_vars();
 
     if (int(route_ctx.trace.size()) == 0) return;
 
-    for (tptr = route_ctx.trace[net_id].head; tptr != nullptr; tptr = tptr->next) {
+    if (!route_ctx.trace[net_id].empty()) {
         draw_state->net_color[net_id] = ezgl::MAGENTA;
     }
 }
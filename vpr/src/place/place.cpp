@@ -1,13 +1,17 @@
 #include <cstdio>
+#include <cstring>
 #include <cmath>
 #include <memory>
 #include <fstream>
+#include <algorithm>
+#include <unordered_set>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_util.h"
 #include "vtr_random.h"
 #include "vtr_geometry.h"
+#include "vtr_parallel.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -96,6 +100,46 @@ struct t_placer_prev_inverse_costs {
     double timing_cost;
 };
 
+/* A move of a batch of moves (see try_swap_batch()).                     *
+ * Each move has its own list of affected nets and cost changes, so that  *
+ * the moves of a batch can be evaluated concurrently.                    *
+ * costs: the placement costs once the move has been accepted/rejected.   */
+struct t_batch_move {
+    t_batch_move(size_t max_blocks)
+        : blocks_affected(max_blocks) {}
+
+    t_pl_blocks_to_be_moved blocks_affected;
+    e_create_move create_move_outcome = e_create_move::ABORT;
+
+    std::vector<ClusterNetId> nets_to_update;
+    int num_nets_affected = 0;
+    double bb_delta_c = 0.;
+    double timing_delta_c = 0.;
+
+    e_move_result outcome = ABORTED;
+    t_placer_costs costs;
+};
+
+/* The moves of the batched annealer, and the bookkeeping used to find    *
+ * which of them can be evaluated concurrently.                           *
+ * net_stamps: nets affected by a move of the batch are marked with the   *
+ *             batch stamp.                                               *
+ * claimed_locs: locations moved from/to by a move of the batch.          */
+struct t_move_batch {
+    t_move_batch(size_t max_moves, size_t max_blocks, size_t num_nets, size_t num_jobs)
+        : moves(max_moves, t_batch_move(max_blocks))
+        , net_stamps(num_nets, 0)
+        , workers(num_jobs) {}
+
+    std::vector<t_batch_move> moves;
+
+    vtr::vector<ClusterNetId, size_t> net_stamps;
+    size_t stamp = 0;
+    std::unordered_set<t_pl_loc> claimed_locs;
+
+    vtr::ParallelWorkers workers;
+};
+
 constexpr float INVALID_DELAY = std::numeric_limits<float>::quiet_NaN();
 
 constexpr double MAX_INV_TIMING_COST = 1.e9;
@@ -280,8 +324,8 @@ static void free_fast_cost_update();
 
 static double comp_bb_cost(e_cost_methods method);
 
-static void update_move_nets(int num_nets_affected);
-static void reset_move_nets(int num_nets_affected);
+static void update_move_nets(int num_nets_affected, const std::vector<ClusterNetId>& nets_to_update);
+static void reset_move_nets(int num_nets_affected, const std::vector<ClusterNetId>& nets_to_update);
 
 static e_move_result try_swap(float t,
                               t_placer_costs* costs,
@@ -294,6 +338,32 @@ static e_move_result try_swap(float t,
                               enum e_place_algorithm place_algorithm,
                               float timing_tradeoff);
 
+static int try_swap_batch(float t,
+                          t_placer_costs* costs,
+                          t_placer_prev_inverse_costs* prev_inverse_costs,
+                          float rlim,
+                          MoveGenerator& move_generator,
+                          t_move_batch& move_batch,
+                          int max_moves,
+                          const PlaceDelayModel* delay_model,
+                          float rlim_escape_fraction,
+                          enum e_place_algorithm place_algorithm,
+                          float timing_tradeoff);
+
+static bool claim_batch_move(t_move_batch& move_batch, t_batch_move& move);
+
+static e_move_result accept_or_reject_move(float t,
+                                           t_placer_costs* costs,
+                                           const t_placer_prev_inverse_costs* prev_inverse_costs,
+                                           t_pl_blocks_to_be_moved& blocks_affected,
+                                           const std::vector<ClusterNetId>& nets_to_update,
+                                           int num_nets_affected,
+                                           double bb_delta_c,
+                                           double timing_delta_c,
+                                           enum e_place_algorithm place_algorithm,
+                                           float timing_tradeoff,
+                                           MoveOutcomeStats& move_outcome_stats);
+
 static void check_place(const t_placer_costs& costs,
                         const PlaceDelayModel* delay_model,
                         enum e_place_algorithm place_algorithm);
@@ -347,9 +417,10 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
                                                const t_pl_blocks_to_be_moved& blocks_affected,
                                                const PlaceDelayModel* delay_model,
                                                double& bb_delta_c,
-                                               double& timing_delta_c);
+                                               double& timing_delta_c,
+                                               std::vector<ClusterNetId>& nets_to_update);
 
-static void record_affected_net(const ClusterNetId net, int& num_affected_nets);
+static void record_affected_net(const ClusterNetId net, int& num_affected_nets, std::vector<ClusterNetId>& nets_to_update);
 
 static void update_net_bb(const ClusterNetId net,
                           const t_pl_blocks_to_be_moved& blocks_affected,
@@ -390,6 +461,7 @@ static void placement_inner_loop(float t,
                                  const PlaceDelayModel* delay_model,
                                  MoveGenerator& move_generator,
                                  t_pl_blocks_to_be_moved& blocks_affected,
+                                 t_move_batch* move_batch,
                                  SetupTimingInfo& timing_info);
 
 static void recompute_costs_from_scratch(const t_placer_opts& placer_opts, const PlaceDelayModel* delay_model, t_placer_costs* costs);
@@ -485,6 +557,17 @@ void try_place(const t_placer_opts& placer_opts,
     alloc_and_load_placement_structs(placer_opts.place_cost_exp, placer_opts,
                                      directs, num_directs);
 
+    /* Moves are only batched if requested, a batch of 1 is a plain try_swap() */
+    std::unique_ptr<t_move_batch> move_batch;
+    if (placer_opts.move_batch_size > 1) {
+        move_batch = std::make_unique<t_move_batch>(placer_opts.move_batch_size,
+                                                    cluster_ctx.clb_nlist.blocks().size(),
+                                                    cluster_ctx.clb_nlist.nets().size(),
+                                                    placer_opts.place_jobs);
+        VTR_LOG("Placer evaluates moves in batches of up to %zu, with %zu thread(s)\n",
+                placer_opts.move_batch_size, move_batch->workers.num_jobs());
+    }
+
     initial_placement(placer_opts.pad_loc_type, placer_opts.pad_loc_file.c_str());
 
     // Update physical pin values
@@ -518,7 +601,7 @@ void try_place(const t_placer_opts& placer_opts,
         placement_delay_calc = std::make_shared<PlacementDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, point_to_point_delay);
         placement_delay_calc->set_tsu_margin_relative(placer_opts.tsu_rel_margin);
         placement_delay_calc->set_tsu_margin_absolute(placer_opts.tsu_abs_margin);
-        timing_info = make_setup_timing_info(placement_delay_calc);
+        timing_info = make_setup_timing_info(placement_delay_calc, placer_opts.timing_update_jobs);
 
         timing_info->update();
         timing_info->set_warn_unconstrained(false); //Don't warn again about unconstrained nodes again during placement
@@ -650,6 +733,7 @@ void try_place(const t_placer_opts& placer_opts,
                              place_delay_model.get(),
                              *move_generator,
                              blocks_affected,
+                             move_batch.get(),
                              *timing_info);
 
         tot_iter += move_lim;
@@ -712,6 +796,7 @@ void try_place(const t_placer_opts& placer_opts,
                          place_delay_model.get(),
                          *move_generator,
                          blocks_affected,
+                         move_batch.get(),
                          *timing_info);
 
     tot_iter += move_lim;
@@ -878,6 +963,7 @@ static void placement_inner_loop(float t,
                                  const PlaceDelayModel* delay_model,
                                  MoveGenerator& move_generator,
                                  t_pl_blocks_to_be_moved& blocks_affected,
+                                 t_move_batch* move_batch,
                                  SetupTimingInfo& timing_info) {
     int inner_crit_iter_count, inner_iter;
 
@@ -890,68 +976,88 @@ static void placement_inner_loop(float t,
     inner_crit_iter_count = 1;
 
     /* Inner loop begins */
-    for (inner_iter = 0; inner_iter < move_lim; inner_iter++) {
-        e_move_result swap_result = try_swap(t, costs, prev_inverse_costs, rlim,
-                                             move_generator,
-                                             blocks_affected,
-                                             delay_model,
-                                             placer_opts.rlim_escape_fraction,
-                                             placer_opts.place_algorithm,
-                                             placer_opts.timing_tradeoff);
-
-        if (swap_result == ACCEPTED) {
-            /* Move was accepted.  Update statistics that are useful for the annealing schedule. */
-            stats->success_sum++;
-            stats->av_cost += costs->cost;
-            stats->av_bb_cost += costs->bb_cost;
-            stats->av_timing_cost += costs->timing_cost;
-            stats->sum_of_squares += (costs->cost) * (costs->cost);
-            num_swap_accepted++;
-        } else if (swap_result == ABORTED) {
-            num_swap_aborted++;
-        } else { // swap_result == REJECTED
-            num_swap_rejected++;
+    inner_iter = 0;
+    while (inner_iter < move_lim) {
+        /* Try either a single move, or a batch of moves evaluated together */
+        int num_moves = 1;
+        e_move_result single_swap_result = ABORTED;
+        if (move_batch) {
+            num_moves = try_swap_batch(t, costs, prev_inverse_costs, rlim,
+                                       move_generator,
+                                       *move_batch,
+                                       std::min<int>(move_batch->moves.size(), move_lim - inner_iter),
+                                       delay_model,
+                                       placer_opts.rlim_escape_fraction,
+                                       placer_opts.place_algorithm,
+                                       placer_opts.timing_tradeoff);
+        } else {
+            single_swap_result = try_swap(t, costs, prev_inverse_costs, rlim,
+                                          move_generator,
+                                          blocks_affected,
+                                          delay_model,
+                                          placer_opts.rlim_escape_fraction,
+                                          placer_opts.place_algorithm,
+                                          placer_opts.timing_tradeoff);
         }
 
-        if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
-            /* Do we want to re-timing analyze the circuit to get updated slack and criticality values?
-             * We do this only once in a while, since it is expensive.
-             */
-            if (inner_crit_iter_count >= inner_recompute_limit
-                && inner_iter != move_lim - 1) { /*on last iteration don't recompute */
+        for (int imove = 0; imove < num_moves; ++imove, ++inner_iter) {
+            e_move_result swap_result = move_batch ? move_batch->moves[imove].outcome : single_swap_result;
+            const t_placer_costs& move_costs = move_batch ? move_batch->moves[imove].costs : *costs;
+
+            if (swap_result == ACCEPTED) {
+                /* Move was accepted.  Update statistics that are useful for the annealing schedule. */
+                stats->success_sum++;
+                stats->av_cost += move_costs.cost;
+                stats->av_bb_cost += move_costs.bb_cost;
+                stats->av_timing_cost += move_costs.timing_cost;
+                stats->sum_of_squares += (move_costs.cost) * (move_costs.cost);
+                num_swap_accepted++;
+            } else if (swap_result == ABORTED) {
+                num_swap_aborted++;
+            } else { // swap_result == REJECTED
+                num_swap_rejected++;
+            }
 
-                inner_crit_iter_count = 0;
-#ifdef VERBOSE
-                VTR_LOG("Inner loop recompute criticalities\n");
-#endif
-                /* Using the delays in net_delay, do a timing analysis to update slacks and
-                 * criticalities; then update the timing cost since it will change.
+            if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
+                /* Do we want to re-timing analyze the circuit to get updated slack and criticality values?
+                 * We do this only once in a while, since it is expensive.
                  */
-                //Inner loop timing update
-                timing_info.update();
-                load_criticalities(timing_info, crit_exponent, netlist_pin_lookup);
+                if (inner_crit_iter_count >= inner_recompute_limit
+                    && inner_iter != move_lim - 1) { /*on last iteration don't recompute */
 
-                comp_td_costs(delay_model, &costs->timing_cost);
+                    inner_crit_iter_count = 0;
+#ifdef VERBOSE
+                    VTR_LOG("Inner loop recompute criticalities\n");
+#endif
+                    /* Using the delays in net_delay, do a timing analysis to update slacks and
+                     * criticalities; then update the timing cost since it will change.
+                     */
+                    //Inner loop timing update
+                    timing_info.update();
+                    load_criticalities(timing_info, crit_exponent, netlist_pin_lookup);
+
+                    comp_td_costs(delay_model, &costs->timing_cost);
+                }
+                inner_crit_iter_count++;
             }
-            inner_crit_iter_count++;
-        }
 #ifdef VERBOSE
-        VTR_LOG("t = %g  cost = %g   bb_cost = %g timing_cost = %g move = %d\n",
-                t, costs->cost, costs->bb_cost, costs->timing_cost, inner_iter);
-        if (fabs((costs->bb_cost) - comp_bb_cost(CHECK)) > (costs->bb_cost) * ERROR_TOL)
-            VPR_ERROR(VPR_ERROR_PLACE,
-                      "fabs((*bb_cost) - comp_bb_cost(CHECK)) > (*bb_cost) * ERROR_TOL");
+            VTR_LOG("t = %g  cost = %g   bb_cost = %g timing_cost = %g move = %d\n",
+                    t, costs->cost, costs->bb_cost, costs->timing_cost, inner_iter);
+            if (fabs((costs->bb_cost) - comp_bb_cost(CHECK)) > (costs->bb_cost) * ERROR_TOL)
+                VPR_ERROR(VPR_ERROR_PLACE,
+                          "fabs((*bb_cost) - comp_bb_cost(CHECK)) > (*bb_cost) * ERROR_TOL");
 #endif
 
-        /* Lines below prevent too much round-off error from accumulating
-         * in the cost over many iterations (due to incremental updates).
-         * This round-off can lead to  error checks failing because the cost
-         * is different from what you get when you recompute from scratch.
-         */
-        ++(*moves_since_cost_recompute);
-        if (*moves_since_cost_recompute > MAX_MOVES_BEFORE_RECOMPUTE) {
-            recompute_costs_from_scratch(placer_opts, delay_model, costs);
-            *moves_since_cost_recompute = 0;
+            /* Lines below prevent too much round-off error from accumulating
+             * in the cost over many iterations (due to incremental updates).
+             * This round-off can lead to  error checks failing because the cost
+             * is different from what you get when you recompute from scratch.
+             */
+            ++(*moves_since_cost_recompute);
+            if (*moves_since_cost_recompute > MAX_MOVES_BEFORE_RECOMPUTE) {
+                recompute_costs_from_scratch(placer_opts, delay_model, costs);
+                *moves_since_cost_recompute = 0;
+            }
         }
     }
     /* Inner loop ends */
@@ -1143,11 +1249,11 @@ static float starting_t(t_placer_costs* costs,
     return (20. * std_dev);
 }
 
-static void update_move_nets(int num_nets_affected) {
+static void update_move_nets(int num_nets_affected, const std::vector<ClusterNetId>& nets_to_update) {
     /* update net cost functions and reset flags. */
     auto& cluster_ctx = g_vpr_ctx.clustering();
     for (int inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
 
         bb_coords[net_id] = ts_bb_coord_new[net_id];
         if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET)
@@ -1161,10 +1267,10 @@ static void update_move_nets(int num_nets_affected) {
     }
 }
 
-static void reset_move_nets(int num_nets_affected) {
+static void reset_move_nets(int num_nets_affected, const std::vector<ClusterNetId>& nets_to_update) {
     /* Reset the net cost function flags first. */
     for (int inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
         temp_net_cost[net_id] = -1;
         bb_updated_before[net_id] = NOT_UPDATED_YET;
     }
@@ -1193,7 +1299,6 @@ static e_move_result try_swap(float t,
     /* I'm using negative values of temp_net_cost as a flag, so DO NOT   *
      * use cost functions that can go negative.                          */
 
-    double delta_c = 0; /* Change in cost due to this swap. */
     double bb_delta_c = 0;
     double timing_delta_c = 0;
 
@@ -1240,71 +1345,272 @@ static e_move_result try_swap(float t,
         apply_move_blocks(blocks_affected);
 
         // Find all the nets affected by this swap and update their costs
-        int num_nets_affected = find_affected_nets_and_update_costs(place_algorithm, blocks_affected, delay_model, bb_delta_c, timing_delta_c);
+        int num_nets_affected = find_affected_nets_and_update_costs(place_algorithm, blocks_affected, delay_model, bb_delta_c, timing_delta_c, ts_nets_to_update);
+
+        move_outcome = accept_or_reject_move(t, costs, prev_inverse_costs,
+                                             blocks_affected,
+                                             ts_nets_to_update, num_nets_affected,
+                                             bb_delta_c, timing_delta_c,
+                                             place_algorithm, timing_tradeoff,
+                                             move_outcome_stats);
+
+        LOG_MOVE_STATS_OUTCOME(move_outcome_stats.delta_cost_norm, bb_delta_c, timing_delta_c,
+                               (move_outcome ? "ACCEPTED" : "REJECTED"), "");
+    }
+
+    move_outcome_stats.outcome = move_outcome;
+
+    move_generator.process_outcome(move_outcome_stats);
+
+    clear_move_blocks(blocks_affected);
+
+    //VTR_ASSERT(check_macro_placement_consistency() == 0);
+#if 0
+    //Check that each accepted swap yields a valid placement
+    check_place(*costs, delay_model, place_algorithm);
+#endif
+
+    return (move_outcome);
+}
+
+//Accepts or rejects a move whose cost change has been evaluated, and
+//either commits it (updating the costs) or reverts it.
+//
+//Fills in move_outcome_stats with the cost changes of the move.
+static e_move_result accept_or_reject_move(float t,
+                                           t_placer_costs* costs,
+                                           const t_placer_prev_inverse_costs* prev_inverse_costs,
+                                           t_pl_blocks_to_be_moved& blocks_affected,
+                                           const std::vector<ClusterNetId>& nets_to_update,
+                                           int num_nets_affected,
+                                           double bb_delta_c,
+                                           double timing_delta_c,
+                                           enum e_place_algorithm place_algorithm,
+                                           float timing_tradeoff,
+                                           MoveOutcomeStats& move_outcome_stats) {
+    double delta_c = 0; /* Change in cost due to this swap. */
+
+    if (place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
+        /*in this case we redefine delta_c as a combination of timing and bb.  *
+         *additionally, we normalize all values, therefore delta_c is in       *
+         *relation to 1*/
+
+        delta_c = (1 - timing_tradeoff) * bb_delta_c * prev_inverse_costs->bb_cost
+                  + timing_tradeoff * timing_delta_c * prev_inverse_costs->timing_cost;
+    } else {
+        delta_c = bb_delta_c;
+    }
+
+    /* 1 -> move accepted, 0 -> rejected. */
+    e_move_result move_outcome = assess_swap(delta_c, t);
+
+    if (move_outcome == ACCEPTED) {
+        costs->cost += delta_c;
+        costs->bb_cost += bb_delta_c;
+
         if (place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
-            /*in this case we redefine delta_c as a combination of timing and bb.  *
-             *additionally, we normalize all values, therefore delta_c is in       *
-             *relation to 1*/
+            /*update the point_to_point_timing_cost and point_to_point_delay
+             * values from the temporary values */
+            costs->timing_cost += timing_delta_c;
 
-            delta_c = (1 - timing_tradeoff) * bb_delta_c * prev_inverse_costs->bb_cost
-                      + timing_tradeoff * timing_delta_c * prev_inverse_costs->timing_cost;
-        } else {
-            delta_c = bb_delta_c;
+            update_td_cost(blocks_affected);
         }
 
-        /* 1 -> move accepted, 0 -> rejected. */
-        move_outcome = assess_swap(delta_c, t);
+        /* update net cost functions and reset flags. */
+        update_move_nets(num_nets_affected, nets_to_update);
 
-        if (move_outcome == ACCEPTED) {
-            costs->cost += delta_c;
-            costs->bb_cost += bb_delta_c;
+        /* Update clb data structures since we kept the move. */
+        commit_move_blocks(blocks_affected);
 
-            if (place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
-                /*update the point_to_point_timing_cost and point_to_point_delay
-                 * values from the temporary values */
-                costs->timing_cost += timing_delta_c;
+    } else { /* Move was rejected.  */
+             /* Reset the net cost function flags first. */
+        reset_move_nets(num_nets_affected, nets_to_update);
+
+        /* Restore the place_ctx.block_locs data structures to their state before the move. */
+        revert_move_blocks(blocks_affected);
+    }
+
+    move_outcome_stats.delta_cost_norm = delta_c;
+    move_outcome_stats.delta_bb_cost_norm = bb_delta_c * prev_inverse_costs->bb_cost;
+    move_outcome_stats.delta_timing_cost_norm = timing_delta_c * prev_inverse_costs->timing_cost;
+
+    move_outcome_stats.delta_bb_cost_abs = bb_delta_c;
+    move_outcome_stats.delta_timing_cost_abs = timing_delta_c;
+
+    return move_outcome;
+}
 
-                update_td_cost(blocks_affected);
+/* Batched version of try_swap(): proposes up to max_moves moves at once, *
+ * evaluates them concurrently and then accepts or rejects them one by    *
+ * one, in the order they were proposed.                                  *
+ *                                                                        *
+ * Moves are only evaluated together if they affect disjoint nets and     *
+ * locations, so the cost change of each of them does not depend on the   *
+ * others: the evaluation only writes per-net scratch data of the move's  *
+ * own nets. The batch ends at the first move conflicting with an earlier *
+ * one; that move is dropped without being counted (a new one is proposed *
+ * with the next batch).                                                  *
+ *                                                                        *
+ * All the random decisions (move proposals and acceptance) are made on   *
+ * the calling thread in a fixed order, so the placement does not depend  *
+ * on the number of threads.                                              *
+ *                                                                        *
+ * Returns the number of moves attempted; their outcomes (and the costs   *
+ * after each of them) are in move_batch.moves[0..num_moves-1].           */
+static int try_swap_batch(float t,
+                          t_placer_costs* costs,
+                          t_placer_prev_inverse_costs* prev_inverse_costs,
+                          float rlim,
+                          MoveGenerator& move_generator,
+                          t_move_batch& move_batch,
+                          int max_moves,
+                          const PlaceDelayModel* delay_model,
+                          float rlim_escape_fraction,
+                          enum e_place_algorithm place_algorithm,
+                          float timing_tradeoff) {
+    VTR_ASSERT(max_moves > 0 && size_t(max_moves) <= move_batch.moves.size());
+
+    ++move_batch.stamp;
+    move_batch.claimed_locs.clear();
+
+    //Propose the moves (without applying them, so that all the proposals
+    //see the same, consistent placement)
+    int num_moves = 0;
+    while (num_moves < max_moves) {
+        t_batch_move& move = move_batch.moves[num_moves];
+
+        float move_rlim = rlim;
+        if (rlim_escape_fraction > 0. && vtr::frand() < rlim_escape_fraction) {
+            move_rlim = std::numeric_limits<float>::infinity();
+        }
+
+        move.create_move_outcome = move_generator.propose_move(move.blocks_affected, move_rlim);
+
+        if (move.create_move_outcome == e_create_move::VALID
+            && !claim_batch_move(move_batch, move)) {
+            //Conflicts with an earlier move of the batch
+            clear_move_blocks(move.blocks_affected);
+            break;
+        }
+        ++num_moves;
+    }
+
+    for (int imove = 0; imove < num_moves; ++imove) {
+        t_batch_move& move = move_batch.moves[imove];
+        if (move.create_move_outcome == e_create_move::VALID) {
+            apply_move_blocks(move.blocks_affected);
+        }
+    }
+
+    //Evaluate the cost changes concurrently
+    move_batch.workers.for_chunks(num_moves, [&](size_t /*ichunk*/, size_t begin, size_t end) {
+        for (size_t imove = begin; imove < end; ++imove) {
+            t_batch_move& move = move_batch.moves[imove];
+            if (move.create_move_outcome != e_create_move::VALID) {
+                continue;
             }
 
-            /* update net cost functions and reset flags. */
-            update_move_nets(num_nets_affected);
+            move.bb_delta_c = 0.;
+            move.timing_delta_c = 0.;
+            move.num_nets_affected = find_affected_nets_and_update_costs(place_algorithm, move.blocks_affected, delay_model,
+                                                                         move.bb_delta_c, move.timing_delta_c,
+                                                                         move.nets_to_update);
+        }
+    });
+
+    //Accept or reject the moves in the order they were proposed
+    for (int imove = 0; imove < num_moves; ++imove) {
+        t_batch_move& move = move_batch.moves[imove];
 
-            /* Update clb data structures since we kept the move. */
-            commit_move_blocks(blocks_affected);
+        num_ts_called++;
 
-        } else { /* Move was rejected.  */
-                 /* Reset the net cost function flags first. */
-            reset_move_nets(num_nets_affected);
+        MoveOutcomeStats move_outcome_stats;
 
-            /* Restore the place_ctx.block_locs data structures to their state before the move. */
-            revert_move_blocks(blocks_affected);
+        LOG_MOVE_STATS_PROPOSED(t, move.blocks_affected);
+
+        if (move.create_move_outcome == e_create_move::ABORT) {
+            LOG_MOVE_STATS_OUTCOME(std::numeric_limits<float>::quiet_NaN(),
+                                   std::numeric_limits<float>::quiet_NaN(),
+                                   std::numeric_limits<float>::quiet_NaN(),
+                                   "ABORTED", "illegal move");
+
+            move.outcome = ABORTED;
+        } else {
+            move.outcome = accept_or_reject_move(t, costs, prev_inverse_costs,
+                                                 move.blocks_affected,
+                                                 move.nets_to_update, move.num_nets_affected,
+                                                 move.bb_delta_c, move.timing_delta_c,
+                                                 place_algorithm, timing_tradeoff,
+                                                 move_outcome_stats);
+
+            LOG_MOVE_STATS_OUTCOME(move_outcome_stats.delta_cost_norm, move.bb_delta_c, move.timing_delta_c,
+                                   (move.outcome ? "ACCEPTED" : "REJECTED"), "");
         }
 
-        move_outcome_stats.delta_cost_norm = delta_c;
-        move_outcome_stats.delta_bb_cost_norm = bb_delta_c * prev_inverse_costs->bb_cost;
-        move_outcome_stats.delta_timing_cost_norm = timing_delta_c * prev_inverse_costs->timing_cost;
+        move_outcome_stats.outcome = move.outcome;
 
-        move_outcome_stats.delta_bb_cost_abs = bb_delta_c;
-        move_outcome_stats.delta_timing_cost_abs = timing_delta_c;
+        move_generator.process_outcome(move_outcome_stats);
 
-        LOG_MOVE_STATS_OUTCOME(delta_c, bb_delta_c, timing_delta_c,
-                               (move_outcome ? "ACCEPTED" : "REJECTED"), "");
+        clear_move_blocks(move.blocks_affected);
+
+        move.costs = *costs;
     }
 
-    move_outcome_stats.outcome = move_outcome;
+    return num_moves;
+}
 
-    move_generator.process_outcome(move_outcome_stats);
+//Checks whether a proposed move touches a net or a location already used by
+//an earlier move of the batch. If not, marks the move's nets and locations as
+//used and returns true.
+static bool claim_batch_move(t_move_batch& move_batch, t_batch_move& move) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    clear_move_blocks(blocks_affected);
+    const t_pl_blocks_to_be_moved& blocks_affected = move.blocks_affected;
 
-    //VTR_ASSERT(check_macro_placement_consistency() == 0);
-#if 0
-    //Check that each accepted swap yields a valid placement
-    check_place(*costs, delay_model, place_algorithm);
-#endif
+    size_t num_pins = 0;
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; iblk++) {
+        const t_pl_moved_block& moved_block = blocks_affected.moved_blocks[iblk];
+        if (move_batch.claimed_locs.count(moved_block.old_loc)
+            || move_batch.claimed_locs.count(moved_block.new_loc)) {
+            return false;
+        }
 
-    return (move_outcome);
+        for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(moved_block.block_num)) {
+            ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(blk_pin);
+            if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+                continue;
+            }
+            if (move_batch.net_stamps[net_id] == move_batch.stamp) {
+                return false;
+            }
+            ++num_pins;
+        }
+    }
+
+    //No conflict, claim the move's nets and locations
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; iblk++) {
+        const t_pl_moved_block& moved_block = blocks_affected.moved_blocks[iblk];
+        move_batch.claimed_locs.insert(moved_block.old_loc);
+        move_batch.claimed_locs.insert(moved_block.new_loc);
+    }
+
+    //The nets are only marked once all of them have been checked, since the
+    //moved blocks of a single move can share nets
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; iblk++) {
+        for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(blocks_affected.moved_blocks[iblk].block_num)) {
+            ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(blk_pin);
+            if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+                move_batch.net_stamps[net_id] = move_batch.stamp;
+            }
+        }
+    }
+
+    //There is at most one affected net per pin of the moved blocks
+    if (move.nets_to_update.size() < num_pins) {
+        move.nets_to_update.resize(num_pins, ClusterNetId::INVALID());
+    }
+
+    return true;
 }
 
 //Puts all the nets changed by the current swap into nets_to_update,
@@ -1315,7 +1621,8 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
                                                const t_pl_blocks_to_be_moved& blocks_affected,
                                                const PlaceDelayModel* delay_model,
                                                double& bb_delta_c,
-                                               double& timing_delta_c) {
+                                               double& timing_delta_c,
+                                               std::vector<ClusterNetId>& nets_to_update) {
     VTR_ASSERT_SAFE(bb_delta_c == 0.);
     VTR_ASSERT_SAFE(timing_delta_c == 0.);
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -1335,7 +1642,7 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
                 continue; //TODO: do we require anyting special here for global nets. "Global nets are assumed to span the whole chip, and do not effect costs"
 
             //Record effected nets
-            record_affected_net(net_id, num_affected_nets);
+            record_affected_net(net_id, num_affected_nets, nets_to_update);
 
             //Update the net bounding boxes
             //
@@ -1354,7 +1661,7 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
      * The cost is only updated once per net.
      */
     for (int inet_affected = 0; inet_affected < num_affected_nets; inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
 
         temp_net_cost[net_id] = get_net_cost(net_id, &ts_bb_coord_new[net_id]);
         bb_delta_c += temp_net_cost[net_id] - net_cost[net_id];
@@ -1363,11 +1670,11 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
     return num_affected_nets;
 }
 
-static void record_affected_net(const ClusterNetId net, int& num_affected_nets) {
+static void record_affected_net(const ClusterNetId net, int& num_affected_nets, std::vector<ClusterNetId>& nets_to_update) {
     //Record effected nets
     if (temp_net_cost[net] < 0.) {
         //Net not marked yet.
-        ts_nets_to_update[num_affected_nets] = net;
+        nets_to_update[num_affected_nets] = net;
         num_affected_nets++;
 
         //Flag to say we've marked this net.
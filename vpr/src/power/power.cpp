@@ -802,22 +802,18 @@ static void power_usage_routing(t_power_usage* power_usage,
 
     /* Populate net indices into rr graph */
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        t_trace* trace;
-
-        for (trace = route_ctx.trace[net_id].head; trace != nullptr; trace = trace->next) {
-            rr_node_power[trace->index].visited = false;
-            rr_node_power[trace->index].net_num = net_id;
+        for (const t_trace& trace : route_ctx.trace[net_id]) {
+            rr_node_power[trace.index].visited = false;
+            rr_node_power[trace.index].net_num = net_id;
         }
     }
 
     /* Populate net indices into rr graph */
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        t_trace* trace;
-
-        for (trace = route_ctx.trace[net_id].head; trace != nullptr; trace = trace->next) {
-            RRNodeId node = trace->index;
+        for (const t_trace& trace : route_ctx.trace[net_id]) {
+            RRNodeId node = trace.index;
             const RRGraph& rr_graph = device_ctx.rr_graph;
-            t_rr_node_power* node_power = &rr_node_power[trace->index];
+            t_rr_node_power* node_power = &rr_node_power[trace.index];
 
             if (node_power->visited) {
                 continue;
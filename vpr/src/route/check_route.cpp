@@ -1,8 +1,11 @@
 #include <cstdio>
+#include <cstdarg>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_memory.h"
+#include "vtr_parallel.h"
+#include "vtr_util.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -16,12 +19,22 @@
 #include "route_tree_type.h"
 #include "route_tree_timing.h"
 
+/* Route errors demoted to warnings, with the name of the function which raised them */
+typedef std::vector<std::pair<std::string, VprError>> t_demoted_route_errors;
+
 /******************** Subroutines local to this module **********************/
+static void check_net_route(ClusterNetId net_id,
+                            enum e_route_type route_type,
+                            const t_non_configurable_rr_sets& non_configurable_rr_sets,
+                            vtr::vector<RRNodeId, bool>& connected_to_route,
+                            std::vector<bool>& pin_done,
+                            t_demoted_route_errors* demoted_errors);
+static void check_route_error(t_demoted_route_errors* demoted_errors, const char* func_name, unsigned int line_num, const char* psz_message, ...);
 static void check_node_and_range(const RRNodeId& inode, enum e_route_type route_type);
 static void check_source(const RRNodeId& inode, ClusterNetId net_id);
-static void check_sink(const RRNodeId& inode, ClusterNetId net_id, bool* pin_done);
-static void check_switch(t_trace* tptr, int num_switch);
-static bool check_adjacent(const RRNodeId& from_node, const RRNodeId& to_node);
+static void check_sink(const RRNodeId& inode, ClusterNetId net_id, std::vector<bool>& pin_done);
+static void check_switch(const t_trace& trace, int num_switch);
+static bool check_adjacent(const RRNodeId& from_node, const RRNodeId& to_node, t_demoted_route_errors* demoted_errors);
 static int chanx_chany_adjacent(const RRNodeId& chanx_node, const RRNodeId& chany_node);
 static void reset_flags(ClusterNetId inet, vtr::vector<RRNodeId, bool>& connected_to_route);
 static void check_locally_used_clb_opins(const t_clb_opins_used& clb_opins_used_locally,
@@ -32,7 +45,7 @@ static void check_net_for_stubs(ClusterNetId net);
 
 /************************ Subroutine definitions ****************************/
 
-void check_route(enum e_route_type route_type) {
+void check_route(enum e_route_type route_type, const size_t& num_jobs) {
     /* This routine checks that a routing:  (1) Describes a properly         *
      * connected path for each net, (2) this path connects all the           *
      * pins spanned by that net, and (3) that no routing resources are       *
@@ -40,19 +53,12 @@ void check_route(enum e_route_type route_type) {
      * scratch).                                                             */
 
     int max_pins;
-    RRNodeId inode, prev_node;
-    unsigned int ipin;
-    bool valid, connects;
-    vtr::vector<RRNodeId, bool> connected_to_route; /* [0 .. device_ctx.rr_nodes.size()-1] */
-    t_trace* tptr;
-    bool* pin_done;
+    bool valid;
 
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.routing();
 
-    const int num_switches = device_ctx.rr_switch_inf.size();
-
     VTR_LOG("\n");
     VTR_LOG("Checking to ensure routing is legal...\n");
 
@@ -71,109 +77,226 @@ void check_route(enum e_route_type route_type) {
 
     auto non_configurable_rr_sets = identify_non_configurable_rr_sets();
 
-    connected_to_route.resize(device_ctx.rr_graph.nodes().size(), false);
-
     max_pins = 0;
     for (auto net_id : cluster_ctx.clb_nlist.nets())
         max_pins = std::max(max_pins, (int)cluster_ctx.clb_nlist.net_pins(net_id).size());
 
-    pin_done = (bool*)vtr::malloc(max_pins * sizeof(bool));
-
     /* Now check that all nets are indeed connected. */
+    std::vector<ClusterNetId> nets_to_check;
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         if (cluster_ctx.clb_nlist.net_is_ignored(net_id) || cluster_ctx.clb_nlist.net_sinks(net_id).size() == 0) /* Skip ignored nets. */
             continue;
+        nets_to_check.push_back(net_id);
+    }
+
+    if (1 == vtr::num_parallel_chunks(nets_to_check.size(), num_jobs)) {
+        vtr::vector<RRNodeId, bool> connected_to_route(device_ctx.rr_graph.nodes().size(), false); /* [0 .. device_ctx.rr_nodes.size()-1] */
+        std::vector<bool> pin_done(max_pins, false);
 
-        for (ipin = 0; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ipin++)
-            pin_done[ipin] = false;
+        for (auto net_id : nets_to_check) {
+            check_net_route(net_id, route_type, non_configurable_rr_sets, connected_to_route, pin_done, nullptr);
 
-        /* Check the SOURCE of the net. */
-        tptr = route_ctx.trace[net_id].head;
-        if (tptr == nullptr) {
-            VPR_ERROR(VPR_ERROR_ROUTE,
-                      "in check_route: net %d has no routing.\n", size_t(net_id));
+            check_net_for_stubs(net_id);
+
+            reset_flags(net_id, connected_to_route);
+        } /* End for each net */
+    } else {
+        /* Each thread checks a contiguous range of nets with its own scratch
+         * flags. Instead of stopping at the first illegal net, errors are
+         * recorded per net and reported once all the threads are done.
+         * As the ranges are ordered, so are the recorded errors. */
+        std::vector<std::vector<std::pair<ClusterNetId, VprError>>> chunk_errors(vtr::num_parallel_chunks(nets_to_check.size(), num_jobs));
+        /* Errors demoted to warnings are logged by this thread, in net order */
+        std::vector<t_demoted_route_errors> chunk_demoted_errors(chunk_errors.size());
+
+        vtr::parallel_for_chunks(nets_to_check.size(), num_jobs, [&](size_t ichunk, size_t begin, size_t end) {
+            vtr::vector<RRNodeId, bool> connected_to_route(device_ctx.rr_graph.nodes().size(), false);
+            std::vector<bool> pin_done(max_pins, false);
+
+            for (size_t inet = begin; inet < end; ++inet) {
+                ClusterNetId net_id = nets_to_check[inet];
+                try {
+                    check_net_route(net_id, route_type, non_configurable_rr_sets, connected_to_route, pin_done, &chunk_demoted_errors[ichunk]);
+                } catch (const VprError& error) {
+                    chunk_errors[ichunk].emplace_back(net_id, error);
+                }
+                reset_flags(net_id, connected_to_route);
+            }
+        });
+
+        for (const auto& demoted_errors : chunk_demoted_errors) {
+            for (const auto& error : demoted_errors) {
+                VTR_LOGFF_WARN(error.second.filename_c_str(), error.second.line(), error.first.c_str(), "%s", error.second.what());
+            }
         }
 
-        inode = tptr->index;
-        check_node_and_range(inode, route_type);
-        check_switch(tptr, num_switches);
-        connected_to_route[inode] = true; /* Mark as in path. */
+        std::vector<std::pair<ClusterNetId, VprError>> net_errors;
+        for (const auto& errors : chunk_errors) {
+            net_errors.insert(net_errors.end(), errors.begin(), errors.end());
+        }
 
-        check_source(inode, net_id);
-        pin_done[0] = true;
+        /* The stub finder relies on the (non thread-safe) route tree allocator,
+         * so stubs are checked here for the nets which passed the other checks */
+        std::vector<std::pair<ClusterNetId, VprError>> stub_errors;
+        auto next_error = net_errors.begin();
+        for (auto net_id : nets_to_check) {
+            if (next_error != net_errors.end() && next_error->first == net_id) {
+                ++next_error;
+                continue;
+            }
+            try {
+                check_net_for_stubs(net_id);
+            } catch (const VprError& error) {
+                stub_errors.emplace_back(net_id, error);
+            }
+        }
+        std::vector<std::pair<ClusterNetId, VprError>> all_errors;
+        std::merge(net_errors.begin(), net_errors.end(),
+                   stub_errors.begin(), stub_errors.end(),
+                   std::back_inserter(all_errors),
+                   [](const std::pair<ClusterNetId, VprError>& lhs, const std::pair<ClusterNetId, VprError>& rhs) {
+                       return lhs.first < rhs.first;
+                   });
+
+        if (!all_errors.empty()) {
+            for (const auto& error : all_errors) {
+                VTR_LOG_ERROR("%s", error.second.what());
+            }
+            VTR_LOG_ERROR("Found %zu illegally routed net(s) out of %zu.\n",
+                          all_errors.size(), nets_to_check.size());
+            /* Report the same error as a serial check would */
+            throw all_errors.front().second;
+        }
+    }
 
-        prev_node = inode;
-        int prev_switch = tptr->iswitch;
-        tptr = tptr->next;
-
-        /* Check the rest of the net */
-        size_t num_sinks = 0;
-        while (tptr != nullptr) {
-            inode = tptr->index;
-            check_node_and_range(inode, route_type);
-            check_switch(tptr, num_switches);
-
-            if (prev_switch == OPEN) { //Start of a new branch
-                if (connected_to_route[inode] == false) {
-                    VPR_ERROR(VPR_ERROR_ROUTE,
-                              "in check_route: node %d does not link into existing routing for net %d.\n", size_t(inode), size_t(net_id));
-                }
-            } else { //Continuing along existing branch
-                connects = check_adjacent(prev_node, inode);
-                if (!connects) {
-                    VPR_ERROR(VPR_ERROR_ROUTE,
-                              "in check_route: found non-adjacent segments in traceback while checking net %d:\n"
-                              "  %s\n"
-                              "  %s\n",
-                              size_t(net_id),
-                              describe_rr_node(prev_node).c_str(),
-                              describe_rr_node(inode).c_str());
-                }
+    VTR_LOG("Completed routing consistency check successfully.\n");
+    VTR_LOG("\n");
+}
 
-                connected_to_route[inode] = true; /* Mark as in path. */
+/* Checks the routing of a single net: it should start from the net SOURCE,
+ * be made of adjacent nodes connected by legal switches, and reach all the
+ * SINKs of the net while respecting non-configurable edges.
+ * connected_to_route and pin_done are scratch flags which must be all false
+ * on entry; connected_to_route is left dirty (see reset_flags()).
+ * Only reads the global contexts, so that nets can be checked in parallel.
+ * See check_route_error() for demoted_errors. */
+static void check_net_route(ClusterNetId net_id,
+                            enum e_route_type route_type,
+                            const t_non_configurable_rr_sets& non_configurable_rr_sets,
+                            vtr::vector<RRNodeId, bool>& connected_to_route,
+                            std::vector<bool>& pin_done,
+                            t_demoted_route_errors* demoted_errors) {
+    RRNodeId inode, prev_node;
+    unsigned int ipin;
+    bool connects;
 
-                if (device_ctx.rr_graph.node_type(inode) == SINK) {
-                    check_sink(inode, net_id, pin_done);
-                    num_sinks += 1;
-                }
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& route_ctx = g_vpr_ctx.routing();
 
-            } /* End of prev_node type != SINK */
-            prev_node = inode;
-            prev_switch = tptr->iswitch;
-            tptr = tptr->next;
-        } /* End while */
+    const t_traceback& traceback = route_ctx.trace[net_id];
+    const int num_switches = device_ctx.rr_switch_inf.size();
 
-        if (num_sinks != cluster_ctx.clb_nlist.net_sinks(net_id).size()) {
-            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                            "in check_route: net %zu (%s) has %zu SINKs (expected %zu).\n",
-                            size_t(net_id), cluster_ctx.clb_nlist.net_name(net_id).c_str(),
-                            num_sinks, cluster_ctx.clb_nlist.net_sinks(net_id).size());
-        }
+    for (ipin = 0; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ipin++)
+        pin_done[ipin] = false;
 
-        for (ipin = 0; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ipin++) {
-            if (pin_done[ipin] == false) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                                "in check_route: net %zu does not connect to pin %d.\n", size_t(net_id), ipin);
+    /* Check the SOURCE of the net. */
+    if (traceback.empty()) {
+        check_route_error(demoted_errors, "check_route", __LINE__,
+                          "in check_route: net %d has no routing.\n", size_t(net_id));
+        return;
+    }
+
+    inode = traceback[0].index;
+    check_node_and_range(inode, route_type);
+    check_switch(traceback[0], num_switches);
+    connected_to_route[inode] = true; /* Mark as in path. */
+
+    check_source(inode, net_id);
+    pin_done[0] = true;
+
+    prev_node = inode;
+    int prev_switch = traceback[0].iswitch;
+
+    /* Check the rest of the net */
+    size_t num_sinks = 0;
+    for (size_t itrace = 1; itrace < traceback.size(); ++itrace) {
+        inode = traceback[itrace].index;
+        check_node_and_range(inode, route_type);
+        check_switch(traceback[itrace], num_switches);
+
+        if (prev_switch == OPEN) { //Start of a new branch
+            if (connected_to_route[inode] == false) {
+                check_route_error(demoted_errors, "check_route", __LINE__,
+                                  "in check_route: node %d does not link into existing routing for net %d.\n", size_t(inode), size_t(net_id));
+            }
+        } else { //Continuing along existing branch
+            connects = check_adjacent(prev_node, inode, demoted_errors);
+            if (!connects) {
+                check_route_error(demoted_errors, "check_route", __LINE__,
+                                  "in check_route: found non-adjacent segments in traceback while checking net %d:\n"
+                                  "  %s\n"
+                                  "  %s\n",
+                                  size_t(net_id),
+                                  describe_rr_node(prev_node).c_str(),
+                                  describe_rr_node(inode).c_str());
             }
-        }
 
-        check_non_configurable_edges(net_id, non_configurable_rr_sets);
+            connected_to_route[inode] = true; /* Mark as in path. */
 
-        check_net_for_stubs(net_id);
+            if (device_ctx.rr_graph.node_type(inode) == SINK) {
+                check_sink(inode, net_id, pin_done);
+                num_sinks += 1;
+            }
 
-        reset_flags(net_id, connected_to_route);
+        } /* End of prev_node type != SINK */
+        prev_node = inode;
+        prev_switch = traceback[itrace].iswitch;
+    } /* End for */
 
-    } /* End for each net */
+    if (num_sinks != cluster_ctx.clb_nlist.net_sinks(net_id).size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                        "in check_route: net %zu (%s) has %zu SINKs (expected %zu).\n",
+                        size_t(net_id), cluster_ctx.clb_nlist.net_name(net_id).c_str(),
+                        num_sinks, cluster_ctx.clb_nlist.net_sinks(net_id).size());
+    }
 
-    free(pin_done);
-    connected_to_route.clear();
-    VTR_LOG("Completed routing consistency check successfully.\n");
-    VTR_LOG("\n");
+    for (ipin = 0; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ipin++) {
+        if (pin_done[ipin] == false) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "in check_route: net %zu does not connect to pin %d.\n", size_t(net_id), ipin);
+        }
+    }
+
+    check_non_configurable_edges(net_id, non_configurable_rr_sets);
+}
+
+/* Reports a route error raised by func_name while checking a net, as      *
+ * VPR_ERROR() would do: the error is demoted to a warning by              *
+ * --disable_errors func_name. The function name is given explicitly, as   *
+ * the errors of check_route() are raised from check_net_route().          *
+ * A demoted error is logged, or recorded in demoted_errors when it is     *
+ * given, so that nets checked in parallel are logged by the caller.       */
+static void check_route_error(t_demoted_route_errors* demoted_errors, const char* func_name, unsigned int line_num, const char* psz_message, ...) {
+    va_list va_args;
+    va_start(va_args, psz_message);
+    std::string msg = vtr::vstring_fmt(psz_message, va_args);
+    va_end(va_args);
+
+    if (!is_error_demoted(func_name)) {
+        vpr_throw_msg(VPR_ERROR_ROUTE, __FILE__, line_num, msg);
+    }
+
+    if (demoted_errors) {
+        demoted_errors->emplace_back(func_name, VprError(VPR_ERROR_ROUTE, msg, __FILE__, line_num));
+    } else {
+        VTR_LOGFF_WARN(__FILE__, line_num, func_name, "%s", msg.c_str());
+    }
 }
 
 /* Checks that this SINK node is one of the terminals of inet, and marks   *
  * the appropriate pin as being reached.                                   */
-static void check_sink(const RRNodeId& inode, ClusterNetId net_id, bool* pin_done) {
+static void check_sink(const RRNodeId& inode, ClusterNetId net_id, std::vector<bool>& pin_done) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.placement();
@@ -256,7 +379,7 @@ static void check_source(const RRNodeId& inode, ClusterNetId net_id) {
     }
 }
 
-static void check_switch(t_trace* tptr, int num_switch) {
+static void check_switch(const t_trace& trace, int num_switch) {
     /* Checks that the switch leading from this traceback element to the next *
      * one is a legal switch type.                                            */
 
@@ -265,8 +388,8 @@ static void check_switch(t_trace* tptr, int num_switch) {
 
     auto& device_ctx = g_vpr_ctx.device();
 
-    inode = tptr->index;
-    switch_type = tptr->iswitch;
+    inode = trace.index;
+    switch_type = trace.iswitch;
 
     if (device_ctx.rr_graph.node_type(inode) != SINK) {
         if (switch_type >= num_switch) {
@@ -295,21 +418,14 @@ static void reset_flags(ClusterNetId inet, vtr::vector<RRNodeId, bool>& connecte
      * next net for connectivity (and the default state of the flags       *
      * should always be zero after they have been used).                   */
 
-    t_trace* tptr;
-    RRNodeId inode;
-
     auto& route_ctx = g_vpr_ctx.routing();
 
-    tptr = route_ctx.trace[inet].head;
-
-    while (tptr != nullptr) {
-        inode = tptr->index;
-        connected_to_route[inode] = false; /* Not in routed path now. */
-        tptr = tptr->next;
+    for (const t_trace& trace : route_ctx.trace[inet]) {
+        connected_to_route[trace.index] = false; /* Not in routed path now. */
     }
 }
 
-static bool check_adjacent(const RRNodeId& from_node, const RRNodeId& to_node) {
+static bool check_adjacent(const RRNodeId& from_node, const RRNodeId& to_node, t_demoted_route_errors* demoted_errors) {
     /* This routine checks if the rr_node to_node is reachable from from_node.   *
      * It returns true if is reachable and false if it is not.  Check_node has   *
      * already been used to verify that both nodes are valid rr_nodes, so only   *
@@ -482,8 +598,8 @@ static bool check_adjacent(const RRNodeId& from_node, const RRNodeId& to_node) {
     else if (num_adj == 0)
         return (false);
 
-    VPR_ERROR(VPR_ERROR_ROUTE,
-              "in check_adjacent: num_adj = %d. Expected 0 or 1.\n", num_adj);
+    check_route_error(demoted_errors, "check_adjacent", __LINE__,
+                      "in check_adjacent: num_adj = %d. Expected 0 or 1.\n", num_adj);
     return false; //Should not reach here once thrown
 }
 
@@ -522,7 +638,6 @@ void recompute_occupancy_from_scratch() {
 
     int iclass, ipin, num_local_opins;
     RRNodeId inode;
-    t_trace* tptr;
 
     auto& route_ctx = g_vpr_ctx.mutable_routing();
     auto& device_ctx = g_vpr_ctx.device();
@@ -540,21 +655,14 @@ void recompute_occupancy_from_scratch() {
         if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) /* Skip ignored nets. */
             continue;
 
-        tptr = route_ctx.trace[net_id].head;
-        if (tptr == nullptr)
-            continue;
-
-        for (;;) {
-            inode = tptr->index;
+        const t_traceback& traceback = route_ctx.trace[net_id];
+        for (size_t itrace = 0; itrace < traceback.size(); ++itrace) {
+            inode = traceback[itrace].index;
             route_ctx.rr_node_route_inf[inode].set_occ(route_ctx.rr_node_route_inf[inode].occ() + 1);
 
-            if (tptr->iswitch == OPEN) {
-                tptr = tptr->next; /* Skip next segment. */
-                if (tptr == nullptr)
-                    break;
+            if (traceback[itrace].iswitch == OPEN) {
+                ++itrace; /* Skip next segment. */
             }
-
-            tptr = tptr->next;
         }
     }
 
@@ -637,20 +745,20 @@ static bool check_non_configurable_edges(ClusterNetId net, const t_non_configura
     auto& route_ctx = g_vpr_ctx.routing();
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    t_trace* head = route_ctx.trace[net].head;
+    const t_traceback& traceback = route_ctx.trace[net];
 
     //Collect all the edges used by this net's routing
     std::set<t_node_edge> routing_edges;
     std::set<RRNodeId> routing_nodes;
-    for (t_trace* trace = head; trace != nullptr; trace = trace->next) {
-        RRNodeId inode = trace->index;
+    for (size_t itrace = 0; itrace < traceback.size(); ++itrace) {
+        RRNodeId inode = traceback[itrace].index;
 
         routing_nodes.insert(inode);
 
-        if (trace->iswitch == OPEN) {
+        if (traceback[itrace].iswitch == OPEN) {
             continue; //End of branch
-        } else if (trace->next) {
-            RRNodeId inode_next = trace->next->index;
+        } else if (itrace + 1 < traceback.size()) {
+            RRNodeId inode_next = traceback[itrace + 1].index;
 
             t_node_edge edge = {inode, inode_next};
 
@@ -3,7 +3,7 @@
 #include "physical_types.h"
 #include "route_common.h"
 
-void check_route(enum e_route_type route_type);
+void check_route(enum e_route_type route_type, const size_t& num_jobs);
 
 void recompute_occupancy_from_scratch();
 
@@ -0,0 +1,810 @@
+/* Save and restore the routing resource graph of the device in a binary snapshot.
+ *
+ * Building the tileable routing resource graph (and checking it) takes most
+ * of the time of VPR on large devices, while it only depends on the architecture,
+ * the grid and the channel widths. When VPR is run repeatedly on the same device,
+ * the graph can be written once with --write_device_snapshot and loaded
+ * with --read_device_snapshot, which copies the internal arrays back
+ * instead of rebuilding them.
+ *
+ * The snapshot is a flat binary file, which is mapped in memory when loaded:
+ *   - a header (magic number, snapshot version, VPR version and byte order)
+ *   - a key describing everything the graph is built from: the content of
+ *     the architecture file, the options of the graph builders, the grid,
+ *     the channel widths, the Fc of the tiles, the switches, the segments and
+ *     the direct connections. The snapshot is only loaded when the key matches
+ *     the current device exactly, otherwise the graph is rebuilt.
+ *   - the internal data of the RRGraph object, and the data of the device
+ *     context derived from it (rr switches, indexed data, rc data, track ids, etc.)
+ *
+ * The grid and the segments are not restored, as they refer to the architecture:
+ * they are built from the architecture as usual and compared to the key.
+ * The fast node look-up of the RRGraph object is rebuilt on demand from the nodes.
+ *
+ * The snapshot is only readable by the same version of VPR on the same kind of host.
+ */
+#include <string.h>
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <memory>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "vtr_version.h"
+#include "vtr_digest.h"
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+#include "vpr_error.h"
+#include "globals.h"
+#include "read_xml_arch_file.h"
+#include "rr_graph_obj.h"
+#include "device_snapshot.h"
+
+/* Change the version whenever the layout of the snapshot changes */
+constexpr uint32_t DEVICE_SNAPSHOT_VERSION = 2;
+constexpr std::array<char, 8> DEVICE_SNAPSHOT_MAGIC = {{'V', 'P', 'R', 'D', 'E', 'V', 'S', 'S'}};
+constexpr uint32_t DEVICE_SNAPSHOT_BYTE_ORDER = 0x01020304;
+
+/************************************************************************
+ * Sequential writer of a snapshot file
+ ***********************************************************************/
+class DeviceSnapshotWriter {
+  public:
+    explicit DeviceSnapshotWriter(const char* file_name)
+        : file_name_(file_name)
+        , fp_(file_name, std::ios::out | std::ios::binary | std::ios::trunc) {
+        if (!fp_.is_open()) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "Failed to open device snapshot '%s' for writing\n",
+                            file_name);
+        }
+    }
+
+    ~DeviceSnapshotWriter() {
+        fp_.close();
+        if (fp_.fail()) {
+            VTR_LOG_ERROR("Failed to write device snapshot '%s'\n", file_name_.c_str());
+        }
+    }
+
+    template<class T>
+    void write_value(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot values must be trivially copyable");
+        fp_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /* Arrays are written with their size */
+    template<class T>
+    void write_array(const T* data, const size_t& size) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot arrays must be trivially copyable");
+        write_value<uint64_t>(size);
+        fp_.write(reinterpret_cast<const char*>(data), sizeof(T) * size);
+    }
+
+    template<class V>
+    void write_vector(const V& values) {
+        write_array(values.data(), values.size());
+    }
+
+    void write_string(const std::string& str) {
+        write_array(str.data(), str.size());
+    }
+
+  private:
+    std::string file_name_;
+    std::ofstream fp_;
+};
+
+/************************************************************************
+ * Sequential reader of a snapshot file mapped in memory
+ ***********************************************************************/
+class DeviceSnapshotReader {
+  public:
+    explicit DeviceSnapshotReader(const char* file_name)
+        : file_name_(file_name) {
+        int fd = open(file_name, O_RDONLY);
+        if (-1 == fd) {
+            return;
+        }
+        struct stat file_stat;
+        if ((0 == fstat(fd, &file_stat)) && (0 < file_stat.st_size)) {
+            void* data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != data) {
+                data_ = static_cast<const char*>(data);
+                size_ = file_stat.st_size;
+            }
+        }
+        close(fd);
+    }
+
+    ~DeviceSnapshotReader() {
+        if (nullptr != data_) {
+            munmap(const_cast<char*>(data_), size_);
+        }
+    }
+
+    bool is_open() const {
+        return nullptr != data_;
+    }
+
+    bool at_end() const {
+        return offset_ == size_;
+    }
+
+    template<class T>
+    T read_value() {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot values must be trivially copyable");
+        T value;
+        memcpy(&value, consume(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    /* Resize the vector to the size of the array, and copy the array */
+    template<class V>
+    void read_vector(V& values) {
+        static_assert(std::is_trivially_copyable<typename V::value_type>::value, "Snapshot arrays must be trivially copyable");
+        size_t size = read_value<uint64_t>();
+        if (size > (size_ - offset_) / sizeof(typename V::value_type)) {
+            consume(size_ - offset_ + 1); /* Error out on truncated file */
+        }
+        const char* data = consume(sizeof(typename V::value_type) * size);
+        values.resize(size);
+        if (0 < size) {
+            memcpy(values.data(), data, sizeof(typename V::value_type) * size);
+        }
+    }
+
+    std::string read_string() {
+        size_t size = read_value<uint64_t>();
+        return std::string(consume(size), size);
+    }
+
+  private:
+    const char* consume(const size_t& num_bytes) {
+        if (num_bytes > size_ - offset_) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "Device snapshot '%s' is truncated or corrupted\n",
+                            file_name_.c_str());
+        }
+        const char* data = data_ + offset_;
+        offset_ += num_bytes;
+        return data;
+    }
+
+  private:
+    std::string file_name_;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    size_t offset_ = 0;
+};
+
+/************************************************************************
+ * Serialization of the internal data of RRGraph,
+ * which is a friend of the RRGraph class
+ ***********************************************************************/
+static void write_rr_switch(DeviceSnapshotWriter& writer, const t_rr_switch_inf& rr_switch);
+static t_rr_switch_inf read_rr_switch(DeviceSnapshotReader& reader);
+
+class RRGraphSnapshotIO {
+  public:
+    static void write(DeviceSnapshotWriter& writer, const RRGraph& rr_graph) {
+        /* Removed nodes and edges are not supported: the graph should be compressed */
+        VTR_ASSERT(false == rr_graph.is_dirty());
+        VTR_ASSERT(rr_graph.invalid_node_ids_.empty());
+        VTR_ASSERT(rr_graph.invalid_edge_ids_.empty());
+
+        writer.write_value<uint64_t>(rr_graph.num_nodes_);
+        writer.write_vector(rr_graph.node_types_);
+        writer.write_vector(rr_graph.node_bounding_boxes_);
+        writer.write_vector(rr_graph.node_capacities_);
+        writer.write_vector(rr_graph.node_cost_indices_);
+        writer.write_vector(rr_graph.node_directions_);
+        writer.write_vector(rr_graph.node_sides_);
+        writer.write_vector(rr_graph.node_Rs_);
+        writer.write_vector(rr_graph.node_Cs_);
+        writer.write_vector(rr_graph.node_rc_data_indices_);
+        writer.write_vector(rr_graph.node_segments_);
+
+        /* The ptc numbers of all the nodes are flattened in a single array */
+        std::vector<uint64_t> ptc_num_offsets;
+        std::vector<short> ptc_nums;
+        ptc_num_offsets.reserve(rr_graph.num_nodes_ + 1);
+        for (const std::vector<short>& node_ptc_nums : rr_graph.node_ptc_nums_) {
+            ptc_num_offsets.push_back(ptc_nums.size());
+            ptc_nums.insert(ptc_nums.end(), node_ptc_nums.begin(), node_ptc_nums.end());
+        }
+        ptc_num_offsets.push_back(ptc_nums.size());
+        writer.write_vector(ptc_num_offsets);
+        writer.write_vector(ptc_nums);
+
+        /* The edges of all the nodes are flattened in a single array,
+         * whose sub-ranges are given by the number of edges of each node */
+        writer.write_vector(rr_graph.node_num_in_edges_);
+        writer.write_vector(rr_graph.node_num_out_edges_);
+        writer.write_vector(rr_graph.node_num_non_configurable_in_edges_);
+        writer.write_vector(rr_graph.node_num_non_configurable_out_edges_);
+        std::vector<RREdgeId> node_edges;
+        node_edges.reserve(2 * rr_graph.num_edges_);
+        for (size_t inode = 0; inode < rr_graph.num_nodes_; ++inode) {
+            RRNodeId node(inode);
+            const RREdgeId* edges = rr_graph.node_edges_[node].get();
+            node_edges.insert(node_edges.end(), edges, edges + rr_graph.node_num_in_edges_[node] + rr_graph.node_num_out_edges_[node]);
+        }
+        writer.write_vector(node_edges);
+
+        writer.write_value<uint64_t>(rr_graph.num_edges_);
+        writer.write_vector(rr_graph.edge_src_nodes_);
+        writer.write_vector(rr_graph.edge_sink_nodes_);
+        writer.write_vector(rr_graph.edge_switches_);
+
+        writer.write_value<uint64_t>(rr_graph.switches_.size());
+        for (const t_rr_switch_inf& rr_switch : rr_graph.switches_) {
+            write_rr_switch(writer, rr_switch);
+        }
+    }
+
+    static void read(DeviceSnapshotReader& reader, RRGraph& rr_graph,
+                     const std::vector<t_segment_inf>& segment_inf) {
+        rr_graph.clear();
+
+        rr_graph.num_nodes_ = reader.read_value<uint64_t>();
+        reader.read_vector(rr_graph.node_types_);
+        reader.read_vector(rr_graph.node_bounding_boxes_);
+        reader.read_vector(rr_graph.node_capacities_);
+        reader.read_vector(rr_graph.node_cost_indices_);
+        reader.read_vector(rr_graph.node_directions_);
+        reader.read_vector(rr_graph.node_sides_);
+        reader.read_vector(rr_graph.node_Rs_);
+        reader.read_vector(rr_graph.node_Cs_);
+        reader.read_vector(rr_graph.node_rc_data_indices_);
+        reader.read_vector(rr_graph.node_segments_);
+
+        std::vector<uint64_t> ptc_num_offsets;
+        std::vector<short> ptc_nums;
+        reader.read_vector(ptc_num_offsets);
+        reader.read_vector(ptc_nums);
+        check_size(rr_graph.num_nodes_ + 1, ptc_num_offsets.size());
+        check_size(ptc_num_offsets[rr_graph.num_nodes_], ptc_nums.size());
+        rr_graph.node_ptc_nums_.resize(rr_graph.num_nodes_);
+        for (size_t inode = 0; inode < rr_graph.num_nodes_; ++inode) {
+            check_size(ptc_num_offsets[inode], ptc_num_offsets[inode + 1]);
+            rr_graph.node_ptc_nums_[RRNodeId(inode)].assign(ptc_nums.begin() + ptc_num_offsets[inode],
+                                                            ptc_nums.begin() + ptc_num_offsets[inode + 1]);
+        }
+
+        reader.read_vector(rr_graph.node_num_in_edges_);
+        reader.read_vector(rr_graph.node_num_out_edges_);
+        reader.read_vector(rr_graph.node_num_non_configurable_in_edges_);
+        reader.read_vector(rr_graph.node_num_non_configurable_out_edges_);
+        check_size(rr_graph.num_nodes_, rr_graph.node_num_in_edges_.size());
+        check_size(rr_graph.num_nodes_, rr_graph.node_num_out_edges_.size());
+        std::vector<RREdgeId> node_edges;
+        reader.read_vector(node_edges);
+        rr_graph.node_edges_.resize(rr_graph.num_nodes_);
+        size_t edge_offset = 0;
+        for (size_t inode = 0; inode < rr_graph.num_nodes_; ++inode) {
+            RRNodeId node(inode);
+            size_t num_node_edges = rr_graph.node_num_in_edges_[node] + rr_graph.node_num_out_edges_[node];
+            check_size(edge_offset + num_node_edges, node_edges.size());
+            rr_graph.node_edges_[node] = std::make_unique<RREdgeId[]>(num_node_edges);
+            std::copy(node_edges.begin() + edge_offset,
+                      node_edges.begin() + edge_offset + num_node_edges,
+                      rr_graph.node_edges_[node].get());
+            edge_offset += num_node_edges;
+        }
+
+        rr_graph.num_edges_ = reader.read_value<uint64_t>();
+        reader.read_vector(rr_graph.edge_src_nodes_);
+        reader.read_vector(rr_graph.edge_sink_nodes_);
+        reader.read_vector(rr_graph.edge_switches_);
+
+        size_t num_switches = reader.read_value<uint64_t>();
+        rr_graph.reserve_switches(num_switches);
+        for (size_t iswitch = 0; iswitch < num_switches; ++iswitch) {
+            rr_graph.create_switch(read_rr_switch(reader));
+        }
+
+        rr_graph.reserve_segments(segment_inf.size());
+        for (const t_segment_inf& segment : segment_inf) {
+            rr_graph.create_segment(segment);
+        }
+
+        /* The sizes of all the arrays are checked by the validator of the RRGraph */
+    }
+
+  private:
+    /* Error out if a size (or an offset) is larger than the size of the array it refers to */
+    static void check_size(const size_t& size, const size_t& max_size) {
+        if (size > max_size) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Device snapshot is corrupted\n");
+        }
+    }
+};
+
+/************************************************************************
+ * The switches refer to the architecture switches by their index,
+ * as their names are owned by the architecture
+ ***********************************************************************/
+static void write_rr_switch(DeviceSnapshotWriter& writer, const t_rr_switch_inf& rr_switch) {
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    int32_t arch_switch_index = -1;
+    for (int iswitch = 0; iswitch < device_ctx.num_arch_switches; ++iswitch) {
+        if ((nullptr != rr_switch.name)
+            && (0 == strcmp(rr_switch.name, device_ctx.arch_switch_inf[iswitch].name))) {
+            arch_switch_index = iswitch;
+            break;
+        }
+    }
+
+    writer.write_value<float>(rr_switch.R);
+    writer.write_value<float>(rr_switch.Cin);
+    writer.write_value<float>(rr_switch.Cout);
+    writer.write_value<float>(rr_switch.Cinternal);
+    writer.write_value<float>(rr_switch.Tdel);
+    writer.write_value<float>(rr_switch.mux_trans_size);
+    writer.write_value<float>(rr_switch.buf_size);
+    writer.write_value<int32_t>(arch_switch_index);
+    writer.write_value<int32_t>(rr_switch.power_buffer_type);
+    writer.write_value<float>(rr_switch.power_buffer_size);
+    writer.write_value<int32_t>(int32_t(rr_switch.type()));
+}
+
+static t_rr_switch_inf read_rr_switch(DeviceSnapshotReader& reader) {
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    t_rr_switch_inf rr_switch;
+    rr_switch.R = reader.read_value<float>();
+    rr_switch.Cin = reader.read_value<float>();
+    rr_switch.Cout = reader.read_value<float>();
+    rr_switch.Cinternal = reader.read_value<float>();
+    rr_switch.Tdel = reader.read_value<float>();
+    rr_switch.mux_trans_size = reader.read_value<float>();
+    rr_switch.buf_size = reader.read_value<float>();
+    int32_t arch_switch_index = reader.read_value<int32_t>();
+    if ((0 <= arch_switch_index) && (arch_switch_index < device_ctx.num_arch_switches)) {
+        rr_switch.name = device_ctx.arch_switch_inf[arch_switch_index].name;
+    }
+    rr_switch.power_buffer_type = e_power_buffer_type(reader.read_value<int32_t>());
+    rr_switch.power_buffer_size = reader.read_value<float>();
+    rr_switch.set_type(SwitchType(reader.read_value<int32_t>()));
+    return rr_switch;
+}
+
+/************************************************************************
+ * The key of a snapshot, which describes everything the graph is built from.
+ * Each part of the key is serialized into a byte string, so that the key
+ * of a snapshot can be compared to the one of the device part by part
+ ***********************************************************************/
+class DeviceSnapshotKey {
+  public:
+    /* Start a new part of the key, to which the next values are added */
+    void add_part(const char* name) {
+        part_names_.emplace_back(name);
+        part_data_.emplace_back();
+    }
+
+    template<class T>
+    void add_value(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot key values must be trivially copyable");
+        VTR_ASSERT(!part_data_.empty());
+        part_data_.back().append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<class T>
+    void add_vector(const std::vector<T>& values) {
+        add_value<uint64_t>(values.size());
+        for (const T& value : values) {
+            add_value<T>(value);
+        }
+    }
+
+    void add_string(const std::string& str) {
+        add_value<uint64_t>(str.size());
+        VTR_ASSERT(!part_data_.empty());
+        part_data_.back().append(str);
+    }
+
+    void add_string(const char* str) {
+        add_string(std::string(nullptr == str ? "" : str));
+    }
+
+    void write(DeviceSnapshotWriter& writer) const {
+        writer.write_value<uint64_t>(part_names_.size());
+        for (size_t ipart = 0; ipart < part_names_.size(); ++ipart) {
+            writer.write_string(part_names_[ipart]);
+            writer.write_string(part_data_[ipart]);
+        }
+    }
+
+    void read(DeviceSnapshotReader& reader) {
+        size_t num_parts = reader.read_value<uint64_t>();
+        part_names_.clear();
+        part_data_.clear();
+        for (size_t ipart = 0; ipart < num_parts; ++ipart) {
+            part_names_.push_back(reader.read_string());
+            part_data_.push_back(reader.read_string());
+        }
+    }
+
+    /* Return the name of the first part which differs from the other key,
+     * or an empty string if the keys match */
+    std::string find_mismatch(const DeviceSnapshotKey& other) const {
+        for (size_t ipart = 0; ipart < part_names_.size(); ++ipart) {
+            if ((ipart >= other.part_names_.size())
+                || (part_names_[ipart] != other.part_names_[ipart])
+                || (part_data_[ipart] != other.part_data_[ipart])) {
+                return part_names_[ipart];
+            }
+        }
+        if (part_names_.size() != other.part_names_.size()) {
+            return "snapshot key layout";
+        }
+        return std::string();
+    }
+
+  private:
+    std::vector<std::string> part_names_;
+    std::vector<std::string> part_data_;
+};
+
+static DeviceSnapshotKey build_device_snapshot_key(const t_graph_type graph_type,
+                                                   const std::vector<t_physical_tile_type>& block_types,
+                                                   const DeviceGrid& grid,
+                                                   const t_chan_width& nodes_per_chan,
+                                                   const t_det_routing_arch& det_routing_arch,
+                                                   const std::vector<t_segment_inf>& segment_inf,
+                                                   const enum e_base_cost_type base_cost_type,
+                                                   const bool trim_empty_channels,
+                                                   const bool trim_obs_channels,
+                                                   const bool wire_opposite_side,
+                                                   const enum e_clock_modeling clock_modeling,
+                                                   const t_direct_inf* directs,
+                                                   const int num_directs) {
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    DeviceSnapshotKey key;
+
+    //Content of the architecture file, which all the other parts are derived from
+    key.add_part("architecture file");
+    key.add_string(vtr::secure_digest_file(get_arch_file_name()));
+
+    //Options of the routing resource graph builders
+    key.add_part("routing resource graph options");
+    key.add_value<int32_t>(graph_type);
+    key.add_value<int32_t>(base_cost_type);
+    key.add_value<int32_t>(clock_modeling);
+    key.add_value<uint8_t>(trim_empty_channels);
+    key.add_value<uint8_t>(trim_obs_channels);
+    key.add_value<uint8_t>(wire_opposite_side);
+    key.add_value<uint8_t>(det_routing_arch.tileable);
+    key.add_value<uint8_t>(det_routing_arch.through_channel);
+    key.add_value<int32_t>(det_routing_arch.directionality);
+    key.add_value<int32_t>(det_routing_arch.global_route_switch);
+    key.add_value<int32_t>(det_routing_arch.delayless_switch);
+    key.add_value<int32_t>(det_routing_arch.wire_to_arch_ipin_switch);
+    key.add_value<float>(det_routing_arch.R_minW_nmos);
+    key.add_value<float>(det_routing_arch.R_minW_pmos);
+
+    key.add_part("switch blocks");
+    key.add_value<int32_t>(det_routing_arch.switch_block_type);
+    key.add_value<int32_t>(det_routing_arch.Fs);
+    key.add_value<int32_t>(det_routing_arch.switch_block_subtype);
+    key.add_value<int32_t>(det_routing_arch.subFs);
+    key.add_value<uint64_t>(det_routing_arch.switchblocks.size());
+    for (const t_switchblock_inf& switchblock : det_routing_arch.switchblocks) {
+        key.add_string(switchblock.name);
+    }
+
+    //Type index, width offset and height offset of each grid tile
+    key.add_part("device grid");
+    key.add_value<uint64_t>(grid.width());
+    key.add_value<uint64_t>(grid.height());
+    for (size_t ix = 0; ix < grid.width(); ++ix) {
+        for (size_t iy = 0; iy < grid.height(); ++iy) {
+            key.add_value<int32_t>(nullptr == grid[ix][iy].type ? -1 : grid[ix][iy].type->index);
+            key.add_value<int32_t>(grid[ix][iy].width_offset);
+            key.add_value<int32_t>(grid[ix][iy].height_offset);
+        }
+    }
+
+    key.add_part("channel widths");
+    key.add_value<int32_t>(nodes_per_chan.max);
+    key.add_value<int32_t>(nodes_per_chan.x_max);
+    key.add_value<int32_t>(nodes_per_chan.y_max);
+    key.add_value<int32_t>(nodes_per_chan.x_min);
+    key.add_value<int32_t>(nodes_per_chan.y_min);
+    key.add_vector(nodes_per_chan.x_list);
+    key.add_vector(nodes_per_chan.y_list);
+
+    //Fc and switch block locations of each tile type
+    key.add_part("Fc of tiles");
+    key.add_value<uint64_t>(block_types.size());
+    for (const t_physical_tile_type& block_type : block_types) {
+        key.add_string(block_type.name);
+        key.add_value<int32_t>(block_type.num_pins);
+        key.add_value<uint64_t>(block_type.fc_specs.size());
+        for (const t_fc_specification& fc_spec : block_type.fc_specs) {
+            key.add_value<int32_t>(int32_t(fc_spec.fc_type));
+            key.add_value<int32_t>(int32_t(fc_spec.fc_value_type));
+            key.add_value<float>(fc_spec.fc_value);
+            key.add_value<int32_t>(fc_spec.seg_index);
+            key.add_vector(fc_spec.pins);
+        }
+        const vtr::Matrix<e_sb_type>& sb_locations = block_type.switchblock_locations;
+        key.add_value<uint64_t>(sb_locations.dim_size(0));
+        key.add_value<uint64_t>(sb_locations.dim_size(1));
+        for (size_t ix = 0; ix < sb_locations.dim_size(0); ++ix) {
+            for (size_t iy = 0; iy < sb_locations.dim_size(1); ++iy) {
+                key.add_value<int32_t>(int32_t(sb_locations[ix][iy]));
+            }
+        }
+    }
+
+    key.add_part("architecture switches");
+    key.add_value<int32_t>(device_ctx.num_arch_switches);
+    for (int iswitch = 0; iswitch < device_ctx.num_arch_switches; ++iswitch) {
+        const t_arch_switch_inf& arch_switch = device_ctx.arch_switch_inf[iswitch];
+        key.add_string(arch_switch.name);
+        key.add_value<int32_t>(int32_t(arch_switch.type()));
+        key.add_value<float>(arch_switch.R);
+        key.add_value<float>(arch_switch.Cin);
+        key.add_value<float>(arch_switch.Cout);
+        key.add_value<float>(arch_switch.Cinternal);
+        key.add_value<float>(arch_switch.mux_trans_size);
+        key.add_value<int32_t>(int32_t(arch_switch.buf_size_type));
+        key.add_value<float>(arch_switch.buf_size);
+        key.add_value<int32_t>(arch_switch.power_buffer_type);
+        key.add_value<float>(arch_switch.power_buffer_size);
+        //Fanin-dependent delays are covered by the content of the architecture file
+        key.add_value<uint8_t>(arch_switch.fixed_Tdel());
+        if (arch_switch.fixed_Tdel()) {
+            key.add_value<float>(arch_switch.Tdel());
+        }
+    }
+
+    key.add_part("routing segments");
+    key.add_value<uint64_t>(segment_inf.size());
+    for (const t_segment_inf& segment : segment_inf) {
+        key.add_string(segment.name);
+        key.add_value<int32_t>(segment.frequency);
+        key.add_value<int32_t>(segment.length);
+        key.add_value<int16_t>(segment.arch_wire_switch);
+        key.add_value<int16_t>(segment.arch_opin_switch);
+        key.add_value<float>(segment.frac_cb);
+        key.add_value<float>(segment.frac_sb);
+        key.add_value<uint8_t>(segment.longline);
+        key.add_value<float>(segment.Rmetal);
+        key.add_value<float>(segment.Cmetal);
+        key.add_value<int32_t>(segment.directionality);
+        key.add_value<uint64_t>(segment.cb.size());
+        for (const bool cb : segment.cb) {
+            key.add_value<uint8_t>(cb);
+        }
+        key.add_value<uint64_t>(segment.sb.size());
+        for (const bool sb : segment.sb) {
+            key.add_value<uint8_t>(sb);
+        }
+    }
+
+    key.add_part("direct connections");
+    key.add_value<int32_t>(num_directs);
+    for (int idirect = 0; idirect < num_directs; ++idirect) {
+        key.add_string(directs[idirect].from_pin);
+        key.add_string(directs[idirect].to_pin);
+        key.add_value<int32_t>(directs[idirect].x_offset);
+        key.add_value<int32_t>(directs[idirect].y_offset);
+        key.add_value<int32_t>(directs[idirect].z_offset);
+        key.add_value<int32_t>(directs[idirect].switch_type);
+        key.add_value<int32_t>(directs[idirect].from_side);
+        key.add_value<int32_t>(directs[idirect].to_side);
+    }
+
+    return key;
+}
+
+/************************************************************************
+ * Top-level functions
+ ***********************************************************************/
+void write_device_snapshot(const char* file_name,
+                           const t_graph_type graph_type,
+                           const std::vector<t_physical_tile_type>& block_types,
+                           const DeviceGrid& grid,
+                           const t_det_routing_arch& det_routing_arch,
+                           const std::vector<t_segment_inf>& segment_inf,
+                           const enum e_base_cost_type base_cost_type,
+                           const bool trim_empty_channels,
+                           const bool trim_obs_channels,
+                           const bool wire_opposite_side,
+                           const enum e_clock_modeling clock_modeling,
+                           const t_direct_inf* directs,
+                           const int num_directs) {
+    vtr::ScopedStartFinishTimer timer("Write device snapshot");
+
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    DeviceSnapshotWriter writer(file_name);
+
+    /* Header */
+    writer.write_value(DEVICE_SNAPSHOT_MAGIC);
+    writer.write_value<uint32_t>(DEVICE_SNAPSHOT_VERSION);
+    writer.write_value<uint32_t>(DEVICE_SNAPSHOT_BYTE_ORDER);
+    writer.write_string(vtr::VERSION);
+
+    build_device_snapshot_key(graph_type, block_types, grid, device_ctx.chan_width,
+                              det_routing_arch, segment_inf, base_cost_type,
+                              trim_empty_channels, trim_obs_channels, wire_opposite_side,
+                              clock_modeling, directs, num_directs)
+        .write(writer);
+
+    /* Routing resource graph */
+    writer.write_value<int32_t>(det_routing_arch.wire_to_rr_ipin_switch);
+    RRGraphSnapshotIO::write(writer, device_ctx.rr_graph);
+
+    writer.write_value<uint64_t>(device_ctx.rr_switch_inf.size());
+    for (const t_rr_switch_inf& rr_switch : device_ctx.rr_switch_inf) {
+        write_rr_switch(writer, rr_switch);
+    }
+    writer.write_vector(device_ctx.rr_indexed_data);
+
+    /* The rc data are written as pairs of (R, C) */
+    std::vector<float> rc_data;
+    for (const t_rr_rc_data& node_rc_data : device_ctx.rr_rc_data) {
+        rc_data.push_back(node_rc_data.R);
+        rc_data.push_back(node_rc_data.C);
+    }
+    writer.write_vector(rc_data);
+
+    /* Track ids of the tileable routing resource graph, flattened as the ptc numbers */
+    std::vector<RRNodeId> track_id_nodes;
+    std::vector<uint64_t> track_id_offsets;
+    std::vector<uint64_t> track_ids;
+    for (const auto& node_track_ids : device_ctx.rr_node_track_ids) {
+        track_id_nodes.push_back(node_track_ids.first);
+        track_id_offsets.push_back(track_ids.size());
+        track_ids.insert(track_ids.end(), node_track_ids.second.begin(), node_track_ids.second.end());
+    }
+    track_id_offsets.push_back(track_ids.size());
+    writer.write_vector(track_id_nodes);
+    writer.write_vector(track_id_offsets);
+    writer.write_vector(track_ids);
+
+    /* Remapping of the architecture switches, as pairs of (fanin, rr_switch) */
+    writer.write_value<uint64_t>(device_ctx.switch_fanin_remap.size());
+    for (const std::map<int, int>& fanin_remap : device_ctx.switch_fanin_remap) {
+        std::vector<int32_t> pairs;
+        for (const auto& fanin_switch : fanin_remap) {
+            pairs.push_back(fanin_switch.first);
+            pairs.push_back(fanin_switch.second);
+        }
+        writer.write_vector(pairs);
+    }
+
+    VTR_LOG("Wrote device snapshot '%s'\n", file_name);
+}
+
+bool read_device_snapshot(const char* file_name,
+                          const t_graph_type graph_type,
+                          const std::vector<t_physical_tile_type>& block_types,
+                          const DeviceGrid& grid,
+                          const t_chan_width& nodes_per_chan,
+                          t_det_routing_arch* det_routing_arch,
+                          const std::vector<t_segment_inf>& segment_inf,
+                          const enum e_base_cost_type base_cost_type,
+                          const bool trim_empty_channels,
+                          const bool trim_obs_channels,
+                          const bool wire_opposite_side,
+                          const enum e_clock_modeling clock_modeling,
+                          const t_direct_inf* directs,
+                          const int num_directs) {
+    vtr::ScopedStartFinishTimer timer("Read device snapshot");
+
+    DeviceSnapshotReader reader(file_name);
+    if (false == reader.is_open()) {
+        VTR_LOG_WARN("Unable to open device snapshot '%s', building the routing resource graph\n",
+                     file_name);
+        return false;
+    }
+
+    /* Header */
+    if ((DEVICE_SNAPSHOT_MAGIC != reader.read_value<std::array<char, 8>>())
+        || (DEVICE_SNAPSHOT_VERSION != reader.read_value<uint32_t>())
+        || (DEVICE_SNAPSHOT_BYTE_ORDER != reader.read_value<uint32_t>())
+        || (vtr::VERSION != reader.read_string())) {
+        VTR_LOG_WARN("Device snapshot '%s' was not written by this version of VPR, building the routing resource graph\n",
+                     file_name);
+        return false;
+    }
+
+    DeviceSnapshotKey snapshot_key;
+    snapshot_key.read(reader);
+    std::string mismatch = snapshot_key.find_mismatch(build_device_snapshot_key(graph_type, block_types, grid, nodes_per_chan,
+                                                                                *det_routing_arch, segment_inf, base_cost_type,
+                                                                                trim_empty_channels, trim_obs_channels, wire_opposite_side,
+                                                                                clock_modeling, directs, num_directs));
+    if (!mismatch.empty()) {
+        VTR_LOG_WARN("Device snapshot '%s' does not match the %s of the device, building the routing resource graph\n",
+                     file_name, mismatch.c_str());
+        return false;
+    }
+
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+
+    /* Routing resource graph */
+    det_routing_arch->wire_to_rr_ipin_switch = reader.read_value<int32_t>();
+    RRGraphSnapshotIO::read(reader, device_ctx.rr_graph, segment_inf);
+
+    size_t num_rr_switches = reader.read_value<uint64_t>();
+    device_ctx.rr_switch_inf.clear();
+    device_ctx.rr_switch_inf.reserve(num_rr_switches);
+    for (size_t iswitch = 0; iswitch < num_rr_switches; ++iswitch) {
+        device_ctx.rr_switch_inf.push_back(read_rr_switch(reader));
+    }
+    reader.read_vector(device_ctx.rr_indexed_data);
+
+    std::vector<float> rc_data;
+    reader.read_vector(rc_data);
+    device_ctx.rr_rc_data.clear();
+    device_ctx.rr_rc_data.reserve(rc_data.size() / 2);
+    for (size_t irc = 0; irc + 1 < rc_data.size(); irc += 2) {
+        device_ctx.rr_rc_data.emplace_back(rc_data[irc], rc_data[irc + 1]);
+    }
+
+    std::vector<RRNodeId> track_id_nodes;
+    std::vector<uint64_t> track_id_offsets;
+    std::vector<uint64_t> track_ids;
+    reader.read_vector(track_id_nodes);
+    reader.read_vector(track_id_offsets);
+    reader.read_vector(track_ids);
+    if ((track_id_offsets.size() != track_id_nodes.size() + 1)
+        || (track_id_offsets.back() != track_ids.size())) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Device snapshot '%s' is corrupted\n", file_name);
+    }
+    device_ctx.rr_node_track_ids.clear();
+    for (size_t inode = 0; inode < track_id_nodes.size(); ++inode) {
+        if (track_id_offsets[inode] > track_id_offsets[inode + 1]) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Device snapshot '%s' is corrupted\n", file_name);
+        }
+        /* Nodes are sorted in the map, so hint the insertion at the end */
+        device_ctx.rr_node_track_ids.emplace_hint(device_ctx.rr_node_track_ids.end(),
+                                                  track_id_nodes[inode],
+                                                  std::vector<size_t>(track_ids.begin() + track_id_offsets[inode],
+                                                                      track_ids.begin() + track_id_offsets[inode + 1]));
+    }
+
+    size_t num_remapped_arch_switches = reader.read_value<uint64_t>();
+    device_ctx.switch_fanin_remap.clear();
+    device_ctx.switch_fanin_remap.resize(num_remapped_arch_switches);
+    for (std::map<int, int>& fanin_remap : device_ctx.switch_fanin_remap) {
+        std::vector<int32_t> pairs;
+        reader.read_vector(pairs);
+        for (size_t ipair = 0; ipair + 1 < pairs.size(); ipair += 2) {
+            fanin_remap[pairs[ipair]] = pairs[ipair + 1];
+        }
+    }
+
+    if (false == reader.at_end()) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Device snapshot '%s' is corrupted\n", file_name);
+    }
+
+    device_ctx.chan_width = nodes_per_chan;
+
+    /* Essential check for rr_graph, build look-up.
+     * The advanced checks were done when the snapshot was written */
+    if (false == device_ctx.rr_graph.validate()) {
+        vpr_throw(VPR_ERROR_ROUTE,
+                  __FILE__,
+                  __LINE__,
+                  "Fundamental errors occurred when validating rr_graph object from device snapshot '%s'!\n",
+                  file_name);
+    }
+
+    VTR_LOG("Loaded routing resource graph from device snapshot '%s'\n", file_name);
+
+    return true;
+}
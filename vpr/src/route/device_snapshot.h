@@ -0,0 +1,49 @@
+/* Defines the functions used to save the routing resource graph of the device
+ * into a binary snapshot, and to restore it without rebuilding it */
+
+#ifndef DEVICE_SNAPSHOT_H
+#define DEVICE_SNAPSHOT_H
+
+#include <vector>
+#include "device_grid.h"
+#include "rr_graph.h"
+
+/* Write the routing resource graph in the device context, with the data
+ * derived from it (rr switches, indexed data, rc data, channel widths and track ids),
+ * into a binary snapshot file. The inputs of the graph builders are recorded
+ * in the snapshot, as the key it is only valid for */
+void write_device_snapshot(const char* file_name,
+                           const t_graph_type graph_type,
+                           const std::vector<t_physical_tile_type>& block_types,
+                           const DeviceGrid& grid,
+                           const t_det_routing_arch& det_routing_arch,
+                           const std::vector<t_segment_inf>& segment_inf,
+                           const enum e_base_cost_type base_cost_type,
+                           const bool trim_empty_channels,
+                           const bool trim_obs_channels,
+                           const bool wire_opposite_side,
+                           const enum e_clock_modeling clock_modeling,
+                           const t_direct_inf* directs,
+                           const int num_directs);
+
+/* Load the routing resource graph from a binary snapshot file into the device context.
+ * The snapshot is only loaded if it was written for the same architecture file content,
+ * graph builder options, grid, channel widths, Fc, switches, segments and directs.
+ * Otherwise, it is left untouched and false is returned,
+ * so that the routing resource graph can be built as usual */
+bool read_device_snapshot(const char* file_name,
+                          const t_graph_type graph_type,
+                          const std::vector<t_physical_tile_type>& block_types,
+                          const DeviceGrid& grid,
+                          const t_chan_width& nodes_per_chan,
+                          t_det_routing_arch* det_routing_arch,
+                          const std::vector<t_segment_inf>& segment_inf,
+                          const enum e_base_cost_type base_cost_type,
+                          const bool trim_empty_channels,
+                          const bool trim_obs_channels,
+                          const bool wire_opposite_side,
+                          const enum e_clock_modeling clock_modeling,
+                          const t_direct_inf* directs,
+                          const int num_directs);
+
+#endif /* DEVICE_SNAPSHOT_H */
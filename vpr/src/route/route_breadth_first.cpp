@@ -15,7 +15,8 @@
 
 static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost);
 
-static void breadth_first_expand_trace_segment(t_trace* start_ptr,
+static void breadth_first_expand_trace_segment(const t_traceback& traceback,
+                                               size_t start_trace,
                                                int remaining_connections_to_sink,
                                                std::vector<RRNodeId>& modified_rr_node_inf);
 
@@ -127,7 +128,7 @@ bool try_breadth_first_route_net(ClusterNetId net_id, float pres_fac, const t_ro
         is_routed = true;
 
     } else {
-        pathfinder_update_path_cost(route_ctx.trace[net_id].head, -1, pres_fac);
+        pathfinder_update_path_cost(route_ctx.trace[net_id], -1, pres_fac);
         is_routed = breadth_first_route_net(net_id, router_opts.bend_cost);
 
         /* Impossible to route? (disconnected rr_graph) */
@@ -137,7 +138,7 @@ bool try_breadth_first_route_net(ClusterNetId net_id, float pres_fac, const t_ro
             VTR_LOG("Routing failed.\n");
         }
 
-        pathfinder_update_path_cost(route_ctx.trace[net_id].head, 1, pres_fac);
+        pathfinder_update_path_cost(route_ctx.trace[net_id], 1, pres_fac);
     }
     return (is_routed);
 }
@@ -160,7 +161,7 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
     RRNodeId inode;
     float pcost, new_pcost;
     t_heap* current;
-    t_trace* tptr;
+    size_t start_trace;
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
@@ -174,7 +175,7 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
     breadth_first_add_source_to_heap(net_id);
     mark_ends(net_id);
 
-    tptr = nullptr;
+    start_trace = 0; /* No route yet */
     remaining_connections_to_sink = 0;
 
     auto src_pin_id = cluster_ctx.clb_nlist.net_driver(net_id);
@@ -183,7 +184,7 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
 
     for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) { /* Need n-1 wires to connect n pins */
 
-        breadth_first_expand_trace_segment(tptr, remaining_connections_to_sink, modified_rr_node_inf);
+        breadth_first_expand_trace_segment(route_ctx.trace[net_id], start_trace, remaining_connections_to_sink, modified_rr_node_inf);
         current = get_heap_head();
 
         if (current == nullptr) { /* Infeasible routing.  No possible path for net. */
@@ -255,7 +256,7 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
 
         route_ctx.rr_node_route_inf[inode].target_flag--; /* Connected to this SINK. */
         remaining_connections_to_sink = route_ctx.rr_node_route_inf[inode].target_flag;
-        tptr = update_traceback(current, net_id);
+        start_trace = update_traceback(current, net_id);
         free_heap_data(current);
     }
 
@@ -268,12 +269,13 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
     return (true);
 }
 
-static void breadth_first_expand_trace_segment(t_trace* start_ptr,
+static void breadth_first_expand_trace_segment(const t_traceback& traceback,
+                                               size_t start_trace,
                                                int remaining_connections_to_sink,
                                                std::vector<RRNodeId>& modified_rr_node_inf) {
-    /* Adds all the rr_nodes in the traceback segment starting at tptr (and     *
-     * continuing to the end of the traceback) to the heap with a cost of zero. *
-     * This allows expansion to begin from the existing wiring.  The            *
+    /* Adds all the rr_nodes in the traceback segment starting at start_trace   *
+     * (and continuing to the end of the traceback) to the heap with a cost of  *
+     * zero.  This allows expansion to begin from the existing wiring.  The     *
      * remaining_connections_to_sink value is 0 if the route segment ending     *
      * at this location is the last one to connect to the SINK ending the route *
      * segment.  This is the usual case.  If it is not the last connection this *
@@ -287,25 +289,24 @@ static void breadth_first_expand_trace_segment(t_trace* start_ptr,
      * the same logic block, and since the and-inputs are logically-equivalent, *
      * this means two connections to the same SINK.                             */
 
-    t_trace *tptr, *next_ptr;
+    size_t itrace;
     RRNodeId inode, sink_node, last_ipin_node;
 
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    tptr = start_ptr;
-    if (tptr != nullptr && device_ctx.rr_graph.node_type(tptr->index) == SINK) {
+    itrace = start_trace;
+    if (itrace < traceback.size() && device_ctx.rr_graph.node_type(traceback[itrace].index) == SINK) {
         /* During logical equivalence case, only use one opin */
-        tptr = tptr->next;
+        ++itrace;
     }
 
     if (remaining_connections_to_sink == 0) { /* Usual case. */
-        while (tptr != nullptr) {
+        for (; itrace < traceback.size(); ++itrace) {
 #ifdef ROUTER_DEBUG
-            VTR_LOG("  Adding previous routing node %d to heap\n", size_t(tptr->index));
+            VTR_LOG("  Adding previous routing node %d to heap\n", size_t(traceback[itrace].index));
 #endif
-            node_to_heap(tptr->index, 0., RRNodeId::INVALID(), RREdgeId::INVALID(), OPEN, OPEN);
-            tptr = tptr->next;
+            node_to_heap(traceback[itrace].index, 0., RRNodeId::INVALID(), RREdgeId::INVALID(), OPEN, OPEN);
         }
     } else { /* This case never executes for most logic blocks. */
 
@@ -315,28 +316,24 @@ static void breadth_first_expand_trace_segment(t_trace* start_ptr,
          * 0., and expand till you hit the next SINK.  That would be slow, so I      *
          * do some hacks to enable incremental wavefront expansion instead.          */
 
-        if (tptr == nullptr)
+        if (itrace >= traceback.size())
             return; /* No route yet */
 
-        next_ptr = tptr->next;
         last_ipin_node = RRNodeId::INVALID(); /* Stops compiler from complaining. */
 
         /* Can't put last SINK on heap with NO_PREVIOUS, etc, since that won't let  *
          * us reach it again.  Instead, leave the last traceback element (SINK) off *
          * the heap.                                                                */
 
-        while (next_ptr != nullptr) {
-            inode = tptr->index;
+        for (; itrace + 1 < traceback.size(); ++itrace) {
+            inode = traceback[itrace].index;
 #ifdef ROUTER_DEBUG
-            VTR_LOG("  Adding previous routing node %d to heap*\n", size_t(tptr->index));
+            VTR_LOG("  Adding previous routing node %d to heap*\n", size_t(inode));
 #endif
             node_to_heap(inode, 0., RRNodeId::INVALID(), RREdgeId::INVALID(), OPEN, OPEN);
 
             if (device_ctx.rr_graph.node_type(inode) == IPIN)
                 last_ipin_node = inode;
-
-            tptr = next_ptr;
-            next_ptr = tptr->next;
         }
         VTR_ASSERT(true == device_ctx.rr_graph.valid_node_id(last_ipin_node));
 
@@ -352,7 +349,7 @@ static void breadth_first_expand_trace_segment(t_trace* start_ptr,
         /* Also need to mark the SINK as having high cost, so another connection can *
          * be made to it.                                                            */
 
-        sink_node = tptr->index;
+        sink_node = traceback[itrace].index;
         add_to_mod_list(sink_node, modified_rr_node_inf);
         route_ctx.rr_node_route_inf[sink_node].path_cost = HUGE_POSITIVE_FLOAT;
 
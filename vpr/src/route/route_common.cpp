@@ -36,12 +36,6 @@
 #include "timing_info.h"
 #include "tatum/echo_writer.hpp"
 
-/**************** Types local to route_common.c ******************/
-struct t_trace_branch {
-    t_trace* head;
-    t_trace* tail;
-};
-
 /**************** Static variables local to route_common.c ******************/
 
 static t_heap** heap; /* Indexed from [1..heap_size] */
@@ -53,12 +47,6 @@ static t_heap* heap_free_head = nullptr;
 /* For keeping track of the sudo malloc memory for the heap*/
 static vtr::t_chunk heap_ch;
 
-/* For managing my own list of currently free trace data structures.    */
-static t_trace* trace_free_head = nullptr;
-/* For keeping track of the sudo malloc memory for the trace*/
-static vtr::t_chunk trace_ch;
-
-static int num_trace_allocated = 0; /* To watch for memory leaks. */
 static int num_heap_allocated = 0;
 static int num_linked_f_pointer_allocated = 0;
 
@@ -92,9 +80,9 @@ static int num_linked_f_pointer_allocated = 0;
  *                                                                          */
 
 /******************** Subroutines local to route_common.c *******************/
-static t_trace_branch traceback_branch(const RRNodeId& node, std::unordered_set<RRNodeId>& main_branch_visited);
-static std::pair<t_trace*, t_trace*> add_trace_non_configurable(t_trace* head, t_trace* tail, const RRNodeId& node, std::unordered_set<RRNodeId>& visited);
-static std::pair<t_trace*, t_trace*> add_trace_non_configurable_recurr(const RRNodeId& node, std::unordered_set<RRNodeId>& visited, int depth = 0);
+static std::vector<t_trace> traceback_branch(const RRNodeId& node, std::unordered_set<RRNodeId>& main_branch_visited);
+static void add_trace_non_configurable(std::vector<t_trace>& branch, const RRNodeId& node, std::unordered_set<RRNodeId>& visited);
+static void add_trace_non_configurable_recurr(std::vector<t_trace>& branch, const RRNodeId& node, std::unordered_set<RRNodeId>& visited, int depth = 0);
 
 static vtr::vector<ClusterNetId, std::vector<RRNodeId>> load_net_rr_terminals(const RRGraph& rr_graph);
 static vtr::vector<ClusterBlockId, std::vector<RRNodeId>> load_rr_clb_sources(const RRGraph& rr_graph);
@@ -102,45 +90,30 @@ static vtr::vector<ClusterBlockId, std::vector<RRNodeId>> load_rr_clb_sources(co
 static t_clb_opins_used alloc_and_load_clb_opins_used_locally();
 static void adjust_one_rr_occ_and_apcost(const RRNodeId& inode, int add_or_sub, float pres_fac, float acc_fac);
 
-bool validate_traceback_recurr(t_trace* trace, std::set<RRNodeId>& seen_rr_nodes);
-static bool validate_trace_nodes(t_trace* head, const std::unordered_set<RRNodeId>& trace_nodes);
+static bool validate_trace_nodes(const t_traceback& traceback, const std::unordered_set<RRNodeId>& trace_nodes);
 static float get_single_rr_cong_cost(const RRNodeId& inode);
 
 /************************** Subroutine definitions ***************************/
 
-void save_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
+void save_routing(vtr::vector<ClusterNetId, t_traceback>& best_routing,
                   const t_clb_opins_used& clb_opins_used_locally,
                   t_clb_opins_used& saved_clb_opins_used_locally) {
-    /* This routing frees any routing currently held in best routing,       *
-     * then copies over the current routing (held in route_ctx.trace), and       *
-     * finally sets route_ctx.trace_head and route_ctx.trace_tail to all NULLs so that the      *
-     * connection to the saved routing is broken.  This is necessary so     *
-     * that the next iteration of the router does not free the saved        *
-     * routing elements.  Also saves any data about locally used clb_opins, *
-     * since this is also part of the routing.                              */
-
-    t_trace *tptr, *tempptr;
+    /* This routing drops any routing currently held in best routing, then    *
+     * moves over the current routing (held in route_ctx.trace), leaving       *
+     * route_ctx.trace empty.  The storage of the dropped best routing is      *
+     * handed to route_ctx.trace, so the next iteration of the router does not *
+     * allocate it again.  Also saves any data about locally used clb_opins,   *
+     * since this is also part of the routing.                                 */
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        /* Free any previously saved routing.  It is no longer best. */
-        tptr = best_routing[net_id];
-        while (tptr != nullptr) {
-            tempptr = tptr->next;
-            free_trace_data(tptr);
-            tptr = tempptr;
-        }
-
-        /* Save a pointer to the current routing in best_routing. */
-        best_routing[net_id] = route_ctx.trace[net_id].head;
+        /* Save the current routing in best_routing. The previously saved     *
+         * routing is no longer best.                                          */
+        swap(best_routing[net_id], route_ctx.trace[net_id]);
 
-        /* Set the current (working) routing to NULL so the current trace       *
-         * elements won't be reused by the memory allocator.                    */
-
-        route_ctx.trace[net_id].head = nullptr;
-        route_ctx.trace[net_id].tail = nullptr;
+        route_ctx.trace[net_id].clear();
         route_ctx.trace_nodes[net_id].clear();
     }
 
@@ -148,13 +121,11 @@ void save_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
     saved_clb_opins_used_locally = clb_opins_used_locally;
 }
 
-/* Deallocates any current routing in route_ctx.trace_head, and replaces it with    *
- * the routing in best_routing.  Best_routing is set to NULL to show that *
- * it no longer points to a valid routing.  NOTE:  route_ctx.trace_tail is not      *
- * restored -- it is set to all NULLs since it is only used in            *
- * update_traceback.  If you need route_ctx.trace_tail restored, modify this        *
- * routine.  Also restores the locally used opin data.                    */
-void restore_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
+/* Deallocates any current routing in route_ctx.trace, and replaces it with *
+ * the routing in best_routing.  Best_routing is left empty to show that it  *
+ * no longer holds a valid routing.  Also restores the locally used opin     *
+ * data.                                                                     */
+void restore_routing(vtr::vector<ClusterNetId, t_traceback>& best_routing,
                      t_clb_opins_used& clb_opins_used_locally,
                      const t_clb_opins_used& saved_clb_opins_used_locally) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -162,13 +133,13 @@ void restore_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         /* Free any current routing. */
-        pathfinder_update_path_cost(route_ctx.trace[net_id].head, -1, 0.f);
+        pathfinder_update_path_cost(route_ctx.trace[net_id], -1, 0.f);
         free_traceback(net_id);
 
         /* Set the current routing to the saved one. */
-        route_ctx.trace[net_id].head = best_routing[net_id];
-        pathfinder_update_path_cost(route_ctx.trace[net_id].head, 1, 0.f);
-        best_routing[net_id] = nullptr; /* No stored routing. */
+        swap(route_ctx.trace[net_id], best_routing[net_id]);
+        pathfinder_update_path_cost(route_ctx.trace[net_id], 1, 0.f);
+        best_routing[net_id].clear(); /* No stored routing. */
     }
 
     /* Restore which OPINs are locally used.                           */
@@ -181,7 +152,6 @@ void restore_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
 void get_serial_num() {
     int serial_num;
     RRNodeId inode;
-    t_trace* tptr;
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.routing();
@@ -193,9 +163,8 @@ void get_serial_num() {
         /* Global nets will have null trace_heads (never routed) so they *
          * are not included in the serial number calculation.            */
 
-        tptr = route_ctx.trace[net_id].head;
-        while (tptr != nullptr) {
-            inode = tptr->index;
+        for (const t_trace& trace : route_ctx.trace[net_id]) {
+            inode = trace.index;
             serial_num += (size_t(net_id) + 1)
                           * (device_ctx.rr_graph.node_xlow(inode) * (device_ctx.grid.width()) - device_ctx.rr_graph.node_yhigh(inode));
 
@@ -203,7 +172,6 @@ void get_serial_num() {
 
             serial_num -= device_ctx.rr_graph.node_type(inode) * (size_t(net_id) + 1) * 100;
             serial_num %= 2000000000; /* Prevent overflow */
-            tptr = tptr->next;
         }
     }
     VTR_LOG("Serial number (magic cookie) for the routing is: %d\n", serial_num);
@@ -378,46 +346,40 @@ vtr::vector<RRNodeId, std::set<ClusterNetId>> collect_rr_node_nets() {
 
     vtr::vector<RRNodeId, std::set<ClusterNetId>> rr_node_nets(device_ctx.rr_graph.nodes().size());
     for (ClusterNetId inet : cluster_ctx.clb_nlist.nets()) {
-        t_trace* trace_elem = route_ctx.trace[inet].head;
-        while (trace_elem) {
-            const RRNodeId& rr_node = trace_elem->index;
-
-            rr_node_nets[rr_node].insert(inet);
-
-            trace_elem = trace_elem->next;
+        for (const t_trace& trace : route_ctx.trace[inet]) {
+            rr_node_nets[trace.index].insert(inet);
         }
     }
     return rr_node_nets;
 }
 
-void pathfinder_update_path_cost(t_trace* route_segment_start,
+void pathfinder_update_path_cost(const t_traceback& traceback,
+                                 int add_or_sub,
+                                 float pres_fac) {
+    pathfinder_update_path_cost(traceback, 0, add_or_sub, pres_fac);
+}
+
+void pathfinder_update_path_cost(const t_traceback& traceback,
+                                 size_t route_segment_start,
                                  int add_or_sub,
                                  float pres_fac) {
     /* This routine updates the occupancy and pres_cost of the rr_nodes that are *
-     * affected by the portion of the routing of one net that starts at          *
-     * route_segment_start.  If route_segment_start is route_ctx.trace[net_id].head, the     *
-     * cost of all the nodes in the routing of net net_id are updated.  If         *
+     * affected by the portion of the routing of one net that starts at the      *
+     * element route_segment_start of its traceback.  If route_segment_start is  *
+     * 0, the cost of all the nodes in the routing of the net are updated.  If   *
      * add_or_sub is -1 the net (or net portion) is ripped up, if it is 1 the    *
      * net is added to the routing.  The size of pres_fac determines how severly *
      * oversubscribed rr_nodes are penalized.                                    */
 
-    t_trace* tptr;
-
-    tptr = route_segment_start;
-    if (tptr == nullptr) /* No routing yet. */
-        return;
-
-    for (;;) {
-        pathfinder_update_single_node_cost(tptr->index, add_or_sub, pres_fac);
+    size_t itrace = route_segment_start;
+    while (itrace < traceback.size()) {
+        pathfinder_update_single_node_cost(traceback[itrace].index, add_or_sub, pres_fac);
 
-        if (tptr->iswitch == OPEN) { //End of branch
-            tptr = tptr->next;       /* Skip next segment. */
-            if (tptr == nullptr)
-                break;
+        if (traceback[itrace].iswitch == OPEN) { //End of branch
+            ++itrace;                            /* Skip next segment. */
         }
 
-        tptr = tptr->next;
-
+        ++itrace;
     } /* End while loop -- did an entire traceback. */
 }
 
@@ -518,46 +480,43 @@ void init_route_structs(int bb_factor) {
     }
 }
 
-t_trace*
-update_traceback(t_heap* hptr, ClusterNetId net_id) {
+size_t update_traceback(t_heap* hptr, ClusterNetId net_id) {
     /* This routine adds the most recently finished wire segment to the         *
-     * traceback linked list.  The first connection starts with the net SOURCE  *
-     * and begins at the structure pointed to by route_ctx.trace[net_id].head. Each         *
-     * connection ends with a SINK.  After each SINK, the next connection       *
-     * begins (if the net has more than 2 pins).  The first element after the   *
-     * SINK gives the routing node on a previous piece of the routing, which is *
-     * the link from the existing net to this new piece of the net.             *
+     * traceback of the net.  The first connection starts with the net SOURCE   *
+     * at the first element of route_ctx.trace[net_id]. Each connection ends    *
+     * with a SINK.  After each SINK, the next connection begins (if the net    *
+     * has more than 2 pins).  The first element after the SINK gives the       *
+     * routing node on a previous piece of the routing, which is the link from  *
+     * the existing net to this new piece of the net.                           *
      * In each traceback I start at the end of a path and trace back through    *
      * its predecessors to the beginning.  I have stored information on the     *
      * predecesser of each node to make traceback easy -- this sacrificies some *
-     * memory for easier code maintenance.  This routine returns a pointer to   *
+     * memory for easier code maintenance.  This routine returns the index of   *
      * the first "new" node in the traceback (node not previously in trace).    */
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     auto& trace_nodes = route_ctx.trace_nodes[net_id];
+    auto& traceback = route_ctx.trace[net_id];
 
-    VTR_ASSERT_SAFE(validate_trace_nodes(route_ctx.trace[net_id].head, trace_nodes));
+    VTR_ASSERT_SAFE(validate_trace_nodes(traceback, trace_nodes));
 
-    t_trace_branch branch = traceback_branch(hptr->index, trace_nodes);
+    std::vector<t_trace> branch = traceback_branch(hptr->index, trace_nodes);
 
-    VTR_ASSERT_SAFE(validate_trace_nodes(branch.head, trace_nodes));
+    size_t first_new_trace = traceback.size();
+    if (!traceback.empty()) {
+        first_new_trace += 1; /* Skip the branch point on the existing routing */
+    }                         /* Otherwise, this was the first "chunk" of the net's routing */
 
-    t_trace* ret_ptr = nullptr;
-    if (route_ctx.trace[net_id].tail != nullptr) {
-        route_ctx.trace[net_id].tail->next = branch.head; /* Traceback ends with tptr */
-        ret_ptr = branch.head->next;                      /* First new segment.       */
-    } else {                                              /* This was the first "chunk" of the net's routing */
-        route_ctx.trace[net_id].head = branch.head;
-        ret_ptr = branch.head; /* Whole traceback is new. */
-    }
+    traceback.append(branch);
+
+    VTR_ASSERT_SAFE(validate_trace_nodes(traceback, trace_nodes));
 
-    route_ctx.trace[net_id].tail = branch.tail;
-    return (ret_ptr);
+    return first_new_trace;
 }
 
 //Traces back a new routing branch starting from the specified 'node' and working backwards to any existing routing.
 //Returns the new branch, and also updates trace_nodes for any new nodes which are included in the branches traceback.
-static t_trace_branch traceback_branch(const RRNodeId& node, std::unordered_set<RRNodeId>& trace_nodes) {
+static std::vector<t_trace> traceback_branch(const RRNodeId& node, std::unordered_set<RRNodeId>& trace_nodes) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.routing();
 
@@ -570,11 +529,9 @@ static t_trace_branch traceback_branch(const RRNodeId& node, std::unordered_set<
 
     //We construct the main traceback by walking from the given node back to the source,
     //according to the previous edges/nodes recorded in rr_node_route_inf by the router.
-    t_trace* branch_head = alloc_trace_data();
-    t_trace* branch_tail = branch_head;
-    branch_head->index = node;
-    branch_head->iswitch = OPEN;
-    branch_head->next = nullptr;
+    //The elements are collected from the SINK backwards, and reversed once complete.
+    std::vector<t_trace> branch;
+    branch.push_back({node, OPEN});
 
     trace_nodes.insert(node);
 
@@ -585,11 +542,7 @@ static t_trace_branch traceback_branch(const RRNodeId& node, std::unordered_set<
 
     while (inode != RRNodeId::INVALID()) {
         //Add the current node to the head of traceback
-        t_trace* prev_ptr = alloc_trace_data();
-        prev_ptr->index = inode;
-        prev_ptr->iswitch = (short)size_t(device_ctx.rr_graph.edge_switch(iedge));
-        prev_ptr->next = branch_head;
-        branch_head = prev_ptr;
+        branch.push_back({inode, (short)size_t(device_ctx.rr_graph.edge_switch(iedge))});
 
         if (trace_nodes.count(inode)) {
             break; //Connected to existing routing
@@ -602,48 +555,29 @@ static t_trace_branch traceback_branch(const RRNodeId& node, std::unordered_set<
         inode = route_ctx.rr_node_route_inf[inode].prev_node;
     }
 
+    std::reverse(branch.begin(), branch.end());
+
     //We next re-expand all the main-branch nodes to add any non-configurably connected side branches
     // We are careful to do this *after* the main branch is constructed to ensure nodes which are both
     // non-configurably connected *and* part of the main branch are only added to the traceback once.
     for (const RRNodeId& new_node : new_nodes_added_to_traceback) {
         //Expand each main branch node
-        std::tie(branch_head, branch_tail) = add_trace_non_configurable(branch_head, branch_tail, new_node, trace_nodes);
+        add_trace_non_configurable(branch, new_node, trace_nodes);
     }
 
-    return {branch_head, branch_tail};
+    return branch;
 }
 
-//Traces any non-configurable subtrees from branch_head, returning the new branch_head and updating trace_nodes
+//Traces any non-configurable subtrees from node, appending them to the branch and updating trace_nodes
 //
 //This effectively does a depth-first traversal
-static std::pair<t_trace*, t_trace*> add_trace_non_configurable(t_trace* head, t_trace* tail, const RRNodeId& node, std::unordered_set<RRNodeId>& trace_nodes) {
+static void add_trace_non_configurable(std::vector<t_trace>& branch, const RRNodeId& node, std::unordered_set<RRNodeId>& trace_nodes) {
     //Trace any non-configurable subtrees
-    t_trace* subtree_head = nullptr;
-    t_trace* subtree_tail = nullptr;
-    std::tie(subtree_head, subtree_tail) = add_trace_non_configurable_recurr(node, trace_nodes);
-
-    //Add any non-empty subtree to tail of traceback
-    if (subtree_head && subtree_tail) {
-        if (!head) { //First subtree becomes head
-            head = subtree_head;
-        } else { //Later subtrees added to tail
-            VTR_ASSERT(tail);
-            tail->next = subtree_head;
-        }
-
-        tail = subtree_tail;
-    } else {
-        VTR_ASSERT(subtree_head == nullptr && subtree_tail == nullptr);
-    }
-
-    return {head, tail};
+    add_trace_non_configurable_recurr(branch, node, trace_nodes);
 }
 
 //Recursive helper function for add_trace_non_configurable()
-static std::pair<t_trace*, t_trace*> add_trace_non_configurable_recurr(const RRNodeId& node, std::unordered_set<RRNodeId>& trace_nodes, int depth) {
-    t_trace* head = nullptr;
-    t_trace* tail = nullptr;
-
+static void add_trace_non_configurable_recurr(std::vector<t_trace>& branch, const RRNodeId& node, std::unordered_set<RRNodeId>& trace_nodes, int depth) {
     //Record the non-configurable out-going edges
     std::vector<RREdgeId> unvisited_non_configurable_edges;
     auto& device_ctx = g_vpr_ctx.device();
@@ -661,11 +595,7 @@ static std::pair<t_trace*, t_trace*> add_trace_non_configurable_recurr(const RRN
         //Base case: leaf node with no non-configurable edges
         if (depth > 0) { //Arrived via non-configurable edge
             VTR_ASSERT(!trace_nodes.count(node));
-            head = alloc_trace_data();
-            head->index = node;
-            head->iswitch = -1;
-            head->next = nullptr;
-            tail = head;
+            branch.push_back({node, -1});
 
             trace_nodes.insert(node);
         }
@@ -679,37 +609,19 @@ static std::pair<t_trace*, t_trace*> add_trace_non_configurable_recurr(const RRN
             VTR_ASSERT(!trace_nodes.count(to_node));
             trace_nodes.insert(node);
 
+            //Duplicate the original head as the start of the new branch
+            size_t intermediate_index = branch.size();
+            branch.push_back({node, (short)iswitch});
+
             //Recurse
-            t_trace* subtree_head = nullptr;
-            t_trace* subtree_tail = nullptr;
-            std::tie(subtree_head, subtree_tail) = add_trace_non_configurable_recurr(to_node, trace_nodes, depth + 1);
-
-            if (subtree_head && subtree_tail) {
-                //Add the non-empty sub-tree
-
-                //Duplicate the original head as the new tail (for the new branch)
-                t_trace* intermediate_head = alloc_trace_data();
-                intermediate_head->index = node;
-                intermediate_head->iswitch = iswitch;
-                intermediate_head->next = nullptr;
-
-                intermediate_head->next = subtree_head;
-
-                if (!head) { //First subtree becomes head
-                    head = intermediate_head;
-                } else { //Later subtrees added to tail
-                    VTR_ASSERT(tail);
-                    tail->next = intermediate_head;
-                }
+            add_trace_non_configurable_recurr(branch, to_node, trace_nodes, depth + 1);
 
-                tail = subtree_tail;
-            } else {
-                VTR_ASSERT(subtree_head == nullptr && subtree_tail == nullptr);
+            if (branch.size() == intermediate_index + 1) {
+                //Empty sub-tree: drop the duplicated head again
+                branch.pop_back();
             }
         }
     }
-
-    return {head, tail};
 }
 
 /* The routine sets the path_cost to HUGE_POSITIVE_FLOAT for  *
@@ -813,26 +725,18 @@ void drop_traceback_tail(ClusterNetId net_id) {
      * network root. */
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    auto* tail_ptr = route_ctx.trace[net_id].tail;
-    auto node = tail_ptr->index;
-    route_ctx.trace_nodes[net_id].erase(node);
-    auto* trace_ptr = route_ctx.trace[net_id].head;
-    while (trace_ptr != nullptr) {
-        t_trace* next_ptr = trace_ptr->next;
-        if (next_ptr == tail_ptr) {
-            trace_ptr->iswitch = tail_ptr->iswitch;
-            trace_ptr->next = nullptr;
-            route_ctx.trace[net_id].tail = trace_ptr;
-            break;
-        }
-        trace_ptr = next_ptr;
-    }
-    free_trace_data(tail_ptr);
+    auto& traceback = route_ctx.trace[net_id];
+    VTR_ASSERT(traceback.size() > 1);
+
+    t_trace tail = traceback.back();
+    route_ctx.trace_nodes[net_id].erase(tail.index);
+    traceback.pop_back();
+    traceback.back().iswitch = tail.iswitch;
 }
 
 void free_traceback(ClusterNetId net_id) {
-    /* Puts the entire traceback (old routing) for this net on the free list *
-     * and sets the route_ctx.trace_head pointers etc. for the net to NULL.            */
+    /* Drops the entire traceback (old routing) for this net, keeping its     *
+     * storage for the next routing of the net.                               */
 
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
@@ -840,31 +744,16 @@ void free_traceback(ClusterNetId net_id) {
         return;
     }
 
-    if (route_ctx.trace[net_id].head == nullptr) {
-        return;
-    }
-
-    free_traceback(route_ctx.trace[net_id].head);
-
-    route_ctx.trace[net_id].head = nullptr;
-    route_ctx.trace[net_id].tail = nullptr;
+    route_ctx.trace[net_id].clear();
     route_ctx.trace_nodes[net_id].clear();
 }
 
-void free_traceback(t_trace* tptr) {
-    while (tptr != nullptr) {
-        t_trace* tempptr = tptr->next;
-        free_trace_data(tptr);
-        tptr = tempptr;
-    }
-}
-
 /* Allocates data structures into which the key routing data can be saved,   *
  * allowing the routing to be recovered later (e.g. after a another routing  *
  * is attempted).                                                            */
-vtr::vector<ClusterNetId, t_trace*> alloc_saved_routing() {
+vtr::vector<ClusterNetId, t_traceback> alloc_saved_routing() {
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    vtr::vector<ClusterNetId, t_trace*> best_routing(cluster_ctx.clb_nlist.nets().size());
+    vtr::vector<ClusterNetId, t_traceback> best_routing(cluster_ctx.clb_nlist.nets().size());
 
     return (best_routing);
 }
@@ -944,13 +833,6 @@ void free_trace_structs() {
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         free_traceback(net_id);
-
-        if (route_ctx.trace[net_id].head) {
-            free(route_ctx.trace[net_id].head);
-            free(route_ctx.trace[net_id].tail);
-        }
-        route_ctx.trace[net_id].head = nullptr;
-        route_ctx.trace[net_id].tail = nullptr;
     }
 }
 
@@ -992,14 +874,8 @@ void free_route_structs() {
 }
 
 /* Frees the data structures needed to save a routing.                     */
-void free_saved_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing) {
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        if (best_routing[net_id] != nullptr) {
-            free(best_routing[net_id]);
-            best_routing[net_id] = nullptr;
-        }
-    }
+void free_saved_routing(vtr::vector<ClusterNetId, t_traceback>& best_routing) {
+    best_routing.clear();
 }
 
 void alloc_and_load_rr_node_route_structs() {
@@ -1430,35 +1306,12 @@ void invalidate_heap_entries(const RRNodeId& sink_node, const RRNodeId& ipin_nod
     }
 }
 
-t_trace*
-alloc_trace_data() {
-    t_trace* temp_ptr;
-
-    if (trace_free_head == nullptr) { /* No elements on the free list */
-        trace_free_head = (t_trace*)vtr::chunk_malloc(sizeof(t_trace), &trace_ch);
-        trace_free_head->next = nullptr;
-    }
-    temp_ptr = trace_free_head;
-    trace_free_head = trace_free_head->next;
-    num_trace_allocated++;
-    return (temp_ptr);
-}
-
-void free_trace_data(t_trace* tptr) {
-    /* Puts the traceback structure pointed to by tptr on the free list. */
-
-    tptr->next = trace_free_head;
-    trace_free_head = tptr;
-    num_trace_allocated--;
-}
-
 void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& tracebacks) {
     if (tracebacks.empty()) return; //Only if routing exists
 
     auto& place_ctx = g_vpr_ctx.placement();
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
@@ -1466,10 +1319,8 @@ void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& traceba
             if (cluster_ctx.clb_nlist.net_sinks(net_id).size() == false) {
                 fprintf(fp, "\n\nUsed in local cluster only, reserved one CLB pin\n\n");
             } else {
-                t_trace* tptr = route_ctx.trace[net_id].head;
-
-                while (tptr != nullptr) {
-                    RRNodeId inode = tptr->index;
+                for (const t_trace& trace : tracebacks[net_id]) {
+                    RRNodeId inode = trace.index;
                     t_rr_type rr_type = device_ctx.rr_graph.node_type(inode);
                     int ilow = device_ctx.rr_graph.node_xlow(inode);
                     int jlow = device_ctx.rr_graph.node_ylow(inode);
@@ -1552,11 +1403,9 @@ void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& traceba
 
                     /* Uncomment line below if you're debugging and want to see the switch types *
                      * used in the routing.                                                      */
-                    fprintf(fp, "Switch: %d", tptr->iswitch);
+                    fprintf(fp, "Switch: %d", trace.iswitch);
 
                     fprintf(fp, "\n");
-
-                    tptr = tptr->next;
                 }
             }
         } else { /* Global net.  Never routed. */
@@ -1599,8 +1448,8 @@ void print_route(const char* placement_file, const char* route_file) {
 
     if (getEchoEnabled() && isEchoFileEnabled(E_ECHO_MEM)) {
         fp = vtr::fopen(getEchoFileName(E_ECHO_MEM), "w");
-        fprintf(fp, "\nNum_heap_allocated: %d   Num_trace_allocated: %d\n",
-                num_heap_allocated, num_trace_allocated);
+        fprintf(fp, "\nNum_heap_allocated: %d\n",
+                num_heap_allocated);
         fprintf(fp, "Num_linked_f_pointer_allocated: %d\n",
                 num_linked_f_pointer_allocated);
         fclose(fp);
@@ -1717,43 +1566,33 @@ static void adjust_one_rr_occ_and_apcost(const RRNodeId& inode, int add_or_sub,
     }
 }
 
-void free_chunk_memory_trace() {
-    if (trace_ch.chunk_ptr_head != nullptr) {
-        free_chunk_memory(&trace_ch);
-        trace_ch.chunk_ptr_head = nullptr;
-        trace_free_head = nullptr;
-    }
-}
-
 // connection based overhaul (more specificity than nets)
 // utility and debugging functions -----------------------
 void print_traceback(ClusterNetId net_id) {
-    // linearly print linked list
+    // linearly print the traceback
     auto& route_ctx = g_vpr_ctx.routing();
     auto& device_ctx = g_vpr_ctx.device();
 
     VTR_LOG("traceback %zu: ", size_t(net_id));
-    t_trace* head = route_ctx.trace[net_id].head;
-    while (head) {
-        RRNodeId inode{head->index};
+    for (const t_trace& trace : route_ctx.trace[net_id]) {
+        RRNodeId inode{trace.index};
         if (device_ctx.rr_graph.node_type(inode) == SINK)
             VTR_LOG("%ld(sink)(%d)->", size_t(inode), route_ctx.rr_node_route_inf[inode].occ());
         else
             VTR_LOG("%ld(%d)->", size_t(inode), route_ctx.rr_node_route_inf[inode].occ());
-        head = head->next;
     }
     VTR_LOG("\n");
 }
 
-void print_traceback(const t_trace* trace) {
+void print_traceback(const t_traceback& traceback) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.routing();
     const t_trace* prev = nullptr;
-    while (trace) {
-        RRNodeId inode = trace->index;
+    for (const t_trace& trace : traceback) {
+        RRNodeId inode = trace.index;
         VTR_LOG("%ld (%s)", size_t(inode), rr_node_typename[device_ctx.rr_graph.node_type(inode)]);
 
-        if (trace->iswitch == OPEN) {
+        if (trace.iswitch == OPEN) {
             VTR_LOG(" !"); //End of branch
         }
 
@@ -1765,72 +1604,59 @@ void print_traceback(const t_trace* trace) {
             VTR_LOG(" x"); //Overused
         }
         VTR_LOG("\n");
-        prev = trace;
-        trace = trace->next;
+        prev = &trace;
     }
     VTR_LOG("\n");
 }
 
-bool validate_traceback(t_trace* trace) {
+bool validate_traceback(const t_traceback& traceback) {
     std::set<RRNodeId> seen_rr_nodes;
 
-    return validate_traceback_recurr(trace, seen_rr_nodes);
-}
-
-bool validate_traceback_recurr(t_trace* trace, std::set<RRNodeId>& seen_rr_nodes) {
-    if (!trace) {
-        return true;
-    }
+    auto& device_ctx = g_vpr_ctx.device();
 
-    seen_rr_nodes.insert(trace->index);
+    for (size_t itrace = 0; itrace < traceback.size(); ++itrace) {
+        const t_trace& trace = traceback[itrace];
+        seen_rr_nodes.insert(trace.index);
 
-    t_trace* next = trace->next;
+        if (itrace + 1 == traceback.size()) {
+            break; //End of traceback
+        }
+        const t_trace& next = traceback[itrace + 1];
 
-    if (next) {
-        if (trace->iswitch == OPEN) { //End of a branch
+        if (trace.iswitch == OPEN) { //End of a branch
 
             //Verify that the next element (branch point) has been already seen in the traceback so far
-            if (!seen_rr_nodes.count(next->index)) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Traceback branch point %ld not found", size_t(next->index));
-            } else {
-                //Recurse along the new branch
-                return validate_traceback_recurr(next, seen_rr_nodes);
+            if (!seen_rr_nodes.count(next.index)) {
+                VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Traceback branch point %ld not found", size_t(next.index));
             }
         } else { //Midway along branch
 
             //Check there is an edge connecting trace and next
-
-            auto& device_ctx = g_vpr_ctx.device();
-
             bool found = false;
-            for (const RREdgeId& iedge : device_ctx.rr_graph.node_out_edges(trace->index)) {
+            for (const RREdgeId& iedge : device_ctx.rr_graph.node_out_edges(trace.index)) {
                 RRNodeId to_node = device_ctx.rr_graph.edge_sink_node(iedge);
 
-                if (to_node == next->index) {
+                if (to_node == next.index) {
                     found = true;
 
                     //Verify that the switch matches
                     int rr_iswitch = (int)size_t(device_ctx.rr_graph.edge_switch(iedge));
-                    if (trace->iswitch != rr_iswitch) {
+                    if (trace.iswitch != rr_iswitch) {
                         VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Traceback mismatched switch type: traceback %d rr_graph %d (RR nodes %ld -> %ld)\n",
-                                        trace->iswitch, rr_iswitch,
-                                        size_t(trace->index), size_t(to_node));
+                                        trace.iswitch, rr_iswitch,
+                                        size_t(trace.index), size_t(to_node));
                     }
                     break;
                 }
             }
 
             if (!found) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Traceback no RR edge between RR nodes %ld -> %ld\n", size_t(trace->index), size_t(next->index));
+                VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Traceback no RR edge between RR nodes %ld -> %ld\n", size_t(trace.index), size_t(next.index));
             }
-
-            //Recurse
-            return validate_traceback_recurr(next, seen_rr_nodes);
         }
     }
 
-    VTR_ASSERT(!next);
-    return true; //End of traceback
+    return true;
 }
 
 //Print information about an invalid routing, caused by overused routing resources
@@ -1843,11 +1669,8 @@ void print_invalid_routing_info() {
     std::multimap<RRNodeId, ClusterNetId> rr_node_nets;
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        t_trace* tptr = route_ctx.trace[net_id].head;
-
-        while (tptr != nullptr) {
-            rr_node_nets.emplace(tptr->index, net_id);
-            tptr = tptr->next;
+        for (const t_trace& trace : route_ctx.trace[net_id]) {
+            rr_node_nets.emplace(trace.index, net_id);
         }
     }
 
@@ -1921,17 +1744,13 @@ void print_rr_node_route_inf_dot() {
     VTR_LOG("}\n");
 }
 
-static bool validate_trace_nodes(t_trace* head, const std::unordered_set<RRNodeId>& trace_nodes) {
-    //Verifies that all nodes in the traceback 'head' are conatined in 'trace_nodes'
-
-    if (!head) {
-        return true;
-    }
+static bool validate_trace_nodes(const t_traceback& traceback, const std::unordered_set<RRNodeId>& trace_nodes) {
+    //Verifies that all nodes in the traceback are conatined in 'trace_nodes'
 
     std::vector<RRNodeId> missing_from_trace_nodes;
-    for (t_trace* tptr = head; tptr != nullptr; tptr = tptr->next) {
-        if (!trace_nodes.count(tptr->index)) {
-            missing_from_trace_nodes.push_back(tptr->index);
+    for (const t_trace& trace : traceback) {
+        if (!trace_nodes.count(trace.index)) {
+            missing_from_trace_nodes.push_back(trace.index);
         }
     }
 
@@ -4,6 +4,7 @@
 #include "clustered_netlist.h"
 #include "vtr_vector.h"
 #include "rr_graph_obj.h"
+#include "route_traceback.h"
 
 /* Used by the heap as its fundamental data structure.
  * Each heap element represents a partial route.
@@ -64,14 +65,18 @@ vtr::vector<ClusterNetId, t_bb> load_route_bb(int bb_factor);
 
 t_bb load_net_route_bb(ClusterNetId net_id, int bb_factor);
 
-void pathfinder_update_path_cost(t_trace* route_segment_start,
+void pathfinder_update_path_cost(const t_traceback& traceback,
+                                 int add_or_sub,
+                                 float pres_fac);
+void pathfinder_update_path_cost(const t_traceback& traceback,
+                                 size_t route_segment_start,
                                  int add_or_sub,
                                  float pres_fac);
 void pathfinder_update_single_node_cost(const RRNodeId& inode, int add_or_sub, float pres_fac);
 
 void pathfinder_update_cost(float pres_fac, float acc_fac);
 
-t_trace* update_traceback(t_heap* hptr, ClusterNetId net_id);
+size_t update_traceback(t_heap* hptr, ClusterNetId net_id);
 
 void reset_path_costs(const std::vector<RRNodeId>& visited_rr_nodes);
 
@@ -88,7 +93,6 @@ bool is_empty_heap();
 
 void free_traceback(ClusterNetId net_id);
 void drop_traceback_tail(ClusterNetId net_id);
-void free_traceback(t_trace* tptr);
 
 void add_to_mod_list(const RRNodeId& inode, std::vector<RRNodeId>& modified_rr_node_inf);
 
@@ -123,17 +127,12 @@ void free_trace_structs();
 void init_heap(const DeviceGrid& grid);
 void reserve_locally_used_opins(float pres_fac, float acc_fac, bool rip_up_local_opins);
 
-void free_chunk_memory_trace();
-
-bool validate_traceback(t_trace* trace);
+bool validate_traceback(const t_traceback& traceback);
 void print_traceback(ClusterNetId net_id);
-void print_traceback(const t_trace* trace);
+void print_traceback(const t_traceback& traceback);
 
 void print_rr_node_route_inf();
 void print_rr_node_route_inf_dot();
 void print_invalid_routing_info();
 
-t_trace* alloc_trace_data();
-void free_trace_data(t_trace* trace);
-
 bool router_needs_lookahead(enum e_router_algorithm router_algorithm);
@@ -278,6 +278,7 @@ static OveruseInfo calculate_overuse_info();
 static void print_route_status_header();
 static void print_route_status(int itry,
                                double elapsed_sec,
+                               double sta_elapsed_sec,
                                float pres_fac,
                                int num_bb_updated,
                                const RouterStats& router_stats,
@@ -291,7 +292,7 @@ static std::string describe_unrouteable_connection(const RRNodeId& source_node,
 static bool is_high_fanout(int fanout, int fanout_threshold);
 
 static size_t dynamic_update_bounding_boxes(const std::vector<ClusterNetId>& nets, int high_fanout_threshold);
-static t_bb calc_current_bb(const t_trace* head);
+static t_bb calc_current_bb(const t_traceback& traceback);
 
 static bool is_better_quality_routing(const vtr::vector<ClusterNetId, t_traceback>& best_routing,
                                       const RoutingMetrics& best_routing_metrics,
@@ -425,6 +426,9 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         RouterStats router_iteration_stats;
         std::vector<ClusterNetId> rerouted_nets;
 
+        /* Route trees only live while a net is routed, so start each iteration with a fresh arena */
+        reset_route_tree_arena();
+
         /* Reset "is_routed" and "is_fixed" flags to indicate nets not pre-routed (yet) */
         for (auto net_id : cluster_ctx.clb_nlist.nets()) {
             route_ctx.net_status[net_id].is_routed = false;
@@ -491,10 +495,13 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         wirelength_info = calculate_wirelength_info(available_wirelength);
         routing_predictor.add_iteration_overuse(itry, overuse_info.overused_nodes());
 
+        double sta_elapsed_time = 0.;
         if (timing_info) {
             //Update timing based on the new routing
             //Note that the net delays have already been updated by timing_driven_route_net
+            double prev_sta_cumm_time = g_vpr_ctx.timing().stats.timing_analysis_wallclock_time();
             timing_info->update();
+            sta_elapsed_time = g_vpr_ctx.timing().stats.timing_analysis_wallclock_time() - prev_sta_cumm_time;
             timing_info->set_warn_unconstrained(false); //Don't warn again about unconstrained nodes again during routing
 
             critical_path = timing_info->least_slack_critical_path();
@@ -510,7 +517,7 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         float iter_elapsed_time = iter_cumm_time - prev_iter_cumm_time;
 
         //Output progress
-        print_route_status(itry, iter_elapsed_time, pres_fac, num_net_bounding_boxes_updated, router_iteration_stats, overuse_info, wirelength_info, timing_info, est_success_iteration);
+        print_route_status(itry, iter_elapsed_time, sta_elapsed_time, pres_fac, num_net_bounding_boxes_updated, router_iteration_stats, overuse_info, wirelength_info, timing_info, est_success_iteration);
 
         prev_iter_cumm_time = iter_cumm_time;
 
@@ -744,8 +751,8 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
 
         /* Restore congestion from best route */
         for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-            pathfinder_update_path_cost(route_ctx.trace[net_id].head, -1, pres_fac);
-            pathfinder_update_path_cost(best_routing[net_id].head, 1, pres_fac);
+            pathfinder_update_path_cost(route_ctx.trace[net_id], -1, pres_fac);
+            pathfinder_update_path_cost(best_routing[net_id], 1, pres_fac);
         }
         router_ctx.trace = best_routing;
         router_ctx.clb_opins_used_locally = best_clb_opins_used_locally;
@@ -1104,7 +1111,7 @@ static bool timing_driven_pre_route_to_clock_root(
 
     profiling::sink_criticality_start();
 
-    VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id].head, rt_root));
+    VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id], rt_root));
 
     t_heap* cheapest = nullptr;
     t_bb bounding_box = route_ctx.route_bb[net_id];
@@ -1147,17 +1154,17 @@ static bool timing_driven_pre_route_to_clock_root(
      * lets me reuse all the routines written for breadth-first routing, which  *
      * all take a traceback structure as input.                                 */
 
-    t_trace* new_route_start_tptr = update_traceback(cheapest, net_id);
-    VTR_ASSERT_DEBUG(validate_traceback(route_ctx.trace[net_id].head));
+    size_t new_route_start = update_traceback(cheapest, net_id);
+    VTR_ASSERT_DEBUG(validate_traceback(route_ctx.trace[net_id]));
     update_route_tree(cheapest, ((high_fanout) ? &spatial_rt_lookup : nullptr));
     VTR_ASSERT_DEBUG(verify_route_tree(rt_root));
-    VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id].head, rt_root));
+    VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id], rt_root));
     VTR_ASSERT_DEBUG(!high_fanout || validate_route_tree_spatial_lookup(rt_root, spatial_rt_lookup));
     if (f_router_debug) {
         update_screen(ScreenUpdatePriority::MAJOR, "Routed connection successfully", ROUTING, nullptr);
     }
     free_heap_data(cheapest);
-    pathfinder_update_path_cost(new_route_start_tptr, 1, pres_fac);
+    pathfinder_update_path_cost(route_ctx.trace[net_id], new_route_start, 1, pres_fac);
     empty_heap();
 
     // need to guarentee ALL nodes' path costs are HUGE_POSITIVE_FLOAT at the start of routing to a sink
@@ -1169,11 +1176,11 @@ static bool timing_driven_pre_route_to_clock_root(
     // - fix routing for all nodes leading to the sink
     // - free up vitual sink occupancy
     disable_expansion_and_remove_sink_from_route_tree_nodes(rt_root);
-    VTR_LOGV_DEBUG(f_router_debug, "Traceback tail before update %d \n",
-                   route_ctx.trace[net_id].tail->index);
+    VTR_LOGV_DEBUG(f_router_debug, "Traceback tail before update %ld \n",
+                   size_t(route_ctx.trace[net_id].back().index));
     drop_traceback_tail(net_id);
-    VTR_LOGV_DEBUG(f_router_debug, "Updated traceback ptrs: %d %d \n",
-                   route_ctx.trace[net_id].head->index, route_ctx.trace[net_id].tail->index);
+    VTR_LOGV_DEBUG(f_router_debug, "Updated traceback ends: %ld %ld \n",
+                   size_t(route_ctx.trace[net_id].front().index), size_t(route_ctx.trace[net_id].back().index));
     m_route_ctx.rr_node_route_inf[sink_node].set_occ(0);
 
     // routed to a sink successfully
@@ -1202,7 +1209,7 @@ static bool timing_driven_route_sink(ClusterNetId net_id,
 
     VTR_LOGV_DEBUG(f_router_debug, "Net %zu Target %d (%s)\n", size_t(net_id), itarget, describe_rr_node(sink_node).c_str());
 
-    VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id].head, rt_root));
+    VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id], rt_root));
 
     std::vector<RRNodeId> modified_rr_node_inf;
     t_heap* cheapest = nullptr;
@@ -1267,18 +1274,18 @@ static bool timing_driven_route_sink(ClusterNetId net_id,
 
     RRNodeId inode = cheapest->index;
     route_ctx.rr_node_route_inf[inode].target_flag--; /* Connected to this SINK. */
-    t_trace* new_route_start_tptr = update_traceback(cheapest, net_id);
-    VTR_ASSERT_DEBUG(validate_traceback(route_ctx.trace[net_id].head));
+    size_t new_route_start = update_traceback(cheapest, net_id);
+    VTR_ASSERT_DEBUG(validate_traceback(route_ctx.trace[net_id]));
 
     rt_node_of_sink[target_pin] = update_route_tree(cheapest, ((high_fanout) ? &spatial_rt_lookup : nullptr));
     VTR_ASSERT_DEBUG(verify_route_tree(rt_root));
-    VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id].head, rt_root));
+    VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id], rt_root));
     VTR_ASSERT_DEBUG(!high_fanout || validate_route_tree_spatial_lookup(rt_root, spatial_rt_lookup));
     if (f_router_debug) {
         update_screen(ScreenUpdatePriority::MAJOR, "Routed connection successfully", ROUTING, nullptr);
     }
     free_heap_data(cheapest);
-    pathfinder_update_path_cost(new_route_start_tptr, 1, pres_fac);
+    pathfinder_update_path_cost(route_ctx.trace[net_id], new_route_start, 1, pres_fac);
     empty_heap();
 
     // need to guarentee ALL nodes' path costs are HUGE_POSITIVE_FLOAT at the start of routing to a sink
@@ -1665,7 +1672,7 @@ static t_rt_node* setup_routing_resources(int itry,
         profiling::net_rerouted();
 
         // rip up the whole net
-        pathfinder_update_path_cost(route_ctx.trace[net_id].head, -1, pres_fac);
+        pathfinder_update_path_cost(route_ctx.trace[net_id], -1, pres_fac);
         free_traceback(net_id);
 
         rt_root = init_route_tree_to_source(net_id);
@@ -1688,7 +1695,7 @@ static t_rt_node* setup_routing_resources(int itry,
         rt_root = traceback_to_route_tree(net_id);
 
         //Santiy check that route tree and traceback are equivalent before pruning
-        VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id].head, rt_root));
+        VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id], rt_root));
 
         // check for edge correctness
         VTR_ASSERT_SAFE(is_valid_skeleton_tree(rt_root));
@@ -1700,7 +1707,7 @@ static t_rt_node* setup_routing_resources(int itry,
         //Now that the tree has been pruned, we can free the old traceback
         // NOTE: this must happen *after* pruning since it changes the
         //       recorded congestion
-        pathfinder_update_path_cost(route_ctx.trace[net_id].head, -1, pres_fac);
+        pathfinder_update_path_cost(route_ctx.trace[net_id], -1, pres_fac);
         free_traceback(net_id);
 
         if (rt_root) { //Partially pruned
@@ -1711,13 +1718,13 @@ static t_rt_node* setup_routing_resources(int itry,
             traceback_from_route_tree(net_id, rt_root, reached_rt_sinks.size());
 
             //Sanity check the traceback for self-consistency
-            VTR_ASSERT_DEBUG(validate_traceback(route_ctx.trace[net_id].head));
+            VTR_ASSERT_DEBUG(validate_traceback(route_ctx.trace[net_id]));
 
             //Santiy check that route tree and traceback are equivalent after pruning
-            VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id].head, rt_root));
+            VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id], rt_root));
 
             // put the updated costs of the route tree nodes back into pathfinder
-            pathfinder_update_path_cost(route_ctx.trace[net_id].head, 1, pres_fac);
+            pathfinder_update_path_cost(route_ctx.trace[net_id], 1, pres_fac);
 
         } else { //Fully destroyed
             profiling::route_tree_pruned();
@@ -1728,8 +1735,7 @@ static t_rt_node* setup_routing_resources(int itry,
             //NOTE: We leave the traceback uninitiailized, so update_traceback()
             //      will correctly add the SOURCE node when the branch to
             //      the first SINK is found.
-            VTR_ASSERT(route_ctx.trace[net_id].head == nullptr);
-            VTR_ASSERT(route_ctx.trace[net_id].tail == nullptr);
+            VTR_ASSERT(route_ctx.trace[net_id].empty());
             VTR_ASSERT(route_ctx.trace_nodes[net_id].empty());
         }
 
@@ -1783,9 +1789,7 @@ void disable_expansion_and_remove_sink_from_route_tree_nodes(t_rt_node* rt_node)
         if (device_ctx.rr_graph.node_type(child_node->inode) == SINK) {
             VTR_LOGV_DEBUG(f_router_debug,
                            "Removing sink %ld from route tree\n", size_t(child_node->inode));
-            rt_node->u.child_list = nullptr;
-            rt_node->u.next = nullptr;
-            free(child_node);
+            release_route_tree_children(rt_node);
             break;
         } else {
             rt_node->re_expand = false;
@@ -2307,15 +2311,15 @@ static bool should_route_net(ClusterNetId net_id, CBRR& connections_inf, bool if
     auto& route_ctx = g_vpr_ctx.routing();
     auto& device_ctx = g_vpr_ctx.device();
 
-    t_trace* tptr = route_ctx.trace[net_id].head;
+    const t_traceback& traceback = route_ctx.trace[net_id];
 
-    if (tptr == nullptr) {
+    if (traceback.empty()) {
         /* No routing yet. */
         return true;
     }
 
-    for (;;) {
-        RRNodeId inode = tptr->index;
+    for (size_t itrace = 0; itrace < traceback.size(); ++itrace) {
+        RRNodeId inode = traceback[itrace].index;
         int occ = route_ctx.rr_node_route_inf[inode].occ();
         int capacity = device_ctx.rr_graph.node_capacity(inode);
 
@@ -2323,7 +2327,7 @@ static bool should_route_net(ClusterNetId net_id, CBRR& connections_inf, bool if
             return true; /* overuse detected */
         }
 
-        if (tptr->iswitch == OPEN) { //End of a branch
+        if (traceback[itrace].iswitch == OPEN) { //End of a branch
             // even if net is fully routed, not complete if parts of it should get ripped up (EXPERIMENTAL)
             if (if_force_reroute) {
                 /* Xifan Tang - TODO: should use RRNodeId */ 
@@ -2331,14 +2335,10 @@ static bool should_route_net(ClusterNetId net_id, CBRR& connections_inf, bool if
                     return true;
                 }
             }
-            tptr = tptr->next; /* Skip next segment (duplicate of original branch node). */
-            if (tptr == nullptr)
-                break;
+            ++itrace; /* Skip next segment (duplicate of original branch node). */
         }
 
-        tptr = tptr->next;
-
-    } /* End while loop -- did an entire traceback. */
+    } /* End for loop -- did an entire traceback. */
 
     VTR_ASSERT(connections_inf.get_remaining_targets().empty());
 
@@ -2580,8 +2580,8 @@ static OveruseInfo calculate_overuse_info() {
     //should be more efficient (since usually only a portion of the RR graph is
     //used by routing, particularly on large devices).
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        for (t_trace* tptr = route_ctx.trace[net_id].head; tptr != nullptr; tptr = tptr->next) {
-            RRNodeId inode = tptr->index;
+        for (const t_trace& trace : route_ctx.trace[net_id]) {
+            RRNodeId inode = trace.index;
 
             auto result = checked_nodes.insert(inode);
             if (!result.second) { //Already counted
@@ -2636,19 +2636,26 @@ static WirelengthInfo calculate_wirelength_info(size_t available_wirelength) {
 }
 
 static void print_route_status_header() {
-    VTR_LOG("---- ------ ------- ---- ------- ------- ------- ----------------- --------------- -------- ---------- ---------- ---------- ---------- --------\n");
-    VTR_LOG("Iter   Time    pres  BBs    Heap  Re-Rtd  Re-Rtd Overused RR Nodes      Wirelength      CPD       sTNS       sWNS       hTNS       hWNS Est Succ\n");
-    VTR_LOG("      (sec)     fac Updt    push    Nets   Conns                                       (ns)       (ns)       (ns)       (ns)       (ns)     Iter\n");
-    VTR_LOG("---- ------ ------- ---- ------- ------- ------- ----------------- --------------- -------- ---------- ---------- ---------- ---------- --------\n");
+    VTR_LOG("---- ------ ------ ------- ---- ------- ------- ------- ----------------- --------------- -------- ---------- ---------- ---------- ---------- --------\n");
+    VTR_LOG("Iter   Time    STA    pres  BBs    Heap  Re-Rtd  Re-Rtd Overused RR Nodes      Wirelength      CPD       sTNS       sWNS       hTNS       hWNS Est Succ\n");
+    VTR_LOG("      (sec)  (sec)     fac Updt    push    Nets   Conns                                       (ns)       (ns)       (ns)       (ns)       (ns)     Iter\n");
+    VTR_LOG("---- ------ ------ ------- ---- ------- ------- ------- ----------------- --------------- -------- ---------- ---------- ---------- ---------- --------\n");
 }
 
-static void print_route_status(int itry, double elapsed_sec, float pres_fac, int num_bb_updated, const RouterStats& router_stats, const OveruseInfo& overuse_info, const WirelengthInfo& wirelength_info, std::shared_ptr<const SetupHoldTimingInfo> timing_info, float est_success_iteration) {
+static void print_route_status(int itry, double elapsed_sec, double sta_elapsed_sec, float pres_fac, int num_bb_updated, const RouterStats& router_stats, const OveruseInfo& overuse_info, const WirelengthInfo& wirelength_info, std::shared_ptr<const SetupHoldTimingInfo> timing_info, float est_success_iteration) {
     //Iteration
     VTR_LOG("%4d", itry);
 
     //Elapsed Time
     VTR_LOG(" %6.1f", elapsed_sec);
 
+    //Elapsed Time in timing analysis (included in the above)
+    if (timing_info) {
+        VTR_LOG(" %6.2f", sta_elapsed_sec);
+    } else {
+        VTR_LOG(" %6s", "N/A");
+    }
+
     //pres_fac
     constexpr int PRES_FAC_DIGITS = 7;
     constexpr int PRES_FAC_SCI_PRECISION = 1;
@@ -2800,9 +2807,9 @@ static size_t dynamic_update_bounding_boxes(const std::vector<ClusterNetId>& upd
     size_t num_bb_updated = 0;
 
     for (ClusterNetId net : updated_nets) {
-        t_trace* routing_head = route_ctx.trace[net].head;
+        const t_traceback& routing = route_ctx.trace[net];
 
-        if (routing_head == nullptr) continue; //Skip if no routing
+        if (routing.empty()) continue; //Skip if no routing
 
         //We do not adjust the boundig boxes of high fanout nets, since they
         //use different bounding boxes based on the target location.
@@ -2810,7 +2817,7 @@ static size_t dynamic_update_bounding_boxes(const std::vector<ClusterNetId>& upd
         //This ensures that the delta values calculated below are always non-negative
         if (is_high_fanout(clb_nlist.net_sinks(net).size(), high_fanout_threshold)) continue;
 
-        t_bb curr_bb = calc_current_bb(routing_head);
+        t_bb curr_bb = calc_current_bb(routing);
 
         t_bb& router_bb = route_ctx.route_bb[net];
 
@@ -2859,7 +2866,7 @@ static size_t dynamic_update_bounding_boxes(const std::vector<ClusterNetId>& upd
 }
 
 //Returns the bounding box of a net's used routing resources
-static t_bb calc_current_bb(const t_trace* head) {
+static t_bb calc_current_bb(const t_traceback& traceback) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& grid = device_ctx.grid;
 
@@ -2869,8 +2876,8 @@ static t_bb calc_current_bb(const t_trace* head) {
     bb.xmax = 0;
     bb.ymax = 0;
 
-    for (const t_trace* elem = head; elem != nullptr; elem = elem->next) {
-        const RRNodeId& node = elem->index;
+    for (const t_trace& elem : traceback) {
+        const RRNodeId& node = elem.index;
         //The router interprets RR nodes which cross the boundary as being
         //'within' of the BB. Only thos which are *strictly* out side the
         //box are exluded, hence we use the nodes xhigh/yhigh for xmin/xmax,
@@ -3031,7 +3038,7 @@ static void prune_unused_non_configurable_nets(CBRR& connections_inf) {
 
         //Santiy check that route tree and traceback are equivalent before pruning
         VTR_ASSERT(verify_traceback_route_tree_equivalent(
-            route_ctx.trace[net_id].head, rt_root));
+            route_ctx.trace[net_id], rt_root));
 
         // check for edge correctness
         VTR_ASSERT_SAFE(is_valid_skeleton_tree(rt_root));
@@ -3046,7 +3053,7 @@ static void prune_unused_non_configurable_nets(CBRR& connections_inf) {
         // Update traceback with pruned tree.
         auto& reached_rt_sinks = connections_inf.get_reached_rt_sinks();
         traceback_from_route_tree(net_id, rt_root, reached_rt_sinks.size());
-        VTR_ASSERT(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id].head, rt_root));
+        VTR_ASSERT(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id], rt_root));
 
         free_route_tree(rt_root);
     }
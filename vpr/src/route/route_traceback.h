@@ -1,20 +1,61 @@
 #ifndef VPR_TRACEBACK_H
 #define VPR_TRACEBACK_H
+#include <cstddef>
+#include <vector>
 
-struct t_trace; //Forward declaration
+#include "vtr_assert.h"
 
+#include "vpr_types.h" //For t_trace
+
+//The routing of a net, stored contiguously in the order the branches were
+//routed. Each branch ends with an element whose iswitch is OPEN (a SINK); the
+//element following it is the (already routed) node the next branch starts from.
+//
+//Iterating over a traceback visits the elements in routing order:
+//
+//    for (const t_trace& trace : route_ctx.trace[net_id]) { ... }
+//
+//Clearing a traceback keeps its storage, so re-routing a net in the next
+//routing iteration does not allocate again.
 struct t_traceback {
-    t_traceback() = default;
-    ~t_traceback();
+    typedef std::vector<t_trace>::const_iterator const_iterator;
+
+    const_iterator begin() const { return traces_.begin(); }
+    const_iterator end() const { return traces_.end(); }
+
+    bool empty() const { return traces_.empty(); }
+    size_t size() const { return traces_.size(); }
+
+    const t_trace& operator[](size_t i) const {
+        VTR_ASSERT_SAFE(i < traces_.size());
+        return traces_[i];
+    }
+    t_trace& operator[](size_t i) {
+        VTR_ASSERT_SAFE(i < traces_.size());
+        return traces_[i];
+    }
+
+    const t_trace& front() const { return traces_.front(); }
+    const t_trace& back() const { return traces_.back(); }
+    t_trace& back() { return traces_.back(); }
+
+    void push_back(const t_trace& trace) { traces_.push_back(trace); }
+    void pop_back() { traces_.pop_back(); }
+    void reserve(size_t num_traces) { traces_.reserve(num_traces); }
+    void clear() { traces_.clear(); }
 
-    t_traceback(const t_traceback&);
-    t_traceback(t_traceback&&);
-    t_traceback operator=(t_traceback);
+    //Appends the elements of branch to the end of the traceback
+    void append(const std::vector<t_trace>& branch) {
+        traces_.insert(traces_.end(), branch.begin(), branch.end());
+    }
 
-    friend void swap(t_traceback& first, t_traceback& second);
+    friend void swap(t_traceback& first, t_traceback& second) {
+        using std::swap;
+        swap(first.traces_, second.traces_);
+    }
 
-    t_trace* head = nullptr;
-    t_trace* tail = nullptr;
+  private:
+    std::vector<t_trace> traces_;
 };
 
 #endif
@@ -1,5 +1,6 @@
 #include <cstdio>
 #include <cmath>
+#include <memory>
 #include <vector>
 
 #include "vtr_assert.h"
@@ -29,10 +30,60 @@
 
 static vtr::vector<RRNodeId, t_rt_node*> rr_node_to_rt_node; /* [0..device_ctx.rr_graph.nodes().size()-1] */
 
-/* Frees lists for fast addition and deletion of nodes and edges. */
+/* Bump arena the nodes (or edges) of the route trees are carved from.
+ * Freed elements are not recycled one by one through a free list: the arena
+ * only counts them, and rewinds to its first block as soon as nothing it
+ * handed out is alive anymore (i.e. after each net has been routed, and at
+ * the start of every routing iteration).  The blocks are kept, so the route
+ * trees of the next net are laid out contiguously in the same memory.      */
+template<typename T>
+class t_route_tree_arena {
+  public:
+    T* alloc() {
+        size_t iblock = num_used_ / BLOCK_SIZE;
+        if (iblock == blocks_.size()) {
+            blocks_.emplace_back(new T[BLOCK_SIZE]);
+        }
+        T* elem = &blocks_[iblock][num_used_ % BLOCK_SIZE];
+        ++num_used_;
+        ++num_live_;
+        return elem;
+    }
+
+    void release(T* elem) {
+        VTR_ASSERT_SAFE(elem != nullptr);
+        VTR_ASSERT_SAFE(num_live_ > 0);
+        (void)elem;
+        --num_live_;
+        if (num_live_ == 0) {
+            num_used_ = 0;
+        }
+    }
+
+    void rewind() {
+        VTR_ASSERT_MSG(num_live_ == 0,
+                       "Route tree arena can only be rewound when all route trees are freed");
+        num_used_ = 0;
+    }
 
-static t_rt_node* rt_node_free_list = nullptr;
-static t_linked_rt_edge* rt_edge_free_list = nullptr;
+    void clear() {
+        blocks_.clear();
+        num_used_ = 0;
+        num_live_ = 0;
+    }
+
+    bool empty() const { return blocks_.empty(); }
+
+  private:
+    static constexpr size_t BLOCK_SIZE = 4096;
+
+    std::vector<std::unique_ptr<T[]>> blocks_;
+    size_t num_used_ = 0; /* Elements handed out since the last rewind */
+    size_t num_live_ = 0; /* Elements handed out and not released yet */
+};
+
+static t_route_tree_arena<t_rt_node> rt_node_arena;
+static t_route_tree_arena<t_linked_rt_edge> rt_edge_arena;
 
 /********************** Subroutines local to this module *********************/
 
@@ -55,9 +106,9 @@ bool verify_route_tree_recurr(t_rt_node* node, std::set<RRNodeId>& seen_nodes);
 
 static t_rt_node* prune_route_tree_recurr(t_rt_node* node, CBRR& connections_inf, bool congested, std::vector<int>* non_config_node_set_usage);
 
-static t_trace* traceback_to_route_tree_branch(t_trace* trace, std::map<RRNodeId, t_rt_node*>& rr_node_to_rt, std::vector<int>* non_config_node_set_usage);
+static size_t traceback_to_route_tree_branch(const t_traceback& traceback, size_t itrace, std::map<RRNodeId, t_rt_node*>& rr_node_to_rt, std::vector<int>* non_config_node_set_usage);
 
-static std::pair<t_trace*, t_trace*> traceback_from_route_tree_recurr(t_trace* head, t_trace* tail, const t_rt_node* node);
+static void traceback_from_route_tree_recurr(t_traceback& traceback, const t_rt_node* node);
 
 void collect_route_tree_connections(const t_rt_node* node, std::set<std::tuple<RRNodeId, int, RRNodeId>>& connections);
 
@@ -74,7 +125,7 @@ bool alloc_route_tree_timing_structs(bool exists_ok) {
     auto& device_ctx = g_vpr_ctx.device();
 
     bool route_tree_structs_are_allocated = (rr_node_to_rt_node.size() == size_t(device_ctx.rr_graph.nodes().size())
-                                             || rt_node_free_list != nullptr);
+                                             || !rt_node_arena.empty());
     if (route_tree_structs_are_allocated) {
         if (exists_ok) {
             return false;
@@ -91,82 +142,39 @@ bool alloc_route_tree_timing_structs(bool exists_ok) {
 
 void free_route_tree_timing_structs() {
     /* Frees the structures needed to build routing trees, and really frees
-     * (i.e. calls free) all the data on the free lists.                         */
-
-    t_rt_node *rt_node, *next_node;
-    t_linked_rt_edge *rt_edge, *next_edge;
+     * (i.e. calls delete) the arenas all the nodes and edges came from.        */
 
     rr_node_to_rt_node.clear();
 
-    rt_node = rt_node_free_list;
-
-    while (rt_node != nullptr) {
-        next_node = rt_node->u.next;
-        free(rt_node);
-        rt_node = next_node;
-    }
-
-    rt_node_free_list = nullptr;
-
-    rt_edge = rt_edge_free_list;
+    rt_node_arena.clear();
+    rt_edge_arena.clear();
+}
 
-    while (rt_edge != nullptr) {
-        next_edge = rt_edge->next;
-        free(rt_edge);
-        rt_edge = next_edge;
-    }
+void reset_route_tree_arena() {
+    /* Rewinds the route tree arenas, so that the route trees built from now on
+     * reuse their blocks from the start. Must only be called when no route
+     * tree is alive (e.g. between routing iterations).                         */
 
-    rt_edge_free_list = nullptr;
+    rt_node_arena.rewind();
+    rt_edge_arena.rewind();
 }
 
 static t_rt_node*
 alloc_rt_node() {
-    /* Allocates a new rt_node, from the free list if possible, from the free
-     * store otherwise.                                                         */
-
-    t_rt_node* rt_node;
-
-    rt_node = rt_node_free_list;
-
-    if (rt_node != nullptr) {
-        rt_node_free_list = rt_node->u.next;
-    } else {
-        rt_node = (t_rt_node*)vtr::malloc(sizeof(t_rt_node));
-    }
-
-    return (rt_node);
+    return rt_node_arena.alloc();
 }
 
 static void free_rt_node(t_rt_node* rt_node) {
-    /* Adds rt_node to the proper free list.          */
-
-    rt_node->u.next = rt_node_free_list;
-    rt_node_free_list = rt_node;
+    rt_node_arena.release(rt_node);
 }
 
 static t_linked_rt_edge*
 alloc_linked_rt_edge() {
-    /* Allocates a new linked_rt_edge, from the free list if possible, from the
-     * free store otherwise.                                                     */
-
-    t_linked_rt_edge* linked_rt_edge;
-
-    linked_rt_edge = rt_edge_free_list;
-
-    if (linked_rt_edge != nullptr) {
-        rt_edge_free_list = linked_rt_edge->next;
-    } else {
-        linked_rt_edge = (t_linked_rt_edge*)vtr::malloc(sizeof(t_linked_rt_edge));
-    }
-
-    VTR_ASSERT(linked_rt_edge != nullptr);
-    return (linked_rt_edge);
+    return rt_edge_arena.alloc();
 }
 
-/* Adds the rt_edge to the rt_edge free list.                       */
 static void free_linked_rt_edge(t_linked_rt_edge* rt_edge) {
-    rt_edge->next = rt_edge_free_list;
-    rt_edge_free_list = rt_edge;
+    rt_edge_arena.release(rt_edge);
 }
 
 /* Initializes the routing tree to just the net source, and returns the root
@@ -624,8 +632,8 @@ bool verify_route_tree_recurr(t_rt_node* node, std::set<RRNodeId>& seen_nodes) {
 }
 
 void free_route_tree(t_rt_node* rt_node) {
-    /* Puts the rt_nodes and edges in the tree rooted at rt_node back on the
-     * free lists.  Recursive, depth-first post-order traversal.                */
+    /* Hands the rt_nodes and edges in the tree rooted at rt_node back to the
+     * arenas.  Recursive, depth-first post-order traversal.                    */
 
     t_linked_rt_edge *rt_edge, *next_edge;
 
@@ -646,6 +654,23 @@ void free_route_tree(t_rt_node* rt_node) {
     free_rt_node(rt_node);
 }
 
+void release_route_tree_children(t_rt_node* rt_node) {
+    /* Detaches all the subtrees below rt_node (but not rt_node itself), and
+     * hands them back to the arenas, which reclaim their memory when they
+     * rewind.  Leaves rt_node without any child.                           */
+
+    t_linked_rt_edge* rt_edge = rt_node->u.child_list;
+
+    while (rt_edge != nullptr) {
+        free_route_tree(rt_edge->child);
+        t_linked_rt_edge* next_edge = rt_edge->next;
+        free_linked_rt_edge(rt_edge);
+        rt_edge = next_edge;
+    }
+
+    rt_node->u.child_list = nullptr;
+}
+
 void print_route_tree(const t_rt_node* rt_node) {
     print_route_tree(rt_node, 0);
 }
@@ -704,62 +729,65 @@ void update_remaining_net_delays_from_route_tree(float* net_delay,
 /***************  Conversion between traceback and route tree *******************/
 t_rt_node* traceback_to_route_tree(ClusterNetId inet, std::vector<int>* non_config_node_set_usage) {
     auto& route_ctx = g_vpr_ctx.routing();
-    return traceback_to_route_tree(route_ctx.trace[inet].head, non_config_node_set_usage);
+    return traceback_to_route_tree(route_ctx.trace[inet], non_config_node_set_usage);
 }
 
 t_rt_node* traceback_to_route_tree(ClusterNetId inet) {
     return traceback_to_route_tree(inet, nullptr);
 }
 
-t_rt_node* traceback_to_route_tree(t_trace* head) {
-    return traceback_to_route_tree(head, nullptr);
+t_rt_node* traceback_to_route_tree(const t_traceback& traceback) {
+    return traceback_to_route_tree(traceback, nullptr);
 }
 
-t_rt_node* traceback_to_route_tree(t_trace* head, std::vector<int>* non_config_node_set_usage) {
+t_rt_node* traceback_to_route_tree(const t_traceback& traceback, std::vector<int>* non_config_node_set_usage) {
     /* Builds a skeleton route tree from a traceback
      * does not calculate R_upstream, C_downstream, or Tdel at all (left uninitialized)
      * returns the root of the converted route tree
      * initially points at the traceback equivalent of root 							  */
 
-    if (head == nullptr) {
+    if (traceback.empty()) {
         return nullptr;
     }
 
-    VTR_ASSERT_DEBUG(validate_traceback(head));
+    VTR_ASSERT_DEBUG(validate_traceback(traceback));
 
     std::map<RRNodeId, t_rt_node*> rr_node_to_rt;
 
-    t_trace* trace = head;
-    while (trace) { //Each branch
-        trace = traceback_to_route_tree_branch(trace, rr_node_to_rt, non_config_node_set_usage);
+    size_t itrace = 0;
+    while (itrace < traceback.size()) { //Each branch
+        itrace = traceback_to_route_tree_branch(traceback, itrace, rr_node_to_rt, non_config_node_set_usage);
     }
     // Due to the recursive nature of traceback_to_route_tree_branch,
     // the source node is not properly configured.
     // Here, for the source we set the parent node and switch to be
     // nullptr and OPEN respectively.
 
-    rr_node_to_rt[head->index]->parent_node = nullptr;
-    rr_node_to_rt[head->index]->parent_switch = OPEN;
+    t_rt_node* root = rr_node_to_rt[traceback.front().index];
+    root->parent_node = nullptr;
+    root->parent_switch = OPEN;
 
-    return rr_node_to_rt[head->index];
+    return root;
 }
 
 //Constructs a single branch of a route tree from a traceback
 //Note that R_upstream and C_downstream are initialized to NaN
 //
-//Returns the t_trace defining the start of the next branch
-static t_trace* traceback_to_route_tree_branch(t_trace* trace,
-                                               std::map<RRNodeId, t_rt_node*>& rr_node_to_rt,
-                                               std::vector<int>* non_config_node_set_usage) {
-    t_trace* next = nullptr;
-
-    if (trace) {
+//Returns the index of the traceback element defining the start of the next branch
+static size_t traceback_to_route_tree_branch(const t_traceback& traceback,
+                                             size_t itrace,
+                                             std::map<RRNodeId, t_rt_node*>& rr_node_to_rt,
+                                             std::vector<int>* non_config_node_set_usage) {
+    size_t next = traceback.size();
+
+    if (itrace < traceback.size()) {
         t_rt_node* node = nullptr;
 
-        RRNodeId inode = trace->index;
-        int iswitch = trace->iswitch;
+        const t_trace& trace = traceback[itrace];
+        RRNodeId inode = trace.index;
+        int iswitch = trace.iswitch;
 
-        auto itr = rr_node_to_rt.find(trace->index);
+        auto itr = rr_node_to_rt.find(trace.index);
         if (itr == rr_node_to_rt.end()) {
             //Create
 
@@ -798,7 +826,7 @@ static t_trace* traceback_to_route_tree_branch(t_trace* trace,
         }
         VTR_ASSERT(node);
 
-        next = trace->next;
+        next = itrace + 1;
         if (iswitch != OPEN) {
             // Keep track of non-configurable set usage by looking for
             // configurable edges that extend out of a non-configurable set.
@@ -814,16 +842,18 @@ static t_trace* traceback_to_route_tree_branch(t_trace* trace,
             }
 
             //Recursively construct the remaining branch
-            next = traceback_to_route_tree_branch(next, rr_node_to_rt, non_config_node_set_usage);
+            VTR_ASSERT(next < traceback.size());
+            RRNodeId child_inode = traceback[next].index;
+            next = traceback_to_route_tree_branch(traceback, next, rr_node_to_rt, non_config_node_set_usage);
 
             //Get the created child
-            itr = rr_node_to_rt.find(trace->next->index);
+            itr = rr_node_to_rt.find(child_inode);
             VTR_ASSERT_MSG(itr != rr_node_to_rt.end(), "Child must exist");
             t_rt_node* child = itr->second;
 
             //Create the edge
             t_linked_rt_edge* edge = alloc_linked_rt_edge();
-            edge->iswitch = trace->iswitch;
+            edge->iswitch = iswitch;
             edge->child = child;
             edge->next = nullptr;
 
@@ -843,86 +873,50 @@ static t_trace* traceback_to_route_tree_branch(t_trace* trace,
     return next;
 }
 
-static std::pair<t_trace*, t_trace*> traceback_from_route_tree_recurr(t_trace* head, t_trace* tail, const t_rt_node* node) {
+static void traceback_from_route_tree_recurr(t_traceback& traceback, const t_rt_node* node) {
     if (node) {
         if (node->u.child_list) {
             //Recursively add children
             for (t_linked_rt_edge* edge = node->u.child_list; edge != nullptr; edge = edge->next) {
-                t_trace* curr = alloc_trace_data();
-                curr->index = node->inode;
-                curr->iswitch = edge->iswitch;
-                curr->next = nullptr;
-
-                if (tail) {
-                    VTR_ASSERT(tail->next == nullptr);
-                    tail->next = curr;
-                }
-
-                tail = curr;
-
-                if (!head) {
-                    head = tail;
-                }
+                traceback.push_back({node->inode, edge->iswitch});
 
-                std::tie(head, tail) = traceback_from_route_tree_recurr(head, tail, edge->child);
+                traceback_from_route_tree_recurr(traceback, edge->child);
             }
         } else {
             //Leaf
-            t_trace* curr = alloc_trace_data();
-            curr->index = node->inode;
-            curr->iswitch = OPEN;
-            curr->next = nullptr;
-
-            if (tail) {
-                VTR_ASSERT(tail->next == nullptr);
-                tail->next = curr;
-            }
-
-            tail = curr;
-
-            if (!head) {
-                head = tail;
-            }
+            traceback.push_back({node->inode, OPEN});
         }
     }
-
-    return {head, tail};
 }
 
-t_trace* traceback_from_route_tree(ClusterNetId inet, const t_rt_node* root, int num_routed_sinks) {
+void traceback_from_route_tree(ClusterNetId inet, const t_rt_node* root, int num_routed_sinks) {
     /* Creates the traceback for net inet from the route tree rooted at root
-     * properly sets route_ctx.trace_head and route_ctx.trace_tail for this net
-     * returns the trace head for inet 					 					 */
+     * and stores it in route_ctx.trace[inet]                                  */
 
     auto& route_ctx = g_vpr_ctx.mutable_routing();
     auto& device_ctx = g_vpr_ctx.device();
 
-    t_trace* head;
-    t_trace* tail;
+    t_traceback& traceback = route_ctx.trace[inet];
     std::unordered_set<RRNodeId> nodes;
 
-    std::tie(head, tail) = traceback_from_route_tree_recurr(nullptr, nullptr, root);
+    traceback.clear();
+    traceback_from_route_tree_recurr(traceback, root);
 
-    VTR_ASSERT(head);
-    VTR_ASSERT(tail);
-    VTR_ASSERT(tail->next == nullptr);
+    VTR_ASSERT(!traceback.empty());
+    VTR_ASSERT(traceback.back().iswitch == OPEN);
 
     int num_trace_sinks = 0;
-    for (t_trace* trace = head; trace != nullptr; trace = trace->next) {
-        nodes.insert(trace->index);
+    for (const t_trace& trace : traceback) {
+        nodes.insert(trace.index);
 
         //Sanity check that number of sinks match expected
-        if (device_ctx.rr_graph.node_type(trace->index) == SINK) {
+        if (device_ctx.rr_graph.node_type(trace.index) == SINK) {
             num_trace_sinks += 1;
         }
     }
     VTR_ASSERT(num_routed_sinks == num_trace_sinks);
 
-    route_ctx.trace[inet].tail = tail;
-    route_ctx.trace[inet].head = head;
     route_ctx.trace_nodes[inet] = nodes;
-
-    return head;
 }
 
 //Prunes a route tree (recursively) based on congestion and the 'force_prune' argument
@@ -1437,7 +1431,7 @@ init_route_tree_to_source_no_net(const RRNodeId& inode) {
     return (rt_root);
 }
 
-bool verify_traceback_route_tree_equivalent(const t_trace* head, const t_rt_node* rt_root) {
+bool verify_traceback_route_tree_equivalent(const t_traceback& traceback, const t_rt_node* rt_root) {
     //Walk the route tree saving all the used connections
     std::set<std::tuple<RRNodeId, int, RRNodeId>> route_tree_connections;
     collect_route_tree_connections(rt_root, route_tree_connections);
@@ -1449,8 +1443,8 @@ bool verify_traceback_route_tree_equivalent(const t_trace* head, const t_rt_node
     RRNodeId prev_node = RRNodeId::INVALID();
     int prev_switch = OPEN;
     RRNodeId to_node = RRNodeId::INVALID();
-    for (const t_trace* trace = head; trace != nullptr; trace = trace->next) {
-        to_node = trace->index;
+    for (const t_trace& trace : traceback) {
+        to_node = trace.index;
 
         auto conn = std::make_tuple(prev_node, prev_switch, to_node);
         if (prev_switch != OPEN) {
@@ -1463,8 +1457,8 @@ bool verify_traceback_route_tree_equivalent(const t_trace* head, const t_rt_node
             }
         }
 
-        prev_node = trace->index;
-        prev_switch = trace->iswitch;
+        prev_node = trace.index;
+        prev_switch = trace.iswitch;
     }
 
     if (!route_tree_connections.empty()) {
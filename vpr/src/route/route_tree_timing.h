@@ -13,9 +13,14 @@ bool alloc_route_tree_timing_structs(bool exists_ok = false);
 
 void free_route_tree_timing_structs();
 
+//Rewinds the arenas of the route trees, so that subsequently built trees reuse
+//their memory from the start. May only be called when no route tree is alive.
+void reset_route_tree_arena();
+
 t_rt_node* init_route_tree_to_source(ClusterNetId inet);
 
 void free_route_tree(t_rt_node* rt_node);
+void release_route_tree_children(t_rt_node* rt_node);
 void print_route_tree(const t_rt_node* rt_node);
 void print_route_tree(const t_rt_node* rt_node, int depth);
 
@@ -36,7 +41,7 @@ t_rt_node* init_route_tree_to_source_no_net(const RRNodeId& inode);
 void add_route_tree_to_rr_node_lookup(t_rt_node* node);
 
 bool verify_route_tree(t_rt_node* root);
-bool verify_traceback_route_tree_equivalent(const t_trace* trace_head, const t_rt_node* rt_root);
+bool verify_traceback_route_tree_equivalent(const t_traceback& traceback, const t_rt_node* rt_root);
 
 t_rt_node* find_sink_rt_node(t_rt_node* rt_root, ClusterNetId net_id, ClusterPinId sink_pin);
 t_rt_node* find_sink_rt_node_recurr(t_rt_node* node, const RRNodeId& sink_inode);
@@ -52,9 +57,9 @@ void print_route_tree_congestion(const t_rt_node* rt_root);
 
 t_rt_node* traceback_to_route_tree(ClusterNetId inet);
 t_rt_node* traceback_to_route_tree(ClusterNetId inet, std::vector<int>* non_config_node_set_usage);
-t_rt_node* traceback_to_route_tree(t_trace* head);
-t_rt_node* traceback_to_route_tree(t_trace* head, std::vector<int>* non_config_node_set_usage);
-t_trace* traceback_from_route_tree(ClusterNetId inet, const t_rt_node* root, int num_remaining_sinks);
+t_rt_node* traceback_to_route_tree(const t_traceback& traceback);
+t_rt_node* traceback_to_route_tree(const t_traceback& traceback, std::vector<int>* non_config_node_set_usage);
+void traceback_from_route_tree(ClusterNetId inet, const t_rt_node* root, int num_remaining_sinks);
 
 // Prune route tree
 //
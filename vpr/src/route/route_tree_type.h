@@ -23,8 +23,8 @@ struct t_linked_rt_edge {
  * incrementally during routing, as pieces are being added).                 *
  * u.child_list:  Pointer to a linked list of linked_rt_edge.  Each one of   *
  *                the linked list entries gives a child of this node.        *
- * u.next:  Used only when this node is on the free list.  Gives the next    *
- *          node on the free list.                                           *
+ * u.next:  Unused.  Nodes are carved from an arena that is rewound as a   *
+ *          whole instead of keeping a free list (see route_tree_timing.cpp).*
  * parent_node:  Pointer to the rt_node that is this node's parent (used to  *
  *               make bottom to top traversals).                             *
  * re_expand:  Should this node be put on the heap as part of the partial    *
@@ -13,14 +13,12 @@ vtr::Matrix<float> calculate_routing_usage(t_rr_type rr_type) {
     //Collect all the in-use RR nodes
     std::set<RRNodeId> rr_nodes;
     for (auto net : cluster_ctx.clb_nlist.nets()) {
-        t_trace* tptr = route_ctx.trace[net].head;
-        while (tptr != nullptr) {
-            RRNodeId inode = tptr->index;
+        for (const t_trace& trace : route_ctx.trace[net]) {
+            RRNodeId inode = trace.index;
 
             if (device_ctx.rr_graph.node_type(inode) == rr_type) {
                 rr_nodes.insert(inode);
             }
-            tptr = tptr->next;
         }
     }
 
@@ -31,6 +31,7 @@
 #include "build_switchblocks.h"
 #include "rr_graph_writer.h"
 #include "rr_graph_reader.h"
+#include "device_snapshot.h"
 #include "router_lookahead_map.h"
 #include "rr_graph_clock.h"
 
@@ -277,6 +278,7 @@ static void build_rr_graph(const t_graph_type graph_type,
                            const t_direct_inf* directs,
                            const int num_directs,
                            int* wire_to_rr_ipin_switch,
+                           const size_t& num_check_jobs,
                            int* Warnings);
 
 /******************* Subroutine definitions *******************************/
@@ -297,6 +299,12 @@ void create_rr_graph(const t_graph_type graph_type,
                      int* Warnings) {
     const auto& device_ctx = g_vpr_ctx.device();
 
+    /* Raised when the rr_graph is loaded from a device snapshot instead of being built */
+    bool snapshot_loaded = false;
+
+    /* Do not allow passing tracks to be wired to the same routing channels in tileable rr_graph */
+    const bool wire_opposite_side = false;
+
     if (!det_routing_arch->read_rr_graph_filename.empty()) {
         if (device_ctx.read_rr_graph_filename != det_routing_arch->read_rr_graph_filename) {
             free_rr_graph();
@@ -306,7 +314,8 @@ void create_rr_graph(const t_graph_type graph_type,
                          segment_inf,
                          base_cost_type,
                          &det_routing_arch->wire_to_rr_ipin_switch,
-                         det_routing_arch->read_rr_graph_filename.c_str());
+                         det_routing_arch->read_rr_graph_filename.c_str(),
+                         det_routing_arch->check_jobs);
 
             /* Xifan Tang - Create rr_graph object: load rr_nodes to the object */
             //convert_rr_graph(segment_inf);
@@ -320,7 +329,25 @@ void create_rr_graph(const t_graph_type graph_type,
 
         free_rr_graph();
 
-        if (GRAPH_UNIDIR_TILEABLE != graph_type) {
+        if (!det_routing_arch->read_device_snapshot_filename.empty()) {
+            snapshot_loaded = read_device_snapshot(det_routing_arch->read_device_snapshot_filename.c_str(),
+                                                   graph_type,
+                                                   block_types,
+                                                   grid,
+                                                   nodes_per_chan,
+                                                   det_routing_arch,
+                                                   segment_inf,
+                                                   base_cost_type,
+                                                   trim_empty_channels,
+                                                   trim_obs_channels,
+                                                   wire_opposite_side,
+                                                   clock_modeling,
+                                                   directs, num_directs);
+        }
+
+        if (snapshot_loaded) {
+            /* Nothing to build */
+        } else if (GRAPH_UNIDIR_TILEABLE != graph_type) {
             build_rr_graph(graph_type,
                            block_types,
                            grid,
@@ -340,6 +367,7 @@ void create_rr_graph(const t_graph_type graph_type,
                            trim_obs_channels,
                            directs, num_directs,
                            &det_routing_arch->wire_to_rr_ipin_switch,
+                           det_routing_arch->check_jobs,
                            Warnings);
 
           if (clock_modeling == DEDICATED_NETWORK) {
@@ -367,7 +395,8 @@ void create_rr_graph(const t_graph_type graph_type,
                                                     directs, num_directs,
                                                     &det_routing_arch->wire_to_rr_ipin_switch,
                                                     trim_obs_channels, /* Allow/Prohibit through tracks across multi-height and multi-width grids */
-                                                    false, /* Do not allow passing tracks to be wired to the same routing channels */
+                                                    wire_opposite_side,
+                                                    det_routing_arch->check_jobs,
                                                     Warnings);
         }
 
@@ -388,6 +417,23 @@ void create_rr_graph(const t_graph_type graph_type,
         rr_graph_obj_filename += std::string(".obj");
         write_xml_rr_graph_obj(rr_graph_obj_filename.c_str(), device_ctx.rr_graph);
     }
+
+    //Write out the device snapshot if needed, unless the rr_graph was just loaded from it
+    if (!det_routing_arch->write_device_snapshot_filename.empty()
+        && !(snapshot_loaded && det_routing_arch->write_device_snapshot_filename == det_routing_arch->read_device_snapshot_filename)) {
+        write_device_snapshot(det_routing_arch->write_device_snapshot_filename.c_str(),
+                              graph_type,
+                              block_types,
+                              grid,
+                              *det_routing_arch,
+                              segment_inf,
+                              base_cost_type,
+                              trim_empty_channels,
+                              trim_obs_channels,
+                              wire_opposite_side,
+                              clock_modeling,
+                              directs, num_directs);
+    }
 }
 
 void print_rr_graph_stats() {
@@ -431,6 +477,7 @@ static void build_rr_graph(const t_graph_type graph_type,
                            const t_direct_inf* directs,
                            const int num_directs,
                            int* wire_to_rr_ipin_switch,
+                           const size_t& num_check_jobs,
                            int* Warnings) {
     vtr::ScopedStartFinishTimer timer("Build routing resource graph");
 
@@ -783,7 +830,7 @@ static void build_rr_graph(const t_graph_type graph_type,
 
     check_rr_graph(graph_type, grid, types);
     /* Error out if advanced checker of rr_graph fails */
-    if (false == check_rr_graph(device_ctx.rr_graph)) {
+    if (false == check_rr_graph(device_ctx.rr_graph, num_check_jobs)) {
         vpr_throw(VPR_ERROR_ROUTE,
                   __FILE__,
                   __LINE__,
@@ -1497,6 +1544,9 @@ void free_rr_graph() {
 
     device_ctx.switch_fanin_remap.clear();
 
+    /* The rc data are fly-weighted by the nodes, so they are rebuilt with the graph */
+    device_ctx.rr_rc_data.clear();
+
     device_ctx.rr_node_metadata.clear();
 
     device_ctx.rr_edge_metadata.clear();
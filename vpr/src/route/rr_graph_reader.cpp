@@ -72,7 +72,8 @@ void load_rr_file(const t_graph_type graph_type,
                   const std::vector<t_segment_inf>& segment_inf,
                   const enum e_base_cost_type base_cost_type,
                   int* wire_to_rr_ipin_switch,
-                  const char* read_rr_graph_name) {
+                  const char* read_rr_graph_name,
+                  const size_t& num_check_jobs) {
     vtr::ScopedStartFinishTimer timer("Loading routing resource graph");
 
     const char* Prop;
@@ -192,7 +193,7 @@ void load_rr_file(const t_graph_type graph_type,
 
         check_rr_graph(graph_type, grid, device_ctx.physical_tile_types);
         /* Error out if advanced checker of rr_graph fails */
-        if (false == check_rr_graph(device_ctx.rr_graph)) {
+        if (false == check_rr_graph(device_ctx.rr_graph, num_check_jobs)) {
             vpr_throw(VPR_ERROR_ROUTE,
                       __FILE__,
                       __LINE__,
@@ -1,6 +1,10 @@
 /************************************************************************
  * Member functions for class RRGSB
  ***********************************************************************/
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
+
 /* Headers from vtrutil library */
 #include "vtr_log.h"
 #include "vtr_assert.h"
@@ -346,35 +350,94 @@ bool RRGSB::is_sb_node_exist_opposite_side(const RRGraph& rr_graph,
   return (-1 != index);
 }
 
-/* check if the candidate CB is a mirror of the current one */
+/* check if the candidate CB is a mirror of the current one,
+ * i.e., their fingerprints are the same */
 bool RRGSB::is_cb_mirror(const RRGraph& rr_graph, const RRGSB& cand, const t_rr_type& cb_type) const { 
   /* Check if channel width is the same */
   if ( get_cb_chan_width(cb_type) != cand.get_cb_chan_width(cb_type) ) {
     return false;
   }
 
+  return get_cb_fingerprint(rr_graph, cb_type) == cand.get_cb_fingerprint(rr_graph, cb_type);
+}
+
+/* Get a fingerprint of a connection block, made of
+ * - the type, directionality and segment of each routing track
+ * - for each ipin, the number of its drivers and, for each driver in the order of the incoming edges,
+ *   the switch id, the node type, the side (for OPINs) and the index in the GSB packed into an integer
+ * Two connection blocks are mirrors if and only if their fingerprints are the same
+ */
+std::vector<uint64_t> RRGSB::get_cb_fingerprint(const RRGraph& rr_graph, const t_rr_type& cb_type) const {
   enum e_side chan_side = get_cb_chan_side(cb_type);
+  const RRChan& cb_chan = chan_node_[size_t(chan_side)];
 
-  /* check the numbers/directionality of channel rr_nodes */
-  if ( false == chan_node_[size_t(chan_side)].is_mirror(rr_graph, cand.chan_node_[size_t(chan_side)]) ) {
-     return false;
+  std::vector<uint64_t> fingerprint;
+
+  /* The numbers/directionality of channel rr_nodes */
+  fingerprint.push_back(uint64_t(cb_chan.get_type()));
+  fingerprint.push_back(cb_chan.get_chan_width());
+  for (size_t itrack = 0; itrack < cb_chan.get_chan_width(); ++itrack) {
+    fingerprint.push_back( (uint64_t(rr_graph.node_type(cb_chan.get_node(itrack))) << 32)
+                         | (uint64_t(uint16_t(rr_graph.node_direction(cb_chan.get_node(itrack)))) << 16)
+                         | uint64_t(uint16_t(size_t(cb_chan.get_node_segment(itrack)))) );
   }
 
-  /* check the equivalence of ipins */
-  std::vector<enum e_side> ipin_side = get_cb_ipin_sides(cb_type);
-  for (size_t side = 0; side < ipin_side.size(); ++side) {
-    /* Ensure we have the same number of IPINs on this side */
-    if ( get_num_ipin_nodes(ipin_side[side]) != cand.get_num_ipin_nodes(ipin_side[side]) ) {
-      return false;
+  /* Fast look-ups for the index of the driving routing tracks and OPINs, 
+   * the first index is kept when a node appears several times
+   */
+  std::unordered_map<RRNodeId, int> track_indices;
+  for (size_t itrack = 0; itrack < cb_chan.get_chan_width(); ++itrack) {
+    track_indices.emplace(cb_chan.get_node(itrack), itrack);
+  }
+  std::unordered_map<RRNodeId, std::pair<e_side, int>> opin_sides_and_indices;
+  for (size_t side = 0; side < get_num_sides(); ++side) {
+    SideManager side_manager(side);
+    for (size_t inode = 0; inode < opin_node_[side].size(); ++inode) {
+      opin_sides_and_indices.emplace(opin_node_[side][inode], std::make_pair(side_manager.get_side(), int(inode)));
     }
-    for (size_t inode = 0; inode < get_num_ipin_nodes(ipin_side[side]); ++inode) {
-      if (false == is_cb_node_mirror(rr_graph, cand, cb_type, ipin_side[side], inode)) {
-        return false;
+  }
+
+  /* The drivers of ipins */
+  for (const e_side& ipin_side : get_cb_ipin_sides(cb_type)) {
+    fingerprint.push_back(get_num_ipin_nodes(ipin_side));
+    for (const RRNodeId& ipin_node : ipin_node_[size_t(ipin_side)]) {
+      fingerprint.push_back(rr_graph.node_in_edges(ipin_node).size());
+      for (const RREdgeId& edge : rr_graph.node_in_edges(ipin_node)) {
+        RRNodeId src_node = rr_graph.edge_src_node(edge);
+        e_side src_node_side = NUM_SIDES;
+        int src_node_id = -1;
+        switch (rr_graph.node_type(src_node)) {
+        case CHANX:
+        case CHANY: {
+          /* if the drive rr_nodes are routing tracks, find index  */
+          auto it = track_indices.find(src_node);
+          if (track_indices.end() != it) {
+            src_node_id = it->second;
+          }
+          break;
+        }
+        case OPIN: {
+          auto it = opin_sides_and_indices.find(src_node);
+          if (opin_sides_and_indices.end() != it) {
+            src_node_side = it->second.first;
+            src_node_id = it->second.second;
+          }
+          break;
+        }
+        default:
+          VTR_LOG("Invalid type of drive_rr_nodes for ipin_node!\n");
+          exit(1);
+        }
+        VTR_ASSERT(size_t(src_node_id + 1) < (size_t(1) << 24));
+        fingerprint.push_back( (uint64_t(uint16_t(size_t(rr_graph.edge_switch(edge)))) << 32)
+                             | (uint64_t(rr_graph.node_type(src_node)) << 28)
+                             | (uint64_t(src_node_side) << 24)
+                             | uint64_t(src_node_id + 1) );
       }
     }
   }
 
-  return true;
+  return fingerprint;
 }
 
 /* check if the CB exist in this GSB */
@@ -578,6 +641,42 @@ bool RRGSB::is_sb_mirror(const RRGraph& rr_graph, const RRGSB& cand) const {
   return true;
 }
 
+/* check if the candidate SB is a mirror of the current one, once rotated or reflected */
+bool RRGSB::is_sb_mirror(const RRGraph& rr_graph, const RRGSB& cand, const t_rr_gsb_side_map& side_map) const {
+  /* check the numbers of sides */
+  if (get_num_sides() != cand.get_num_sides()) {
+    return false;
+  }
+
+  for (size_t side = 0; side < get_num_sides(); ++side) {
+    SideManager side_manager(side);
+    e_side cand_side = side_map[side];
+
+    /* Ensure we have the same channel width and the same number of opin_rr_nodes on the mapped sides */
+    if ( (get_chan_width(side_manager.get_side()) != cand.get_chan_width(cand_side))
+      || (get_num_opin_nodes(side_manager.get_side()) != cand.get_num_opin_nodes(cand_side)) ) {
+      return false;
+    }
+
+    for (size_t itrack = 0; itrack < get_chan_width(side_manager.get_side()); ++itrack) {
+      /* Check the directionality and the segment of each node */
+      if ( (get_chan_node_direction(side_manager.get_side(), itrack) != cand.get_chan_node_direction(cand_side, itrack))
+        || (get_chan_node_segment(side_manager.get_side(), itrack) != cand.get_chan_node_segment(cand_side, itrack)) ) {
+        return false;
+      }
+      /* For OUT_PORT rr_node, we need to check fan-in */
+      if (OUT_PORT != get_chan_node_direction(side_manager.get_side(), itrack)) {
+        continue; /* skip IN_PORT */
+      }
+      if (false == is_sb_node_mirror(rr_graph, cand, side_map, side_manager.get_side(), itrack)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 /* Public Accessors: Cooridinator conversion */
 
 /* get the x coordinate of this GSB */
@@ -1005,76 +1104,72 @@ bool RRGSB::is_sb_node_mirror(const RRGraph& rr_graph,
   return true;
 } 
 
-/* check if two ipin_nodes have a similar set of drive_rr_nodes 
+/* check if two rr_nodes have the same set of drive_rr_nodes, 
+ * once the sides of this GSB are mapped to the sides of the candidate
  * for each drive_rr_node:
- * 1. CHANX or CHANY: should have the same side and index
- * 2. each drive_rr_switch should be the same 
+ * 1. CHANX or CHANY: should have the same mapped side and index
+ * 2. OPIN: should have the same mapped side and index
+ * 3. each drive_rr_switch should be the same 
+ * The order of the drive_rr_nodes does not matter, as it follows the order of the sides
  */
-bool RRGSB::is_cb_node_mirror(const RRGraph& rr_graph,
+bool RRGSB::is_sb_node_mirror(const RRGraph& rr_graph,
                               const RRGSB& cand, 
-                              const t_rr_type& cb_type,
+                              const t_rr_gsb_side_map& side_map,
                               const e_side& node_side, 
-                              const size_t& node_id) const {
+                              const size_t& track_id) const {
+  e_side cand_side = side_map[size_t(node_side)];
+
   /* Ensure rr_nodes are either the output of short-connection or multiplexer  */
-  RRNodeId node = this->get_ipin_node(node_side, node_id);
-  RRNodeId cand_node = cand.get_ipin_node(node_side, node_id);
+  bool is_short_conkt = this->is_sb_node_passing_wire(rr_graph, node_side, track_id);
 
-  if ( rr_graph.node_in_edges(node).size() != rr_graph.node_in_edges(cand_node).size() ) {
+  if (is_short_conkt != cand.is_sb_node_passing_wire(rr_graph, cand_side, track_id)) {
     return false;
   }
 
-  std::vector<RREdgeId> node_in_edges;
-  for (const RREdgeId& edge : rr_graph.node_in_edges(node)) {
-    node_in_edges.push_back(edge);
+  if (true == is_short_conkt) {
+    /* Both are pass wires, which should come from the same track on the opposite side */
+    SideManager side_manager(node_side);
+    SideManager cand_side_manager(cand_side);
+    return get_node_index(rr_graph, get_chan_node(node_side, track_id), side_manager.get_opposite(), IN_PORT)
+        == cand.get_node_index(rr_graph, cand.get_chan_node(cand_side, track_id), cand_side_manager.get_opposite(), IN_PORT);
   }
 
-  std::vector<RREdgeId> cand_node_in_edges;
-  for (const RREdgeId& edge : rr_graph.node_in_edges(cand_node)) {
-    cand_node_in_edges.push_back(edge);
+  std::vector<RREdgeId> node_in_edges = get_chan_node_in_edges(rr_graph, node_side, track_id);
+  std::vector<RREdgeId> cand_node_in_edges = cand.get_chan_node_in_edges(rr_graph, cand_side, track_id);
+
+  /* For non-passing wires, check driving rr_nodes */
+  if (node_in_edges.size() != cand_node_in_edges.size()) {
+    return false;
   }
-  VTR_ASSERT(node_in_edges.size() == cand_node_in_edges.size());
 
-  for (size_t iedge = 0; iedge < node_in_edges.size(); ++iedge) {
-    RREdgeId src_edge = node_in_edges[iedge];
-    RREdgeId src_cand_edge = cand_node_in_edges[iedge];
-    RRNodeId src_node = rr_graph.edge_src_node(src_edge);
-    RRNodeId src_cand_node = rr_graph.edge_src_node(src_cand_edge);
-    /* node type should be the same  */
-    if (rr_graph.node_type(src_node) != rr_graph.node_type(src_cand_node)) {
-      return false;
-    }
-    /* switch type should be the same  */
-    if (rr_graph.edge_switch(src_edge)!= rr_graph.edge_switch(src_cand_edge)) {
-      return false;
-    }
+  /* Describe each drive_rr_node by its side and index in the candidate, 
+   * if it is a grid pin, and its drive_rr_switch
+   */
+  std::vector<std::tuple<size_t, bool, int, RRSwitchId>> drivers;
+  std::vector<std::tuple<size_t, bool, int, RRSwitchId>> cand_drivers;
+  drivers.reserve(node_in_edges.size());
+  cand_drivers.reserve(cand_node_in_edges.size());
 
+  for (size_t iedge = 0; iedge < node_in_edges.size(); ++iedge) {
+    RRNodeId src_node = rr_graph.edge_src_node(node_in_edges[iedge]);
+    RRNodeId src_cand_node = rr_graph.edge_src_node(cand_node_in_edges[iedge]);
     int src_node_id, des_node_id;
     enum e_side src_node_side, des_node_side; 
-    enum e_side chan_side = get_cb_chan_side(cb_type);
-    switch (rr_graph.node_type(src_node)) {
-    case CHANX:
-    case CHANY:
-      /* if the drive rr_nodes are routing tracks, find index  */
-      src_node_id = this->get_chan_node_index(chan_side, src_node);
-      des_node_id =  cand.get_chan_node_index(chan_side, src_cand_node);
-      break;
-    case OPIN:
-      this->get_node_side_and_index(rr_graph, src_node, OUT_PORT, src_node_side, src_node_id);
-       cand.get_node_side_and_index(rr_graph, src_cand_node, OUT_PORT, des_node_side, des_node_id);
-      if (src_node_side != des_node_side) {
-        return false;
-      } 
-      break;
-    default:
-      VTR_LOG("Invalid type of drive_rr_nodes for ipin_node!\n");
-      exit(1);
-    }
-    if (src_node_id != des_node_id) {
+    this->get_node_side_and_index(rr_graph, src_node, IN_PORT, src_node_side, src_node_id);
+     cand.get_node_side_and_index(rr_graph, src_cand_node, IN_PORT, des_node_side, des_node_id);
+    if ( (NUM_SIDES == src_node_side) || (NUM_SIDES == des_node_side) ) {
       return false;
-    } 
+    }
+    drivers.emplace_back(size_t(side_map[size_t(src_node_side)]), OPIN == rr_graph.node_type(src_node),
+                         src_node_id, rr_graph.edge_switch(node_in_edges[iedge]));
+    cand_drivers.emplace_back(size_t(des_node_side), OPIN == rr_graph.node_type(src_cand_node),
+                              des_node_id, rr_graph.edge_switch(cand_node_in_edges[iedge]));
   }
 
-  return true;
+  std::sort(drivers.begin(), drivers.end());
+  std::sort(cand_drivers.begin(), cand_drivers.end());
+
+  return drivers == cand_drivers;
 } 
 
 size_t RRGSB::get_track_id_first_short_connection(const RRGraph& rr_graph, const e_side& node_side) const {
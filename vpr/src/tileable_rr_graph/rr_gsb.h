@@ -4,6 +4,9 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
+#include <array>
+#include <cstdint>
+
 /* Headers from vtrutil library */
 #include "vtr_geometry.h"
 
@@ -12,6 +15,13 @@
 /* Begin namespace openfpga */
 namespace openfpga {
 
+/********************************************************************
+ * A map from the sides of a GSB to the sides of another GSB,
+ * indexed by the sides of the first GSB, e.g., side_map[size_t(LEFT)].
+ * This describes a rotation or a reflection of a switch block
+ *******************************************************************/
+typedef std::array<e_side, NUM_SIDES> t_rr_gsb_side_map;
+
 /********************************************************************
  * Object Generic Switch Block 
  * This block contains
@@ -118,9 +128,14 @@ class RRGSB {
     /* Check if the node exist in the opposite side of this Switch Block */
     bool is_sb_node_exist_opposite_side(const RRGraph& rr_graph, const RRNodeId& node, const e_side& node_side) const;
   public: /* Accessors: to identify mirrors */
-    /* check if the candidate SB is a mirror of the current one */
+    /* check if the candidate CB is a mirror of the current one */
     bool is_cb_mirror(const RRGraph& rr_graph, const RRGSB& cand, const t_rr_type& cb_type) const; 
 
+    /* Get a fingerprint of the routing tracks and the drivers of ipins of a CB,
+     * two CBs are mirrors if and only if their fingerprints are the same
+     */
+    std::vector<uint64_t> get_cb_fingerprint(const RRGraph& rr_graph, const t_rr_type& cb_type) const; 
+
     /* check if the connect block exists in the GSB */
     bool is_cb_exist(const t_rr_type& cb_type) const;
 
@@ -166,6 +181,16 @@ class RRGSB {
      */
     bool is_sb_mirror(const RRGraph& rr_graph, const RRGSB& cand) const; 
 
+    /* check if the candidate SB is a mirror of the current one 
+     * once the candidate is rotated or reflected:
+     * each side of the current SB is compared to the side side_map[side] of the candidate.
+     * Routing tracks are compared by their index on the side,
+     * so the channel type of a side may differ (e.g., LEFT mapped to BOTTOM).
+     * The drivers of each routing track are compared as a set,
+     * as the inputs of the routing multiplexers are ordered by sides
+     */
+    bool is_sb_mirror(const RRGraph& rr_graph, const RRGSB& cand, const t_rr_gsb_side_map& side_map) const; 
+
   public: /* Cooridinator conversion and output  */
     size_t get_x() const; /* get the x coordinate of this switch block */
     size_t get_y() const; /* get the y coordinate of this switch block */
@@ -236,11 +261,11 @@ class RRGSB {
                            const e_side& node_side, 
                            const size_t& track_id) const; 
 
-    bool is_cb_node_mirror(const RRGraph& rr_graph, 
-                           const RRGSB& cand, 
-                           const t_rr_type& cb_type, 
+    bool is_sb_node_mirror(const RRGraph& rr_graph,
+                           const RRGSB& cand,
+                           const t_rr_gsb_side_map& side_map,
                            const e_side& node_side, 
-                           const size_t& node_id) const; 
+                           const size_t& track_id) const; 
 
     size_t get_track_id_first_short_connection(const RRGraph& rr_graph, const e_side& node_side) const; 
 
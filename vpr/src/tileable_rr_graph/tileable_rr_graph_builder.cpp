@@ -85,6 +85,7 @@ void build_tileable_unidir_rr_graph(const std::vector<t_physical_tile_type>& typ
                                     int* wire_to_rr_ipin_switch,
                                     const bool& through_channel,
                                     const bool& wire_opposite_side,
+                                    const size_t& num_check_jobs,
                                     int *Warnings) { 
 
   vtr::ScopedStartFinishTimer timer("Build tileable routing resource graph");
@@ -308,7 +309,7 @@ void build_tileable_unidir_rr_graph(const std::vector<t_physical_tile_type>& typ
 
   check_rr_graph(GRAPH_UNIDIR, grids, types);
   /* Error out if advanced checker of rr_graph fails */
-  if (false == check_rr_graph(device_ctx.rr_graph)) {
+  if (false == check_rr_graph(device_ctx.rr_graph, num_check_jobs)) {
     vpr_throw(VPR_ERROR_ROUTE,
               __FILE__,
               __LINE__,
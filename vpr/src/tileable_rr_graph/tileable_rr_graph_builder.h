@@ -32,6 +32,7 @@ void build_tileable_unidir_rr_graph(const std::vector<t_physical_tile_type>& typ
                                     int* wire_to_rr_ipin_switch,
                                     const bool& through_channel,
                                     const bool& wire_opposite_side,
+                                    const size_t& num_check_jobs,
                                     int *Warnings); 
 
 } /* end namespace openfpga */
@@ -0,0 +1,151 @@
+#ifndef VPR_PARALLEL_WALKER_H
+#define VPR_PARALLEL_WALKER_H
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "vtr_parallel.h"
+
+#include "tatum/graph_walkers/TimingGraphWalker.hpp"
+#include "tatum/graph_visitors/GraphVisitor.hpp"
+#include "tatum/TimingGraph.hpp"
+
+//A timing graph walker which traverses the timing graph level by level
+//(like tatum's ParallelLevelizedWalker), but processes the nodes of each
+//level with plain threads instead of TBB.
+//
+//This makes a parallel timing update available in every build, whether
+//or not TBB was found. The number of threads used is not a property of
+//the walker itself (tatum default-constructs the walkers inside its analyzers),
+//but of the calling thread: it is set for a scope with ScopedNumJobs, which
+//the concrete timing infos do around each timing update.
+//
+//Small levels (fewer than MIN_NODES_PER_JOB nodes per thread) are walked
+//serially, so that threads are only started when there is enough work.
+class VprParallelWalker : public tatum::TimingGraphWalker {
+  public:
+    //Sets the number of threads used by the VprParallelWalkers called from the
+    //current thread, until the object goes out of scope
+    class ScopedNumJobs {
+      public:
+        ScopedNumJobs(size_t num_jobs_v)
+            : prev_num_jobs_(current_num_jobs()) {
+            current_num_jobs() = vtr::resolve_num_jobs(num_jobs_v);
+        }
+        ~ScopedNumJobs() {
+            current_num_jobs() = prev_num_jobs_;
+        }
+
+        ScopedNumJobs(const ScopedNumJobs&) = delete;
+        ScopedNumJobs& operator=(const ScopedNumJobs&) = delete;
+
+      private:
+        size_t prev_num_jobs_;
+    };
+
+    //Number of threads currently used by walkers on the calling thread
+    static size_t num_jobs() { return current_num_jobs(); }
+
+    //Minimum number of nodes processed by each thread
+    constexpr static size_t MIN_NODES_PER_JOB = 1000;
+
+  protected:
+    void do_arrival_pre_traversal_impl(const tatum::TimingGraph& tg, const tatum::TimingConstraints& tc, tatum::GraphVisitor& visitor) override {
+        tatum::LevelId first_level = *tg.levels().begin();
+        num_unconstrained_startpoints_ = count_unconstrained(tg.level_nodes(first_level), [&](tatum::NodeId node) {
+            return visitor.do_arrival_pre_traverse_node(tg, tc, node);
+        });
+    }
+
+    void do_required_pre_traversal_impl(const tatum::TimingGraph& tg, const tatum::TimingConstraints& tc, tatum::GraphVisitor& visitor) override {
+        num_unconstrained_endpoints_ = count_unconstrained(tg.logical_outputs(), [&](tatum::NodeId node) {
+            return visitor.do_required_pre_traverse_node(tg, tc, node);
+        });
+    }
+
+    void do_arrival_traversal_impl(const tatum::TimingGraph& tg, const tatum::TimingConstraints& tc, const tatum::DelayCalculator& dc, tatum::GraphVisitor& visitor) override {
+        for (tatum::LevelId level_id : tg.levels()) {
+            for_each_node(tg.level_nodes(level_id), [&](tatum::NodeId node) {
+                visitor.do_arrival_traverse_node(tg, tc, dc, node);
+            });
+        }
+    }
+
+    void do_required_traversal_impl(const tatum::TimingGraph& tg, const tatum::TimingConstraints& tc, const tatum::DelayCalculator& dc, tatum::GraphVisitor& visitor) override {
+        for (tatum::LevelId level_id : tg.reversed_levels()) {
+            for_each_node(tg.level_nodes(level_id), [&](tatum::NodeId node) {
+                visitor.do_required_traverse_node(tg, tc, dc, node);
+            });
+        }
+    }
+
+    void do_update_slack_impl(const tatum::TimingGraph& tg, const tatum::DelayCalculator& dc, tatum::GraphVisitor& visitor) override {
+        for_each_node(tg.nodes(), [&](tatum::NodeId node) {
+            visitor.do_slack_traverse_node(tg, dc, node);
+        });
+    }
+
+    void do_reset_impl(const tatum::TimingGraph& tg, tatum::GraphVisitor& visitor) override {
+        for_each_node(tg.nodes(), [&](tatum::NodeId node) {
+            visitor.do_reset_node(node);
+        });
+        for_each_node(tg.edges(), [&](tatum::EdgeId edge) {
+            visitor.do_reset_edge(edge);
+        });
+    }
+
+    size_t num_unconstrained_startpoints_impl() const override { return num_unconstrained_startpoints_; }
+    size_t num_unconstrained_endpoints_impl() const override { return num_unconstrained_endpoints_; }
+
+  private:
+    static size_t& current_num_jobs() {
+        thread_local size_t num_jobs = 1;
+        return num_jobs;
+    }
+
+    //Number of threads worth using for num_items independent items
+    static size_t num_jobs_for(size_t num_items) {
+        return std::max<size_t>(1, std::min(num_jobs(), num_items / MIN_NODES_PER_JOB));
+    }
+
+    //Calls func on every element of range (which must have random access iterators)
+    template<typename Range, typename Func>
+    static void for_each_node(const Range& range, const Func& func) {
+        auto begin = range.begin();
+        size_t num_items = std::distance(range.begin(), range.end());
+
+        vtr::parallel_for_chunks(num_items, num_jobs_for(num_items), [&](size_t /*ichunk*/, size_t ibegin, size_t iend) {
+            for (size_t i = ibegin; i < iend; ++i) {
+                func(begin[i]);
+            }
+        });
+    }
+
+    //Calls is_constrained on every element of range and returns how many returned false
+    template<typename Range, typename Func>
+    static size_t count_unconstrained(const Range& range, const Func& is_constrained) {
+        auto begin = range.begin();
+        size_t num_items = std::distance(range.begin(), range.end());
+        size_t num_jobs = num_jobs_for(num_items);
+
+        std::vector<size_t> chunk_counts(vtr::num_parallel_chunks(num_items, num_jobs), 0);
+        vtr::parallel_for_chunks(num_items, num_jobs, [&](size_t ichunk, size_t ibegin, size_t iend) {
+            for (size_t i = ibegin; i < iend; ++i) {
+                if (!is_constrained(begin[i])) {
+                    ++chunk_counts[ichunk];
+                }
+            }
+        });
+
+        size_t num_unconstrained = 0;
+        for (size_t count : chunk_counts) {
+            num_unconstrained += count;
+        }
+        return num_unconstrained;
+    }
+
+    size_t num_unconstrained_startpoints_ = 0;
+    size_t num_unconstrained_endpoints_ = 0;
+};
+
+#endif
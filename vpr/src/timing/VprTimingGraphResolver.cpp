@@ -189,8 +189,8 @@ std::vector<tatum::DelayComponent> VprTimingGraphResolver::interconnect_delay_br
         if (detail_level() == e_timing_report_detail::DETAILED_ROUTING && !route_ctx.trace.empty()) {
             //check if detailed timing report has been selected and that the vector of tracebacks
             //is not empty.
-            if (route_ctx.trace[src_net].head != nullptr) {
-                //the traceback is not a nullptr, so we find the path of the net from source to sink.
+            if (!route_ctx.trace[src_net].empty()) {
+                //the traceback is not empty, so we find the path of the net from source to sink.
                 //Note that the previously declared interblock_component will not be added to the
                 //vector of net components.
                 get_detailed_interconnect_components(components, src_net, sink_pin);
@@ -6,6 +6,7 @@
 #include "vpr_error.h"
 #include "slack_evaluation.h"
 #include "globals.h"
+#include "VprParallelWalker.h"
 
 #include "tatum/report/graphviz_dot_writer.hpp"
 
@@ -22,11 +23,13 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
     ConcreteSetupTimingInfo(std::shared_ptr<const tatum::TimingGraph> timing_graph_v,
                             std::shared_ptr<const tatum::TimingConstraints> timing_constraints_v,
                             std::shared_ptr<DelayCalc> delay_calc,
-                            std::shared_ptr<tatum::SetupTimingAnalyzer> analyzer_v)
+                            std::shared_ptr<tatum::SetupTimingAnalyzer> analyzer_v,
+                            size_t num_jobs_v = 1)
         : timing_graph_(timing_graph_v)
         , timing_constraints_(timing_constraints_v)
         , delay_calc_(delay_calc)
         , setup_analyzer_(analyzer_v)
+        , num_jobs_(num_jobs_v)
         , slack_crit_(g_vpr_ctx.atom().nlist, g_vpr_ctx.atom().lookup) {
         //pass
     }
@@ -105,6 +108,7 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
         {
             auto start_time = Clock::now();
 
+            VprParallelWalker::ScopedNumJobs scoped_num_jobs(num_jobs_);
             setup_analyzer_->update_setup_timing();
 
             sta_wallclock_time = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -141,6 +145,7 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
     std::shared_ptr<const tatum::TimingConstraints> timing_constraints_;
     std::shared_ptr<DelayCalc> delay_calc_;
     std::shared_ptr<tatum::SetupTimingAnalyzer> setup_analyzer_;
+    size_t num_jobs_; //Number of threads used to update timing
 
     SetupSlackCrit slack_crit_;
 
@@ -171,11 +176,13 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
     ConcreteHoldTimingInfo(std::shared_ptr<const tatum::TimingGraph> timing_graph_v,
                            std::shared_ptr<const tatum::TimingConstraints> timing_constraints_v,
                            std::shared_ptr<DelayCalc> delay_calc,
-                           std::shared_ptr<tatum::HoldTimingAnalyzer> analyzer_v)
+                           std::shared_ptr<tatum::HoldTimingAnalyzer> analyzer_v,
+                           size_t num_jobs_v = 1)
         : timing_graph_(timing_graph_v)
         , timing_constraints_(timing_constraints_v)
         , delay_calc_(delay_calc)
         , hold_analyzer_(analyzer_v)
+        , num_jobs_(num_jobs_v)
         , slack_crit_(g_vpr_ctx.atom().nlist, g_vpr_ctx.atom().lookup) {
         //pass
     }
@@ -218,6 +225,7 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
         {
             auto start_time = Clock::now();
 
+            VprParallelWalker::ScopedNumJobs scoped_num_jobs(num_jobs_);
             hold_analyzer_->update_hold_timing();
 
             sta_wallclock_time = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -251,6 +259,7 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
     std::shared_ptr<const tatum::TimingConstraints> timing_constraints_;
     std::shared_ptr<DelayCalc> delay_calc_;
     std::shared_ptr<tatum::HoldTimingAnalyzer> hold_analyzer_;
+    size_t num_jobs_; //Number of threads used to update timing
 
     HoldSlackCrit slack_crit_;
 
@@ -267,10 +276,12 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
     ConcreteSetupHoldTimingInfo(std::shared_ptr<const tatum::TimingGraph> timing_graph_v,
                                 std::shared_ptr<const tatum::TimingConstraints> timing_constraints_v,
                                 std::shared_ptr<DelayCalc> delay_calc,
-                                std::shared_ptr<tatum::SetupHoldTimingAnalyzer> analyzer_v)
-        : setup_timing_(timing_graph_v, timing_constraints_v, delay_calc, analyzer_v)
-        , hold_timing_(timing_graph_v, timing_constraints_v, delay_calc, analyzer_v)
-        , setup_hold_analyzer_(analyzer_v) {
+                                std::shared_ptr<tatum::SetupHoldTimingAnalyzer> analyzer_v,
+                                size_t num_jobs_v = 1)
+        : setup_timing_(timing_graph_v, timing_constraints_v, delay_calc, analyzer_v, num_jobs_v)
+        , hold_timing_(timing_graph_v, timing_constraints_v, delay_calc, analyzer_v, num_jobs_v)
+        , setup_hold_analyzer_(analyzer_v)
+        , num_jobs_(num_jobs_v) {
         //pass
     }
 
@@ -322,6 +333,7 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
         {
             auto start_time = Clock::now();
 
+            VprParallelWalker::ScopedNumJobs scoped_num_jobs(num_jobs_);
             setup_hold_analyzer_->update_timing();
 
             sta_wallclock_time = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -360,6 +372,7 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
     ConcreteSetupTimingInfo<DelayCalc> setup_timing_;
     ConcreteHoldTimingInfo<DelayCalc> hold_timing_;
     std::shared_ptr<tatum::SetupHoldTimingAnalyzer> setup_hold_analyzer_;
+    size_t num_jobs_; //Number of threads used to update timing
 
     bool warn_unconstrained_ = true;
 
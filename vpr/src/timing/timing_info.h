@@ -6,18 +6,22 @@
 #include "tatum/analyzer_factory.hpp"
 #include "tatum/timing_paths.hpp"
 #include "timing_util.h"
+#include "VprParallelWalker.h"
+
+//Note: the timing infos below update timing with VprParallelWalker, using
+//      up to num_jobs threads (0: all the threads of the host machine)
 
 //Create a SetupTimingInfo for the given delay calculator
 template<class DelayCalc>
-std::unique_ptr<SetupTimingInfo> make_setup_timing_info(std::shared_ptr<DelayCalc> delay_calculator);
+std::unique_ptr<SetupTimingInfo> make_setup_timing_info(std::shared_ptr<DelayCalc> delay_calculator, size_t num_jobs = 1);
 
 //Create a HoldTimingInfo for the given delay calculator
 template<class DelayCalc>
-std::unique_ptr<HoldTimingInfo> make_hold_timing_info(std::shared_ptr<DelayCalc> delay_calculator);
+std::unique_ptr<HoldTimingInfo> make_hold_timing_info(std::shared_ptr<DelayCalc> delay_calculator, size_t num_jobs = 1);
 
 //Create a SetupHoldTimingInfo for the given delay calculator
 template<class DelayCalc>
-std::unique_ptr<SetupHoldTimingInfo> make_setup_hold_timing_info(std::shared_ptr<DelayCalc> delay_calculator);
+std::unique_ptr<SetupHoldTimingInfo> make_setup_hold_timing_info(std::shared_ptr<DelayCalc> delay_calculator, size_t num_jobs = 1);
 
 //Create a timing info object which does no timing analysis, and returns
 //place-holder values. This is useful to running timing driven algorithms
@@ -142,30 +146,30 @@ class SetupHoldTimingInfo : public SetupTimingInfo, public HoldTimingInfo {
 #include "concrete_timing_info.h"
 
 template<class DelayCalc>
-std::unique_ptr<SetupTimingInfo> make_setup_timing_info(std::shared_ptr<DelayCalc> delay_calculator) {
+std::unique_ptr<SetupTimingInfo> make_setup_timing_info(std::shared_ptr<DelayCalc> delay_calculator, size_t num_jobs) {
     auto& timing_ctx = g_vpr_ctx.timing();
 
-    std::shared_ptr<tatum::SetupTimingAnalyzer> analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
+    std::shared_ptr<tatum::SetupTimingAnalyzer> analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, VprParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
 
-    return std::make_unique<ConcreteSetupTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer);
+    return std::make_unique<ConcreteSetupTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer, num_jobs);
 }
 
 template<class DelayCalc>
-std::unique_ptr<HoldTimingInfo> make_hold_timing_info(std::shared_ptr<DelayCalc> delay_calculator) {
+std::unique_ptr<HoldTimingInfo> make_hold_timing_info(std::shared_ptr<DelayCalc> delay_calculator, size_t num_jobs) {
     auto& timing_ctx = g_vpr_ctx.timing();
 
-    std::shared_ptr<tatum::HoldTimingAnalyzer> analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
+    std::shared_ptr<tatum::HoldTimingAnalyzer> analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis, VprParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
 
-    return std::make_unique<ConcreteHoldTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer);
+    return std::make_unique<ConcreteHoldTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer, num_jobs);
 }
 
 template<class DelayCalc>
-std::unique_ptr<SetupHoldTimingInfo> make_setup_hold_timing_info(std::shared_ptr<DelayCalc> delay_calculator) {
+std::unique_ptr<SetupHoldTimingInfo> make_setup_hold_timing_info(std::shared_ptr<DelayCalc> delay_calculator, size_t num_jobs) {
     auto& timing_ctx = g_vpr_ctx.timing();
 
-    std::shared_ptr<tatum::SetupHoldTimingAnalyzer> analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
+    std::shared_ptr<tatum::SetupHoldTimingAnalyzer> analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, VprParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
 
-    return std::make_unique<ConcreteSetupHoldTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer);
+    return std::make_unique<ConcreteSetupHoldTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer, num_jobs);
 }
 
 inline std::unique_ptr<SetupHoldTimingInfo> make_constant_timing_info(const float criticality) {
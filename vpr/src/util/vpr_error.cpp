@@ -21,6 +21,10 @@ void map_error_activation_status(std::string function_name) {
     functions_to_demote.insert(function_name);
 }
 
+bool is_error_demoted(const std::string& function_name) {
+    return functions_to_demote.count(function_name) > 0;
+}
+
 void vpr_throw(enum e_vpr_error type,
                const char* psz_file_name,
                unsigned int line_num,
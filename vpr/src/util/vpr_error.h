@@ -53,6 +53,9 @@ class VprError : public vtr::VtrError {
 // going to be demoted to be VTR_LOG_WARN
 void map_error_activation_status(std::string function_name);
 
+// Returns true if the VPR_ERROR errors of a function are demoted to warnings
+bool is_error_demoted(const std::string& function_name);
+
 //VPR error reporting routines
 //
 //Note that we mark these functions with the C++11 attribute 'noreturn'
@@ -0,0 +1,281 @@
+#include "catch.hpp"
+
+#include "vpr_api.h"
+#include "globals.h"
+#include "rr_graph.h"
+#include "device_snapshot.h"
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+static constexpr const char kArchFile[] = "test_read_arch_metadata.xml";
+static constexpr const char kSnapshotFile[] = "test_device_snapshot.bin";
+static constexpr const char kTileableArchFile[] = "../../openfpga_flow/vpr_arch/k4_N4_tileable_40nm.xml";
+
+// Data of the routing resource graph in the device context, including
+// every array restored from a snapshot
+struct t_rr_graph_data {
+    std::vector<int> node_ints;
+    std::vector<float> node_floats;
+    std::vector<size_t> edges;
+    std::vector<int> switch_ints;
+    std::vector<float> switch_floats;
+    std::vector<std::string> switch_names;
+    std::vector<int> indexed_data_ints;
+    std::vector<float> indexed_data_floats;
+    std::vector<float> rc_data;
+    std::map<RRNodeId, std::vector<size_t>> track_ids;
+    std::vector<std::map<int, int>> switch_fanin_remap;
+};
+
+static t_rr_graph_data get_rr_graph_data() {
+    const auto& device_ctx = g_vpr_ctx.device();
+    const RRGraph& rr_graph = device_ctx.rr_graph;
+
+    t_rr_graph_data data;
+    for (const RRNodeId& node : rr_graph.nodes()) {
+        data.node_ints.push_back(rr_graph.node_type(node));
+        data.node_ints.push_back(rr_graph.node_xlow(node));
+        data.node_ints.push_back(rr_graph.node_ylow(node));
+        data.node_ints.push_back(rr_graph.node_xhigh(node));
+        data.node_ints.push_back(rr_graph.node_yhigh(node));
+        data.node_ints.push_back(rr_graph.node_ptc_num(node));
+        data.node_ints.push_back(rr_graph.node_capacity(node));
+        data.node_ints.push_back(rr_graph.node_cost_index(node));
+        data.node_ints.push_back(rr_graph.node_rc_data_index(node));
+        if (CHANX == rr_graph.node_type(node) || CHANY == rr_graph.node_type(node)) {
+            data.node_ints.push_back(rr_graph.node_direction(node));
+            data.node_ints.push_back(size_t(rr_graph.node_segment(node)));
+        }
+        if (IPIN == rr_graph.node_type(node) || OPIN == rr_graph.node_type(node)) {
+            data.node_ints.push_back(rr_graph.node_side(node));
+        }
+        data.node_ints.push_back(rr_graph.node_in_edges(node).size());
+        data.node_ints.push_back(rr_graph.node_out_edges(node).size());
+        data.node_floats.push_back(rr_graph.node_R(node));
+        data.node_floats.push_back(rr_graph.node_C(node));
+    }
+
+    for (const RREdgeId& edge : rr_graph.edges()) {
+        data.edges.push_back(size_t(rr_graph.edge_src_node(edge)));
+        data.edges.push_back(size_t(rr_graph.edge_sink_node(edge)));
+        data.edges.push_back(size_t(rr_graph.edge_switch(edge)));
+        data.edges.push_back(rr_graph.edge_is_configurable(edge));
+    }
+
+    for (const t_rr_switch_inf& rr_switch : device_ctx.rr_switch_inf) {
+        data.switch_ints.push_back(int(rr_switch.type()));
+        data.switch_ints.push_back(rr_switch.power_buffer_type);
+        data.switch_floats.push_back(rr_switch.R);
+        data.switch_floats.push_back(rr_switch.Cin);
+        data.switch_floats.push_back(rr_switch.Cout);
+        data.switch_floats.push_back(rr_switch.Cinternal);
+        data.switch_floats.push_back(rr_switch.Tdel);
+        data.switch_floats.push_back(rr_switch.mux_trans_size);
+        data.switch_floats.push_back(rr_switch.buf_size);
+        data.switch_floats.push_back(rr_switch.power_buffer_size);
+        data.switch_names.push_back(rr_switch.name ? rr_switch.name : "");
+    }
+
+    for (const t_rr_indexed_data& indexed_data : device_ctx.rr_indexed_data) {
+        data.indexed_data_ints.push_back(indexed_data.ortho_cost_index);
+        data.indexed_data_ints.push_back(indexed_data.seg_index);
+        data.indexed_data_floats.push_back(indexed_data.base_cost);
+        data.indexed_data_floats.push_back(indexed_data.saved_base_cost);
+        data.indexed_data_floats.push_back(indexed_data.inv_length);
+        data.indexed_data_floats.push_back(indexed_data.T_linear);
+        data.indexed_data_floats.push_back(indexed_data.T_quadratic);
+        data.indexed_data_floats.push_back(indexed_data.C_load);
+    }
+
+    for (const t_rr_rc_data& rc_data : device_ctx.rr_rc_data) {
+        data.rc_data.push_back(rc_data.R);
+        data.rc_data.push_back(rc_data.C);
+    }
+
+    data.track_ids = device_ctx.rr_node_track_ids;
+    data.switch_fanin_remap = device_ctx.switch_fanin_remap;
+    return data;
+}
+
+static void check_rr_graph_data(const t_rr_graph_data& loaded_data, const t_rr_graph_data& built_data) {
+    CHECK(loaded_data.node_ints == built_data.node_ints);
+    CHECK(loaded_data.node_floats == built_data.node_floats);
+    CHECK(loaded_data.edges == built_data.edges);
+    CHECK(loaded_data.switch_ints == built_data.switch_ints);
+    CHECK(loaded_data.switch_floats == built_data.switch_floats);
+    CHECK(loaded_data.switch_names == built_data.switch_names);
+    CHECK(loaded_data.indexed_data_ints == built_data.indexed_data_ints);
+    CHECK(loaded_data.indexed_data_floats == built_data.indexed_data_floats);
+    CHECK(loaded_data.rc_data == built_data.rc_data);
+    CHECK(loaded_data.track_ids == built_data.track_ids);
+    CHECK(loaded_data.switch_fanin_remap == built_data.switch_fanin_remap);
+}
+
+// Run the flow up to the creation of the device and return its routing resource graph
+static t_rr_graph_data create_device_rr_graph_data(std::vector<const char*> args) {
+    t_vpr_setup vpr_setup;
+    t_arch arch;
+    t_options options;
+    vpr_init(args.size(), args.data(),
+             &options, &vpr_setup, &arch);
+    vpr_create_device(vpr_setup, arch);
+
+    t_rr_graph_data data = get_rr_graph_data();
+    REQUIRE(!data.node_ints.empty());
+    REQUIRE(!data.edges.empty());
+
+    vpr_free_all(arch, vpr_setup);
+    return data;
+}
+
+static bool read_snapshot(t_vpr_setup& vpr_setup, const t_arch& arch) {
+    const auto& device_ctx = g_vpr_ctx.device();
+    t_graph_type graph_type = (BI_DIRECTIONAL == vpr_setup.RoutingArch.directionality) ? GRAPH_BIDIR : GRAPH_UNIDIR;
+    if (vpr_setup.RoutingArch.tileable) {
+        graph_type = GRAPH_UNIDIR_TILEABLE;
+    }
+
+    return read_device_snapshot(kSnapshotFile,
+                                graph_type,
+                                device_ctx.physical_tile_types,
+                                device_ctx.grid,
+                                device_ctx.chan_width,
+                                &vpr_setup.RoutingArch,
+                                vpr_setup.Segments,
+                                vpr_setup.RouterOpts.base_cost_type,
+                                vpr_setup.RouterOpts.trim_empty_channels,
+                                vpr_setup.RouterOpts.trim_obs_channels || vpr_setup.RoutingArch.through_channel,
+                                false,
+                                vpr_setup.RouterOpts.clock_modeling,
+                                arch.Directs, arch.num_directs);
+}
+
+TEST_CASE("device_snapshot_round_trip", "[vpr]") {
+    t_rr_graph_data built_data = create_device_rr_graph_data({"test_vpr",
+                                                              kArchFile,
+                                                              "wire.eblif",
+                                                              "--route_chan_width",
+                                                              "100",
+                                                              "--write_device_snapshot",
+                                                              kSnapshotFile});
+
+    t_vpr_setup vpr_setup;
+    t_arch arch;
+    t_options options;
+    const char* argv[] = {
+        "test_vpr",
+        kArchFile,
+        "wire.eblif",
+        "--route_chan_width",
+        "100",
+        "--read_device_snapshot",
+        kSnapshotFile,
+    };
+    vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+             &options, &vpr_setup, &arch);
+    vpr_create_device(vpr_setup, arch);
+
+    SECTION("graph loaded by the flow matches the built graph") {
+        check_rr_graph_data(get_rr_graph_data(), built_data);
+    }
+
+    SECTION("snapshot is accepted for the same inputs") {
+        free_rr_graph();
+        REQUIRE(read_snapshot(vpr_setup, arch));
+        check_rr_graph_data(get_rr_graph_data(), built_data);
+    }
+
+    SECTION("snapshot is rejected for different switch blocks") {
+        vpr_setup.RoutingArch.Fs += 3;
+        CHECK_FALSE(read_snapshot(vpr_setup, arch));
+        vpr_setup.RoutingArch.Fs -= 3;
+    }
+
+    SECTION("snapshot is rejected for different transistor resistances") {
+        vpr_setup.RoutingArch.R_minW_nmos *= 2;
+        CHECK_FALSE(read_snapshot(vpr_setup, arch));
+        vpr_setup.RoutingArch.R_minW_nmos /= 2;
+    }
+
+    SECTION("snapshot is rejected for different segments") {
+        REQUIRE(!vpr_setup.Segments.empty());
+        vpr_setup.Segments[0].frequency += 1;
+        CHECK_FALSE(read_snapshot(vpr_setup, arch));
+        vpr_setup.Segments[0].frequency -= 1;
+    }
+
+    vpr_free_all(arch, vpr_setup);
+    std::remove(kSnapshotFile);
+}
+
+TEST_CASE("device_snapshot_round_trip_tileable", "[vpr]") {
+    // The track ids are only built for the tileable routing resource graph
+    t_rr_graph_data built_data = create_device_rr_graph_data({"test_vpr",
+                                                              kTileableArchFile,
+                                                              "wire.eblif",
+                                                              "--route_chan_width",
+                                                              "40",
+                                                              "--write_device_snapshot",
+                                                              kSnapshotFile});
+    REQUIRE(!built_data.track_ids.empty());
+
+    t_rr_graph_data loaded_data = create_device_rr_graph_data({"test_vpr",
+                                                               kTileableArchFile,
+                                                               "wire.eblif",
+                                                               "--route_chan_width",
+                                                               "40",
+                                                               "--read_device_snapshot",
+                                                               kSnapshotFile});
+    check_rr_graph_data(loaded_data, built_data);
+
+    std::remove(kSnapshotFile);
+}
+
+TEST_CASE("device_snapshot_fallback", "[vpr]") {
+    // A snapshot written for another channel width must not be loaded:
+    // the flow has to build the same graph as without any snapshot
+    t_rr_graph_data built_data = create_device_rr_graph_data({"test_vpr",
+                                                              kArchFile,
+                                                              "wire.eblif",
+                                                              "--route_chan_width",
+                                                              "80"});
+
+    create_device_rr_graph_data({"test_vpr",
+                                 kArchFile,
+                                 "wire.eblif",
+                                 "--route_chan_width",
+                                 "100",
+                                 "--write_device_snapshot",
+                                 kSnapshotFile});
+
+    SECTION("snapshot of a different key") {
+        t_rr_graph_data loaded_data = create_device_rr_graph_data({"test_vpr",
+                                                                   kArchFile,
+                                                                   "wire.eblif",
+                                                                   "--route_chan_width",
+                                                                   "80",
+                                                                   "--read_device_snapshot",
+                                                                   kSnapshotFile});
+        check_rr_graph_data(loaded_data, built_data);
+    }
+
+    SECTION("missing snapshot") {
+        std::remove(kSnapshotFile);
+        t_rr_graph_data loaded_data = create_device_rr_graph_data({"test_vpr",
+                                                                   kArchFile,
+                                                                   "wire.eblif",
+                                                                   "--route_chan_width",
+                                                                   "80",
+                                                                   "--read_device_snapshot",
+                                                                   kSnapshotFile});
+        check_rr_graph_data(loaded_data, built_data);
+    }
+
+    std::remove(kSnapshotFile);
+}
+
+} // namespace
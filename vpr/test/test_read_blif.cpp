@@ -0,0 +1,130 @@
+#include "catch.hpp"
+
+#include "read_xml_arch_file.h"
+#include "arch_util.h"
+#include "atom_netlist.h"
+#include "read_blif.h"
+#include "vpr_error.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+static constexpr const char kArchFile[] = "test_read_arch_metadata.xml";
+static constexpr const char kBlifFile[] = "test_read_blif.blif";
+static constexpr const char kEblifFile[] = "test_read_blif.eblif";
+static constexpr const char kFallbackFile[] = "test_read_blif_fallback.blif";
+
+typedef std::map<std::string, std::string> t_string_map;
+
+// Both readers call the netlist construction methods in the same order,
+// so the netlists must have the same components with the same ids
+static void check_same_netlist(const AtomNetlist& fast_netlist, const AtomNetlist& blifparse_netlist) {
+    CHECK(fast_netlist.netlist_name() == blifparse_netlist.netlist_name());
+    CHECK(fast_netlist.netlist_id() == blifparse_netlist.netlist_id());
+
+    REQUIRE(fast_netlist.blocks().size() == blifparse_netlist.blocks().size());
+    for (AtomBlockId blk_id : fast_netlist.blocks()) {
+        CHECK(fast_netlist.block_name(blk_id) == blifparse_netlist.block_name(blk_id));
+        CHECK(fast_netlist.block_model(blk_id) == blifparse_netlist.block_model(blk_id));
+        CHECK(fast_netlist.block_truth_table(blk_id) == blifparse_netlist.block_truth_table(blk_id));
+
+        auto fast_attrs = fast_netlist.block_attrs(blk_id);
+        auto blifparse_attrs = blifparse_netlist.block_attrs(blk_id);
+        CHECK(t_string_map(fast_attrs.begin(), fast_attrs.end())
+              == t_string_map(blifparse_attrs.begin(), blifparse_attrs.end()));
+
+        auto fast_params = fast_netlist.block_params(blk_id);
+        auto blifparse_params = blifparse_netlist.block_params(blk_id);
+        CHECK(t_string_map(fast_params.begin(), fast_params.end())
+              == t_string_map(blifparse_params.begin(), blifparse_params.end()));
+    }
+
+    REQUIRE(fast_netlist.ports().size() == blifparse_netlist.ports().size());
+    for (AtomPortId port_id : fast_netlist.ports()) {
+        CHECK(fast_netlist.port_name(port_id) == blifparse_netlist.port_name(port_id));
+        CHECK(fast_netlist.port_block(port_id) == blifparse_netlist.port_block(port_id));
+        CHECK(fast_netlist.port_model(port_id) == blifparse_netlist.port_model(port_id));
+        CHECK(fast_netlist.port_width(port_id) == blifparse_netlist.port_width(port_id));
+    }
+
+    REQUIRE(fast_netlist.pins().size() == blifparse_netlist.pins().size());
+    for (AtomPinId pin_id : fast_netlist.pins()) {
+        CHECK(fast_netlist.pin_port(pin_id) == blifparse_netlist.pin_port(pin_id));
+        CHECK(fast_netlist.pin_port_bit(pin_id) == blifparse_netlist.pin_port_bit(pin_id));
+        CHECK(fast_netlist.pin_net(pin_id) == blifparse_netlist.pin_net(pin_id));
+        CHECK(fast_netlist.pin_type(pin_id) == blifparse_netlist.pin_type(pin_id));
+        CHECK(fast_netlist.pin_is_constant(pin_id) == blifparse_netlist.pin_is_constant(pin_id));
+    }
+
+    // Nets merged by .conn are removed, but keep their invalid ids until the netlist is compressed
+    REQUIRE(std::vector<AtomNetId>(fast_netlist.nets().begin(), fast_netlist.nets().end())
+            == std::vector<AtomNetId>(blifparse_netlist.nets().begin(), blifparse_netlist.nets().end()));
+    for (AtomNetId net_id : fast_netlist.nets()) {
+        if (!net_id) {
+            continue;
+        }
+        CHECK(fast_netlist.net_name(net_id) == blifparse_netlist.net_name(net_id));
+        auto fast_pins = fast_netlist.net_pins(net_id);
+        auto blifparse_pins = blifparse_netlist.net_pins(net_id);
+        CHECK(std::vector<AtomPinId>(fast_pins.begin(), fast_pins.end())
+              == std::vector<AtomPinId>(blifparse_pins.begin(), blifparse_pins.end()));
+    }
+}
+
+// Line of the error reported while reading a netlist, or 0 if none is reported
+static size_t read_blif_error_line(e_circuit_format circuit_format, const char* blif_file, const t_arch& arch, e_blif_reader blif_reader) {
+    try {
+        read_blif(circuit_format, blif_file, arch.models, arch.model_library, blif_reader);
+    } catch (const VprError& error) {
+        return error.line();
+    }
+    return 0;
+}
+
+TEST_CASE("read_blif_fast_reader", "[vpr]") {
+    t_arch arch;
+    std::vector<t_physical_tile_type> physical_tile_types;
+    std::vector<t_logical_block_type> logical_block_types;
+
+    XmlReadArch(kArchFile, /*timing_enabled=*/false,
+                &arch, physical_tile_types, logical_block_types);
+
+    SECTION("BLIF with continued lines, comments and latches") {
+        AtomNetlist fast_netlist = read_blif(e_circuit_format::BLIF, kBlifFile,
+                                             arch.models, arch.model_library, e_blif_reader::FAST);
+        AtomNetlist blifparse_netlist = read_blif(e_circuit_format::BLIF, kBlifFile,
+                                                  arch.models, arch.model_library, e_blif_reader::BLIFPARSE);
+        CHECK(fast_netlist.netlist_name() == "blif_top");
+        CHECK(fast_netlist.blocks().size() == 22);
+        check_same_netlist(fast_netlist, blifparse_netlist);
+    }
+
+    SECTION("EBLIF with .cname, .attr, .param and .conn") {
+        AtomNetlist fast_netlist = read_blif(e_circuit_format::EBLIF, kEblifFile,
+                                             arch.models, arch.model_library, e_blif_reader::FAST);
+        AtomNetlist blifparse_netlist = read_blif(e_circuit_format::EBLIF, kEblifFile,
+                                                  arch.models, arch.model_library, e_blif_reader::BLIFPARSE);
+        CHECK(fast_netlist.netlist_name() == "eblif_top");
+        CHECK(fast_netlist.find_block("xor_n1") != AtomBlockId::INVALID());
+        check_same_netlist(fast_netlist, blifparse_netlist);
+    }
+
+    SECTION("unsupported file falls back to blifparse") {
+        CHECK_THROWS_AS(read_blif(e_circuit_format::BLIF, kFallbackFile,
+                                  arch.models, arch.model_library, e_blif_reader::FAST),
+                        const VprError&);
+
+        size_t fallback_error_line = read_blif_error_line(e_circuit_format::BLIF, kFallbackFile, arch, e_blif_reader::FAST_WITH_FALLBACK);
+        size_t blifparse_error_line = read_blif_error_line(e_circuit_format::BLIF, kFallbackFile, arch, e_blif_reader::BLIFPARSE);
+        CHECK(fallback_error_line != 0);
+        CHECK(fallback_error_line == blifparse_error_line);
+    }
+
+    free_type_descriptors(logical_block_types);
+    free_type_descriptors(physical_tile_types);
+    free_arch(&arch);
+}
+
+} // namespace
@@ -0,0 +1,252 @@
+#include "catch.hpp"
+
+#include "vpr_api.h"
+#include "globals.h"
+#include "route_common.h"
+#include "route_tree_timing.h"
+#include <deque>
+#include <queue>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace {
+
+static constexpr const char kArchFile[] = "test_read_arch_metadata.xml";
+static constexpr size_t kNumSinks = 4;
+
+// Reference: the traceback as the linked list it used to be
+struct t_linked_trace {
+    RRNodeId index;
+    short iswitch;
+    t_linked_trace* next;
+};
+
+struct t_linked_traceback {
+    std::deque<t_linked_trace> pool;
+    t_linked_trace* head = nullptr;
+    t_linked_trace* tail = nullptr;
+
+    t_linked_trace* alloc(const RRNodeId& index, short iswitch) {
+        pool.push_back({index, iswitch, nullptr});
+        return &pool.back();
+    }
+};
+
+static std::pair<t_linked_trace*, t_linked_trace*> ref_add_trace_non_configurable_recurr(t_linked_traceback& traceback, const RRNodeId& node, std::unordered_set<RRNodeId>& trace_nodes, int depth) {
+    const RRGraph& rr_graph = g_vpr_ctx.device().rr_graph;
+    t_linked_trace* head = nullptr;
+    t_linked_trace* tail = nullptr;
+
+    std::vector<RREdgeId> unvisited_non_configurable_edges;
+    for (auto iedge : rr_graph.node_non_configurable_out_edges(node)) {
+        if (!trace_nodes.count(rr_graph.edge_sink_node(iedge))) {
+            unvisited_non_configurable_edges.push_back(iedge);
+        }
+    }
+
+    if (unvisited_non_configurable_edges.empty()) {
+        if (depth > 0) {
+            head = traceback.alloc(node, -1);
+            tail = head;
+            trace_nodes.insert(node);
+        }
+    } else {
+        for (auto iedge : unvisited_non_configurable_edges) {
+            trace_nodes.insert(node);
+
+            t_linked_trace* subtree_head = nullptr;
+            t_linked_trace* subtree_tail = nullptr;
+            std::tie(subtree_head, subtree_tail) = ref_add_trace_non_configurable_recurr(traceback, rr_graph.edge_sink_node(iedge), trace_nodes, depth + 1);
+
+            if (subtree_head && subtree_tail) {
+                t_linked_trace* intermediate_head = traceback.alloc(node, (short)size_t(rr_graph.edge_switch(iedge)));
+                intermediate_head->next = subtree_head;
+                if (!head) {
+                    head = intermediate_head;
+                } else {
+                    tail->next = intermediate_head;
+                }
+                tail = subtree_tail;
+            }
+        }
+    }
+
+    return {head, tail};
+}
+
+// Adds the branch ending at sink as the linked traceback did, and returns the first new element
+static t_linked_trace* ref_update_traceback(t_linked_traceback& traceback, const RRNodeId& sink, std::unordered_set<RRNodeId>& trace_nodes) {
+    const RRGraph& rr_graph = g_vpr_ctx.device().rr_graph;
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    t_linked_trace* branch_head = traceback.alloc(sink, OPEN);
+    t_linked_trace* branch_tail = branch_head;
+    trace_nodes.insert(sink);
+
+    std::vector<RRNodeId> new_nodes = {sink};
+    RREdgeId iedge = route_ctx.rr_node_route_inf[sink].prev_edge;
+    RRNodeId inode = route_ctx.rr_node_route_inf[sink].prev_node;
+    while (inode != RRNodeId::INVALID()) {
+        t_linked_trace* prev_ptr = traceback.alloc(inode, (short)size_t(rr_graph.edge_switch(iedge)));
+        prev_ptr->next = branch_head;
+        branch_head = prev_ptr;
+
+        if (trace_nodes.count(inode)) {
+            break;
+        }
+        trace_nodes.insert(inode);
+        new_nodes.push_back(inode);
+
+        iedge = route_ctx.rr_node_route_inf[inode].prev_edge;
+        inode = route_ctx.rr_node_route_inf[inode].prev_node;
+    }
+
+    for (const RRNodeId& new_node : new_nodes) {
+        t_linked_trace* subtree_head = nullptr;
+        t_linked_trace* subtree_tail = nullptr;
+        std::tie(subtree_head, subtree_tail) = ref_add_trace_non_configurable_recurr(traceback, new_node, trace_nodes, 0);
+        if (subtree_head && subtree_tail) {
+            branch_tail->next = subtree_head;
+            branch_tail = subtree_tail;
+        }
+    }
+
+    t_linked_trace* first_new = branch_head;
+    if (traceback.tail) {
+        traceback.tail->next = branch_head;
+        first_new = branch_head->next;
+    } else {
+        traceback.head = branch_head;
+    }
+    traceback.tail = branch_tail;
+    return first_new;
+}
+
+typedef std::vector<std::pair<size_t, int>> t_trace_elements;
+
+static t_trace_elements get_trace_elements(const t_linked_traceback& traceback) {
+    t_trace_elements elements;
+    for (const t_linked_trace* tptr = traceback.head; tptr != nullptr; tptr = tptr->next) {
+        elements.emplace_back(size_t(tptr->index), tptr->iswitch);
+    }
+    return elements;
+}
+
+static t_trace_elements get_trace_elements(const t_traceback& traceback) {
+    t_trace_elements elements;
+    for (const t_trace& trace : traceback) {
+        elements.emplace_back(size_t(trace.index), trace.iswitch);
+    }
+    return elements;
+}
+
+static size_t get_trace_position(const t_linked_traceback& traceback, const t_linked_trace* element) {
+    size_t position = 0;
+    for (const t_linked_trace* tptr = traceback.head; tptr != element; tptr = tptr->next) {
+        ++position;
+    }
+    return position;
+}
+
+// Records a breadth-first tree from source in the previous nodes/edges of the router,
+// as a routing from source to each of the returned sinks would, and returns the sinks
+static std::vector<RRNodeId> expand_routing_tree(const RRNodeId& source) {
+    const RRGraph& rr_graph = g_vpr_ctx.device().rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    std::vector<RRNodeId> sinks;
+    std::unordered_set<RRNodeId> visited = {source};
+    std::queue<RRNodeId> frontier;
+    frontier.push(source);
+    while (!frontier.empty() && sinks.size() < kNumSinks) {
+        RRNodeId node = frontier.front();
+        frontier.pop();
+        if (SINK == rr_graph.node_type(node)) {
+            sinks.push_back(node);
+            continue;
+        }
+        for (const RREdgeId& edge : rr_graph.node_out_edges(node)) {
+            RRNodeId to_node = rr_graph.edge_sink_node(edge);
+            if (visited.count(to_node)) {
+                continue;
+            }
+            visited.insert(to_node);
+            route_ctx.rr_node_route_inf[to_node].prev_node = node;
+            route_ctx.rr_node_route_inf[to_node].prev_edge = edge;
+            frontier.push(to_node);
+        }
+    }
+    return sinks;
+}
+
+TEST_CASE("route_traceback_matches_linked_list", "[vpr]") {
+    t_vpr_setup vpr_setup;
+    t_arch arch;
+    t_options options;
+    const char* argv[] = {
+        "test_vpr",
+        kArchFile,
+        "wire.eblif",
+        "--route_chan_width",
+        "100",
+    };
+    vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+             &options, &vpr_setup, &arch);
+    vpr_create_device(vpr_setup, arch);
+
+    const RRGraph& rr_graph = g_vpr_ctx.device().rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    alloc_and_load_rr_node_route_structs();
+    alloc_route_tree_timing_structs();
+    ClusterNetId net_id(0);
+    route_ctx.trace.resize(1);
+    route_ctx.trace_nodes.resize(1);
+
+    // Route from the first source reaching enough sinks
+    std::vector<RRNodeId> sinks;
+    for (const RRNodeId& node : rr_graph.nodes()) {
+        if (SOURCE != rr_graph.node_type(node)) {
+            continue;
+        }
+        reset_rr_node_route_structs();
+        sinks = expand_routing_tree(node);
+        if (kNumSinks == sinks.size()) {
+            break;
+        }
+    }
+    REQUIRE(kNumSinks == sinks.size());
+
+    t_linked_traceback ref_traceback;
+    std::unordered_set<RRNodeId> ref_trace_nodes;
+    for (const RRNodeId& sink : sinks) {
+        t_heap heap;
+        heap.index = sink;
+        size_t first_new_trace = update_traceback(&heap, net_id);
+        t_linked_trace* ref_first_new_trace = ref_update_traceback(ref_traceback, sink, ref_trace_nodes);
+
+        CHECK(get_trace_elements(route_ctx.trace[net_id]) == get_trace_elements(ref_traceback));
+        CHECK(first_new_trace == get_trace_position(ref_traceback, ref_first_new_trace));
+        CHECK(route_ctx.trace_nodes[net_id] == ref_trace_nodes);
+    }
+    CHECK(validate_traceback(route_ctx.trace[net_id]));
+
+    // The route tree built from the traceback has the same connections
+    t_rt_node* rt_root = traceback_to_route_tree(route_ctx.trace[net_id]);
+    REQUIRE(rt_root != nullptr);
+    CHECK(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id], rt_root));
+    free_route_tree(rt_root);
+
+    free_traceback(net_id);
+    CHECK(route_ctx.trace[net_id].empty());
+    CHECK(route_ctx.trace_nodes[net_id].empty());
+
+    free_route_tree_timing_structs();
+    route_ctx.trace.clear();
+    route_ctx.trace_nodes.clear();
+    vpr_free_all(arch, vpr_setup);
+}
+
+} // namespace